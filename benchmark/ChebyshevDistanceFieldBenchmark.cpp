@@ -0,0 +1,93 @@
+/**
+* \file ChebyshevDistanceFieldBenchmark.cpp
+*
+* \brief Measures the time of recomputing the distance field for empty-space skipping.
+*
+* Usage: ChebyshevDistanceFieldBenchmark [gridSize] [numIterations]
+*
+* A synthetic occupancy grid of gridSize^3 bricks, 128^3 by default, holds a sphere of
+* sparse occupied bricks, the typical shape after a transfer function has hidden the air
+* around an object. The distance field is computed numIterations times and the median time
+* is reported against the budget for recomputing it after a transfer function edit.
+*/
+
+#include <volumedata/ComputeChebyshevDistanceField.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace Constants
+{
+    constexpr uint32_t defaultGridSize = 128;
+    constexpr unsigned int defaultNumIterations = 11;
+    constexpr double budgetInMilliseconds = 20.0;
+}
+
+namespace
+{
+    std::vector<uint8_t> MakeSyntheticOccupancyGrid(uint32_t size)
+    {
+        std::mt19937 randomEngine{42};
+        std::bernoulli_distribution isOccupied{0.2};
+        const float center = 0.5f * static_cast<float>(size);
+        const float radius = 0.35f * static_cast<float>(size);
+
+        std::vector<uint8_t> occupancy(static_cast<size_t>(size) * size * size, 0);
+        for (uint32_t z = 0; z < size; ++z)
+        {
+            for (uint32_t y = 0; y < size; ++y)
+            {
+                for (uint32_t x = 0; x < size; ++x)
+                {
+                    const float dx = static_cast<float>(x) - center;
+                    const float dy = static_cast<float>(y) - center;
+                    const float dz = static_cast<float>(z) - center;
+                    if (dx * dx + dy * dy + dz * dz < radius * radius && isOccupied(randomEngine))
+                    {
+                        occupancy[(static_cast<size_t>(z) * size + y) * size + x] = 255;
+                    }
+                }
+            }
+        }
+        return occupancy;
+    }
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+    const uint32_t gridSize = (argc >= 2) ? static_cast<uint32_t>(std::max(1, std::atoi(argv[1]))) : Constants::defaultGridSize;
+    const unsigned int numIterations = (argc >= 3) ? static_cast<unsigned int>(std::max(1, std::atoi(argv[2]))) : Constants::defaultNumIterations;
+
+    const auto occupancy = MakeSyntheticOccupancyGrid(gridSize);
+
+    std::vector<double> times;
+    uint64_t distanceSum = 0;
+    for (auto i = 0u; i < numIterations; ++i)
+    {
+        const auto begin = std::chrono::steady_clock::now();
+        const auto distances = VolumeData::ComputeChebyshevDistanceField(occupancy, gridSize, gridSize, gridSize);
+        const auto end = std::chrono::steady_clock::now();
+        times.push_back(std::chrono::duration<double, std::milli>(end - begin).count());
+
+        distanceSum = 0;
+        for (const uint8_t distance : distances)
+        {
+            distanceSum += distance;
+        }
+    }
+
+    std::ranges::sort(times);
+    const double medianTime = times[times.size() / 2];
+
+    std::cout << "Median of " << numIterations << " distance fields of " << gridSize << "^3 bricks: "
+              << std::fixed << std::setprecision(2) << medianTime << " ms (budget " << Constants::budgetInMilliseconds << " ms, mean distance "
+              << static_cast<double>(distanceSum) / static_cast<double>(occupancy.size()) << ")" << std::endl;
+
+    return EXIT_SUCCESS;
+}
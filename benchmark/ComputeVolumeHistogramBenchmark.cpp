@@ -0,0 +1,125 @@
+/**
+* \file ComputeVolumeHistogramBenchmark.cpp
+*
+* \brief Measures the throughput of the volume histogram kernel.
+*
+* Usage: ComputeVolumeHistogramBenchmark [input.raw] [numIterations]
+*
+* Without an input, a synthetic 512^3 16-bit volume of noise is generated. The histogram
+* is computed numIterations times with ComputeVolumeHistogram and with a plain sequential
+* loop for reference, and the median time and throughput of both are reported.
+*/
+
+#include <volumedata/ComputeVolumeHistogram.h>
+#include <volumedata/LoadVolumeRaw.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Constants
+{
+    constexpr uint32_t syntheticVolumeSize = 512;
+    constexpr uint32_t numBins = 256;
+    constexpr unsigned int defaultNumIterations = 5;
+}
+
+namespace
+{
+    VolumeData::VolumeData MakeSyntheticVolume()
+    {
+        constexpr auto size = Constants::syntheticVolumeSize;
+        auto volumeData = VolumeData::VolumeData{VolumeData::VolumeMetadata{size, size, size, 1, 16}};
+
+        std::mt19937 randomEngine{42};
+        std::uniform_int_distribution<uint32_t> noise{0, 4095};
+        auto& data = volumeData.GetData();
+        auto* values = reinterpret_cast<uint16_t*>(data.data());
+        for (size_t i = 0; i < data.size() / sizeof(uint16_t); ++i)
+        {
+            values[i] = static_cast<uint16_t>(noise(randomEngine));
+        }
+
+        return volumeData;
+    }
+
+    /// Single-threaded reference of the first component, without sub-histograms
+    std::vector<uint64_t> ComputeSequentialHistogram(const VolumeData::VolumeData& volumeData)
+    {
+        const auto& metadata = volumeData.GetMetadata();
+        const uint32_t bitsPerComponent = metadata.GetBitsPerComponent();
+        const uint32_t components = metadata.GetComponents();
+        const size_t numVoxels = volumeData.GetSizeInBytes() / (bitsPerComponent / 8);
+
+        std::vector<uint64_t> counts(Constants::numBins, 0);
+        for (size_t i = 0; i < numVoxels; i += components)
+        {
+            const uint32_t value = (bitsPerComponent == 16) ? reinterpret_cast<const uint16_t*>(volumeData.GetDataPtr())[i] : volumeData.GetDataPtr()[i];
+            ++counts[(value * Constants::numBins) >> bitsPerComponent];
+        }
+        return counts;
+    }
+
+    double MeasureTime(const std::function<void()>& compute, unsigned int numIterations)
+    {
+        std::vector<double> times;
+        for (auto i = 0u; i < numIterations; ++i)
+        {
+            const auto begin = std::chrono::steady_clock::now();
+            compute();
+            const auto end = std::chrono::steady_clock::now();
+            times.push_back(std::chrono::duration<double, std::milli>(end - begin).count());
+        }
+
+        std::ranges::sort(times);
+        return times[times.size() / 2];
+    }
+
+    void Report(const std::string& name, size_t volumeSizeInBytes, double timeInMilliseconds)
+    {
+        const double volumeSizeInMiB = static_cast<double>(volumeSizeInBytes) / (1024.0 * 1024.0);
+
+        std::cout << std::left << std::setw(20) << name << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(10) << timeInMilliseconds << " ms"
+                  << std::setw(10) << volumeSizeInMiB / (timeInMilliseconds / 1000.0) << " MiB/s" << std::endl;
+    }
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+    const unsigned int numIterations = (argc >= 3) ? static_cast<unsigned int>(std::max(1, std::atoi(argv[2]))) : Constants::defaultNumIterations;
+
+    VolumeData::VolumeData volumeData;
+    if (argc >= 2)
+    {
+        auto volumeLoadingResult = VolumeData::LoadVolumeRaw(argv[1]);
+        if (!volumeLoadingResult)
+        {
+            std::cerr << "Failed to load volume from " << argv[1] << std::endl;
+            return EXIT_FAILURE;
+        }
+        volumeData = std::move(volumeLoadingResult.value());
+    }
+    else
+    {
+        volumeData = MakeSyntheticVolume();
+    }
+
+    const size_t volumeSizeInBytes = volumeData.GetSizeInBytes();
+    const double volumeSizeInMiB = static_cast<double>(volumeSizeInBytes) / (1024.0 * 1024.0);
+    std::cout << "Median of " << numIterations << " histograms of " << std::fixed << std::setprecision(1) << volumeSizeInMiB << " MiB" << std::endl;
+
+    Report("sequential", volumeSizeInBytes, MeasureTime([&]() { ComputeSequentialHistogram(volumeData); }, numIterations));
+    Report("parallel", volumeSizeInBytes, MeasureTime([&]() { VolumeData::ComputeVolumeHistogram(volumeData, Constants::numBins); }, numIterations));
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,199 @@
+/**
+* \file LoadVolumeBenchmark.cpp
+*
+* \brief Compares load times of raw, bricked and compressed bricked volumes.
+*
+* Usage: LoadVolumeBenchmark [input.raw] [numIterations]
+*
+* Without an input, a synthetic 16-bit CT-like volume is generated: a noisy sphere of
+* tissue surrounded by air. The volume is written as .raw/.ini, as an uncompressed bricked
+* file and as a compressed bricked file into the temp directory, and each file is loaded
+* numIterations times. The median load time, the file size and the effective throughput
+* are reported per format.
+*
+* All files the benchmark writes are removed again at the end; an input volume passed on
+* the command line is left untouched.
+*
+* The files are read back right after writing them, so the measurement reflects a warm
+* operating system file cache unless the cache is dropped in between. For a cold-cache
+* comparison, run the benchmark once to create the files and drop the cache before timing.
+*/
+
+#include <volumedata/BrickCompression.h>
+#include <volumedata/LoadVolume.h>
+#include <volumedata/LoadVolumeRaw.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+#include <volumedata/WriteBrickedVolume.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace Constants
+{
+    constexpr uint32_t syntheticVolumeSize = 256;
+    constexpr unsigned int defaultNumIterations = 5;
+}
+
+namespace
+{
+    VolumeData::VolumeData MakeSyntheticVolume()
+    {
+        constexpr auto size = Constants::syntheticVolumeSize;
+        auto volumeData = VolumeData::VolumeData{VolumeData::VolumeMetadata{size, size, size, 1, 16}};
+
+        std::mt19937 randomEngine{42};
+        std::normal_distribution<float> noise{0.0f, 40.0f};
+        const float radius = 0.4f * size;
+        const float center = 0.5f * size;
+
+        for (auto z = 0u; z < size; ++z)
+        {
+            for (auto y = 0u; y < size; ++y)
+            {
+                for (auto x = 0u; x < size; ++x)
+                {
+                    const float dx = x - center;
+                    const float dy = y - center;
+                    const float dz = z - center;
+                    const bool isTissue = dx * dx + dy * dy + dz * dz < radius * radius;
+                    const float value = isTissue ? 1000.0f + 0.5f * z + noise(randomEngine) : 0.0f;
+                    volumeData.SetVoxel16(x, y, z, static_cast<uint16_t>(std::clamp(value, 0.0f, 65535.0f)));
+                }
+            }
+        }
+
+        return volumeData;
+    }
+
+    void WriteRawVolume(const VolumeData::VolumeData& volumeData, const std::filesystem::path& rawFilePath)
+    {
+        const auto& metadata = volumeData.GetMetadata();
+        const auto data = volumeData.GetData();
+        std::ofstream rawFile(rawFilePath, std::ios::binary);
+        rawFile.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+
+        auto iniFilePath = rawFilePath;
+        iniFilePath.replace_extension(".ini");
+        std::ofstream iniFile(iniFilePath);
+        iniFile << "[Volume]\n"
+                << "Width=" << metadata.GetWidth() << "\n"
+                << "Height=" << metadata.GetHeight() << "\n"
+                << "Depth=" << metadata.GetDepth() << "\n"
+                << "Components=" << metadata.GetComponents() << "\n"
+                << "BitsPerComponent=" << metadata.GetBitsPerComponent() << "\n";
+    }
+
+    /// Median load time in milliseconds, or a negative value if loading failed
+    double MeasureLoadTime(const std::function<bool()>& load, unsigned int numIterations)
+    {
+        std::vector<double> loadTimes;
+        for (auto i = 0u; i < numIterations; ++i)
+        {
+            const auto begin = std::chrono::steady_clock::now();
+            if (!load())
+            {
+                return -1.0;
+            }
+            const auto end = std::chrono::steady_clock::now();
+            loadTimes.push_back(std::chrono::duration<double, std::milli>(end - begin).count());
+        }
+
+        std::ranges::sort(loadTimes);
+        return loadTimes[loadTimes.size() / 2];
+    }
+
+    /// Prints the file size, median load time and throughput of a format, or a failure line if it could not be loaded
+    bool Report(const std::string& name, const std::filesystem::path& filePath, size_t volumeSizeInBytes, double loadTimeInMilliseconds)
+    {
+        if (loadTimeInMilliseconds < 0.0)
+        {
+            std::cout << std::left << std::setw(20) << name << "failed to load " << filePath << std::endl;
+            return false;
+        }
+
+        const double fileSizeInMiB = static_cast<double>(std::filesystem::file_size(filePath)) / (1024.0 * 1024.0);
+        const double volumeSizeInMiB = static_cast<double>(volumeSizeInBytes) / (1024.0 * 1024.0);
+
+        std::cout << std::left << std::setw(20) << name << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(10) << fileSizeInMiB << " MiB"
+                  << std::setw(10) << loadTimeInMilliseconds << " ms"
+                  << std::setw(10) << volumeSizeInMiB / (loadTimeInMilliseconds / 1000.0) << " MiB/s" << std::endl;
+        return true;
+    }
+
+    /// Removes the given files, ignoring files that do not exist
+    void RemoveFiles(const std::vector<std::filesystem::path>& filePaths)
+    {
+        for (const auto& filePath : filePaths)
+        {
+            std::error_code errorCode;
+            std::filesystem::remove(filePath, errorCode);
+        }
+    }
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+    const auto tempDirectory = std::filesystem::temp_directory_path();
+    const unsigned int numIterations = (argc >= 3) ? static_cast<unsigned int>(std::max(1, std::atoi(argv[2]))) : Constants::defaultNumIterations;
+
+    std::filesystem::path rawFilePath = tempDirectory / "LoadVolumeBenchmark.raw";
+    const auto bricksFilePath = tempDirectory / "LoadVolumeBenchmarkUncompressed.bvol";
+    const auto compressedBricksFilePath = tempDirectory / "LoadVolumeBenchmarkCompressed.bvol";
+
+    // The input volume is only removed if the benchmark generated it
+    std::vector<std::filesystem::path> createdFilePaths{bricksFilePath, compressedBricksFilePath};
+    if (argc >= 2)
+    {
+        rawFilePath = argv[1];
+    }
+    else
+    {
+        WriteRawVolume(MakeSyntheticVolume(), rawFilePath);
+        createdFilePaths.push_back(rawFilePath);
+        createdFilePaths.push_back(std::filesystem::path{rawFilePath}.replace_extension(".ini"));
+    }
+
+    const auto volumeLoadingResult = VolumeData::LoadVolumeRaw(rawFilePath);
+    if (!volumeLoadingResult)
+    {
+        std::cerr << "Failed to load volume from " << rawFilePath << std::endl;
+        RemoveFiles(createdFilePaths);
+        return EXIT_FAILURE;
+    }
+    const auto& volumeData = volumeLoadingResult.value();
+    const size_t volumeSizeInBytes = volumeData.GetSizeInBytes();
+
+    if (!VolumeData::WriteBrickedVolume(volumeData, bricksFilePath, 64, VolumeData::BrickCompression::None) ||
+        !VolumeData::WriteBrickedVolume(volumeData, compressedBricksFilePath, 64, VolumeData::BrickCompression::DeltaRle))
+    {
+        std::cerr << "Failed to write bricked volumes to " << tempDirectory << std::endl;
+        RemoveFiles(createdFilePaths);
+        return EXIT_FAILURE;
+    }
+
+    const auto LoadWith = [](const std::filesystem::path& filePath)
+    {
+        return [filePath]() { return VolumeData::LoadVolume(filePath).has_value(); };
+    };
+
+    std::cout << "Median of " << numIterations << " loads of " << rawFilePath << std::endl;
+    bool succeeded = Report("raw", rawFilePath, volumeSizeInBytes, MeasureLoadTime(LoadWith(rawFilePath), numIterations));
+    succeeded = Report("bricked", bricksFilePath, volumeSizeInBytes, MeasureLoadTime(LoadWith(bricksFilePath), numIterations)) && succeeded;
+    succeeded = Report("bricked delta-rle", compressedBricksFilePath, volumeSizeInBytes, MeasureLoadTime(LoadWith(compressedBricksFilePath), numIterations)) && succeeded;
+
+    RemoveFiles(createdFilePaths);
+    return succeeded ? EXIT_SUCCESS : EXIT_FAILURE;
+}
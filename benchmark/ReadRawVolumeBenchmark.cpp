@@ -0,0 +1,226 @@
+/**
+* \file ReadRawVolumeBenchmark.cpp
+*
+* \brief Compares the read throughput of the raw volume loaders on large files.
+*
+* Usage: ReadRawVolumeBenchmark [input.raw] [numIterations]
+*
+* Without an input, a synthetic 1024^3 16-bit volume of noise (2 GiB) is written into the
+* temp directory. The file is then loaded numIterations times with a single buffered
+* std::ifstream::read, the loader used before ReadFileInParallel, with
+* VolumeStorageMode::Owning and with VolumeStorageMode::OwningUncached, and the median
+* load time and throughput are reported.
+*
+* On Linux, each loader is first measured with a cold file cache, where the file is evicted
+* from the cache with posix_fadvise() before every load, which reflects the storage
+* bandwidth. All loaders are also measured with a warm file cache, where the file has just
+* been read, which reflects the cost of copying out of the cache.
+* All loaders must return the same voxels, which is checked via their content hashes.
+*/
+
+#include <volumedata/ComputeVolumeContentHash.h>
+#include <volumedata/LoadVolumeRaw.h>
+#include <volumedata/LoadVolumeMetadata.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+#include <volumedata/VolumeStorageMode.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace Constants
+{
+    constexpr uint32_t syntheticVolumeSize = 1024;
+    constexpr unsigned int defaultNumIterations = 3;
+}
+
+namespace
+{
+    /// Writes the synthetic volume slice by slice, so that it never has to be held in memory as a whole
+    void WriteSyntheticVolume(const std::filesystem::path& rawFilePath)
+    {
+        constexpr auto size = Constants::syntheticVolumeSize;
+
+        std::mt19937 randomEngine{42};
+        std::uniform_int_distribution<uint32_t> noise{0, 4095};
+        std::vector<uint16_t> slice(static_cast<size_t>(size) * size);
+
+        std::ofstream rawFile(rawFilePath, std::ios::binary);
+        for (auto z = 0u; z < size; ++z)
+        {
+            std::ranges::generate(slice, [&]() { return static_cast<uint16_t>(noise(randomEngine)); });
+            rawFile.write(reinterpret_cast<const char*>(slice.data()), static_cast<std::streamsize>(slice.size() * sizeof(uint16_t)));
+        }
+
+        auto iniFilePath = rawFilePath;
+        iniFilePath.replace_extension(".ini");
+        std::ofstream iniFile(iniFilePath);
+        iniFile << "[Volume]\n"
+                << "Width=" << size << "\n"
+                << "Height=" << size << "\n"
+                << "Depth=" << size << "\n"
+                << "Components=1\n"
+                << "BitsPerComponent=16\n";
+    }
+
+    /// Single buffered read of the whole file, as the owning loader did before reading in parallel
+    std::optional<VolumeData::VolumeData> LoadWithIfstream(const std::filesystem::path& rawFilePath, const VolumeData::VolumeMetadata& metadata)
+    {
+        auto volumeData = VolumeData::VolumeData{metadata};
+        std::ifstream file(rawFilePath, std::ios::binary);
+        file.read(reinterpret_cast<char*>(volumeData.GetDataPtr()), static_cast<std::streamsize>(volumeData.GetSizeInBytes()));
+        return file.good() ? std::optional{std::move(volumeData)} : std::nullopt;
+    }
+
+    /// Drops the file from the operating system file cache, returns false where this is not supported
+    bool EvictFromFileCache(const std::filesystem::path& filePath)
+    {
+#if defined(__linux__) && defined(POSIX_FADV_DONTNEED)
+        const int fileDescriptor = open(filePath.c_str(), O_RDONLY);
+        if (fileDescriptor < 0)
+        {
+            return false;
+        }
+        const bool isEvicted = posix_fadvise(fileDescriptor, 0, 0, POSIX_FADV_DONTNEED) == 0;
+        close(fileDescriptor);
+        return isEvicted;
+#else
+        static_cast<void>(filePath);
+        return false;
+#endif
+    }
+
+    struct Measurement
+    {
+        double timeInMilliseconds = -1.0; /**< Median load time, negative if loading failed. */
+        uint64_t contentHash = 0; /**< Content hash of the last loaded volume. */
+    };
+
+    Measurement MeasureLoadTime(const std::function<std::optional<VolumeData::VolumeData>()>& load, const std::function<void()>& prepare, unsigned int numIterations)
+    {
+        std::vector<double> loadTimes;
+        Measurement measurement;
+        for (auto i = 0u; i < numIterations; ++i)
+        {
+            prepare();
+            const auto begin = std::chrono::steady_clock::now();
+            const auto volumeData = load();
+            const auto end = std::chrono::steady_clock::now();
+            if (!volumeData)
+            {
+                return measurement;
+            }
+
+            loadTimes.push_back(std::chrono::duration<double, std::milli>(end - begin).count());
+            measurement.contentHash = VolumeData::ComputeVolumeContentHash(volumeData.value());
+        }
+
+        std::ranges::sort(loadTimes);
+        measurement.timeInMilliseconds = loadTimes[loadTimes.size() / 2];
+        return measurement;
+    }
+
+    void Report(const std::string& name, size_t sizeInBytes, double timeInMilliseconds)
+    {
+        const double sizeInMiB = static_cast<double>(sizeInBytes) / (1024.0 * 1024.0);
+
+        std::cout << std::left << std::setw(28) << name << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(10) << timeInMilliseconds << " ms"
+                  << std::setw(10) << sizeInMiB / (timeInMilliseconds / 1000.0) << " MiB/s" << std::endl;
+    }
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+    const unsigned int numIterations = (argc >= 3) ? static_cast<unsigned int>(std::max(1, std::atoi(argv[2]))) : Constants::defaultNumIterations;
+
+    std::filesystem::path rawFilePath = std::filesystem::temp_directory_path() / "ReadRawVolumeBenchmark.raw";
+    if (argc >= 2)
+    {
+        rawFilePath = argv[1];
+    }
+    else if (!std::filesystem::exists(rawFilePath))
+    {
+        WriteSyntheticVolume(rawFilePath);
+    }
+
+    auto iniFilePath = rawFilePath;
+    iniFilePath.replace_extension(".ini");
+    const auto metadataResult = VolumeData::LoadVolumeMetadata(iniFilePath);
+    if (!metadataResult)
+    {
+        std::cerr << "Failed to load metadata from " << iniFilePath << std::endl;
+        return EXIT_FAILURE;
+    }
+    const auto& metadata = metadataResult.value();
+
+    const auto LoadWithStorageMode = [&](VolumeData::VolumeStorageMode storageMode)
+    {
+        return [&, storageMode]() -> std::optional<VolumeData::VolumeData>
+        {
+            auto volumeLoadingResult = VolumeData::LoadVolumeRaw(rawFilePath, metadata, storageMode);
+            return volumeLoadingResult ? std::optional{std::move(volumeLoadingResult).value()} : std::nullopt;
+        };
+    };
+
+    const std::vector<std::pair<std::string, std::function<std::optional<VolumeData::VolumeData>()>>> loaders = {
+        {"ifstream", [&]() { return LoadWithIfstream(rawFilePath, metadata); }},
+        {"parallel", LoadWithStorageMode(VolumeData::VolumeStorageMode::Owning)},
+        {"parallel uncached", LoadWithStorageMode(VolumeData::VolumeStorageMode::OwningUncached)}
+    };
+
+    const bool canEvict = EvictFromFileCache(rawFilePath);
+    const auto KeepCache = []() {};
+    const auto DropCache = [&]() { EvictFromFileCache(rawFilePath); };
+
+    std::cout << "Median of " << numIterations << " loads of " << rawFilePath << " (" << metadata.GetTotalSizeInBytes() / (1024 * 1024) << " MiB)" << std::endl;
+
+    std::optional<uint64_t> referenceHash;
+    bool isConsistent = true;
+    for (const auto& [name, load] : loaders)
+    {
+        // The cold loads leave the file in the cache for the warm loads
+        for (const bool isCold : {true, false})
+        {
+            if (isCold && !canEvict)
+            {
+                continue;
+            }
+
+            const auto measurement = MeasureLoadTime(load, isCold ? std::function<void()>{DropCache} : std::function<void()>{KeepCache}, numIterations);
+            if (measurement.timeInMilliseconds < 0.0)
+            {
+                std::cerr << "Loading with " << name << " failed" << std::endl;
+                return EXIT_FAILURE;
+            }
+
+            Report(name + (isCold ? " (cold)" : " (warm)"), metadata.GetTotalSizeInBytes(), measurement.timeInMilliseconds);
+            isConsistent = isConsistent && referenceHash.value_or(measurement.contentHash) == measurement.contentHash;
+            referenceHash = measurement.contentHash;
+        }
+    }
+
+    if (!isConsistent)
+    {
+        std::cerr << "Loaded voxels of the loaders differ" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,228 @@
+/**
+* \file VolumeViewBenchmark.cpp
+*
+* \brief Compares voxel access through the checked VolumeData accessors and through VolumeView.
+*
+* Usage: VolumeViewBenchmark [numIterations]
+*
+* A synthetic 256^3 16-bit volume of noise is processed by two single-threaded kernels:
+* a sum over all voxels and a sum of central-difference gradient magnitudes, the access
+* pattern of gradient and filter computations. Each kernel is run numIterations times with
+* VolumeData::GetVoxel16(), with VolumeView::At() and with loops over VolumeView rows, and
+* the median time and voxel throughput are reported. The results of all variants are
+* compared, so that the compiler cannot drop any of them.
+*/
+
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+#include <volumedata/VolumeView.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace Constants
+{
+    constexpr uint32_t syntheticVolumeSize = 256;
+    constexpr unsigned int defaultNumIterations = 5;
+}
+
+namespace
+{
+    using View = VolumeData::VolumeView<const uint16_t>;
+
+    VolumeData::VolumeData MakeSyntheticVolume()
+    {
+        constexpr auto size = Constants::syntheticVolumeSize;
+        auto volumeData = VolumeData::VolumeData{VolumeData::VolumeMetadata{size, size, size, 1, 16}};
+
+        std::mt19937 randomEngine{42};
+        std::uniform_int_distribution<uint32_t> noise{0, 4095};
+        auto& data = volumeData.GetData();
+        auto* values = reinterpret_cast<uint16_t*>(data.data());
+        for (size_t i = 0; i < data.size() / sizeof(uint16_t); ++i)
+        {
+            values[i] = static_cast<uint16_t>(noise(randomEngine));
+        }
+
+        return volumeData;
+    }
+
+    uint64_t SumChecked(const VolumeData::VolumeData& volumeData)
+    {
+        const auto& metadata = volumeData.GetMetadata();
+        uint64_t sum = 0;
+        for (uint32_t z = 0; z < metadata.GetDepth(); ++z)
+        {
+            for (uint32_t y = 0; y < metadata.GetHeight(); ++y)
+            {
+                for (uint32_t x = 0; x < metadata.GetWidth(); ++x)
+                {
+                    sum += volumeData.GetVoxel16(x, y, z);
+                }
+            }
+        }
+        return sum;
+    }
+
+    uint64_t SumAt(const View& view)
+    {
+        uint64_t sum = 0;
+        for (uint32_t z = 0; z < view.GetDepth(); ++z)
+        {
+            for (uint32_t y = 0; y < view.GetHeight(); ++y)
+            {
+                for (uint32_t x = 0; x < view.GetWidth(); ++x)
+                {
+                    sum += view.At(x, y, z);
+                }
+            }
+        }
+        return sum;
+    }
+
+    uint64_t SumRows(const View& view)
+    {
+        uint64_t sum = 0;
+        for (const auto row : view.GetRows())
+        {
+            uint32_t rowSum = 0;
+            for (const uint16_t value : row)
+            {
+                rowSum += value;
+            }
+            sum += rowSum;
+        }
+        return sum;
+    }
+
+    /// Sum of L1 central-difference gradient magnitudes over the interior voxels
+    uint64_t GradientChecked(const VolumeData::VolumeData& volumeData)
+    {
+        const auto& metadata = volumeData.GetMetadata();
+        uint64_t sum = 0;
+        for (uint32_t z = 1; z + 1 < metadata.GetDepth(); ++z)
+        {
+            for (uint32_t y = 1; y + 1 < metadata.GetHeight(); ++y)
+            {
+                for (uint32_t x = 1; x + 1 < metadata.GetWidth(); ++x)
+                {
+                    const int32_t gradientX = volumeData.GetVoxel16(x + 1, y, z) - volumeData.GetVoxel16(x - 1, y, z);
+                    const int32_t gradientY = volumeData.GetVoxel16(x, y + 1, z) - volumeData.GetVoxel16(x, y - 1, z);
+                    const int32_t gradientZ = volumeData.GetVoxel16(x, y, z + 1) - volumeData.GetVoxel16(x, y, z - 1);
+                    sum += std::abs(gradientX) + std::abs(gradientY) + std::abs(gradientZ);
+                }
+            }
+        }
+        return sum;
+    }
+
+    uint64_t GradientAt(const View& view)
+    {
+        uint64_t sum = 0;
+        for (uint32_t z = 1; z + 1 < view.GetDepth(); ++z)
+        {
+            for (uint32_t y = 1; y + 1 < view.GetHeight(); ++y)
+            {
+                for (uint32_t x = 1; x + 1 < view.GetWidth(); ++x)
+                {
+                    const int32_t gradientX = view.At(x + 1, y, z) - view.At(x - 1, y, z);
+                    const int32_t gradientY = view.At(x, y + 1, z) - view.At(x, y - 1, z);
+                    const int32_t gradientZ = view.At(x, y, z + 1) - view.At(x, y, z - 1);
+                    sum += std::abs(gradientX) + std::abs(gradientY) + std::abs(gradientZ);
+                }
+            }
+        }
+        return sum;
+    }
+
+    uint64_t GradientRows(const View& view)
+    {
+        uint64_t sum = 0;
+        for (uint32_t z = 1; z + 1 < view.GetDepth(); ++z)
+        {
+            for (uint32_t y = 1; y + 1 < view.GetHeight(); ++y)
+            {
+                const auto neighborhood = view.GetRowNeighborhood(y, z);
+                uint32_t rowSum = 0;
+                for (size_t x = 1; x + 1 < neighborhood.row.size(); ++x)
+                {
+                    const int32_t gradientX = neighborhood.row[x + 1] - neighborhood.row[x - 1];
+                    const int32_t gradientY = neighborhood.nextRow[x] - neighborhood.previousRow[x];
+                    const int32_t gradientZ = neighborhood.nextSlice[x] - neighborhood.previousSlice[x];
+                    rowSum += std::abs(gradientX) + std::abs(gradientY) + std::abs(gradientZ);
+                }
+                sum += rowSum;
+            }
+        }
+        return sum;
+    }
+
+    /// Median time in milliseconds, with the result of the last run
+    std::pair<double, uint64_t> MeasureTime(const std::function<uint64_t()>& compute, unsigned int numIterations)
+    {
+        std::vector<double> times;
+        uint64_t result = 0;
+        for (auto i = 0u; i < numIterations; ++i)
+        {
+            const auto begin = std::chrono::steady_clock::now();
+            result = compute();
+            const auto end = std::chrono::steady_clock::now();
+            times.push_back(std::chrono::duration<double, std::milli>(end - begin).count());
+        }
+
+        std::ranges::sort(times);
+        return {times[times.size() / 2], result};
+    }
+
+    void Report(const std::string& name, size_t numVoxels, double timeInMilliseconds)
+    {
+        const double numMegaVoxels = static_cast<double>(numVoxels) / 1.0e6;
+
+        std::cout << std::left << std::setw(20) << name << std::right << std::fixed << std::setprecision(1)
+                  << std::setw(10) << timeInMilliseconds << " ms"
+                  << std::setw(10) << numMegaVoxels / (timeInMilliseconds / 1000.0) << " MVoxel/s" << std::endl;
+    }
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+    const unsigned int numIterations = (argc >= 2) ? static_cast<unsigned int>(std::max(1, std::atoi(argv[1]))) : Constants::defaultNumIterations;
+
+    const auto volumeData = MakeSyntheticVolume();
+    const auto view = VolumeData::MakeVolumeView<uint16_t>(volumeData).value();
+    const size_t numVoxels = view.GetNumVoxels();
+
+    std::cout << "Median of " << numIterations << " runs over " << Constants::syntheticVolumeSize << "^3 16-bit voxels" << std::endl;
+
+    bool isConsistent = true;
+    const auto RunKernel = [&](const std::string& kernelName, const std::function<uint64_t()>& checked, const std::function<uint64_t()>& at, const std::function<uint64_t()>& rows)
+    {
+        const auto [checkedTime, checkedResult] = MeasureTime(checked, numIterations);
+        const auto [atTime, atResult] = MeasureTime(at, numIterations);
+        const auto [rowsTime, rowsResult] = MeasureTime(rows, numIterations);
+
+        Report(kernelName + " GetVoxel16", numVoxels, checkedTime);
+        Report(kernelName + " At", numVoxels, atTime);
+        Report(kernelName + " rows", numVoxels, rowsTime);
+        isConsistent = isConsistent && atResult == checkedResult && rowsResult == checkedResult;
+    };
+
+    RunKernel("sum", [&]() { return SumChecked(volumeData); }, [&]() { return SumAt(view); }, [&]() { return SumRows(view); });
+    RunKernel("gradient", [&]() { return GradientChecked(volumeData); }, [&]() { return GradientAt(view); }, [&]() { return GradientRows(view); });
+
+    if (!isConsistent)
+    {
+        std::cerr << "Results of the access methods differ" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
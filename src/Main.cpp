@@ -1,19 +1,44 @@
+#include <buffers/FrameBuffer.h>
+#include <buffers/FrameBufferId.h>
+#include <buffers/FrameBufferResizer.h>
+#include <buffers/MakeFrameBufferResizer.h>
+#include <config/Config.h>
 #include <context/GlfwWindow.h>
 #include <gui/Gui.h>
+#include <gui/GuiUpdateFlags.h>
 #include <gui/MakeGui.h>
 #include <input/DisplayProperties.h>
 #include <input/InputHandler.h>
 #include <input/MakeInputHandler.h>
+#include <renderpass/MakeProgressiveRefinement.h>
+#include <renderpass/MakeRedrawTracker.h>
 #include <renderpass/MakeRenderPasses.h>
+#include <renderpass/ProgressiveRefinement.h>
+#include <renderpass/RedrawScope.h>
+#include <renderpass/RedrawTracker.h>
 #include <ssao/SsaoUpdater.h>
 #include <ssao/MakeSsaoUpdater.h>
 #include <storage/MakeStorage.h>
 #include <storage/Storage.h>
 #include <transferfunction/TransferFunctionTextureUpdater.h>
 #include <transferfunction/MakeTransferFunctionTextureUpdater.h>
+#include <volumedata/GradientVolumeUpdater.h>
+#include <volumedata/MakeGradientVolumeUpdater.h>
+#include <volumedata/MakeOccupancyGridUpdater.h>
+#include <volumedata/MakePagedVolumeStreamer.h>
+#include <volumedata/MakeProgressiveVolumeLoader.h>
+#include <volumedata/MakeTimeSeriesPlayer.h>
+#include <volumedata/MakeVolumeQuantizationUpdater.h>
+#include <volumedata/OccupancyGridUpdater.h>
+#include <volumedata/PagedVolumeStreamer.h>
+#include <volumedata/ProgressiveVolumeLoader.h>
+#include <volumedata/TimeSeriesPlayer.h>
+#include <volumedata/VolumeQuantizationUpdater.h>
 
 #include <glad/glad.h>
 
+#include <algorithm>
+
 int main()
 {
     auto storage = Factory::MakeStorage();
@@ -21,18 +46,69 @@ int main()
     auto gui = Factory::MakeGui(storage);
     auto ssaoUpdater = Factory::MakeSsaoUpdater(storage);
     auto transferFunctionTextureUpdater = Factory::MakeTransferFunctionTextureUpdater(storage);
-    const auto renderPasses = Factory::MakeRenderPasses(gui, inputHandler, storage);
+    auto progressiveVolumeLoader = Factory::MakeProgressiveVolumeLoader(storage);
+    auto timeSeriesPlayer = Factory::MakeTimeSeriesPlayer(storage);
+    auto volumeQuantizationUpdater = Factory::MakeVolumeQuantizationUpdater(storage);
+    auto occupancyGridUpdater = Factory::MakeOccupancyGridUpdater(storage);
+    auto gradientVolumeUpdater = Factory::MakeGradientVolumeUpdater(storage);
+    auto pagedVolumeStreamer = Factory::MakePagedVolumeStreamer(storage);
+    auto redrawTracker = Factory::MakeRedrawTracker(storage);
+    auto progressiveRefinement = Factory::MakeProgressiveRefinement(storage);
+    auto frameBufferResizer = Factory::MakeFrameBufferResizer(storage);
+    const auto renderPasses = Factory::MakeRenderPasses(gui, inputHandler, progressiveRefinement, storage);
+    const auto& defaultFrameBuffer = storage.GetFrameBuffer(FrameBufferId::Default);
+    const auto& lastFrameFrameBuffer = storage.GetFrameBuffer(FrameBufferId::LastFrame);
     auto& window = storage.GetWindow();
 
     while (!window.ShouldClose())
     {
+        progressiveVolumeLoader.Update();
+        timeSeriesPlayer.Update();
         inputHandler.Update();
+        frameBufferResizer.Update(inputHandler.GetWindowWidth(), inputHandler.GetWindowHeight());
+
+        // The scene is also rendered until the refinement of the last change is complete
+        const auto trackedRedrawScope = redrawTracker.Update(inputHandler.GetWindowWidth(), inputHandler.GetWindowHeight(), gui.GetGuiWidth(), gui.HasPendingInput() || gui.HasPendingHistogram());
+        const auto redrawScope = (!Config::enableOnDemandRendering || !progressiveRefinement.IsComplete())
+            ? RedrawScope::Scene
+            : trackedRedrawScope;
+
         ssaoUpdater.Update();
+        volumeQuantizationUpdater.Update();
+        occupancyGridUpdater.Update();
+        gradientVolumeUpdater.Update();
+        pagedVolumeStreamer.Update(redrawScope == RedrawScope::Scene);
         transferFunctionTextureUpdater.Update();
 
-        for (const auto& renderPass : renderPasses)
+        // Background workers wake the loop once their results are ready, and the time series player once its next step is due.
+        // A redraw requested by the updaters above is picked up in the next iteration without waiting.
+        if (redrawScope == RedrawScope::None)
+        {
+            if (!storage.GetGuiUpdateFlags().redrawRequested)
+            {
+                window.WaitEvents(std::min(Config::idleWaitTimeoutInSeconds, timeSeriesPlayer.GetSecondsUntilNextStep()));
+            }
+            continue;
+        }
+
+        // The last frame is stored without the GUI, which is drawn on top of it again
+        const auto lastFrameWidth = inputHandler.GetWindowWidth();
+        const auto lastFrameHeight = inputHandler.GetWindowHeight();
+        if (redrawScope == RedrawScope::Scene)
+        {
+            // The offscreen volume framebuffers have the size of the window, the GUI panel is left of the viewport
+            const auto guiWidth = static_cast<unsigned int>(gui.GetGuiWidth());
+            const auto viewportWidth = (inputHandler.GetWindowWidth() > guiWidth) ? inputHandler.GetWindowWidth() - guiWidth : 0u;
+            progressiveRefinement.Update(redrawTracker.HasSceneChanged(), viewportWidth, inputHandler.GetWindowHeight());
+            for (const auto& renderPass : renderPasses)
+            {
+                renderPass.Render();
+            }
+            defaultFrameBuffer.BlitColorTo(lastFrameFrameBuffer, lastFrameWidth, lastFrameHeight);
+        }
+        else
         {
-            renderPass.Render();
+            lastFrameFrameBuffer.BlitColorTo(defaultFrameBuffer, lastFrameWidth, lastFrameHeight);
         }
 
         gui.Draw();
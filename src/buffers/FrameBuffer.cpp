@@ -1,5 +1,6 @@
 #include <buffers/FrameBuffer.h>
 #include <config/Config.h>
+#include <textures/GetTexelSizeInBytes.h>
 #include <textures/Texture.h>
 
 #include <glad/glad.h>
@@ -11,6 +12,9 @@ FrameBuffer::FrameBuffer(FrameBufferId frameBufferId)
     : m_frameBufferId{frameBufferId}
     , m_frameBufferObject{0}
     , m_renderBufferObjects{}
+    , m_renderBufferInternalFormats{}
+    , m_attachedTextureIds{}
+    , m_renderBufferSizeInBytes{0}
 {
     if (frameBufferId != FrameBufferId::Default)
     {
@@ -34,6 +38,9 @@ FrameBuffer::FrameBuffer(FrameBuffer&& other) noexcept
     : m_frameBufferId{other.m_frameBufferId}
     , m_frameBufferObject{other.m_frameBufferObject}
     , m_renderBufferObjects{std::move(other.m_renderBufferObjects)}
+    , m_renderBufferInternalFormats{std::move(other.m_renderBufferInternalFormats)}
+    , m_attachedTextureIds{std::move(other.m_attachedTextureIds)}
+    , m_renderBufferSizeInBytes{other.m_renderBufferSizeInBytes}
 {
     other.m_frameBufferObject = 0;
 }
@@ -54,6 +61,9 @@ FrameBuffer& FrameBuffer::operator=(FrameBuffer&& other) noexcept
         m_frameBufferId = other.m_frameBufferId;
         m_frameBufferObject = other.m_frameBufferObject;
         m_renderBufferObjects = std::move(other.m_renderBufferObjects);
+        m_renderBufferInternalFormats = std::move(other.m_renderBufferInternalFormats);
+        m_attachedTextureIds = std::move(other.m_attachedTextureIds);
+        m_renderBufferSizeInBytes = other.m_renderBufferSizeInBytes;
 
         other.m_frameBufferObject = 0;
     }
@@ -68,6 +78,7 @@ FrameBufferId FrameBuffer::GetId() const
 void FrameBuffer::AttachTexture(GLenum attachment, const Texture& texture)
 {
     glFramebufferTexture2D(GL_FRAMEBUFFER, attachment, GL_TEXTURE_2D, texture.GetGlId(), 0);
+    m_attachedTextureIds.push_back(texture.GetId());
 }
 
 void FrameBuffer::AttachRenderBuffer(GLenum attachment, GLenum internalFormat, unsigned int width, unsigned int height)
@@ -78,6 +89,20 @@ void FrameBuffer::AttachRenderBuffer(GLenum attachment, GLenum internalFormat, u
     glRenderbufferStorage(GL_RENDERBUFFER, internalFormat, width, height);
     glFramebufferRenderbuffer(GL_FRAMEBUFFER, attachment, GL_RENDERBUFFER, renderBufferObject);
     m_renderBufferObjects.push_back(renderBufferObject);
+    m_renderBufferInternalFormats.push_back(internalFormat);
+    m_renderBufferSizeInBytes += size_t{width} * height * GetTexelSizeInBytes(internalFormat, GL_NONE, GL_NONE);
+}
+
+void FrameBuffer::ResizeRenderBuffers(unsigned int width, unsigned int height)
+{
+    m_renderBufferSizeInBytes = 0;
+    for (size_t i = 0; i < m_renderBufferObjects.size(); ++i)
+    {
+        glBindRenderbuffer(GL_RENDERBUFFER, m_renderBufferObjects[i]);
+        glRenderbufferStorage(GL_RENDERBUFFER, m_renderBufferInternalFormats[i], width, height);
+        m_renderBufferSizeInBytes += size_t{width} * height * GetTexelSizeInBytes(m_renderBufferInternalFormats[i], GL_NONE, GL_NONE);
+    }
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
 }
 
 void FrameBuffer::Bind() const
@@ -97,3 +122,21 @@ void FrameBuffer::Check() const
         std::cout << "Framebuffer not complete!" << std::endl;
     }
 }
+
+void FrameBuffer::BlitColorTo(const FrameBuffer& destination, unsigned int width, unsigned int height, unsigned int destinationX, unsigned int destinationY) const
+{
+    glBindFramebuffer(GL_READ_FRAMEBUFFER, m_frameBufferObject);
+    glBindFramebuffer(GL_DRAW_FRAMEBUFFER, destination.m_frameBufferObject);
+    glBlitFramebuffer(0, 0, width, height, destinationX, destinationY, destinationX + width, destinationY + height, GL_COLOR_BUFFER_BIT, GL_NEAREST);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+}
+
+const std::vector<TextureId>& FrameBuffer::GetAttachedTextureIds() const
+{
+    return m_attachedTextureIds;
+}
+
+size_t FrameBuffer::GetRenderBufferSizeInBytes() const
+{
+    return m_renderBufferSizeInBytes;
+}
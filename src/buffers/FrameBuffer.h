@@ -8,6 +8,9 @@
 #define FRAME_BUFFER_H
 
 #include <buffers/FrameBufferId.h>
+#include <textures/TextureId.h>
+
+#include <cstddef>
 #include <vector>
 
 class Texture;
@@ -64,6 +67,14 @@ public:
     */
     void AttachRenderBuffer(unsigned int attachment, unsigned int internalFormat, unsigned int width, unsigned int height);
 
+    /**
+    * Reallocates all renderbuffers owned by this framebuffer with a new size, keeping their formats and attachments.
+    * @param width The new width of the renderbuffers in pixels.
+    * @param height The new height of the renderbuffers in pixels.
+    * @return void
+    */
+    void ResizeRenderBuffers(unsigned int width, unsigned int height);
+
     /**
     * Binds this framebuffer for rendering.
     * @return void
@@ -82,10 +93,36 @@ public:
     */
     void Check() const;
 
+    /**
+    * Copies the color buffer of this framebuffer into another framebuffer, starting at the lower left corner of this one.
+    * @param destination The framebuffer to copy into.
+    * @param width The width of the copied region in pixels.
+    * @param height The height of the copied region in pixels.
+    * @param destinationX The left edge of the region in the destination in pixels.
+    * @param destinationY The bottom edge of the region in the destination in pixels.
+    * @return void
+    */
+    void BlitColorTo(const FrameBuffer& destination, unsigned int width, unsigned int height, unsigned int destinationX = 0, unsigned int destinationY = 0) const;
+
+    /**
+    * Gets the textures attached to this framebuffer, whose memory is accounted for by the textures themselves.
+    * @return const std::vector<TextureId>& The IDs of the attached textures in order of attachment.
+    */
+    const std::vector<TextureId>& GetAttachedTextureIds() const;
+
+    /**
+    * Gets the estimated video memory of the renderbuffers owned by this framebuffer.
+    * @return size_t The size in bytes.
+    */
+    size_t GetRenderBufferSizeInBytes() const;
+
 private:
     FrameBufferId m_frameBufferId; /**< The ID of this framebuffer for identification. */
     unsigned int m_frameBufferObject; /**< The OpenGL framebuffer object handle. */
     std::vector<unsigned int> m_renderBufferObjects; /**< Renderbuffer object handles owned by this framebuffer. */
+    std::vector<unsigned int> m_renderBufferInternalFormats; /**< Internal formats of the renderbuffers, in the order of m_renderBufferObjects. */
+    std::vector<TextureId> m_attachedTextureIds; /**< IDs of the textures attached to this framebuffer. */
+    size_t m_renderBufferSizeInBytes; /**< Estimated video memory of the owned renderbuffers. */
 };
 
 #endif
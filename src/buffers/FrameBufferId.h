@@ -27,6 +27,10 @@ enum class FrameBufferId
     Ssao,        /**< SSAO computation framebuffer with occlusion output. */
     SsaoBlur,    /**< SSAO blur framebuffer with smoothed occlusion output. */
     Default,     /**< Default framebuffer (screen) for final rendering. */
+    PagedVolumeFeedback, /**< Low-resolution framebuffer receiving the brick requests of the ray caster. */
+    LastFrame,   /**< Framebuffer holding a copy of the last rendered scene, presented again on frames that only redraw the GUI. */
+    ReducedVolume, /**< Framebuffer the volume is ray cast into at reduced resolution while the scene changes. */
+    RefinedVolume, /**< Framebuffer holding the upscaled volume image, which is refined tile by tile at rest. */
     Unknown      /**< Sentinel value for uninitialized or invalid framebuffer IDs. */
 };
 
@@ -0,0 +1,42 @@
+#include <buffers/FrameBufferResizer.h>
+#include <buffers/FrameBuffer.h>
+#include <textures/Texture.h>
+
+#include <glad/glad.h>
+
+FrameBufferResizer::FrameBufferResizer(
+    Texture& lastFrameTexture,
+    Texture& reducedVolumeColorTexture,
+    Texture& refinedVolumeColorTexture,
+    FrameBuffer& reducedVolumeFrameBuffer,
+    FrameBuffer& refinedVolumeFrameBuffer,
+    unsigned int width,
+    unsigned int height
+)
+    : m_lastFrameTexture{lastFrameTexture}
+    , m_reducedVolumeColorTexture{reducedVolumeColorTexture}
+    , m_refinedVolumeColorTexture{refinedVolumeColorTexture}
+    , m_reducedVolumeFrameBuffer{reducedVolumeFrameBuffer}
+    , m_refinedVolumeFrameBuffer{refinedVolumeFrameBuffer}
+    , m_width{width}
+    , m_height{height}
+{
+}
+
+void FrameBufferResizer::Update(unsigned int width, unsigned int height)
+{
+    if (width == 0 || height == 0 || (width == m_width && height == m_height))
+    {
+        return;
+    }
+
+    m_width = width;
+    m_height = height;
+
+    // Same formats as in Factory::MakeTextures
+    m_lastFrameTexture.SetImage2D(width, height, GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    m_reducedVolumeColorTexture.SetImage2D(width, height, GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    m_refinedVolumeColorTexture.SetImage2D(width, height, GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+    m_reducedVolumeFrameBuffer.ResizeRenderBuffers(width, height);
+    m_refinedVolumeFrameBuffer.ResizeRenderBuffers(width, height);
+}
@@ -0,0 +1,71 @@
+/**
+* \file FrameBufferResizer.h
+*
+* \brief Keeps the offscreen render targets at the size of the window's framebuffer.
+*/
+
+#ifndef FRAME_BUFFER_RESIZER_H
+#define FRAME_BUFFER_RESIZER_H
+
+class FrameBuffer;
+class Texture;
+
+/**
+* \class FrameBufferResizer
+*
+* \brief Reallocates the window-sized offscreen textures and renderbuffers when the framebuffer size changes.
+*
+* The color textures of the reduced and refined volume framebuffers, their depth renderbuffers
+* and the texture of the last frame are allocated with the initial window size. Whenever the
+* size of the window's framebuffer changes, they are reallocated with the new size in place,
+* so that the framebuffers and the render passes referring to them stay valid. Their contents
+* are undefined afterwards, which is fine as a resize always redraws the scene.
+*
+* A framebuffer size of zero, as reported for minimized windows, is ignored.
+*
+* @see Factory::MakeFrameBuffers for the framebuffers and their attachments.
+* @see Factory::MakeFrameBufferResizer for construction from Storage.
+*/
+class FrameBufferResizer
+{
+public:
+    /**
+    * Constructor.
+    * @param lastFrameTexture Reference to the texture of the last frame in Storage.
+    * @param reducedVolumeColorTexture Reference to the color texture of the reduced volume framebuffer in Storage.
+    * @param refinedVolumeColorTexture Reference to the color texture of the refined volume framebuffer in Storage.
+    * @param reducedVolumeFrameBuffer Reference to the reduced volume framebuffer in Storage, owning a depth renderbuffer.
+    * @param refinedVolumeFrameBuffer Reference to the refined volume framebuffer in Storage, owning a depth renderbuffer.
+    * @param width The width the render targets were allocated with.
+    * @param height The height the render targets were allocated with.
+    */
+    FrameBufferResizer(
+        Texture& lastFrameTexture,
+        Texture& reducedVolumeColorTexture,
+        Texture& refinedVolumeColorTexture,
+        FrameBuffer& reducedVolumeFrameBuffer,
+        FrameBuffer& refinedVolumeFrameBuffer,
+        unsigned int width,
+        unsigned int height
+    );
+
+    /**
+    * Reallocates the render targets if the framebuffer size changed.
+    * Should be called once per frame before rendering.
+    * @param width The width of the window's framebuffer in pixels.
+    * @param height The height of the window's framebuffer in pixels.
+    * @return void
+    */
+    void Update(unsigned int width, unsigned int height);
+
+private:
+    Texture& m_lastFrameTexture; /**< Reference to the texture of the last frame. */
+    Texture& m_reducedVolumeColorTexture; /**< Reference to the color texture of the reduced volume framebuffer. */
+    Texture& m_refinedVolumeColorTexture; /**< Reference to the color texture of the refined volume framebuffer. */
+    FrameBuffer& m_reducedVolumeFrameBuffer; /**< Reference to the reduced volume framebuffer. */
+    FrameBuffer& m_refinedVolumeFrameBuffer; /**< Reference to the refined volume framebuffer. */
+    unsigned int m_width; /**< Current width of the render targets in pixels. */
+    unsigned int m_height; /**< Current height of the render targets in pixels. */
+};
+
+#endif
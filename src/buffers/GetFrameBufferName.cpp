@@ -0,0 +1,26 @@
+#include <buffers/GetFrameBufferName.h>
+
+const char* GetFrameBufferName(FrameBufferId frameBufferId)
+{
+    switch (frameBufferId)
+    {
+        case FrameBufferId::SsaoInput:
+            return "SsaoInput";
+        case FrameBufferId::Ssao:
+            return "Ssao";
+        case FrameBufferId::SsaoBlur:
+            return "SsaoBlur";
+        case FrameBufferId::Default:
+            return "Default";
+        case FrameBufferId::PagedVolumeFeedback:
+            return "PagedVolumeFeedback";
+        case FrameBufferId::LastFrame:
+            return "LastFrame";
+        case FrameBufferId::ReducedVolume:
+            return "ReducedVolume";
+        case FrameBufferId::RefinedVolume:
+            return "RefinedVolume";
+        default:
+            return "Unknown";
+    }
+}
@@ -0,0 +1,19 @@
+/**
+* \file GetFrameBufferName.h
+*
+* \brief Function for getting a readable name of a framebuffer.
+*/
+
+#ifndef GET_FRAME_BUFFER_NAME_H
+#define GET_FRAME_BUFFER_NAME_H
+
+#include <buffers/FrameBufferId.h>
+
+/**
+* Gets a readable name of a framebuffer for display in the GUI.
+* @param frameBufferId The ID of the framebuffer.
+* @return const char* The name, matching the FrameBufferId enumerator.
+*/
+const char* GetFrameBufferName(FrameBufferId frameBufferId);
+
+#endif
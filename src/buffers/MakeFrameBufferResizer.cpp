@@ -0,0 +1,19 @@
+#include <buffers/MakeFrameBufferResizer.h>
+#include <buffers/FrameBufferId.h>
+
+#include <config/Config.h>
+#include <storage/Storage.h>
+#include <textures/TextureId.h>
+
+FrameBufferResizer Factory::MakeFrameBufferResizer(Storage& storage)
+{
+    return FrameBufferResizer {
+        storage.GetTexture(TextureId::LastFrame),
+        storage.GetTexture(TextureId::ReducedVolumeColor),
+        storage.GetTexture(TextureId::RefinedVolumeColor),
+        storage.GetFrameBuffer(FrameBufferId::ReducedVolume),
+        storage.GetFrameBuffer(FrameBufferId::RefinedVolume),
+        Config::windowWidth,
+        Config::windowHeight
+    };
+}
@@ -0,0 +1,26 @@
+/**
+* \file MakeFrameBufferResizer.h
+*
+* \brief Factory function for creating the framebuffer resizer.
+*/
+
+#ifndef MAKE_FRAME_BUFFER_RESIZER_H
+#define MAKE_FRAME_BUFFER_RESIZER_H
+
+#include <buffers/FrameBufferResizer.h>
+
+class Storage;
+
+namespace Factory
+{
+    /**
+    * Creates the resizer of the window-sized offscreen render targets in Storage.
+    * The render targets are expected to have the size of Config::windowWidth and Config::windowHeight.
+    * @param storage Storage containing the textures and framebuffers to resize.
+    * @return FrameBufferResizer Initialized FrameBufferResizer object.
+    * @see FrameBufferResizer for the reallocation.
+    */
+    FrameBufferResizer MakeFrameBufferResizer(Storage& storage);
+}
+
+#endif
@@ -25,11 +25,15 @@ namespace Factory
     std::vector<FrameBuffer> MakeFrameBuffers(const TextureStorage& textureStorage)
     {
         std::vector<FrameBuffer> frameBuffers;
-        frameBuffers.reserve(4);
+        frameBuffers.reserve(8);
         frameBuffers.emplace_back(FrameBufferId::Default);
         frameBuffers.emplace_back(FrameBufferId::SsaoInput);
         frameBuffers.emplace_back(FrameBufferId::Ssao);
         frameBuffers.emplace_back(FrameBufferId::SsaoBlur);
+        frameBuffers.emplace_back(FrameBufferId::PagedVolumeFeedback);
+        frameBuffers.emplace_back(FrameBufferId::LastFrame);
+        frameBuffers.emplace_back(FrameBufferId::ReducedVolume);
+        frameBuffers.emplace_back(FrameBufferId::RefinedVolume);
 
         auto& ssaoInputFrameBuffer = GetFrameBuffer(frameBuffers, FrameBufferId::SsaoInput);
         ssaoInputFrameBuffer.Bind();
@@ -55,6 +59,36 @@ namespace Factory
         ssaoBlurFrameBuffer.Check();
         ssaoBlurFrameBuffer.Unbind();
 
+        // The volume shader writes its color to location 0 and the requested brick to location 1
+        auto& pagedVolumeFeedbackFrameBuffer = GetFrameBuffer(frameBuffers, FrameBufferId::PagedVolumeFeedback);
+        pagedVolumeFeedbackFrameBuffer.Bind();
+        pagedVolumeFeedbackFrameBuffer.AttachTexture(GL_COLOR_ATTACHMENT0, textureStorage.GetElement(TextureId::PagedVolumeFeedback));
+        unsigned int feedbackAttachments[2] = { GL_NONE, GL_COLOR_ATTACHMENT0 };
+        glDrawBuffers(2, feedbackAttachments);
+        pagedVolumeFeedbackFrameBuffer.Check();
+        pagedVolumeFeedbackFrameBuffer.Unbind();
+
+        auto& lastFrameFrameBuffer = GetFrameBuffer(frameBuffers, FrameBufferId::LastFrame);
+        lastFrameFrameBuffer.Bind();
+        lastFrameFrameBuffer.AttachTexture(GL_COLOR_ATTACHMENT0, textureStorage.GetElement(TextureId::LastFrame));
+        lastFrameFrameBuffer.Check();
+        lastFrameFrameBuffer.Unbind();
+
+        // The ray caster needs a depth buffer, so that only the front faces of the unit cube are shaded
+        auto& reducedVolumeFrameBuffer = GetFrameBuffer(frameBuffers, FrameBufferId::ReducedVolume);
+        reducedVolumeFrameBuffer.Bind();
+        reducedVolumeFrameBuffer.AttachTexture(GL_COLOR_ATTACHMENT0, textureStorage.GetElement(TextureId::ReducedVolumeColor));
+        reducedVolumeFrameBuffer.AttachRenderBuffer(GL_DEPTH_ATTACHMENT, GL_DEPTH_COMPONENT, Config::windowWidth, Config::windowHeight);
+        reducedVolumeFrameBuffer.Check();
+        reducedVolumeFrameBuffer.Unbind();
+
+        auto& refinedVolumeFrameBuffer = GetFrameBuffer(frameBuffers, FrameBufferId::RefinedVolume);
+        refinedVolumeFrameBuffer.Bind();
+        refinedVolumeFrameBuffer.AttachTexture(GL_COLOR_ATTACHMENT0, textureStorage.GetElement(TextureId::RefinedVolumeColor));
+        refinedVolumeFrameBuffer.AttachRenderBuffer(GL_DEPTH_ATTACHMENT, GL_DEPTH_COMPONENT, Config::windowWidth, Config::windowHeight);
+        refinedVolumeFrameBuffer.Check();
+        refinedVolumeFrameBuffer.Unbind();
+
         return frameBuffers;
     }
 }
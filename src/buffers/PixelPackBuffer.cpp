@@ -0,0 +1,69 @@
+#include <buffers/PixelPackBuffer.h>
+
+#include <glad/glad.h>
+
+PixelPackBuffer::PixelPackBuffer(size_t sizeInBytes)
+    : m_pixelPackBufferObject{}
+    , m_sizeInBytes{sizeInBytes}
+{
+    glGenBuffers(1, &m_pixelPackBufferObject);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pixelPackBufferObject);
+    glBufferData(GL_PIXEL_PACK_BUFFER, m_sizeInBytes, nullptr, GL_STREAM_READ);
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+PixelPackBuffer::PixelPackBuffer(PixelPackBuffer&& other) noexcept
+    : m_pixelPackBufferObject{other.m_pixelPackBufferObject}
+    , m_sizeInBytes{other.m_sizeInBytes}
+{
+    other.m_pixelPackBufferObject = 0;
+    other.m_sizeInBytes = 0;
+}
+
+PixelPackBuffer& PixelPackBuffer::operator=(PixelPackBuffer&& other) noexcept
+{
+    if (this != &other)
+    {
+        if (m_pixelPackBufferObject != 0)
+        {
+            glDeleteBuffers(1, &m_pixelPackBufferObject);
+        }
+
+        m_pixelPackBufferObject = other.m_pixelPackBufferObject;
+        m_sizeInBytes = other.m_sizeInBytes;
+
+        other.m_pixelPackBufferObject = 0;
+        other.m_sizeInBytes = 0;
+    }
+    return *this;
+}
+
+PixelPackBuffer::~PixelPackBuffer()
+{
+    if (m_pixelPackBufferObject != 0)
+    {
+        glDeleteBuffers(1, &m_pixelPackBufferObject);
+    }
+}
+
+const void* PixelPackBuffer::Map()
+{
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pixelPackBufferObject);
+    return glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, m_sizeInBytes, GL_MAP_READ_BIT);
+}
+
+bool PixelPackBuffer::Unmap()
+{
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pixelPackBufferObject);
+    return glUnmapBuffer(GL_PIXEL_PACK_BUFFER) == GL_TRUE;
+}
+
+void PixelPackBuffer::Bind() const
+{
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pixelPackBufferObject);
+}
+
+void PixelPackBuffer::Unbind() const
+{
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
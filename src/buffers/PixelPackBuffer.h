@@ -0,0 +1,82 @@
+/**
+* \file PixelPackBuffer.h
+*
+* \brief Pixel pack buffer object (PBO) abstraction for asynchronous readbacks.
+*/
+
+#ifndef PIXEL_PACK_BUFFER_H
+#define PIXEL_PACK_BUFFER_H
+
+#include <cstddef>
+
+/**
+* \class PixelPackBuffer
+*
+* \brief Encapsulates an OpenGL pixel pack buffer used as a destination for readbacks.
+*
+* While a pixel pack buffer is bound, the data pointer passed to glReadPixels or
+* glGetTexImage is interpreted as an offset into the buffer, so the call returns
+* immediately and the copy completes on the GPU. Mapping the buffer a frame or more
+* later then reads the result without stalling the pipeline.
+*
+* All member functions must be called on the thread owning the OpenGL context.
+*
+* PixelPackBuffer is movable but not copyable, following RAII principles with proper
+* cleanup in the destructor.
+*
+* @see PixelUnpackBuffer for the upload counterpart.
+* @see VolumeData::PagedVolumeStreamer for reading back the brick feedback buffer.
+*/
+class PixelPackBuffer
+{
+public:
+    /**
+    * Constructor.
+    * Allocates uninitialized buffer storage of the given size.
+    * @param sizeInBytes The size of the buffer storage in bytes.
+    */
+    explicit PixelPackBuffer(size_t sizeInBytes);
+
+    PixelPackBuffer(const PixelPackBuffer&) = delete;
+    PixelPackBuffer(PixelPackBuffer&& other) noexcept;
+
+    PixelPackBuffer& operator=(const PixelPackBuffer&) = delete;
+    PixelPackBuffer& operator=(PixelPackBuffer&& other) noexcept;
+
+    ~PixelPackBuffer();
+
+    /**
+    * Maps the whole buffer for reading.
+    * Blocks until pending readbacks into the buffer have completed.
+    * Leaves the buffer bound to GL_PIXEL_PACK_BUFFER.
+    * @return const void* Pointer to the mapped buffer storage, or nullptr if mapping failed.
+    */
+    const void* Map();
+
+    /**
+    * Unmaps the buffer.
+    * Leaves the buffer bound to GL_PIXEL_PACK_BUFFER.
+    * @return bool False if the buffer contents were corrupted while mapped, true otherwise.
+    */
+    bool Unmap();
+
+    /**
+    * Binds the buffer to GL_PIXEL_PACK_BUFFER.
+    * @return void
+    */
+    void Bind() const;
+
+    /**
+    * Unbinds any buffer from GL_PIXEL_PACK_BUFFER.
+    * @return void
+    */
+    void Unbind() const;
+
+    size_t GetSizeInBytes() const { return m_sizeInBytes; }
+
+private:
+    unsigned int m_pixelPackBufferObject; /**< The OpenGL buffer object handle. */
+    size_t m_sizeInBytes; /**< The size of the buffer storage in bytes. */
+};
+
+#endif
@@ -0,0 +1,69 @@
+#include <buffers/PixelUnpackBuffer.h>
+
+#include <glad/glad.h>
+
+PixelUnpackBuffer::PixelUnpackBuffer(size_t sizeInBytes)
+    : m_pixelUnpackBufferObject{}
+    , m_sizeInBytes{sizeInBytes}
+{
+    glGenBuffers(1, &m_pixelUnpackBufferObject);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_pixelUnpackBufferObject);
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, m_sizeInBytes, nullptr, GL_STREAM_DRAW);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
+
+PixelUnpackBuffer::PixelUnpackBuffer(PixelUnpackBuffer&& other) noexcept
+    : m_pixelUnpackBufferObject{other.m_pixelUnpackBufferObject}
+    , m_sizeInBytes{other.m_sizeInBytes}
+{
+    other.m_pixelUnpackBufferObject = 0;
+    other.m_sizeInBytes = 0;
+}
+
+PixelUnpackBuffer& PixelUnpackBuffer::operator=(PixelUnpackBuffer&& other) noexcept
+{
+    if (this != &other)
+    {
+        if (m_pixelUnpackBufferObject != 0)
+        {
+            glDeleteBuffers(1, &m_pixelUnpackBufferObject);
+        }
+
+        m_pixelUnpackBufferObject = other.m_pixelUnpackBufferObject;
+        m_sizeInBytes = other.m_sizeInBytes;
+
+        other.m_pixelUnpackBufferObject = 0;
+        other.m_sizeInBytes = 0;
+    }
+    return *this;
+}
+
+PixelUnpackBuffer::~PixelUnpackBuffer()
+{
+    if (m_pixelUnpackBufferObject != 0)
+    {
+        glDeleteBuffers(1, &m_pixelUnpackBufferObject);
+    }
+}
+
+void* PixelUnpackBuffer::Map()
+{
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_pixelUnpackBufferObject);
+    return glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, m_sizeInBytes, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+}
+
+bool PixelUnpackBuffer::Unmap()
+{
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_pixelUnpackBufferObject);
+    return glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER) == GL_TRUE;
+}
+
+void PixelUnpackBuffer::Bind() const
+{
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_pixelUnpackBufferObject);
+}
+
+void PixelUnpackBuffer::Unbind() const
+{
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+}
@@ -0,0 +1,83 @@
+/**
+* \file PixelUnpackBuffer.h
+*
+* \brief Pixel unpack buffer object (PBO) abstraction for asynchronous texture uploads.
+*/
+
+#ifndef PIXEL_UNPACK_BUFFER_H
+#define PIXEL_UNPACK_BUFFER_H
+
+#include <cstddef>
+
+/**
+* \class PixelUnpackBuffer
+*
+* \brief Encapsulates an OpenGL pixel unpack buffer used as a staging area for texture uploads.
+*
+* While a pixel unpack buffer is bound, the data pointer passed to glTexSubImage* is
+* interpreted as an offset into the buffer, so the driver can copy the texels to the GPU
+* asynchronously instead of blocking on client memory.
+*
+* The buffer can be mapped into client memory via Map(). The returned pointer may be
+* written from any thread, while Map(), Unmap() and all other member functions must be
+* called on the thread owning the OpenGL context.
+*
+* PixelUnpackBuffer is movable but not copyable, following RAII principles with proper
+* cleanup in the destructor.
+*
+* @see Factory::MakeStreamedVolumeDataTexture for streaming volume slabs through a ring of buffers.
+* @see Texture::SetSubImage3D for uploading from a bound buffer.
+*/
+class PixelUnpackBuffer
+{
+public:
+    /**
+    * Constructor.
+    * Allocates uninitialized buffer storage of the given size.
+    * @param sizeInBytes The size of the buffer storage in bytes.
+    */
+    explicit PixelUnpackBuffer(size_t sizeInBytes);
+
+    PixelUnpackBuffer(const PixelUnpackBuffer&) = delete;
+    PixelUnpackBuffer(PixelUnpackBuffer&& other) noexcept;
+
+    PixelUnpackBuffer& operator=(const PixelUnpackBuffer&) = delete;
+    PixelUnpackBuffer& operator=(PixelUnpackBuffer&& other) noexcept;
+
+    ~PixelUnpackBuffer();
+
+    /**
+    * Maps the whole buffer for writing, invalidating its previous contents.
+    * Invalidation lets the driver hand out fresh storage instead of waiting for a pending upload.
+    * Leaves the buffer bound to GL_PIXEL_UNPACK_BUFFER.
+    * @return void* Pointer to the mapped buffer storage, or nullptr if mapping failed.
+    */
+    void* Map();
+
+    /**
+    * Unmaps the buffer.
+    * Leaves the buffer bound to GL_PIXEL_UNPACK_BUFFER.
+    * @return bool False if the buffer contents were corrupted while mapped, true otherwise.
+    */
+    bool Unmap();
+
+    /**
+    * Binds the buffer to GL_PIXEL_UNPACK_BUFFER.
+    * @return void
+    */
+    void Bind() const;
+
+    /**
+    * Unbinds any buffer from GL_PIXEL_UNPACK_BUFFER.
+    * @return void
+    */
+    void Unbind() const;
+
+    size_t GetSizeInBytes() const { return m_sizeInBytes; }
+
+private:
+    unsigned int m_pixelUnpackBufferObject; /**< The OpenGL buffer object handle. */
+    size_t m_sizeInBytes; /**< The size of the buffer storage in bytes. */
+};
+
+#endif
@@ -27,6 +27,8 @@ struct CameraParameters
     glm::vec3 lookAt; /**< Point in world space the camera looks at. */
     glm::vec3 up; /**< World-space up vector for orientation. */
     float zoom; /**< Field of view angle in degrees. */
+
+    bool operator==(const CameraParameters&) const = default;
 };
 
 #endif
@@ -19,10 +19,21 @@
 #include <lights/PointLight.h>
 #include <lights/MakeDefaultDirectionalLight.h>
 #include <lights/MakeDefaultPointLights.h>
+#include <renderpass/RaycastingQuality.h>
 #include <transferfunction/MakeDefaultTransferFunction.h>
+#include <volumedata/VolumeLoadingMode.h>
+#include <volumedata/VolumeQuantizationMode.h>
+#include <volumedata/VolumeRegion.h>
+#include <volumedata/VolumeResidencyPolicy.h>
+#include <volumedata/VolumeStorageMode.h>
+#include <volumedata/VolumeUploadMode.h>
+#include <volumedata/VolumeWindow.h>
 
 #include <glm/glm.hpp>
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
 #include <string>
 #include <vector>
@@ -41,12 +52,55 @@ namespace Config
     constexpr unsigned int windowHeight = 1080;
     //constexpr unsigned int windowWidth = 3840;
     //constexpr unsigned int windowHeight = 2160;
+    constexpr bool enableOnDemandRendering = true;
+    constexpr double idleWaitTimeoutInSeconds = 5.0;
+    constexpr unsigned int numRedrawFramesAfterChange = 3;
+    constexpr bool enableProgressiveRefinement = true;
+    constexpr unsigned int progressiveRefinementTileSize = 128;
+    constexpr size_t progressiveRefinementBudgetInPixelsPerFrame = 1024 * 1024;
     const std::filesystem::path applicationStateIniFilePath = "./volume-renderer.ini";
     const std::filesystem::path datasetPath = "./datasets/knee.raw";
+    constexpr VolumeData::VolumeLoadingMode volumeLoadingMode = VolumeData::VolumeLoadingMode::Progressive;
+    constexpr std::array<uint32_t, 3> progressiveLoadingStrides = {8, 4, 2};
+    constexpr VolumeData::VolumeStorageMode volumeStorageMode = VolumeData::VolumeStorageMode::Mapped;
+    constexpr VolumeData::VolumeRegion volumeRegion = VolumeData::VolumeRegion{};
+    constexpr VolumeData::VolumeUploadMode volumeUploadMode = VolumeData::VolumeUploadMode::Streamed;
+    constexpr VolumeData::VolumeResidencyPolicy volumeResidencyPolicy = VolumeData::VolumeResidencyPolicy::KeepResident;
+    constexpr size_t volumeUploadSlabSizeInBytes = 32 * 1024 * 1024;
+    constexpr unsigned int numVolumeUploadBuffers = 3;
+    constexpr bool generateVolumePyramid = true;
+    constexpr float volumeLodBias = 0.0f;
+    constexpr bool enableEmptySpaceSkipping = true;
+    constexpr unsigned int occupancyGridBrickSize = 16;
+    constexpr unsigned int maxRaycastingSteps = 16384;
+    constexpr unsigned int maxAdaptiveSamplingNyquistSteps = 16;
+    constexpr float adaptiveSamplingMaxValueChangePerStep = 0.02f;
+    constexpr bool enableGradientShading = true;
+    constexpr VolumeData::VolumeQuantizationMode volumeQuantizationMode = VolumeData::VolumeQuantizationMode::Off;
+    constexpr VolumeData::VolumeWindow defaultVolumeWindow = VolumeData::VolumeWindow{};
+    constexpr float volumeQuantizationLowerPercentile = 0.005f;
+    constexpr float volumeQuantizationUpperPercentile = 0.995f;
+    constexpr unsigned int volumeQuantizationHistogramNumBins = 4096;
+    const std::filesystem::path timeSeriesPath = "";
+    constexpr float timeSeriesPlaybackRate = 10.0f;
+    constexpr unsigned int numTimeSeriesUploadBuffers = 3;
+    constexpr size_t pagedVolumeAtlasSizeInBytes = size_t{1} << 30;
+    constexpr size_t pagedVolumeHostCacheSizeInBytes = size_t{4} << 30;
+    constexpr unsigned int pagedVolumeFeedbackDownscale = 8;
+    constexpr unsigned int pagedVolumeFeedbackWidth = windowWidth / pagedVolumeFeedbackDownscale;
+    constexpr unsigned int pagedVolumeFeedbackHeight = windowHeight / pagedVolumeFeedbackDownscale;
+    constexpr unsigned int maxPagedBrickUploadsPerFrame = 32;
+    constexpr unsigned int maxPendingPagedBrickRequests = 256;
+    constexpr unsigned int numPagedVolumeStreamingThreads = 4;
+    constexpr size_t gpuMemoryBudgetInBytes = 0;
+    constexpr float gpuMemoryBudgetFraction = 0.8f;
+    constexpr bool enableDerivedDataCache = true;
+    const std::filesystem::path derivedDataCachePath = "./cache";
     const std::filesystem::path shadersPath = "./shaders";
     constexpr bool showLightSourceByDefault = false;
     constexpr float defaultGuiWidthRatio = 0.3f;
     constexpr float defaultTransferFunctionGuiHeightRatio = 0.3f;
+    constexpr unsigned int transferFunctionGuiHistogramNumBins = 256;
     constexpr unsigned int numPointLights = 2;
     const DirectionalLight defaultDirectionalLight = Factory::MakeDefaultDirectionalLight();
     const std::vector<PointLight> defaultPointLights = Factory::MakeDefaultPointLights(numPointLights);
@@ -65,6 +119,8 @@ namespace Config
     constexpr float defaultTrackballSensitivity = 0.003f;
     constexpr bool defaultTrackballInvertYAxis = true;
     constexpr float defaultRaycastingDensityMultiplier = 20.0f;
+    constexpr RaycastingQuality defaultRaycastingQuality = RaycastingQuality::Balanced;
+    constexpr bool defaultEnablePreIntegration = true;
 }
 
 #endif
@@ -16,7 +16,7 @@
 *
 * Defines compile-time constants that control transfer function behavior,
 * including the maximum number of control points and the resolution of the
-* 1D texture used for GPU sampling.
+* 1D texture and the 2D pre-integration table used for GPU sampling.
 *
 * @see TransferFunction for control point management.
 * @see TransferFunctionTextureUpdater for texture generation.
@@ -27,6 +27,7 @@ namespace TransferFunctionConstants
     constexpr size_t maxNumControlPoints = 8;    /**< Maximum number of transfer function control points. */
     constexpr size_t textureSize = 512;          /**< Resolution of the 1D transfer function texture in texels. */
     constexpr size_t textureDataSize = textureSize * 4;  /**< Size of texture data buffer in bytes (RGBA format). */
+    constexpr size_t preIntegrationTableSize = 256;      /**< Resolution of the 2D pre-integration table along each axis. */
 }
 
 #endif
@@ -30,6 +30,11 @@ namespace Context
         glfwPollEvents();
     }
 
+    void GlfwWindow::WaitEvents(double timeoutInSeconds)
+    {
+        glfwWaitEventsTimeout(timeoutInSeconds);
+    }
+
     void GlfwWindow::Shutdown()
     {
         m_window.reset();
@@ -18,7 +18,7 @@ namespace Context
     *
     * Encapsulates a GLFW window with automatic initialization and cleanup.
     * Provides methods for checking window state, swapping buffers, and polling
-    * events. Uses a custom deleter to ensure proper GLFW resource cleanup.
+    * or waiting for events. Uses a custom deleter to ensure proper GLFW resource cleanup.
     *
     * The window is created in the constructor with the dimensions specified in
     * Config::windowWidth and Config::windowHeight. The OpenGL context is made
@@ -63,6 +63,14 @@ namespace Context
         */
         void PostRender();
 
+        /**
+        * Blocks until input events arrive or the timeout expires, and processes them.
+        * Used instead of rendering when nothing changed since the last frame.
+        * @param timeoutInSeconds The maximum time to wait.
+        * @return void
+        */
+        void WaitEvents(double timeoutInSeconds);
+
         /**
         * Shuts down the GLFW window and terminates GLFW.
         * @return void
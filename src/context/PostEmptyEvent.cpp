@@ -0,0 +1,7 @@
+#include <context/PostEmptyEvent.h>
+#include <GLFW/glfw3.h>
+
+void Context::PostEmptyEvent()
+{
+    glfwPostEmptyEvent();
+}
@@ -0,0 +1,26 @@
+/**
+* \file PostEmptyEvent.h
+*
+* \brief Function for waking the main loop from another thread.
+*/
+
+#ifndef POST_EMPTY_EVENT_H
+#define POST_EMPTY_EVENT_H
+
+namespace Context
+{
+    /**
+    * Posts an empty event to the GLFW event queue, so that GlfwWindow::WaitEvents() returns.
+    *
+    * The main loop waits for events while nothing needs to be drawn. Background workers
+    * call this function once a result is ready for the main thread, so that it is picked
+    * up right away instead of after the idle timeout. May be called from any thread.
+    *
+    * @return void
+    *
+    * @see GlfwWindow::WaitEvents for the idle wait.
+    */
+    void PostEmptyEvent();
+}
+
+#endif
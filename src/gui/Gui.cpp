@@ -1,4 +1,5 @@
 #include <gui/Gui.h>
+#include <buffers/GetFrameBufferName.h>
 #include <config/Config.h>
 #include <gui/GuiParameters.h>
 #include <gui/GuiUpdateFlags.h>
@@ -6,21 +7,55 @@
 #include <gui/MakeSlider.h>
 #include <gui/StyleGui.h>
 #include <gui/TransferFunctionGui.h>
+#include <renderpass/GetRaycastingQualitySettings.h>
+#include <renderpass/RaycastingQuality.h>
+#include <storage/GetGpuMemoryUsageInBytes.h>
+#include <textures/GetGpuMemoryBudgetInBytes.h>
+#include <textures/GetTextureName.h>
+#include <textures/QueryGpuMemoryInfo.h>
+#include <volumedata/TimeSeriesPlaybackState.h>
+#include <volumedata/VolumeLoadingProgress.h>
 
 #include <GLFW/glfw3.h>
 
+#include <algorithm>
+#include <string>
+
 namespace Constants
 {
     const ImGuiColorEditFlags colorPickerFlags = ImGuiColorEditFlags_NoAlpha | ImGuiColorEditFlags_PickerHueBar | ImGuiColorEditFlags_DisplayRGB | ImGuiColorEditFlags_Float;
+    const ImGuiTableFlags memoryTableFlags = ImGuiTableFlags_RowBg | ImGuiTableFlags_BordersInnerV;
+    constexpr double bytesPerMebibyte = 1024.0 * 1024.0;
 }
 
-Gui::Gui(const Context::WindowPtr& window, GuiParameters& guiParameters, GuiUpdateFlags& guiUpdateFlags)
+namespace
+{
+    double ToMebibytes(size_t sizeInBytes)
+    {
+        return static_cast<double>(sizeInBytes) / Constants::bytesPerMebibyte;
+    }
+
+    void DrawMemoryTableRow(const char* name, size_t sizeInBytes)
+    {
+        ImGui::TableNextRow();
+        ImGui::TableSetColumnIndex(0);
+        ImGui::TextUnformatted(name);
+        ImGui::TableSetColumnIndex(1);
+        ImGui::Text("%.2f MiB", ToMebibytes(sizeInBytes));
+    }
+} // anonymous namespace
+
+Gui::Gui(const Context::WindowPtr& window, GuiParameters& guiParameters, GuiUpdateFlags& guiUpdateFlags, const VolumeData::VolumeLoadingProgress& volumeLoadingProgress, const VolumeData::VolumeHandle& volumeData, VolumeData::TimeSeriesPlaybackState& timeSeriesPlaybackState, const TextureStorage& textureStorage, const FrameBufferStorage& frameBufferStorage)
     : m_window{window}
     , m_guiParameters{guiParameters}
     , m_guiUpdateFlags{guiUpdateFlags}
+    , m_volumeLoadingProgress{volumeLoadingProgress}
+    , m_timeSeriesPlaybackState{timeSeriesPlaybackState}
+    , m_textureStorage{textureStorage}
+    , m_frameBufferStorage{frameBufferStorage}
     , m_guiWidth{0.0f}
     , m_transferFunctionHeight{0.0f}
-    , m_transferFunctionGui{guiParameters.transferFunction, guiUpdateFlags}
+    , m_transferFunctionGui{guiParameters.transferFunction, guiUpdateFlags, volumeData, guiParameters.volumeWindow}
 {
     IMGUI_CHECKVERSION();
     ImGui::CreateContext();
@@ -39,6 +74,9 @@ Gui::Gui(const Context::WindowPtr& window, GuiParameters& guiParameters, GuiUpda
 
     ImGui_ImplGlfw_InitForOpenGL(window.get(), true);
     ImGui_ImplOpenGL3_Init("#version 130");
+
+    // A click released before HasPendingInput() polls the buttons is still reported as pressed once
+    glfwSetInputMode(window.get(), GLFW_STICKY_MOUSE_BUTTONS, GLFW_TRUE);
 }
 
 void Gui::Shutdown()
@@ -53,6 +91,41 @@ float Gui::GetGuiWidth() const
     return m_guiWidth;
 }
 
+bool Gui::HasPendingHistogram() const
+{
+    return m_transferFunctionGui.HasPendingHistogram();
+}
+
+bool Gui::HasPendingInput() const
+{
+    const ImGuiIO& io = ImGui::GetIO();
+
+    // Input the GUI is still reacting to: a moving mouse, unprocessed characters or an active text field
+    if (io.MouseDelta.x != 0.0f || io.MouseDelta.y != 0.0f || io.MouseWheel != 0.0f || !io.InputQueueCharacters.empty() || io.WantTextInput)
+    {
+        return true;
+    }
+
+    // Input since the last GUI frame, whose cursor position and buttons the GUI has not seen yet
+    for (int button = 0; button < ImGuiMouseButton_COUNT; ++button)
+    {
+        if ((glfwGetMouseButton(m_window.get(), button) == GLFW_PRESS) != io.MouseDown[button])
+        {
+            return true;
+        }
+    }
+
+    if (glfwGetWindowAttrib(m_window.get(), GLFW_HOVERED) == GLFW_FALSE)
+    {
+        return false;
+    }
+
+    double cursorX = 0.0;
+    double cursorY = 0.0;
+    glfwGetCursorPos(m_window.get(), &cursorX, &cursorY);
+    return !ImGui::IsMousePosValid(&io.MousePos) || static_cast<float>(cursorX) != io.MousePos.x || static_cast<float>(cursorY) != io.MousePos.y;
+}
+
 void Gui::Draw()
 {
     ImGui_ImplOpenGL3_NewFrame();
@@ -84,6 +157,31 @@ void Gui::Draw()
     // Update GUI width after potential resize
     m_guiWidth = ImGui::GetWindowWidth();
 
+    // Volume loading
+    if (m_volumeLoadingProgress.isLoading)
+    {
+        const auto stride = m_volumeLoadingProgress.displayedStride;
+        const auto overlay = (stride == 0) ? std::string{"Loading volume"} : "Loading volume (showing 1/" + std::to_string(stride) + " resolution)";
+        ImGui::ProgressBar(m_volumeLoadingProgress.fraction, ImVec2{-1, 0}, overlay.c_str());
+    }
+    else if (m_volumeLoadingProgress.error)
+    {
+        ImGui::TextColored(ImVec4{1.0f, 0.4f, 0.4f, 1.0f}, "Failed to load volume from %s", Config::datasetPath.string().c_str());
+    }
+
+    // Time series
+    if (m_timeSeriesPlaybackState.numSteps > 0 && ImGui::CollapsingHeader("Time Series", ImGuiTreeNodeFlags_DefaultOpen))
+    {
+        MakeCheckbox("Play", &m_timeSeriesPlaybackState.isPlaying);
+        ImGui::Text("Step %zu / %zu", m_timeSeriesPlaybackState.displayedStep + 1, m_timeSeriesPlaybackState.numSteps);
+        ImGui::Text("Dropped frames: %llu", static_cast<unsigned long long>(m_timeSeriesPlaybackState.numDroppedFrames));
+    }
+
+    if (m_timeSeriesPlaybackState.error)
+    {
+        ImGui::TextColored(ImVec4{1.0f, 0.4f, 0.4f, 1.0f}, "Failed to read time series from %s", Config::timeSeriesPath.string().c_str());
+    }
+
     // Trackball
     if (ImGui::CollapsingHeader("Camera", ImGuiTreeNodeFlags_OpenOnDoubleClick | ImGuiTreeNodeFlags_OpenOnArrow))
     {
@@ -227,6 +325,105 @@ void Gui::Draw()
     if (ImGui::CollapsingHeader("Rendering", ImGuiTreeNodeFlags_DefaultOpen))
     {
         MakeSliderFloat("Opacity", &m_guiParameters.raycastingDensityMultiplier, 5.0f, 40.0f);
+
+        if (ImGui::BeginCombo("Quality", GetRaycastingQualityName(m_guiParameters.raycastingQuality)))
+        {
+            for (const auto quality : {RaycastingQuality::Interactive, RaycastingQuality::Balanced, RaycastingQuality::High, RaycastingQuality::Reference})
+            {
+                if (ImGui::Selectable(GetRaycastingQualityName(quality), quality == m_guiParameters.raycastingQuality))
+                {
+                    m_guiParameters.raycastingQuality = quality;
+                }
+            }
+            ImGui::EndCombo();
+        }
+
+        MakeCheckbox("Pre-Integration", &m_guiParameters.enablePreIntegration);
+
+        // Frame time averaged by ImGui, against the target of the preset
+        const auto qualitySettings = GetRaycastingQualitySettings(m_guiParameters.raycastingQuality);
+        const float frameTimeInMilliseconds = 1000.0f / std::max(ImGui::GetIO().Framerate, 1.0f);
+        if (qualitySettings.frameTimeTargetInMilliseconds > 0.0f)
+        {
+            ImGui::Text("Frame time: %.1f ms (target %.1f ms)", frameTimeInMilliseconds, qualitySettings.frameTimeTargetInMilliseconds);
+            ImGui::Text("Max. error vs. Reference: %.3f", qualitySettings.maxColorError);
+        }
+        else
+        {
+            ImGui::Text("Frame time: %.1f ms (no target)", frameTimeInMilliseconds);
+        }
+
+        if (Config::volumeQuantizationMode != VolumeData::VolumeQuantizationMode::Off)
+        {
+            MakeSliderFloat("Window Center", &m_guiParameters.volumeWindow.center, 0.0f, 1.0f);
+            MakeSliderFloat("Window Width", &m_guiParameters.volumeWindow.width, 0.001f, 1.0f);
+            if (ImGui::Button("Fit Window to Data"))
+            {
+                m_guiUpdateFlags.volumeWindowFitRequested = true;
+            }
+        }
+    }
+
+    // GPU memory
+    if (ImGui::CollapsingHeader("GPU Memory", ImGuiTreeNodeFlags_OpenOnDoubleClick | ImGuiTreeNodeFlags_OpenOnArrow))
+    {
+        const auto gpuMemoryInfo = QueryGpuMemoryInfo();
+        const size_t usedMemoryInBytes = GetGpuMemoryUsageInBytes(m_textureStorage, m_frameBufferStorage);
+        const auto budgetInBytes = GetGpuMemoryBudgetInBytes(gpuMemoryInfo, usedMemoryInBytes);
+
+        ImGui::Text("Used: %.1f MiB", ToMebibytes(usedMemoryInBytes));
+        if (budgetInBytes)
+        {
+            ImGui::Text("Budget: %.1f MiB", ToMebibytes(budgetInBytes.value()));
+        }
+        else
+        {
+            ImGui::TextUnformatted("Budget: not reported by the driver");
+        }
+        if (gpuMemoryInfo.totalMemoryInBytes)
+        {
+            ImGui::Text("Total video memory: %.1f MiB", ToMebibytes(gpuMemoryInfo.totalMemoryInBytes.value()));
+        }
+        if (gpuMemoryInfo.availableMemoryInBytes)
+        {
+            ImGui::Text("Available video memory: %.1f MiB", ToMebibytes(gpuMemoryInfo.availableMemoryInBytes.value()));
+        }
+        ImGui::Text("Max 3D texture size: %u", gpuMemoryInfo.max3DTextureSize);
+
+        if (!m_volumeLoadingProgress.isLoading && m_volumeLoadingProgress.displayedStride > 1)
+        {
+            ImGui::TextColored(ImVec4{1.0f, 0.8f, 0.4f, 1.0f}, "Volume downsampled to 1/%u resolution to fit", m_volumeLoadingProgress.displayedStride);
+        }
+
+        if (ImGui::BeginTable("Textures", 2, Constants::memoryTableFlags))
+        {
+            ImGui::TableSetupColumn("Texture");
+            ImGui::TableSetupColumn("Size");
+            ImGui::TableHeadersRow();
+            for (const auto& texture : m_textureStorage.GetElements())
+            {
+                DrawMemoryTableRow(GetTextureName(texture.GetId()), texture.GetSizeInBytes());
+            }
+            ImGui::EndTable();
+        }
+
+        // Attached textures are listed above as well and only counted once in the total
+        if (ImGui::BeginTable("Framebuffers", 2, Constants::memoryTableFlags))
+        {
+            ImGui::TableSetupColumn("Framebuffer");
+            ImGui::TableSetupColumn("Size");
+            ImGui::TableHeadersRow();
+            for (const auto& frameBuffer : m_frameBufferStorage.GetElements())
+            {
+                size_t frameBufferSizeInBytes = frameBuffer.GetRenderBufferSizeInBytes();
+                for (const auto textureId : frameBuffer.GetAttachedTextureIds())
+                {
+                    frameBufferSizeInBytes += m_textureStorage.GetElement(textureId).GetSizeInBytes();
+                }
+                DrawMemoryTableRow(GetFrameBufferName(frameBuffer.GetId()), frameBufferSizeInBytes);
+            }
+            ImGui::EndTable();
+        }
     }
 
     ImGui::End();
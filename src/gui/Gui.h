@@ -14,10 +14,18 @@
 #include <imgui_impl_opengl3.h>
 
 #include <context/GlfwWindowTypes.h>
+#include <storage/StorageTypes.h>
 
 struct GuiParameters;
 struct GuiUpdateFlags;
 
+namespace VolumeData
+{
+    class VolumeHandle;
+    struct TimeSeriesPlaybackState;
+    struct VolumeLoadingProgress;
+}
+
 /**
 * \class Gui
 *
@@ -29,7 +37,8 @@ struct GuiUpdateFlags;
 * need regeneration (e.g., SSAO noise texture, transfer function texture).
 *
 * The GUI is organized into collapsing sections for different parameter categories.
-* Also includes a transfer function editor for interactive control point manipulation.
+* Also includes a transfer function editor for interactive control point manipulation,
+* and a breakdown of the video memory used by each texture and framebuffer.
 *
 * @see GuiParameters for the parameter structure that stores all GUI values.
 * @see GuiUpdateFlags for signaling when resources need updates.
@@ -44,8 +53,13 @@ public:
     * @param window The GLFW window reference for ImGui initialization.
     * @param guiParameters Reference to GUI parameters that will be modified by the GUI.
     * @param guiUpdateFlags Reference to update flags that signal when resources need regeneration.
+    * @param volumeLoadingProgress Reference to the background volume loading progress to display.
+    * @param volumeData Reference to the handle of the volume whose histogram the transfer function editor displays.
+    * @param timeSeriesPlaybackState Reference to the time series playback state to display and control.
+    * @param textureStorage Reference to the textures whose video memory to display.
+    * @param frameBufferStorage Reference to the framebuffers whose video memory to display.
     */
-    Gui(const Context::WindowPtr& window, GuiParameters& guiParameters, GuiUpdateFlags& guiUpdateFlags);
+    Gui(const Context::WindowPtr& window, GuiParameters& guiParameters, GuiUpdateFlags& guiUpdateFlags, const VolumeData::VolumeLoadingProgress& volumeLoadingProgress, const VolumeData::VolumeHandle& volumeData, VolumeData::TimeSeriesPlaybackState& timeSeriesPlaybackState, const TextureStorage& textureStorage, const FrameBufferStorage& frameBufferStorage);
 
     /**
     * Shuts down ImGui and cleans up resources.
@@ -61,10 +75,30 @@ public:
 
     float GetGuiWidth() const;
 
+    /**
+    * Checks whether the GUI has input to process, using only the public ImGuiIO state and GLFW.
+    * Input is pending while the mouse moved or scrolled in the last GUI frame, characters are
+    * queued, a text field is active, or the cursor position or mouse buttons differ from those
+    * the GUI saw in its last frame. Sticky mouse buttons are enabled, so that a click while the
+    * application is idle is detected even if the button was released before this check.
+    * @return bool True if the next Draw() has mouse or keyboard input to process.
+    */
+    bool HasPendingInput() const;
+
+    /**
+    * Checks whether the transfer function editor has a finished histogram to display.
+    * @return bool True if the next Draw() displays a new histogram.
+    */
+    bool HasPendingHistogram() const;
+
 private:
     const Context::WindowPtr& m_window; /**< The GLFW window for ImGui rendering. */
     GuiParameters& m_guiParameters; /**< Reference to GUI parameters modified by the interface. */
     GuiUpdateFlags& m_guiUpdateFlags; /**< Reference to flags indicating when resources need updates. */
+    const VolumeData::VolumeLoadingProgress& m_volumeLoadingProgress; /**< Reference to the background volume loading progress. */
+    VolumeData::TimeSeriesPlaybackState& m_timeSeriesPlaybackState; /**< Reference to the time series playback state. */
+    const TextureStorage& m_textureStorage; /**< Reference to the textures whose video memory is displayed. */
+    const FrameBufferStorage& m_frameBufferStorage; /**< Reference to the framebuffers whose video memory is displayed. */
     float m_guiWidth; /**< Current width of the GUI panel in pixels. */
     float m_transferFunctionHeight; /**< Current height of the transfer function editor in pixels. */
     TransferFunctionGui m_transferFunctionGui; /**< Transfer function editor widget. */
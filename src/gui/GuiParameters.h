@@ -9,7 +9,9 @@
 
 #include <lights/DirectionalLight.h>
 #include <lights/PointLight.h>
+#include <renderpass/RaycastingQuality.h>
 #include <transferfunction/TransferFunction.h>
+#include <volumedata/VolumeWindow.h>
 
 #include <vector>
 
@@ -44,6 +46,11 @@ struct GuiParameters
     bool trackballInvertYAxis; /**< Whether to invert the Y-axis for trackball controls. */
     float trackballSensitivity; /**< Sensitivity multiplier for trackball rotation. */
     float raycastingDensityMultiplier; /**< Density multiplier for volume ray-casting. */
+    VolumeData::VolumeWindow volumeWindow; /**< Window of 16-bit values mapped to the quantized 8-bit volume texture. */
+    RaycastingQuality raycastingQuality; /**< Quality preset of the ray caster, trading frame time for sampling error. */
+    bool enablePreIntegration; /**< Whether ray segments are classified with the pre-integrated transfer function. */
+
+    bool operator==(const GuiParameters&) const = default;
 };
 
 #endif
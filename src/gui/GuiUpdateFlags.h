@@ -14,8 +14,12 @@
 *
 * Contains boolean flags set by the GUI when parameters are modified that require
 * expensive resource updates (e.g., regenerating textures or kernel samples).
-* Updater components (SsaoUpdater, TransferFunctionTextureUpdater) monitor these
-* flags and perform necessary updates, then clear the flags.
+* Updater components (SsaoUpdater, VolumeQuantizationUpdater, OccupancyGridUpdater, GradientVolumeUpdater, PagedVolumeStreamer, TransferFunctionTextureUpdater) monitor these
+* flags and perform necessary updates, then clear the flags. The volumeDataChanged
+* flag is cleared by the ProgressiveVolumeLoader, which runs first in the frame, and set
+* by it or by the TimeSeriesPlayer, which runs right after it. The timeStepChanged flag
+* is set and cleared by the TimeSeriesPlayer alone. The RedrawTracker reads all flags
+* before the updaters clear them, so that any change is drawn.
 *
 * This decouples the GUI from resource management and prevents unnecessary
 * regeneration when parameters haven't changed.
@@ -28,6 +32,10 @@ struct GuiUpdateFlags
 {
     bool ssaoParametersChanged = false; /**< True if SSAO kernel size or radius changed, requiring noise texture regeneration. */
     bool transferFunctionChanged = false; /**< True if transfer function control points changed, requiring texture update. */
+    bool volumeDataChanged = false; /**< True during the frame in which a new volume level was published by the ProgressiveVolumeLoader or a new timestep by the TimeSeriesPlayer. */
+    bool timeStepChanged = false; /**< True during the frame in which the TimeSeriesPlayer presented a new timestep while playing, which replaced only the volume data and its texture. */
+    bool volumeWindowFitRequested = false; /**< True if the volume window should be fitted to the histogram percentiles by the VolumeQuantizationUpdater. */
+    bool redrawRequested = false; /**< True if an updater uploaded results of background work, cleared by the RedrawTracker, which then redraws the scene. */
 };
 
 #endif
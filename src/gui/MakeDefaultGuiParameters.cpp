@@ -15,6 +15,9 @@ GuiParameters Factory::MakeDefaultGuiParameters()
         true,
         Config::defaultTrackballInvertYAxis,
         Config::defaultTrackballSensitivity,
-        Config::defaultRaycastingDensityMultiplier
+        Config::defaultRaycastingDensityMultiplier,
+        Config::defaultVolumeWindow,
+        Config::defaultRaycastingQuality,
+        Config::defaultEnablePreIntegration
     };
 }
\ No newline at end of file
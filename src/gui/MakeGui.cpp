@@ -8,7 +8,12 @@ namespace Factory
         return Gui {
             storage.GetWindow().GetWindow(),
             storage.GetGuiParameters(),
-            storage.GetGuiUpdateFlags()
+            storage.GetGuiUpdateFlags(),
+            storage.GetVolumeLoadingProgress(),
+            storage.GetVolumeData(),
+            storage.GetTimeSeriesPlaybackState(),
+            storage.GetTextureStorage(),
+            storage.GetFrameBufferStorage()
 		};
     }
 }
@@ -1,8 +1,14 @@
 #include <gui/TransferFunctionGui.h>
 #include <gui/GuiUpdateFlags.h>
 
+#include <config/Config.h>
+#include <context/PostEmptyEvent.h>
 #include <transferfunction/InterpolateTransferFunction.h>
 #include <transferfunction/TransferFunction.h>
+#include <volumedata/IsVolumeQuantized.h>
+#include <volumedata/LoadOrComputeVolumeHistogram.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeHandle.h>
 
 #include <glm/gtc/type_ptr.hpp>
 
@@ -12,6 +18,7 @@
 #include <ranges>
 #include <span>
 #include <string>
+#include <utility>
 
 namespace
 {
@@ -27,7 +34,7 @@ namespace Constants
     constexpr float minPointDistance = 0.001f;
 }
 
-TransferFunctionGui::TransferFunctionGui(TransferFunction& transferFunction, GuiUpdateFlags& guiUpdateFlags)
+TransferFunctionGui::TransferFunctionGui(TransferFunction& transferFunction, GuiUpdateFlags& guiUpdateFlags, const VolumeData::VolumeHandle& volumeData, const VolumeData::VolumeWindow& volumeWindow)
     : m_wasClicked{false}
     , m_numActivePoints{0}
     , m_draggedPointIndex{std::nullopt}
@@ -40,16 +47,78 @@ TransferFunctionGui::TransferFunctionGui(TransferFunction& transferFunction, Gui
     , m_mousePos{}
     , m_transferFunction{transferFunction}
     , m_guiUpdateFlags{guiUpdateFlags}
+    , m_volumeData{volumeData}
+    , m_volumeWindow{volumeWindow}
+    , m_volumeHistogram{}
+    , m_isHistogramRequested{false}
+    , m_mutex{}
+    , m_isComputingHistogram{false}
+    , m_pendingHistogram{std::nullopt}
+    , m_workerThread{}
 {
 }
 
 void TransferFunctionGui::Update()
 {
+    UpdateHistogram();
     PrepareInteraction();
     HandleInteraction();
     Draw();
 }
 
+bool TransferFunctionGui::HasPendingHistogram() const
+{
+    std::lock_guard lock{m_mutex};
+    return m_pendingHistogram.has_value();
+}
+
+void TransferFunctionGui::UpdateHistogram()
+{
+    if (m_guiUpdateFlags.volumeDataChanged)
+    {
+        m_isHistogramRequested = false;
+    }
+
+    std::optional<VolumeData::VolumeHistogram> pendingHistogram;
+    bool isComputingHistogram = false;
+    {
+        std::lock_guard lock{m_mutex};
+        pendingHistogram = std::exchange(m_pendingHistogram, std::nullopt);
+        isComputingHistogram = m_isComputingHistogram;
+    }
+
+    if (pendingHistogram)
+    {
+        m_volumeHistogram = std::move(pendingHistogram.value());
+    }
+
+    // A volume loaded before the first frame does not raise the flag, so the first valid volume is requested as well.
+    // The worker holds its own handle, so the volume it reads stays alive even if it is replaced before the worker is done.
+    if (m_isHistogramRequested || isComputingHistogram || !m_volumeData->IsValid())
+    {
+        return;
+    }
+
+    m_isHistogramRequested = true;
+    {
+        std::lock_guard lock{m_mutex};
+        m_isComputingHistogram = true;
+    }
+    m_workerThread = std::jthread{[this](VolumeData::VolumeHandle volumeData) { ComputeHistogramInBackground(std::move(volumeData)); }, m_volumeData};
+}
+
+void TransferFunctionGui::ComputeHistogramInBackground(VolumeData::VolumeHandle volumeData)
+{
+    auto volumeHistogram = VolumeData::LoadOrComputeVolumeHistogram(*volumeData, Config::transferFunctionGuiHistogramNumBins);
+
+    {
+        std::lock_guard lock{m_mutex};
+        m_pendingHistogram = std::move(volumeHistogram);
+        m_isComputingHistogram = false;
+    }
+    Context::PostEmptyEvent();
+}
+
 void TransferFunctionGui::PrepareInteraction()
 {
     m_plotSize = ImGui::GetContentRegionAvail();
@@ -190,6 +259,7 @@ void TransferFunctionGui::Draw()
     auto& drawList = *ImGui::GetWindowDrawList();
     DrawBackground(drawList);
     DrawGrid(drawList);
+    DrawHistogram(drawList);
     DrawColorGradient(drawList);
     DrawOpacityCurve(drawList);
     DrawControlPoints(drawList);
@@ -214,6 +284,46 @@ void TransferFunctionGui::DrawGrid(ImDrawList& drawList)
     }
 }
 
+void TransferFunctionGui::DrawHistogram(ImDrawList& drawList)
+{
+    if (m_volumeHistogram.IsEmpty())
+    {
+        return;
+    }
+
+    // Log scale, as the background bins of most volumes dwarf everything else
+    const auto counts = m_volumeHistogram.GetCounts(0);
+    const auto logMaxCount = std::log1p(static_cast<float>(m_volumeHistogram.GetMaxCount(0)));
+    if (logMaxCount <= 0.0f)
+    {
+        return;
+    }
+
+    const auto isQuantized = VolumeData::IsVolumeQuantized(m_volumeData->GetMetadata());
+    const auto GetBinPosition = [&](size_t bin)
+    {
+        const auto value = static_cast<float>(bin) / static_cast<float>(counts.size());
+        return m_plotPos.x + (isQuantized ? m_volumeWindow.Apply(value) : value) * m_plotSize.x;
+    };
+
+    const auto baseline = m_plotPos.y + m_interactiveAreaHeight;
+
+    for (auto bin = size_t{0}; bin < counts.size(); ++bin)
+    {
+        const auto x0 = GetBinPosition(bin);
+        const auto x1 = GetBinPosition(bin + 1);
+
+        // Bins clamped by the window collapse to zero width
+        if (x1 <= x0)
+        {
+            continue;
+        }
+
+        const auto height = std::log1p(static_cast<float>(counts[bin])) / logMaxCount * m_interactiveAreaHeight;
+        drawList.AddRectFilled(ImVec2(x0, baseline - height), ImVec2(x1, baseline), IM_COL32(110, 110, 110, 140));
+    }
+}
+
 void TransferFunctionGui::DrawColorGradient(ImDrawList& drawList)
 {
     const auto activePoints = std::span{m_transferFunction.GetControlPoints().data(), m_numActivePoints};
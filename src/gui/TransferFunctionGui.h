@@ -7,9 +7,15 @@
 #ifndef TRANSFER_FUNCTION_GUI_H
 #define TRANSFER_FUNCTION_GUI_H
 
+#include <volumedata/VolumeHandle.h>
+#include <volumedata/VolumeHistogram.h>
+#include <volumedata/VolumeWindow.h>
+
 #include <imgui.h>
 
+#include <mutex>
 #include <optional>
+#include <thread>
 
 struct GuiUpdateFlags;
 class TransferFunction;
@@ -27,6 +33,11 @@ class TransferFunction;
 * - Change colors via color picker
 *
 * The widget displays a color gradient at the bottom and an opacity curve above it.
+* Behind the curve, the log-scaled histogram of the first volume component is drawn.
+* It is computed on a background thread once per published volume, i.e. whenever
+* GuiUpdateFlags::volumeDataChanged is set. Volumes published while a job is running are
+* coalesced into a single follow-up job for the latest volume. For quantized volumes,
+* the bins are mapped through the volume window, like the values in the texture.
 * Control points are shown as draggable circles. Mouse interactions are tracked to
 * provide visual feedback (hover effects, cursor changes).
 *
@@ -36,6 +47,7 @@ class TransferFunction;
 * @see TransferFunction for control point storage and manipulation.
 * @see GuiUpdateFlags for change notification.
 * @see TransferFunctionTextureUpdater for texture updates.
+* @see ComputeVolumeHistogram for the histogram computation.
 */
 class TransferFunctionGui
 {
@@ -44,8 +56,15 @@ public:
     * Constructor.
     * @param transferFunction Reference to the transfer function to edit.
     * @param guiUpdateFlags Reference to GUI update flags for change notification.
+    * @param volumeData Reference to the handle of the volume whose histogram is displayed.
+    * @param volumeWindow Reference to the window quantized volumes are mapped through.
     */
-    TransferFunctionGui(TransferFunction& transferFunction, GuiUpdateFlags& guiUpdateFlags);
+    TransferFunctionGui(TransferFunction& transferFunction, GuiUpdateFlags& guiUpdateFlags, const VolumeData::VolumeHandle& volumeData, const VolumeData::VolumeWindow& volumeWindow);
+
+    TransferFunctionGui(const TransferFunctionGui&) = delete;
+    TransferFunctionGui& operator=(const TransferFunctionGui&) = delete;
+    TransferFunctionGui(TransferFunctionGui&&) = delete;
+    TransferFunctionGui& operator=(TransferFunctionGui&&) = delete;
 
     /**
     * Updates and renders the transfer function editor.
@@ -54,7 +73,24 @@ public:
     */
     void Update();
 
+    /**
+    * Checks whether a finished histogram is waiting to be picked up by the next Update().
+    * @return bool True if the next Update() displays a new histogram.
+    */
+    bool HasPendingHistogram() const;
+
 private:
+    /**
+    * Picks up a finished histogram and starts a background job if the volume data changed.
+    */
+    void UpdateHistogram();
+
+    /**
+    * Worker thread entry point.
+    * @param volumeData Handle of the volume to compute the histogram of, shared with the Storage for the lifetime of the worker.
+    */
+    void ComputeHistogramInBackground(VolumeData::VolumeHandle volumeData);
+
     /**
     * Prepares cached values for interaction handling.
     */
@@ -100,6 +136,11 @@ private:
     */
     void DrawGrid(ImDrawList& drawList);
 
+    /**
+    * Draws the log-scaled volume histogram behind the opacity curve.
+    */
+    void DrawHistogram(ImDrawList& drawList);
+
     /**
     * Draws the interpolated color gradient at the bottom.
     */
@@ -144,6 +185,14 @@ private:
     ImVec2 m_mousePos; /**< Current mouse position in screen coordinates. */
     TransferFunction& m_transferFunction; /**< Reference to the transfer function being edited. */
     GuiUpdateFlags& m_guiUpdateFlags; /**< Reference to GUI update flags for change notification. */
+    const VolumeData::VolumeHandle& m_volumeData; /**< Reference to the handle of the volume whose histogram is displayed. */
+    const VolumeData::VolumeWindow& m_volumeWindow; /**< Reference to the window quantized volumes are mapped through. */
+    VolumeData::VolumeHistogram m_volumeHistogram; /**< Cached histogram of the volume data. */
+    bool m_isHistogramRequested; /**< Whether a histogram was requested for the current volume, so that an empty result is not requested again. */
+    mutable std::mutex m_mutex; /**< Guards the members shared with the worker thread below. */
+    bool m_isComputingHistogram; /**< Whether a background job is running. */
+    std::optional<VolumeData::VolumeHistogram> m_pendingHistogram; /**< Finished histogram not yet displayed. */
+    std::jthread m_workerThread; /**< Background histogram thread, declared last so it is joined first. */
 };
 
 #endif
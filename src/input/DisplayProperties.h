@@ -26,6 +26,8 @@
 struct DisplayProperties
 {
     bool showSsaoMap; /**< If true, displays the SSAO map instead of the final composited image. */
+
+    bool operator==(const DisplayProperties&) const = default;
 };
 
 #endif
@@ -32,6 +32,8 @@ struct DirectionalLight
     glm::vec3 diffuse; /**< Diffuse color component. */
     glm::vec3 specular; /**< Specular color component. */
     float intensity; /**< Light intensity multiplier. */
+
+    bool operator==(const DirectionalLight&) const = default;
 };
 
 #endif
@@ -64,6 +64,10 @@ namespace Persistence
         // General rendering parameters
         ShowLightSources,       /**< Whether to render light source visualizations. */
         DensityMultiplier,      /**< Volume density multiplier for rendering. */
+        WindowCenter,           /**< Center of the volume quantization window. */
+        WindowWidth,            /**< Width of the volume quantization window. */
+        RaycastingQuality,      /**< Quality preset of the ray caster. */
+        PreIntegration,         /**< Whether to use the pre-integrated transfer function. */
 
         Unknown                 /**< Unrecognized key. */
     };
@@ -12,7 +12,7 @@ namespace
         Key enumKey;
     };
 
-    constexpr std::array<ApplicationStateIniFileKeyMapping, 31> applicationStateIniFileKeyLookup =
+    constexpr std::array<ApplicationStateIniFileKeyMapping, 35> applicationStateIniFileKeyLookup =
     {{  
         {"PositionX", Key::PositionX},
         {"PositionY", Key::PositionY},
@@ -44,7 +44,11 @@ namespace
         {"SpecularB", Key::SpecularB},
         {"Intensity", Key::Intensity},
         {"ShowLightSources", Key::ShowLightSources},
-        {"DensityMultiplier", Key::DensityMultiplier}
+        {"DensityMultiplier", Key::DensityMultiplier},
+        {"WindowCenter", Key::WindowCenter},
+        {"WindowWidth", Key::WindowWidth},
+        {"RaycastingQuality", Key::RaycastingQuality},
+        {"PreIntegration", Key::PreIntegration}
     }};
 }
 
@@ -24,6 +24,8 @@ namespace
         case Key::SsaoNoiseSize:
         case Key::SsaoEnable:
         case Key::ShowLightSources:
+        case Key::RaycastingQuality:
+        case Key::PreIntegration:
             return Persistence::ParseValue<unsigned int>(valueString);
         default:
             return Persistence::ParseValue<float>(valueString);
@@ -233,6 +235,18 @@ std::expected<void, Persistence::ApplicationStateIniFileLoadingError> Persistenc
             case Key::DensityMultiplier:
                 guiParameters.raycastingDensityMultiplier = static_cast<float>(value);
                 break;
+            case Key::WindowCenter:
+                guiParameters.volumeWindow.center = static_cast<float>(value);
+                break;
+            case Key::WindowWidth:
+                guiParameters.volumeWindow.width = static_cast<float>(value);
+                break;
+            case Key::RaycastingQuality:
+                guiParameters.raycastingQuality = static_cast<RaycastingQuality>(std::min(static_cast<unsigned int>(value), static_cast<unsigned int>(RaycastingQuality::Reference)));
+                break;
+            case Key::PreIntegration:
+                guiParameters.enablePreIntegration = static_cast<bool>(value);
+                break;
             default:
                 break;
             }
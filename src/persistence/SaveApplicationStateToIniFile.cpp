@@ -105,6 +105,10 @@ std::expected<void, Persistence::ApplicationStateIniFileSavingError> Persistence
     file << SectionNames::rendering << "\n";
     file << "ShowLightSources=" << (guiParameters.showLightSources ? 1 : 0) << "\n";
     file << "DensityMultiplier=" << guiParameters.raycastingDensityMultiplier << "\n";
+    file << "WindowCenter=" << guiParameters.volumeWindow.center << "\n";
+    file << "WindowWidth=" << guiParameters.volumeWindow.width << "\n";
+    file << "RaycastingQuality=" << static_cast<unsigned int>(guiParameters.raycastingQuality) << "\n";
+    file << "PreIntegration=" << (guiParameters.enablePreIntegration ? 1 : 0) << "\n";
     file << "\n";
 
     if (!file.good())
@@ -0,0 +1,34 @@
+#include <renderpass/GetRaycastingQualitySettings.h>
+
+RaycastingQualitySettings GetRaycastingQualitySettings(RaycastingQuality raycastingQuality)
+{
+    switch (raycastingQuality)
+    {
+        case RaycastingQuality::Interactive:
+            return RaycastingQualitySettings{0.5f, true, 16, 1000.0f / 60.0f, 0.04f, 0.5f, 1.0f};
+        case RaycastingQuality::Balanced:
+            return RaycastingQualitySettings{1.0f, true, 8, 1000.0f / 30.0f, 0.02f, 0.5f, 0.5f};
+        case RaycastingQuality::High:
+            return RaycastingQualitySettings{2.0f, true, 4, 100.0f, 0.01f, 0.5f, 0.25f};
+        case RaycastingQuality::Reference:
+        default:
+            return RaycastingQualitySettings{4.0f, false, 1, 0.0f, 0.0f, 1.0f, 1.0f};
+    }
+}
+
+const char* GetRaycastingQualityName(RaycastingQuality raycastingQuality)
+{
+    switch (raycastingQuality)
+    {
+        case RaycastingQuality::Interactive:
+            return "Interactive";
+        case RaycastingQuality::Balanced:
+            return "Balanced";
+        case RaycastingQuality::High:
+            return "High";
+        case RaycastingQuality::Reference:
+            return "Reference";
+        default:
+            return "Unknown";
+    }
+}
@@ -0,0 +1,27 @@
+/**
+* \file GetRaycastingQualitySettings.h
+*
+* \brief Functions for looking up the settings and names of the ray-casting quality presets.
+*/
+
+#ifndef GET_RAYCASTING_QUALITY_SETTINGS_H
+#define GET_RAYCASTING_QUALITY_SETTINGS_H
+
+#include <renderpass/RaycastingQuality.h>
+#include <renderpass/RaycastingQualitySettings.h>
+
+/**
+* Gets the sampling parameters and targets of a quality preset.
+* @param raycastingQuality The preset.
+* @return RaycastingQualitySettings The settings of the preset.
+*/
+RaycastingQualitySettings GetRaycastingQualitySettings(RaycastingQuality raycastingQuality);
+
+/**
+* Gets a readable name of a quality preset for display in the GUI.
+* @param raycastingQuality The preset.
+* @return const char* The name, matching the RaycastingQuality enumerator.
+*/
+const char* GetRaycastingQualityName(RaycastingQuality raycastingQuality);
+
+#endif
@@ -0,0 +1,18 @@
+#include <renderpass/GetRaycastingStepMultiplier.h>
+#include <renderpass/RaycastingQualitySettings.h>
+
+#include <algorithm>
+#include <cmath>
+
+uint32_t GetRaycastingStepMultiplier(float sampleLod, uint32_t brickNyquistSteps, const RaycastingQualitySettings& qualitySettings)
+{
+    if (!qualitySettings.enableAdaptiveSampling)
+    {
+        return 1;
+    }
+
+    const auto brickMultiplier = (brickNyquistSteps > 1) ? static_cast<int>(static_cast<float>(brickNyquistSteps) * qualitySettings.samplingRate) : 1;
+    const auto distanceMultiplier = (sampleLod < 1.0f) ? 1 : static_cast<int>(std::exp2(std::floor(sampleLod)) * qualitySettings.samplingRate);
+
+    return static_cast<uint32_t>(std::clamp(std::max(brickMultiplier, distanceMultiplier), 1, static_cast<int>(std::max(qualitySettings.maxStepMultiplier, 1u))));
+}
@@ -0,0 +1,33 @@
+/**
+* \file GetRaycastingStepMultiplier.h
+*
+* \brief Function for choosing how many base steps one ray sample spans under adaptive sampling.
+*/
+
+#ifndef GET_RAYCASTING_STEP_MULTIPLIER_H
+#define GET_RAYCASTING_STEP_MULTIPLIER_H
+
+#include <cstdint>
+
+struct RaycastingQualitySettings;
+
+/**
+* Computes the number of base steps to the next sample, like GetStepMultiplier() in Volume.frag.
+*
+* The brick and the distance terms count Nyquist steps: the number of Nyquist steps the brick's
+* value range allows, and the Nyquist step of the mip level sampled at the given level of detail.
+* A term only spreads the samples out once it allows more than one Nyquist step. Otherwise the
+* base step of the preset is kept, so that presets sampling above the Nyquist rate keep their rate.
+* The shader additionally ends a step spanning a smooth brick at the brick's exit.
+*
+* @param sampleLod The mip level whose voxels cover about one pixel at the sample position, at least 0.
+* @param brickNyquistSteps The number of Nyquist steps one sample may span within the brick, at least 1.
+* @param qualitySettings The settings of the active quality preset.
+* @return uint32_t The number of base steps, between 1 and qualitySettings.maxStepMultiplier, or 1 without adaptive sampling.
+*
+* @see ComputeBrickStepMultipliers for the brick term.
+* @see RaycastingQualitySettings for the base step.
+*/
+uint32_t GetRaycastingStepMultiplier(float sampleLod, uint32_t brickNyquistSteps, const RaycastingQualitySettings& qualitySettings);
+
+#endif
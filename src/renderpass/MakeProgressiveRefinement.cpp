@@ -0,0 +1,13 @@
+#include <renderpass/MakeProgressiveRefinement.h>
+
+#include <config/Config.h>
+#include <storage/Storage.h>
+
+ProgressiveRefinement Factory::MakeProgressiveRefinement(Storage& storage)
+{
+    return ProgressiveRefinement {
+        storage.GetGuiParameters(),
+        Config::progressiveRefinementTileSize,
+        Config::progressiveRefinementBudgetInPixelsPerFrame
+    };
+}
@@ -0,0 +1,28 @@
+/**
+* \file MakeProgressiveRefinement.h
+*
+* \brief Factory function for creating the progressive refinement scheduler.
+*/
+
+#ifndef MAKE_PROGRESSIVE_REFINEMENT_H
+#define MAKE_PROGRESSIVE_REFINEMENT_H
+
+#include <renderpass/ProgressiveRefinement.h>
+
+class Storage;
+
+namespace Factory
+{
+    /**
+    * Creates the progressive refinement scheduler with the tile size and budget from Config.
+    *
+    * @param storage Storage containing the GUI parameters.
+    * @return Initialized ProgressiveRefinement object.
+    *
+    * @see ProgressiveRefinement for the scheduling.
+    * @see Config::progressiveRefinementBudgetInPixelsPerFrame for the number of pixels refined per frame.
+    */
+    ProgressiveRefinement MakeProgressiveRefinement(Storage& storage);
+}
+
+#endif
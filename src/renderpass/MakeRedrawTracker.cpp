@@ -0,0 +1,14 @@
+#include <renderpass/MakeRedrawTracker.h>
+
+#include <storage/Storage.h>
+
+RedrawTracker Factory::MakeRedrawTracker(Storage& storage)
+{
+    return RedrawTracker {
+        storage.GetCamera(),
+        storage.GetDisplayProperties(),
+        storage.GetGuiParameters(),
+        storage.GetGuiUpdateFlags(),
+        storage.GetVolumeLoadingProgress()
+    };
+}
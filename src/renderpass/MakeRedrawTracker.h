@@ -0,0 +1,27 @@
+/**
+* \file MakeRedrawTracker.h
+*
+* \brief Factory function for creating the redraw tracker.
+*/
+
+#ifndef MAKE_REDRAW_TRACKER_H
+#define MAKE_REDRAW_TRACKER_H
+
+#include <renderpass/RedrawTracker.h>
+
+class Storage;
+
+namespace Factory
+{
+    /**
+    * Creates the redraw tracker for skipping frames in which nothing changed.
+    *
+    * @param storage Storage containing the camera, display properties, GUI parameters, GUI update flags and volume loading progress.
+    * @return Initialized RedrawTracker object.
+    *
+    * @see RedrawTracker for the change tracking.
+    */
+    RedrawTracker MakeRedrawTracker(Storage& storage);
+}
+
+#endif
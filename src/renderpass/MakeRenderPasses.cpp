@@ -1,4 +1,7 @@
 #include <renderpass/MakeRenderPasses.h>
+#include <renderpass/GetRaycastingQualitySettings.h>
+#include <renderpass/ProgressiveRefinement.h>
+#include <renderpass/RefinementTile.h>
 #include <renderpass/RenderPassId.h>
 
 #include <buffers/FrameBuffer.h>
@@ -21,8 +24,15 @@
 #include <storage/Storage.h>
 #include <textures/Texture.h>
 #include <textures/TextureId.h>
+#include <volumedata/GetNyquistStepSize.h>
+#include <volumedata/VolumeHandle.h>
+#include <volumedata/VolumeLoadingMode.h>
 
 #include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <cmath>
 
 namespace
 {
@@ -59,45 +69,270 @@ namespace
         };
     }
 
-    RenderPass MakeRaycastingRenderPass(
+    std::vector<std::reference_wrapper<const Texture>> GetRaycastingTextures(const TextureStorage& textureStorage)
+    {
+        return
+        {
+            std::cref(textureStorage.GetElement(TextureId::VolumeData)),
+            std::cref(textureStorage.GetElement(TextureId::TransferFunction)),
+            std::cref(textureStorage.GetElement(TextureId::PreIntegrationTable)),
+            std::cref(textureStorage.GetElement(TextureId::OccupancyGrid)),
+            std::cref(textureStorage.GetElement(TextureId::GradientVolume)),
+            std::cref(textureStorage.GetElement(TextureId::BrickAtlas)),
+            std::cref(textureStorage.GetElement(TextureId::PageTable))
+        };
+    }
+
+    void UpdateRaycastingParametersInShader(
         const Camera& camera,
         const GuiParameters& guiParameters,
+        const Shader& shader,
+        const VolumeData::VolumeHandle& volumeData,
+        float viewportWidth,
+        float viewportHeight,
+        float samplingRateScale)
+    {
+        ShaderUtils::UpdateCameraMatricesInShader(camera, shader, viewportWidth, viewportHeight);
+        shader.SetVec3("cameraPos", camera.GetPosition());
+        shader.SetMat4("model", glm::mat4{ 1.0f });
+        shader.SetFloat("densityMultiplier", guiParameters.raycastingDensityMultiplier);
+        // Paged volumes keep no volume in storage, their step size is set by the PagedVolumeStreamer
+        if (Config::volumeLoadingMode != VolumeData::VolumeLoadingMode::Paged)
+        {
+            shader.SetFloat("nyquistStepSize", VolumeData::GetNyquistStepSize(volumeData->GetMetadata()));
+        }
+        const auto qualitySettings = GetRaycastingQualitySettings(guiParameters.raycastingQuality);
+        shader.SetFloat("samplingRate", qualitySettings.samplingRate * samplingRateScale);
+        shader.SetInt("enableAdaptiveSampling", qualitySettings.enableAdaptiveSampling ? 1 : 0);
+        shader.SetInt("maxStepMultiplier", static_cast<int>(qualitySettings.maxStepMultiplier));
+        shader.SetInt("enablePreIntegration", guiParameters.enablePreIntegration ? 1 : 0);
+        // World-space size of a pixel at unit distance from the camera, for the level of detail selection
+        shader.SetFloat("pixelFootprint", 2.0f * std::tan(0.5f * glm::radians(camera.GetZoom())) / viewportHeight);
+        ShaderUtils::UpdateLightingParametersInShader(guiParameters, shader);
+    }
+
+    RenderPass MakeReducedRaycastingRenderPass(
+        const Camera& camera,
+        const GuiParameters& guiParameters,
+        const ProgressiveRefinement& progressiveRefinement,
         const TextureStorage& textureStorage,
         const ShaderStorage& shaderStorage,
         const FrameBufferStorage& frameBufferStorage,
         const UnitCube& unitCube,
-        float viewportWidth,
-        float viewportHeight
+        const VolumeData::VolumeHandle& volumeData
         )
+    {
+        auto textures = GetRaycastingTextures(textureStorage);
+
+        const auto& shader = shaderStorage.GetElement(ShaderId::Volume);
+
+        auto prepareFunction = [&camera, &guiParameters, &progressiveRefinement, &shader, &volumeData]()
+        {
+            if (!progressiveRefinement.IsInteracting())
+            {
+                return;
+            }
+
+            const auto reducedWidth = progressiveRefinement.GetReducedViewportWidth();
+            const auto reducedHeight = progressiveRefinement.GetReducedViewportHeight();
+            glViewport(0, 0, reducedWidth, reducedHeight);
+            glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+            UpdateRaycastingParametersInShader(camera, guiParameters, shader, volumeData, static_cast<float>(reducedWidth), static_cast<float>(reducedHeight), progressiveRefinement.GetSamplingRateScale());
+        };
+
+        auto renderFunction = [&progressiveRefinement, &unitCube]()
+        {
+            if (progressiveRefinement.IsInteracting())
+            {
+                unitCube.Render();
+            }
+        };
+
+        return
+        {
+            RenderPassId::ReducedVolume,
+            shader,
+            frameBufferStorage.GetElement(FrameBufferId::ReducedVolume),
+            std::move(textures),
+            std::move(prepareFunction),
+            std::move(renderFunction)
+        };
+    }
+
+    RenderPass MakeUpscaleRenderPass(
+        const ProgressiveRefinement& progressiveRefinement,
+        const TextureStorage& textureStorage,
+        const ShaderStorage& shaderStorage,
+        const FrameBufferStorage& frameBufferStorage,
+        const ScreenQuad& screenQuad)
     {
         auto textures = std::vector<std::reference_wrapper<const Texture>>
         {
-            std::cref(textureStorage.GetElement(TextureId::VolumeData)),
-            std::cref(textureStorage.GetElement(TextureId::TransferFunction))
+            std::cref(textureStorage.GetElement(TextureId::ReducedVolumeColor))
         };
+
+        const auto& shader = shaderStorage.GetElement(ShaderId::Upscale);
+
+        auto prepareFunction = [&progressiveRefinement, &shader]()
+        {
+            if (!progressiveRefinement.IsInteracting())
+            {
+                return;
+            }
+
+            glViewport(0, 0, progressiveRefinement.GetViewportWidth(), progressiveRefinement.GetViewportHeight());
+            glClear(GL_DEPTH_BUFFER_BIT);
+            shader.SetVec2("sourceSize", glm::vec2{progressiveRefinement.GetReducedViewportWidth(), progressiveRefinement.GetReducedViewportHeight()});
+        };
+
+        auto renderFunction = [&progressiveRefinement, &screenQuad]()
+        {
+            if (progressiveRefinement.IsInteracting())
+            {
+                screenQuad.Render();
+            }
+        };
+
+        return
+        {
+            RenderPassId::Upscale,
+            shader,
+            frameBufferStorage.GetElement(FrameBufferId::RefinedVolume),
+            std::move(textures),
+            std::move(prepareFunction),
+            std::move(renderFunction)
+        };
+    }
+
+    RenderPass MakeRaycastingRenderPass(
+        const Camera& camera,
+        const GuiParameters& guiParameters,
+        const ProgressiveRefinement& progressiveRefinement,
+        const TextureStorage& textureStorage,
+        const ShaderStorage& shaderStorage,
+        const FrameBufferStorage& frameBufferStorage,
+        const UnitCube& unitCube,
+        const VolumeData::VolumeHandle& volumeData
+        )
+    {
+        auto textures = GetRaycastingTextures(textureStorage);
         
         const auto& shader = shaderStorage.GetElement(ShaderId::Volume);
 
-        auto prepareFunction = [&camera, &guiParameters, &shader, viewportWidth, viewportHeight]()
+        // Sets the uniforms in every frame, the paged volume feedback pass renders with them
+        auto prepareFunction = [&camera, &guiParameters, &progressiveRefinement, &shader, &volumeData]()
         {
+            const auto viewportWidth = progressiveRefinement.GetViewportWidth();
+            const auto viewportHeight = progressiveRefinement.GetViewportHeight();
+            glViewport(0, 0, viewportWidth, viewportHeight);
             glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
-            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-            ShaderUtils::UpdateCameraMatricesInShader(camera, shader, viewportWidth, viewportHeight);
-            shader.SetVec3("cameraPos", camera.GetPosition());
-            shader.SetMat4("model", glm::mat4{ 1.0f });
-            shader.SetFloat("densityMultiplier", guiParameters.raycastingDensityMultiplier);
+            UpdateRaycastingParametersInShader(camera, guiParameters, shader, volumeData, static_cast<float>(viewportWidth), static_cast<float>(viewportHeight), 1.0f);
         };
 
-        auto renderFunction = [&unitCube]()
+        auto renderFunction = [&progressiveRefinement, &unitCube]()
         {
-            unitCube.Render();
+            glEnable(GL_SCISSOR_TEST);
+            for (const auto& tile : progressiveRefinement.GetTiles())
+            {
+                glScissor(tile.x, tile.y, tile.width, tile.height);
+                glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+                unitCube.Render();
+            }
+            glDisable(GL_SCISSOR_TEST);
         };
 
         return 
         {
             RenderPassId::Volume,
             shader,
-            frameBufferStorage.GetElement(FrameBufferId::Default),
+            frameBufferStorage.GetElement(FrameBufferId::RefinedVolume),
+            std::move(textures),
+            std::move(prepareFunction),
+            std::move(renderFunction)
+        };
+    }
+
+    RenderPass MakePresentRenderPass(
+        const Gui& gui,
+        const ProgressiveRefinement& progressiveRefinement,
+        const ShaderStorage& shaderStorage,
+        const FrameBufferStorage& frameBufferStorage)
+    {
+        auto textures = std::vector<std::reference_wrapper<const Texture>>{};
+
+        const auto& shader = shaderStorage.GetElement(ShaderId::SsaoInput);     // Dummy shader
+        const auto& refinedVolumeFrameBuffer = frameBufferStorage.GetElement(FrameBufferId::RefinedVolume);
+        const auto& defaultFrameBuffer = frameBufferStorage.GetElement(FrameBufferId::Default);
+
+        auto prepareFunction = []()
+        {
+            glClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+            glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        };
+
+        auto renderFunction = [&gui, &progressiveRefinement, &refinedVolumeFrameBuffer, &defaultFrameBuffer]()
+        {
+            refinedVolumeFrameBuffer.BlitColorTo(defaultFrameBuffer, progressiveRefinement.GetViewportWidth(), progressiveRefinement.GetViewportHeight(), static_cast<unsigned int>(gui.GetGuiWidth()), 0);
+        };
+
+        return
+        {
+            RenderPassId::Present,
+            shader,
+            defaultFrameBuffer,
+            std::move(textures),
+            std::move(prepareFunction),
+            std::move(renderFunction)
+        };
+    }
+
+    RenderPass MakePagedVolumeFeedbackRenderPass(
+        const ProgressiveRefinement& progressiveRefinement,
+        const TextureStorage& textureStorage,
+        const ShaderStorage& shaderStorage,
+        const FrameBufferStorage& frameBufferStorage,
+        const UnitCube& unitCube
+        )
+    {
+        auto textures = std::vector<std::reference_wrapper<const Texture>>
+        {
+            std::cref(textureStorage.GetElement(TextureId::TransferFunction)),
+            std::cref(textureStorage.GetElement(TextureId::PreIntegrationTable)),
+            std::cref(textureStorage.GetElement(TextureId::BrickAtlas)),
+            std::cref(textureStorage.GetElement(TextureId::PageTable))
+        };
+
+        const auto& shader = shaderStorage.GetElement(ShaderId::Volume);
+
+        auto prepareFunction = [&shader]()
+        {
+            const GLuint noBrick[4] = { 0xFFFFFFFFu, 0, 0, 0 };
+            glClearBufferuiv(GL_COLOR, 1, noBrick);
+            shader.SetInt("writeFeedback", 1);
+        };
+
+        auto renderFunction = [&progressiveRefinement, &shader, &unitCube]()
+        {
+            // Same aspect ratio as the raycasting pass, so the camera matrices it set can be reused
+            const auto feedbackWidth = std::min(static_cast<int>(std::ceil(static_cast<float>(progressiveRefinement.GetViewportWidth()) / Config::pagedVolumeFeedbackDownscale)), static_cast<int>(Config::pagedVolumeFeedbackWidth));
+            const auto feedbackHeight = std::min(static_cast<int>(std::ceil(static_cast<float>(progressiveRefinement.GetViewportHeight()) / Config::pagedVolumeFeedbackDownscale)), static_cast<int>(Config::pagedVolumeFeedbackHeight));
+
+            GLint viewport[4];
+            glGetIntegerv(GL_VIEWPORT, viewport);
+            glViewport(0, 0, feedbackWidth, feedbackHeight);
+
+            unitCube.Render();
+
+            glViewport(viewport[0], viewport[1], viewport[2], viewport[3]);
+            shader.SetInt("writeFeedback", 0);
+        };
+
+        return
+        {
+            RenderPassId::PagedVolumeFeedback,
+            shader,
+            frameBufferStorage.GetElement(FrameBufferId::PagedVolumeFeedback),
             std::move(textures),
             std::move(prepareFunction),
             std::move(renderFunction)
@@ -338,7 +573,7 @@ namespace
 }
 
 
-RenderPasses Factory::MakeRenderPasses(const Gui& gui, const InputHandler& inputHandler, const Storage& storage)
+RenderPasses Factory::MakeRenderPasses(const Gui& gui, const InputHandler& inputHandler, const ProgressiveRefinement& progressiveRefinement, const Storage& storage)
 {
     const auto& camera = storage.GetCamera();
     const auto& displayProperties = storage.GetDisplayProperties();
@@ -346,6 +581,7 @@ RenderPasses Factory::MakeRenderPasses(const Gui& gui, const InputHandler& input
     const auto& ssaoKernel = storage.GetSsaoKernel();
     const auto& screenQuad = storage.GetScreenQuad();
     const auto& unitCube = storage.GetUnitCube();
+    const auto& volumeData = storage.GetVolumeData();
     const auto& textureStorage = storage.GetTextureStorage();
     const auto& shaderStorage = storage.GetShaderStorage();
     const auto& frameBufferStorage = storage.GetFrameBufferStorage();
@@ -353,10 +589,13 @@ RenderPasses Factory::MakeRenderPasses(const Gui& gui, const InputHandler& input
     const auto viewportWidth = static_cast<float>(inputHandler.GetWindowWidth() - static_cast<int>(gui.GetGuiWidth()));
     const auto viewportHeight = static_cast<float>(inputHandler.GetWindowHeight());
 
-    return
+    auto renderPasses = RenderPasses
     {
         MakeSetupRenderPass(gui, inputHandler, shaderStorage, frameBufferStorage),
-        MakeRaycastingRenderPass(camera, guiParameters, textureStorage, shaderStorage, frameBufferStorage, unitCube, viewportWidth, viewportHeight),
+        MakeReducedRaycastingRenderPass(camera, guiParameters, progressiveRefinement, textureStorage, shaderStorage, frameBufferStorage, unitCube, volumeData),
+        MakeUpscaleRenderPass(progressiveRefinement, textureStorage, shaderStorage, frameBufferStorage, screenQuad),
+        MakeRaycastingRenderPass(camera, guiParameters, progressiveRefinement, textureStorage, shaderStorage, frameBufferStorage, unitCube, volumeData),
+        MakePresentRenderPass(gui, progressiveRefinement, shaderStorage, frameBufferStorage),
         // SSAO, light source, and debug passes are currently disabled
         // MakeSsaoInputRenderPass(camera, shaderStorage, frameBufferStorage, unitCube, viewportWidth, viewportHeight),
         // MakeSsaoRenderPass(camera, textureStorage, shaderStorage, frameBufferStorage, screenQuad, viewportWidth, viewportHeight),
@@ -365,4 +604,11 @@ RenderPasses Factory::MakeRenderPasses(const Gui& gui, const InputHandler& input
         // MakeLightSourceRenderPass(camera, guiParameters, shaderStorage, frameBufferStorage, viewportWidth, viewportHeight),
         // MakeDebugRenderPass(displayProperties, textureStorage, shaderStorage, frameBufferStorage, screenQuad)
     };
+
+    if (Config::volumeLoadingMode == VolumeData::VolumeLoadingMode::Paged)
+    {
+        renderPasses.push_back(MakePagedVolumeFeedbackRenderPass(progressiveRefinement, textureStorage, shaderStorage, frameBufferStorage, unitCube));
+    }
+
+    return renderPasses;
 }
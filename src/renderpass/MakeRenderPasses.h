@@ -11,6 +11,7 @@
 
 class Gui;
 class InputHandler;
+class ProgressiveRefinement;
 class Storage;
 
 namespace Factory
@@ -18,22 +19,26 @@ namespace Factory
     /**
     * Creates and configures all render passes for the rendering pipeline.
     *
-    * Constructs the complete sequence of render passes including Setup, Volume,
-    * SSAO Input, SSAO, SSAO Blur, SSAO Final, Light Source, and Debug passes.
+    * Constructs the complete sequence of render passes including Setup, ReducedVolume,
+    * Upscale, Volume, Present, SSAO Input, SSAO, SSAO Blur, SSAO Final, Light Source,
+    * and Debug passes. The volume passes render into offscreen framebuffers as scheduled
+    * by the progressive refinement, and the Present pass copies the result to the screen.
     * Each render pass is configured with appropriate shaders, framebuffers,
     * textures, and rendering functions. The render passes encapsulate all
     * rendering logic for each stage of the pipeline.
     *
     * @param gui GUI component for rendering the user interface.
     * @param inputHandler Input handler for display property queries.
+    * @param progressiveRefinement Progressive refinement deciding which volume passes draw in a frame.
     * @param storage Storage containing all rendering resources (shaders, textures, framebuffers, etc.).
     * @return Vector of configured RenderPass objects indexed by RenderPassId.
     *
     * @see RenderPass for render pass abstraction.
     * @see RenderPassId for render pass identifier enumeration.
+    * @see ProgressiveRefinement for the scheduling of the volume passes.
     * @see Storage for centralized resource management.
     */
-    RenderPasses MakeRenderPasses(const Gui& gui, const InputHandler& inputHandler, const Storage& storage);
+    RenderPasses MakeRenderPasses(const Gui& gui, const InputHandler& inputHandler, const ProgressiveRefinement& progressiveRefinement, const Storage& storage);
 }
 
 #endif
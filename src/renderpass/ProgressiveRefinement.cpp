@@ -0,0 +1,147 @@
+#include <renderpass/ProgressiveRefinement.h>
+#include <config/Config.h>
+#include <gui/GuiParameters.h>
+#include <renderpass/GetRaycastingQualitySettings.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+    /// Squared distance of the tile center to the viewport center, in doubled pixels to stay integral
+    unsigned long long GetSquaredDistanceToCenter(const RefinementTile& tile, unsigned int viewportWidth, unsigned int viewportHeight)
+    {
+        const long long distanceX = 2LL * tile.x + tile.width - viewportWidth;
+        const long long distanceY = 2LL * tile.y + tile.height - viewportHeight;
+        return static_cast<unsigned long long>(distanceX * distanceX + distanceY * distanceY);
+    }
+
+    unsigned int ScaleToPixels(unsigned int size, float scale)
+    {
+        return std::max(1u, static_cast<unsigned int>(std::lround(static_cast<float>(size) * scale)));
+    }
+} // anonymous namespace
+
+ProgressiveRefinement::ProgressiveRefinement(const GuiParameters& guiParameters, unsigned int tileSize, size_t budgetInPixelsPerFrame)
+    : m_guiParameters{guiParameters}
+    , m_tileSize{std::max(tileSize, 1u)}
+    , m_budgetInPixelsPerFrame{budgetInPixelsPerFrame}
+    , m_viewportWidth{0}
+    , m_viewportHeight{0}
+    , m_tiles{}
+    , m_firstFrameTile{0}
+    , m_numRefinedTiles{0}
+    , m_isInteracting{false}
+{
+}
+
+void ProgressiveRefinement::Update(bool hasSceneChanged, unsigned int viewportWidth, unsigned int viewportHeight)
+{
+    const bool hasViewportChanged = viewportWidth != m_viewportWidth || viewportHeight != m_viewportHeight;
+    if (hasViewportChanged)
+    {
+        MakeTiles(viewportWidth, viewportHeight);
+    }
+
+    m_isInteracting = false;
+    m_firstFrameTile = m_numRefinedTiles;
+
+    if (hasSceneChanged || hasViewportChanged)
+    {
+        m_firstFrameTile = 0;
+
+        // Without a reduced image to start from, the whole viewport is rendered at once
+        if (!IsReducedDuringInteraction())
+        {
+            m_numRefinedTiles = m_tiles.size();
+            return;
+        }
+
+        m_numRefinedTiles = 0;
+        m_isInteracting = true;
+        return;
+    }
+
+    size_t numPixels = 0;
+    while (m_numRefinedTiles < m_tiles.size())
+    {
+        const auto& tile = m_tiles[m_numRefinedTiles];
+        const size_t numTilePixels = static_cast<size_t>(tile.width) * tile.height;
+        if (m_numRefinedTiles > m_firstFrameTile && numPixels + numTilePixels > m_budgetInPixelsPerFrame)
+        {
+            break;
+        }
+        numPixels += numTilePixels;
+        ++m_numRefinedTiles;
+    }
+}
+
+bool ProgressiveRefinement::IsInteracting() const
+{
+    return m_isInteracting;
+}
+
+bool ProgressiveRefinement::IsComplete() const
+{
+    return !m_isInteracting && m_numRefinedTiles == m_tiles.size();
+}
+
+float ProgressiveRefinement::GetResolutionScale() const
+{
+    return GetRaycastingQualitySettings(m_guiParameters.raycastingQuality).interactionResolutionScale;
+}
+
+float ProgressiveRefinement::GetSamplingRateScale() const
+{
+    return GetRaycastingQualitySettings(m_guiParameters.raycastingQuality).interactionSamplingRateScale;
+}
+
+unsigned int ProgressiveRefinement::GetViewportWidth() const
+{
+    return m_viewportWidth;
+}
+
+unsigned int ProgressiveRefinement::GetViewportHeight() const
+{
+    return m_viewportHeight;
+}
+
+unsigned int ProgressiveRefinement::GetReducedViewportWidth() const
+{
+    return ScaleToPixels(m_viewportWidth, GetResolutionScale());
+}
+
+unsigned int ProgressiveRefinement::GetReducedViewportHeight() const
+{
+    return ScaleToPixels(m_viewportHeight, GetResolutionScale());
+}
+
+std::span<const RefinementTile> ProgressiveRefinement::GetTiles() const
+{
+    return std::span<const RefinementTile>{m_tiles}.subspan(m_firstFrameTile, m_numRefinedTiles - m_firstFrameTile);
+}
+
+void ProgressiveRefinement::MakeTiles(unsigned int viewportWidth, unsigned int viewportHeight)
+{
+    m_viewportWidth = viewportWidth;
+    m_viewportHeight = viewportHeight;
+    m_tiles.clear();
+
+    for (unsigned int y = 0; y < viewportHeight; y += m_tileSize)
+    {
+        for (unsigned int x = 0; x < viewportWidth; x += m_tileSize)
+        {
+            m_tiles.push_back(RefinementTile{x, y, std::min(m_tileSize, viewportWidth - x), std::min(m_tileSize, viewportHeight - y)});
+        }
+    }
+
+    std::ranges::stable_sort(m_tiles, {}, [viewportWidth, viewportHeight](const RefinementTile& tile)
+    {
+        return GetSquaredDistanceToCenter(tile, viewportWidth, viewportHeight);
+    });
+}
+
+bool ProgressiveRefinement::IsReducedDuringInteraction() const
+{
+    return Config::enableProgressiveRefinement && (GetResolutionScale() < 1.0f || GetSamplingRateScale() < 1.0f);
+}
@@ -0,0 +1,130 @@
+/**
+* \file ProgressiveRefinement.h
+*
+* \brief Schedules low-resolution ray casting during interaction and tiled refinement at rest.
+*/
+
+#ifndef PROGRESSIVE_REFINEMENT_H
+#define PROGRESSIVE_REFINEMENT_H
+
+#include <renderpass/RefinementTile.h>
+
+#include <cstddef>
+#include <span>
+#include <vector>
+
+struct GuiParameters;
+
+/**
+* \class ProgressiveRefinement
+*
+* \brief Decides per frame whether the volume is ray cast at reduced quality or which tiles are refined.
+*
+* In a frame in which the scene changed, the volume is ray cast at the interaction
+* resolution and sampling rate of the quality preset, and upscaled to the viewport. In
+* the following frames, the viewport is refined tile by tile at full resolution and
+* sampling rate, starting at the center, where the volume usually is. Each frame refines
+* whole tiles up to the pixel budget, and at least one tile, until the viewport is
+* complete. A change restarts from the reduced image.
+*
+* Presets that do not reduce the quality during interaction, and all presets if
+* Config::enableProgressiveRefinement is false, render the whole viewport at full quality
+* in the frame of the change.
+*
+* Only the scheduling lives here, the render passes created by Factory::MakeRenderPasses
+* act on it.
+*
+* @see RaycastingQualitySettings for the interaction resolution and sampling rate of a preset.
+* @see RedrawTracker for detecting changes of the scene.
+* @see Factory::MakeProgressiveRefinement for construction from Storage.
+*/
+class ProgressiveRefinement
+{
+public:
+    /**
+    * Constructor.
+    * The viewport counts as complete until the first call of Update().
+    * @param guiParameters Reference to the GUI parameters holding the quality preset.
+    * @param tileSize Edge length of the refinement tiles in pixels.
+    * @param budgetInPixelsPerFrame Number of pixels refined per frame.
+    */
+    ProgressiveRefinement(const GuiParameters& guiParameters, unsigned int tileSize, size_t budgetInPixelsPerFrame);
+
+    /**
+    * Advances the refinement by one frame.
+    * Should be called once per frame in which the scene is rendered, before the render passes.
+    * @param hasSceneChanged Whether the scene changed since the last rendered frame.
+    * @param viewportWidth The width of the viewport in pixels.
+    * @param viewportHeight The height of the viewport in pixels.
+    * @return void
+    */
+    void Update(bool hasSceneChanged, unsigned int viewportWidth, unsigned int viewportHeight);
+
+    /**
+    * Checks whether the volume is ray cast at reduced quality in the current frame.
+    * @return bool True in the frame of a change, if the preset reduces the quality during interaction.
+    */
+    bool IsInteracting() const;
+
+    /**
+    * Checks whether the whole viewport has been refined since the last change.
+    * @return bool True if no more frames are needed.
+    */
+    bool IsComplete() const;
+
+    /**
+    * Gets the fraction of the viewport resolution rendered while interacting.
+    * @return float The resolution scale of the quality preset.
+    */
+    float GetResolutionScale() const;
+
+    /**
+    * Gets the fraction of the sampling rate used while interacting.
+    * @return float The sampling rate scale of the quality preset.
+    */
+    float GetSamplingRateScale() const;
+
+    /**
+    * Gets the size of the viewport passed to the last Update().
+    * @return unsigned int The width or height in pixels.
+    */
+    unsigned int GetViewportWidth() const;
+    unsigned int GetViewportHeight() const;
+
+    /**
+    * Gets the size of the image ray cast while interacting, the viewport size scaled by GetResolutionScale().
+    * @return unsigned int The width or height in pixels, at least one.
+    */
+    unsigned int GetReducedViewportWidth() const;
+    unsigned int GetReducedViewportHeight() const;
+
+    /**
+    * Gets the tiles to refine in the current frame.
+    * @return std::span<const RefinementTile> The tiles, empty while interacting and once complete.
+    */
+    std::span<const RefinementTile> GetTiles() const;
+
+private:
+    /**
+    * Splits the viewport into tiles, sorted by the distance of their centers to the viewport center.
+    */
+    void MakeTiles(unsigned int viewportWidth, unsigned int viewportHeight);
+
+    /**
+    * Checks whether the current preset reduces the resolution or sampling rate during interaction.
+    */
+    bool IsReducedDuringInteraction() const;
+
+private:
+    const GuiParameters& m_guiParameters; /**< Reference to the GUI parameters holding the quality preset. */
+    unsigned int m_tileSize; /**< Edge length of the refinement tiles in pixels. */
+    size_t m_budgetInPixelsPerFrame; /**< Number of pixels refined per frame. */
+    unsigned int m_viewportWidth; /**< Width of the viewport the tiles were made for. */
+    unsigned int m_viewportHeight; /**< Height of the viewport the tiles were made for. */
+    std::vector<RefinementTile> m_tiles; /**< All tiles of the viewport in refinement order. */
+    size_t m_firstFrameTile; /**< Index of the first tile refined in the current frame. */
+    size_t m_numRefinedTiles; /**< Number of tiles refined since the last change, including the current frame. */
+    bool m_isInteracting; /**< Whether the current frame is ray cast at reduced quality. */
+};
+
+#endif
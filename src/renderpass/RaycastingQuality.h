@@ -0,0 +1,30 @@
+/**
+* \file RaycastingQuality.h
+*
+* \brief Enumeration of the quality presets of the volume ray caster.
+*/
+
+#ifndef RAYCASTING_QUALITY_H
+#define RAYCASTING_QUALITY_H
+
+/**
+* \enum RaycastingQuality
+*
+* \brief Selects a trade-off between the frame time and the sampling error of the ray caster.
+*
+* Each preset maps to a sampling rate relative to the Nyquist rate of the volume, a limit
+* on how far adaptive sampling may spread samples apart, and the frame time and error the
+* settings are chosen to meet.
+*
+* @see GetRaycastingQualitySettings for the settings of each preset.
+* @see GuiParameters for the selected preset.
+*/
+enum class RaycastingQuality
+{
+    Interactive, /**< Half the Nyquist rate with wide adaptive steps, for 60 frames per second. */
+    Balanced,    /**< The Nyquist rate with adaptive steps, for 30 frames per second. */
+    High,        /**< Twice the Nyquist rate with narrow adaptive steps, for stills. */
+    Reference    /**< Four times the Nyquist rate without adaptive steps, the baseline the errors are measured against. */
+};
+
+#endif
@@ -0,0 +1,45 @@
+/**
+* \file RaycastingQualitySettings.h
+*
+* \brief Sampling parameters and targets of a ray-casting quality preset.
+*/
+
+#ifndef RAYCASTING_QUALITY_SETTINGS_H
+#define RAYCASTING_QUALITY_SETTINGS_H
+
+#include <cstdint>
+
+/**
+* \struct RaycastingQualitySettings
+*
+* \brief Parameters the ray caster runs with under a quality preset, and the targets they are chosen to meet.
+*
+* The base step along a ray is GetNyquistStepSize() / samplingRate. With adaptive sampling,
+* a sample may span several base steps where the data varies slowly or a pixel covers many
+* voxels, up to maxStepMultiplier. Opacities are corrected for the step length, so the
+* presets differ in sampling error only, not in brightness.
+*
+* While the scene changes, the ray caster renders at interactionResolutionScale of the
+* viewport resolution and interactionSamplingRateScale of the sampling rate, and refines
+* to the full settings once it comes to rest.
+*
+* The targets are measurable: frame time as shown next to the preset in the GUI, and error
+* as the mean absolute difference per color channel, in [0, 1], from a screenshot of the
+* same view rendered with RaycastingQuality::Reference.
+*
+* @see RaycastingQuality for the presets.
+* @see GetRaycastingQualitySettings for the settings of each preset.
+* @see ProgressiveRefinement for the refinement after interaction.
+*/
+struct RaycastingQualitySettings
+{
+    float samplingRate; /**< Samples per Nyquist step. */
+    bool enableAdaptiveSampling; /**< Whether samples may span several base steps. */
+    uint32_t maxStepMultiplier; /**< Largest number of base steps one sample may span. */
+    float frameTimeTargetInMilliseconds; /**< Frame time to stay below, 0 for none. */
+    float maxColorError; /**< Mean absolute color difference from the reference preset to stay below. */
+    float interactionResolutionScale; /**< Fraction of the viewport resolution rendered while the scene changes. */
+    float interactionSamplingRateScale; /**< Fraction of the sampling rate used while the scene changes. */
+};
+
+#endif
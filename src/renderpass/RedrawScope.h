@@ -0,0 +1,24 @@
+/**
+* \file RedrawScope.h
+*
+* \brief Enumeration of what needs to be drawn in a frame.
+*/
+
+#ifndef REDRAW_SCOPE_H
+#define REDRAW_SCOPE_H
+
+/**
+* \enum RedrawScope
+*
+* \brief Selects which parts of a frame are drawn, from nothing to the whole scene.
+*
+* @see RedrawTracker for deciding the scope of each frame.
+*/
+enum class RedrawScope
+{
+    None,  /**< Nothing changed, the main loop waits for events instead of drawing. */
+    Gui,   /**< Only the GUI changed, the last rendered scene is presented again below it. */
+    Scene  /**< The scene changed, all render passes run. */
+};
+
+#endif
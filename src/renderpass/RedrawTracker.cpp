@@ -0,0 +1,93 @@
+#include <renderpass/RedrawTracker.h>
+#include <camera/Camera.h>
+#include <config/Config.h>
+#include <gui/GuiUpdateFlags.h>
+#include <volumedata/VolumeLoadingProgress.h>
+
+#include <utility>
+
+RedrawTracker::RedrawTracker(
+    const Camera& camera,
+    const DisplayProperties& displayProperties,
+    const GuiParameters& guiParameters,
+    GuiUpdateFlags& guiUpdateFlags,
+    const VolumeData::VolumeLoadingProgress& volumeLoadingProgress
+)
+    : m_camera{camera}
+    , m_displayProperties{displayProperties}
+    , m_guiParameters{guiParameters}
+    , m_guiUpdateFlags{guiUpdateFlags}
+    , m_volumeLoadingProgress{volumeLoadingProgress}
+    , m_renderedCameraParameters{camera.GetCameraParameters()}
+    , m_renderedDisplayProperties{displayProperties}
+    , m_renderedGuiParameters{guiParameters}
+    , m_renderedWindowWidth{0}
+    , m_renderedWindowHeight{0}
+    , m_renderedGuiWidth{0.0f}
+    , m_numSceneFramesLeft{Config::numRedrawFramesAfterChange}
+    , m_numGuiFramesLeft{0}
+    , m_hasSceneChanged{true}
+{
+}
+
+RedrawScope RedrawTracker::Update(unsigned int windowWidth, unsigned int windowHeight, float guiWidth, bool hasPendingInput)
+{
+    const auto cameraParameters = m_camera.GetCameraParameters();
+
+    m_hasSceneChanged = DetectSceneChange(cameraParameters, windowWidth, windowHeight, guiWidth);
+    if (m_hasSceneChanged)
+    {
+        m_renderedCameraParameters = cameraParameters;
+        m_renderedDisplayProperties = m_displayProperties;
+        m_renderedGuiParameters = m_guiParameters;
+        m_renderedWindowWidth = windowWidth;
+        m_renderedWindowHeight = windowHeight;
+        m_renderedGuiWidth = guiWidth;
+        m_numSceneFramesLeft = Config::numRedrawFramesAfterChange;
+    }
+
+    // The progress bar changes without any input
+    if (hasPendingInput || m_volumeLoadingProgress.isLoading)
+    {
+        m_numGuiFramesLeft = Config::numRedrawFramesAfterChange;
+    }
+
+    // A scene frame also draws the GUI
+    if (m_numSceneFramesLeft > 0)
+    {
+        --m_numSceneFramesLeft;
+        m_numGuiFramesLeft = (m_numGuiFramesLeft > 0) ? m_numGuiFramesLeft - 1 : 0;
+        return RedrawScope::Scene;
+    }
+
+    if (m_numGuiFramesLeft > 0)
+    {
+        --m_numGuiFramesLeft;
+        return RedrawScope::Gui;
+    }
+
+    return RedrawScope::None;
+}
+
+bool RedrawTracker::HasSceneChanged() const
+{
+    return m_hasSceneChanged;
+}
+
+bool RedrawTracker::DetectSceneChange(const CameraParameters& cameraParameters, unsigned int windowWidth, unsigned int windowHeight, float guiWidth)
+{
+    const bool isRedrawRequested = std::exchange(m_guiUpdateFlags.redrawRequested, false);
+
+    return isRedrawRequested
+        || m_guiUpdateFlags.ssaoParametersChanged
+        || m_guiUpdateFlags.transferFunctionChanged
+        || m_guiUpdateFlags.volumeDataChanged
+        || m_guiUpdateFlags.timeStepChanged
+        || m_guiUpdateFlags.volumeWindowFitRequested
+        || cameraParameters != m_renderedCameraParameters
+        || m_displayProperties != m_renderedDisplayProperties
+        || m_guiParameters != m_renderedGuiParameters
+        || windowWidth != m_renderedWindowWidth
+        || windowHeight != m_renderedWindowHeight
+        || guiWidth != m_renderedGuiWidth;
+}
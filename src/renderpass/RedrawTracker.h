@@ -0,0 +1,108 @@
+/**
+* \file RedrawTracker.h
+*
+* \brief Decides whether a frame needs to be drawn by tracking changes to the rendered state.
+*/
+
+#ifndef REDRAW_TRACKER_H
+#define REDRAW_TRACKER_H
+
+#include <camera/CameraParameters.h>
+#include <gui/GuiParameters.h>
+#include <input/DisplayProperties.h>
+#include <renderpass/RedrawScope.h>
+
+class Camera;
+struct GuiUpdateFlags;
+
+namespace VolumeData
+{
+    struct VolumeLoadingProgress;
+}
+
+/**
+* \class RedrawTracker
+*
+* \brief Skips frames in which nothing changed, so that an idle viewer does not use the CPU and GPU.
+*
+* Keeps a copy of the camera parameters, display properties, GUI parameters, window size
+* and GUI width the scene was last rendered with. Update() compares them with the current
+* state and checks the GuiUpdateFlags, which are set by the GUI, the loaders and the
+* updaters that upload results of background work. Any difference redraws the scene.
+* Input events that the GUI has not processed yet and a volume that is still loading
+* redraw only the GUI, on top of the last rendered scene.
+*
+* Each change is drawn for Config::numRedrawFramesAfterChange frames, so that the paged
+* volume feedback, which is read back two frames late, and the GUI layout settle before
+* the loop goes idle. HasSceneChanged() tells the ProgressiveRefinement whether a frame
+* shows a new change, which it renders at reduced quality.
+*
+* While idle, the main loop blocks in GlfwWindow::WaitEvents(). Background workers wake it
+* with Context::PostEmptyEvent() once a result is ready for their updater.
+*
+* @see RedrawScope for the possible results.
+* @see GuiUpdateFlags::redrawRequested for requesting a redraw from an updater.
+* @see Factory::MakeRedrawTracker for construction from Storage.
+*/
+class RedrawTracker
+{
+public:
+    /**
+    * Constructor.
+    * The first frames after construction always draw the scene.
+    * @param camera Reference to the camera.
+    * @param displayProperties Reference to the display properties.
+    * @param guiParameters Reference to the GUI parameters.
+    * @param guiUpdateFlags Reference to the GUI update flags, whose redrawRequested flag is cleared by Update().
+    * @param volumeLoadingProgress Reference to the background volume loading progress shown by the GUI.
+    */
+    RedrawTracker(
+        const Camera& camera,
+        const DisplayProperties& displayProperties,
+        const GuiParameters& guiParameters,
+        GuiUpdateFlags& guiUpdateFlags,
+        const VolumeData::VolumeLoadingProgress& volumeLoadingProgress
+    );
+
+    /**
+    * Decides what to draw in the current frame.
+    * Should be called once per frame after input has been processed and before the updaters clear the GuiUpdateFlags.
+    * @param windowWidth The current window width in pixels.
+    * @param windowHeight The current window height in pixels.
+    * @param guiWidth The current width of the GUI panel in pixels.
+    * @param hasPendingInput Whether input events or background results arrived that the GUI has not processed yet.
+    * @return RedrawScope What needs to be drawn.
+    */
+    RedrawScope Update(unsigned int windowWidth, unsigned int windowHeight, float guiWidth, bool hasPendingInput);
+
+    /**
+    * Checks whether the last call of Update() detected a change of the scene.
+    * Unlike a RedrawScope::Scene result, this is false in the frames that only settle a change.
+    * @return bool True if the scene changed since the frame before.
+    */
+    bool HasSceneChanged() const;
+
+private:
+    /**
+    * Checks whether the scene has to be rendered again, and consumes GuiUpdateFlags::redrawRequested.
+    */
+    bool DetectSceneChange(const CameraParameters& cameraParameters, unsigned int windowWidth, unsigned int windowHeight, float guiWidth);
+
+private:
+    const Camera& m_camera; /**< Reference to the camera. */
+    const DisplayProperties& m_displayProperties; /**< Reference to the display properties. */
+    const GuiParameters& m_guiParameters; /**< Reference to the GUI parameters. */
+    GuiUpdateFlags& m_guiUpdateFlags; /**< Reference to the GUI update flags. */
+    const VolumeData::VolumeLoadingProgress& m_volumeLoadingProgress; /**< Reference to the background volume loading progress. */
+    CameraParameters m_renderedCameraParameters; /**< Camera parameters the scene was last rendered with. */
+    DisplayProperties m_renderedDisplayProperties; /**< Display properties the scene was last rendered with. */
+    GuiParameters m_renderedGuiParameters; /**< GUI parameters the scene was last rendered with. */
+    unsigned int m_renderedWindowWidth; /**< Window width the scene was last rendered with. */
+    unsigned int m_renderedWindowHeight; /**< Window height the scene was last rendered with. */
+    float m_renderedGuiWidth; /**< GUI width the scene was last rendered with. */
+    unsigned int m_numSceneFramesLeft; /**< Number of frames that still render the scene after the last change. */
+    unsigned int m_numGuiFramesLeft; /**< Number of frames that still draw the GUI after the last input. */
+    bool m_hasSceneChanged; /**< Whether the last call of Update() detected a change of the scene. */
+};
+
+#endif
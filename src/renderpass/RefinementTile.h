@@ -0,0 +1,27 @@
+/**
+* \file RefinementTile.h
+*
+* \brief Rectangle of the viewport refined at full quality in one frame.
+*/
+
+#ifndef REFINEMENT_TILE_H
+#define REFINEMENT_TILE_H
+
+/**
+* \struct RefinementTile
+*
+* \brief Pixel rectangle of the viewport, with the origin at the lower left like glScissor.
+*
+* @see ProgressiveRefinement for the order in which tiles are refined.
+*/
+struct RefinementTile
+{
+    unsigned int x; /**< Left edge in pixels. */
+    unsigned int y; /**< Bottom edge in pixels. */
+    unsigned int width; /**< Width in pixels. */
+    unsigned int height; /**< Height in pixels. */
+
+    bool operator==(const RefinementTile&) const = default;
+};
+
+#endif
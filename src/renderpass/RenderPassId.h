@@ -23,7 +23,11 @@
 enum class RenderPassId
 {
     Setup,        /**< Initial setup pass that clears the screen. */
-    Volume,       /**< Volume ray-casting pass that renders the 3D volume data. */
+    ReducedVolume, /**< Volume ray-casting pass at reduced resolution and sampling rate while the scene changes. */
+    Upscale,      /**< Edge-aware upscaling of the reduced volume image to the viewport resolution. */
+    Volume,       /**< Volume ray-casting pass that refines tiles of the volume image at full quality. */
+    Present,      /**< Copies the volume image into the viewport of the screen. */
+    PagedVolumeFeedback, /**< Low-resolution ray-casting pass that records the bricks a paged volume needs. */
     SsaoInput,    /**< Geometry pass that renders position, normal, and albedo to G-buffer. */
     Ssao,         /**< SSAO computation pass that samples occlusion from G-buffer. */
     SsaoBlur,     /**< Blur pass that smooths SSAO output to reduce noise. */
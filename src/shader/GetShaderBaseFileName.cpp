@@ -11,7 +11,7 @@ namespace
         std::string_view shaderBaseFileName;
     };
 
-    constexpr std::array<ShaderBaseFileNameMapping, 7> shaderBaseFileNames =
+    constexpr std::array<ShaderBaseFileNameMapping, 8> shaderBaseFileNames =
     {{
         {ShaderId::Volume, "Volume"},
         {ShaderId::Ssao, "Ssao"},
@@ -19,7 +19,8 @@ namespace
         {ShaderId::SsaoFinal, "SsaoFinal"},
         {ShaderId::SsaoInput, "SsaoInput"},
         {ShaderId::DebugQuad, "DebugQuad"},
-        {ShaderId::LightSource, "LightSource"}
+        {ShaderId::LightSource, "LightSource"},
+        {ShaderId::Upscale, "Upscale"}
     }};
 }
 
@@ -70,7 +70,7 @@ namespace Factory
     )
     {
         auto shaders = std::vector<Shader>{};
-        shaders.reserve(7);
+        shaders.reserve(8);
         shaders.push_back(CreateShader(ShaderId::Volume));
         shaders.push_back(CreateShader(ShaderId::SsaoInput));
         shaders.push_back(CreateShader(ShaderId::Ssao));
@@ -78,23 +78,42 @@ namespace Factory
         shaders.push_back(CreateShader(ShaderId::SsaoFinal));
         shaders.push_back(CreateShader(ShaderId::DebugQuad));
         shaders.push_back(CreateShader(ShaderId::LightSource));
+        shaders.push_back(CreateShader(ShaderId::Upscale));
         
         const auto& volumeTexture = textureStorage.GetElement(TextureId::VolumeData);
         const auto& transferFunctionTexture = textureStorage.GetElement(TextureId::TransferFunction);
+        const auto& preIntegrationTableTexture = textureStorage.GetElement(TextureId::PreIntegrationTable);
+        const auto& occupancyGridTexture = textureStorage.GetElement(TextureId::OccupancyGrid);
+        const auto& gradientVolumeTexture = textureStorage.GetElement(TextureId::GradientVolume);
+        const auto& brickAtlasTexture = textureStorage.GetElement(TextureId::BrickAtlas);
+        const auto& pageTableTexture = textureStorage.GetElement(TextureId::PageTable);
         const auto& ssaoPositionTexture = textureStorage.GetElement(TextureId::SsaoPosition);
         const auto& ssaoNormalTexture = textureStorage.GetElement(TextureId::SsaoNormal);
         const auto& ssaoAlbedoTexture = textureStorage.GetElement(TextureId::SsaoAlbedo);
         const auto& ssaoTexture = textureStorage.GetElement(TextureId::Ssao);
         const auto& ssaoNoiseTexture = textureStorage.GetElement(TextureId::SsaoNoise);
         const auto& ssaoPointLightsContributionTexture = textureStorage.GetElement(TextureId::SsaoPointLightsContribution);
+        const auto& reducedVolumeColorTexture = textureStorage.GetElement(TextureId::ReducedVolumeColor);
 
         const auto& volumeShader = GetShader(shaders, ShaderId::Volume);
         volumeShader.Use();
         volumeShader.SetInt("volumeTexture", volumeTexture.GetTextureUnit());
         volumeShader.SetInt("transferFunctionTexture", transferFunctionTexture.GetTextureUnit());
+        volumeShader.SetInt("preIntegrationTableTexture", preIntegrationTableTexture.GetTextureUnit());
+        volumeShader.SetInt("occupancyGridTexture", occupancyGridTexture.GetTextureUnit());
+        volumeShader.SetFloat("occupancyGridBrickSize", static_cast<float>(Config::occupancyGridBrickSize));
+        volumeShader.SetInt("gradientVolumeTexture", gradientVolumeTexture.GetTextureUnit());
+        // Paged volumes have no gradient volume to shade with
+        const bool isPaged = Config::volumeLoadingMode == VolumeData::VolumeLoadingMode::Paged;
+        volumeShader.SetInt("enableShading", (Config::enableGradientShading && !isPaged) ? 1 : 0);
+        volumeShader.SetInt("brickAtlasTexture", brickAtlasTexture.GetTextureUnit());
+        volumeShader.SetInt("pageTableTexture", pageTableTexture.GetTextureUnit());
+        volumeShader.SetInt("enablePaging", isPaged ? 1 : 0);
+        volumeShader.SetInt("writeFeedback", 0);
         // TODO set view vector and camera pos every frame
-        volumeShader.SetFloat("stepSize", 0.1f); // TODO add to gui parameters
-        volumeShader.SetInt("maxSteps", 128); // TODO make configurable
+        // The step size is derived from the volume and the quality preset by the raycasting render pass
+        volumeShader.SetInt("maxSteps", Config::maxRaycastingSteps);
+        volumeShader.SetFloat("lodBias", Config::volumeLodBias);
 
         const Shader& ssaoShader = GetShader(shaders, ShaderId::Ssao);
         ssaoShader.Use();
@@ -124,6 +143,10 @@ namespace Factory
         ssaoFinalShader.SetInt("ssaoMap", ssaoTexture.GetTextureUnit());
         ssaoFinalShader.SetInt("enableSsao", guiParameters.enableSsao);
 
+        const Shader& upscaleShader = GetShader(shaders, ShaderId::Upscale);
+        upscaleShader.Use();
+        upscaleShader.SetInt("colorTexture", reducedVolumeColorTexture.GetTextureUnit());
+
         return shaders;
     }
 }
@@ -29,6 +29,7 @@ enum class ShaderId
     SsaoFinal,    /**< Final compositing shader that combines volume with SSAO. */
     DebugQuad,    /**< Debug visualization shader for displaying intermediate textures. */
     LightSource,  /**< Light source visualization shader. */
+    Upscale,      /**< Edge-aware upscaling shader for the volume ray cast at reduced resolution. */
     Unknown       /**< Sentinel value for uninitialized or invalid shader IDs. */
 };
 
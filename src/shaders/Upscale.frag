@@ -0,0 +1,43 @@
+#version 330 core
+out vec4 FragColor;
+
+in vec2 TexCoords;
+
+uniform sampler2D colorTexture;
+uniform vec2 sourceSize;
+
+// Color difference at which a texel's weight drops to about a third, small enough to keep silhouettes sharp
+const float colorSigma = 0.1;
+
+// Bilinear upscaling of the lower left sourceSize texels of the color texture, with the four
+// texels weighted by their similarity to the nearest one, so that the filter does not blur
+// across edges such as the silhouette of the volume against the background
+void main()
+{
+    vec2 position = TexCoords * sourceSize - 0.5;
+    vec2 base = floor(position);
+    vec2 fraction = position - base;
+    vec2 maxTexel = sourceSize - 1.0;
+
+    vec4 nearestColor = texelFetch(colorTexture, ivec2(clamp(base + step(0.5, fraction), vec2(0.0), maxTexel)), 0);
+
+    vec4 color = vec4(0.0);
+    float weightSum = 0.0;
+
+    for (int y = 0; y < 2; ++y)
+    {
+        for (int x = 0; x < 2; ++x)
+        {
+            vec2 offset = vec2(float(x), float(y));
+            vec4 texelColor = texelFetch(colorTexture, ivec2(clamp(base + offset, vec2(0.0), maxTexel)), 0);
+            vec2 bilinearWeights = mix(1.0 - fraction, fraction, offset);
+            float colorDifference = length(texelColor - nearestColor);
+            float weight = bilinearWeights.x * bilinearWeights.y * exp(-0.5 * colorDifference * colorDifference / (colorSigma * colorSigma));
+            color += weight * texelColor;
+            weightSum += weight;
+        }
+    }
+
+    // The nearest texel always has a weight of at least a quarter
+    FragColor = color / weightSum;
+}
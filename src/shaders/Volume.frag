@@ -1,5 +1,33 @@
 #version 330 core
-out vec4 FragColor;
+#define NUM_POINT_LIGHTS 2
+#define MAX_PAGED_LEVELS 16
+
+struct Material
+{
+    vec3 specular;
+    float shininess;
+};
+
+struct DirectionalLight
+{
+    vec3 direction;
+    vec3 ambient;
+    vec3 diffuse;
+    vec3 specular;
+    float intensity;
+};
+
+struct PointLight
+{
+    vec3 position;
+    vec3 ambient;
+    vec3 diffuse;
+    vec3 specular;
+    float intensity;
+};
+
+layout(location = 0) out vec4 FragColor;
+layout(location = 1) out uint FeedbackKey;
 
 in vec3 TexCoords;
 in vec3 WorldPos;
@@ -7,11 +35,56 @@ in vec3 ViewPos;
 
 uniform sampler3D volumeTexture;
 uniform sampler1D transferFunctionTexture;
+uniform sampler2D preIntegrationTableTexture;
+uniform usampler3D occupancyGridTexture;
+uniform sampler3D gradientVolumeTexture;
+uniform sampler3D brickAtlasTexture;
+uniform usampler3D pageTableTexture;
 uniform mat4 view;
 uniform vec3 cameraPos;
-uniform float stepSize;
+uniform float nyquistStepSize;
+uniform float samplingRate;
 uniform int maxSteps;
+uniform int enableAdaptiveSampling;
+uniform int maxStepMultiplier;
+uniform int enablePreIntegration;
 uniform float densityMultiplier;
+uniform float pixelFootprint;
+uniform float lodBias;
+uniform float occupancyGridBrickSize;
+uniform int enableShading;
+uniform int enablePaging;
+uniform int writeFeedback;
+uniform int feedbackFrameIndex;
+uniform int numPagedLevels;
+uniform float pagedBrickSize;
+uniform float pagedAtlasNumSlots;
+uniform vec3 pagedLevelSizes[MAX_PAGED_LEVELS];
+uniform vec3 pagedLevelNumBricks[MAX_PAGED_LEVELS];
+uniform int pagedLevelOffsets[MAX_PAGED_LEVELS];
+uniform Material material;
+uniform DirectionalLight directionalLight;
+uniform PointLight pointLights[NUM_POINT_LIGHTS];
+
+// Below this encoded gradient magnitude, the normal is too noisy to shade with
+const float minShadingGradientMagnitude = 0.1;
+
+// Must match PagedBrickKey and the page table layout of the PagedVolumeStreamer
+const uint NO_BRICK = 0xFFFFFFFFu;
+const uint BRICK_INDEX_BITS = 27u;
+const uint PAGE_MISSING = 0u;
+const uint PAGE_EMPTY = 2u;
+
+const int SAMPLE_VALID = 0;
+const int SAMPLE_EMPTY = 1;
+const int SAMPLE_MISSING = 2;
+
+float volumeResolution;
+vec3 brickExtent;
+float stepSize;
+float opacityReferenceStepSize;
+uint missingKey;   // First brick along the ray missing at the requested level
+uint sampledKey;   // Brick the latest valid paged sample was taken from
 
 vec3 GetRayDirection()
 {
@@ -36,26 +109,252 @@ bool IntersectBox(vec3 rayOrigin, vec3 rayDir, out float tNear, out float tFar)
     return tFar > tNear && tFar > 0.0;
 }
 
-vec4 SampleVolume(vec3 pos)
+// Mip level whose voxels cover about one pixel at the sample position
+float GetSampleLod(vec3 pos)
+{
+    vec3 samplePos = pos - 0.5;
+    float voxelsPerPixel = distance(cameraPos, samplePos) * pixelFootprint * volumeResolution;
+    return max(log2(voxelsPerPixel) + lodBias, 0.0);
+}
+
+ivec3 GetBrick(vec3 pos)
+{
+    return clamp(ivec3(pos / brickExtent), ivec3(0), textureSize(occupancyGridTexture, 0) - 1);
+}
+
+// Red: number of bricks from the brick containing pos to the nearest visible brick, zero if the brick itself is visible.
+// Green: number of Nyquist steps a sample may span within the brick, from the brick's value range.
+uvec2 GetOccupancyGridTexel(vec3 pos)
+{
+    return texelFetch(occupancyGridTexture, GetBrick(pos), 0).rg;
+}
+
+// Distance along the ray from pos to the far side of a box containing pos
+float GetBoxExitDistance(vec3 pos, vec3 rayDir, vec3 boxMin, vec3 boxMax)
+{
+    vec3 invRayDir = 1.0 / rayDir;
+    vec3 tExit = max((boxMin - pos) * invRayDir, (boxMax - pos) * invRayDir);
+    return min(min(tExit.x, tExit.y), tExit.z);
+}
+
+// Distance along the ray from pos to the far side of the cube of empty bricks around the brick
+// containing pos, which extends emptyBrickDistance - 1 bricks to each side
+float GetEmptyCubeExitDistance(vec3 pos, vec3 rayDir, uint emptyBrickDistance)
+{
+    vec3 brick = vec3(GetBrick(pos));
+    float radius = float(emptyBrickDistance - 1u);
+    return GetBoxExitDistance(pos, rayDir, (brick - radius) * brickExtent, (brick + radius + 1.0) * brickExtent);
+}
+
+// Number of base steps to the next sample. Samples are spread out where the brick's values vary
+// slowly, and where a pixel covers so many voxels that the mip level sampled there has a coarser
+// Nyquist step. Both terms count Nyquist steps and only apply beyond one, so that presets sampling
+// above the Nyquist rate keep their base step. A step spanning a smooth brick ends at the brick's exit.
+// Mirrored by GetRaycastingStepMultiplier() on the CPU.
+int GetStepMultiplier(vec3 pos, vec3 rayDir, uint brickNyquistSteps)
+{
+    if (enableAdaptiveSampling == 0)
+    {
+        return 1;
+    }
+
+    int brickMultiplier = (brickNyquistSteps > 1u) ? int(float(brickNyquistSteps) * samplingRate) : 1;
+    if (brickMultiplier > 1)
+    {
+        vec3 brickMin = vec3(GetBrick(pos)) * brickExtent;
+        int stepsToBrickExit = int(ceil(GetBoxExitDistance(pos, rayDir, brickMin, brickMin + brickExtent) / stepSize));
+        brickMultiplier = min(brickMultiplier, stepsToBrickExit);
+    }
+
+    float lod = GetSampleLod(pos);
+    int distanceMultiplier = (lod < 1.0) ? 1 : int(exp2(floor(lod)) * samplingRate);
+
+    return clamp(max(brickMultiplier, distanceMultiplier), 1, maxStepMultiplier);
+}
+
+// Resolves a sample through the page table at the level its footprint asks for, falling back
+// to coarser resident levels. An empty brick at the requested level is reported with its bounds.
+int SamplePagedVolume(vec3 pos, out float density, out vec3 emptyMin, out vec3 emptyMax)
+{
+    density = 0.0;
+    emptyMin = vec3(0.0);
+    emptyMax = vec3(0.0);
+
+    if (any(lessThan(pos, vec3(0.0))) || any(greaterThan(pos, vec3(1.0))))
+    {
+        return SAMPLE_MISSING;
+    }
+
+    int requestedLevel = min(int(GetSampleLod(pos)), numPagedLevels - 1);
+
+    for (int level = requestedLevel; level < numPagedLevels; ++level)
+    {
+        vec3 levelSize = pagedLevelSizes[level];
+        vec3 voxel = pos * levelSize;
+        vec3 brick = min(floor(voxel / pagedBrickSize), pagedLevelNumBricks[level] - 1.0);
+        uvec4 entry = texelFetch(pageTableTexture, ivec3(brick) + ivec3(0, 0, pagedLevelOffsets[level]), 0);
+
+        if (entry.a == PAGE_EMPTY)
+        {
+            if (level == requestedLevel)
+            {
+                emptyMin = brick * pagedBrickSize / levelSize;
+                emptyMax = min((brick + 1.0) * pagedBrickSize, levelSize) / levelSize;
+                return SAMPLE_EMPTY;
+            }
+            continue;
+        }
+
+        uvec3 brickCoords = uvec3(brick);
+        uvec3 numBricks = uvec3(pagedLevelNumBricks[level]);
+        uint key = (uint(level) << BRICK_INDEX_BITS) | (brickCoords.x + numBricks.x * (brickCoords.y + numBricks.y * brickCoords.z));
+
+        if (entry.a == PAGE_MISSING)
+        {
+            if (level == requestedLevel && missingKey == NO_BRICK)
+            {
+                missingKey = key;
+            }
+            continue;
+        }
+
+        // The atlas holds no apron, so stay within the brick's own voxels
+        vec3 brickOrigin = brick * pagedBrickSize;
+        vec3 brickVoxels = min(vec3(pagedBrickSize), levelSize - brickOrigin);
+        vec3 localVoxel = clamp(voxel - brickOrigin, vec3(0.5), brickVoxels - 0.5);
+        vec3 atlasPos = (vec3(entry.rgb) * pagedBrickSize + localVoxel) / (pagedAtlasNumSlots * pagedBrickSize);
+
+        density = textureLod(brickAtlasTexture, atlasPos, 0.0).r;
+        sampledKey = key;
+        return SAMPLE_VALID;
+    }
+
+    return SAMPLE_MISSING;
+}
+
+vec3 DecodeOctahedralNormal(vec2 encoded)
+{
+    vec2 f = encoded * 2.0 - 1.0;
+    vec3 normal = vec3(f, 1.0 - abs(f.x) - abs(f.y));
+    float fold = max(-normal.z, 0.0);
+    normal.xy += vec2(normal.x >= 0.0 ? -fold : fold, normal.y >= 0.0 ? -fold : fold);
+    return normalize(normal);
+}
+
+vec3 CalculateDirectionalLight(vec3 materialColor, vec3 normal, vec3 viewDirection)
+{
+    vec3 ambient = directionalLight.ambient * materialColor;
+
+    vec3 lightDirection = normalize(-directionalLight.direction);
+    float diffuseFactor = max(dot(normal, lightDirection), 0.0);
+    vec3 diffuse = directionalLight.diffuse * diffuseFactor * materialColor;
+
+    vec3 reflectionDirection = reflect(-lightDirection, normal);
+    float specularFactor = pow(max(dot(viewDirection, reflectionDirection), 0.0), material.shininess);
+    vec3 specular = directionalLight.specular * specularFactor * material.specular;
+
+    return (ambient + diffuse + specular) * directionalLight.intensity;
+}
+
+vec3 CalculatePointLight(vec3 materialColor, PointLight pointLight, vec3 samplePosition, vec3 normal, vec3 viewDirection)
+{
+    vec3 ambient = pointLight.ambient * materialColor;
+
+    vec3 lightDirection = normalize(pointLight.position - samplePosition);
+    float diffuseFactor = max(dot(normal, lightDirection), 0.0);
+    vec3 diffuse = pointLight.diffuse * diffuseFactor * materialColor;
+
+    vec3 reflectionDirection = reflect(-lightDirection, normal);
+    float specularFactor = pow(max(dot(viewDirection, reflectionDirection), 0.0), material.shininess);
+    vec3 specular = pointLight.specular * specularFactor * material.specular;
+
+    float distance = length(pointLight.position - samplePosition);
+    float attenuation = 1.0 / (1.0f + 0.022f * distance + 0.0019f * (distance * distance));
+
+    return (ambient + (diffuse + specular) * attenuation) * pointLight.intensity;
+}
+
+// Phong shading with the precomputed gradient, blended out where the gradient is too weak to define a surface
+vec3 ShadeSample(vec3 materialColor, vec3 pos, vec3 rayDir)
+{
+    vec3 gradient = texture(gradientVolumeTexture, pos).rgb;
+    float shadingWeight = smoothstep(0.0, minShadingGradientMagnitude, gradient.b);
+    if (shadingWeight <= 0.0)
+    {
+        return materialColor;
+    }
+
+    vec3 viewDirection = -rayDir;
+    vec3 normal = DecodeOctahedralNormal(gradient.rg);
+
+    // Two-sided lighting, as the ray may hit either side of a boundary
+    if (dot(normal, viewDirection) < 0.0)
+    {
+        normal = -normal;
+    }
+
+    vec3 samplePosition = pos - 0.5;
+    vec3 color = CalculateDirectionalLight(materialColor, normal, viewDirection);
+
+    for (int i = 0; i < NUM_POINT_LIGHTS; ++i)
+    {
+        color += CalculatePointLight(materialColor, pointLights[i], samplePosition, normal, viewDirection);
+    }
+
+    return mix(materialColor, color, shadingWeight);
+}
+
+// Scaled density at pos, or -1 outside of the volume
+float SampleDensity(vec3 pos)
 {
     if (pos.x < 0.0 || pos.x > 1.0 ||
         pos.y < 0.0 || pos.y > 1.0 ||
         pos.z < 0.0 || pos.z > 1.0)
+    {
+        return -1.0;
+    }
+
+    // Explicit level of detail, as implicit derivatives are undefined inside the ray loop
+    float density = textureLod(volumeTexture, pos, GetSampleLod(pos)).r;
+    return density * densityMultiplier;
+}
+
+// Color and opacity of a segment of the given length, corrected for the opacity reference step
+vec4 ClassifySample(float density, float segmentLength)
+{
+    if (density < 0.0)
     {
         return vec4(0.0);
     }
 
-    float density = texture(volumeTexture, pos).r;
-    density *= densityMultiplier;
+    vec4 sampleColor = texture(transferFunctionTexture, density);
+    sampleColor.a = 1.0 - pow(1.0 - clamp(sampleColor.a, 0.0, 1.0), segmentLength / opacityReferenceStepSize);
+    return sampleColor;
+}
+
+// Color and opacity of a segment between two densities from the pre-integration table, which
+// holds the average extinction and extinction-weighted color over all densities in between
+vec4 ClassifySegment(float frontDensity, float backDensity, float segmentLength)
+{
+    float tableSize = float(textureSize(preIntegrationTableTexture, 0).x);
+    vec2 tableCoords = (clamp(vec2(frontDensity, backDensity), 0.0, 1.0) * (tableSize - 1.0) + 0.5) / tableSize;
+    vec4 extinction = texture(preIntegrationTableTexture, tableCoords);
 
-    // Look up color and alpha from transfer function
-    vec4 transferFunctionColor = texture(transferFunctionTexture, density);
+    if (extinction.a <= 0.0)
+    {
+        return vec4(0.0);
+    }
 
-    return transferFunctionColor;
+    float alpha = 1.0 - exp(-extinction.a * segmentLength / opacityReferenceStepSize);
+    return vec4(clamp(extinction.rgb / extinction.a, 0.0, 1.0), alpha);
 }
 
 void main()
 {
+    ivec3 volumeSize = (enablePaging == 1) ? ivec3(pagedLevelSizes[0]) : textureSize(volumeTexture, 0);
+    volumeResolution = float(max(volumeSize.x, max(volumeSize.y, volumeSize.z)));
+    brickExtent = occupancyGridBrickSize / vec3(volumeSize);
+
     vec3 rayOrigin = TexCoords;
     vec3 rayDir = GetRayDirection();
 
@@ -74,6 +373,11 @@ void main()
     vec3 rayStart = rayOrigin + rayDir * tNear;
     vec3 rayStop = rayOrigin + rayDir * tFar;
 
+    // Base step of the sampling grid, and the step the transfer function opacities refer to,
+    // which is one voxel, so that the image does not change with the step length
+    stepSize = nyquistStepSize / samplingRate;
+    opacityReferenceStepSize = 2.0 * nyquistStepSize;
+
     float rayLength = distance(rayStop, rayStart);
     vec3 rayStep = normalize(rayStop - rayStart) * stepSize;
 
@@ -82,9 +386,87 @@ void main()
 
     int steps = min(maxSteps, int(rayLength / stepSize));
 
-    for (int i = 0; i < steps; ++i)
+    missingKey = NO_BRICK;
+    sampledKey = NO_BRICK;
+    FeedbackKey = NO_BRICK;
+
+    // The used brick reported in the feedback varies per pixel and frame, so that all bricks along the ray stay recent
+    uvec2 pixel = uvec2(gl_FragCoord.xy);
+    int touchSampleIndex = int((pixel.x * 1973u + pixel.y * 9277u + uint(feedbackFrameIndex / 2)) % uint(max(steps, 1)));
+    uint touchedKey = NO_BRICK;
+
+    // With pre-integration, a sample is composited as the segment from the previous sample,
+    // which is none at the start of the ray and behind skipped or missing bricks
+    float frontDensity = -1.0;
+    float segmentLength = 0.0;
+
+    int i = 0;
+    while (i < steps)
     {
-        vec4 sampleColor = SampleVolume(currentPos);
+        float sampleDensity;
+        int stepMultiplier;
+
+        if (enablePaging == 1)
+        {
+            float density;
+            vec3 emptyMin;
+            vec3 emptyMax;
+            int sampleStatus = SamplePagedVolume(currentPos, density, emptyMin, emptyMax);
+
+            if (sampleStatus == SAMPLE_EMPTY)
+            {
+                int skippedSteps = max(1, int(ceil(GetBoxExitDistance(currentPos, rayDir, emptyMin, emptyMax) / stepSize)));
+                i += skippedSteps;
+                currentPos += rayStep * float(skippedSteps);
+                frontDensity = -1.0;
+                continue;
+            }
+
+            if (sampleStatus == SAMPLE_VALID && (i <= touchSampleIndex || touchedKey == NO_BRICK))
+            {
+                touchedKey = sampledKey;
+            }
+
+            // Missing bricks contribute nothing until they are streamed in
+            sampleDensity = (sampleStatus == SAMPLE_VALID) ? density * densityMultiplier : -1.0;
+            stepMultiplier = GetStepMultiplier(currentPos, rayDir, 0u);
+        }
+        else
+        {
+            // Leap over all bricks the transfer function maps to zero opacity within the distance
+            // to the nearest visible brick, in whole steps so that the samples behind them stay on
+            // the same grid
+            uvec2 occupancyGridTexel = GetOccupancyGridTexel(currentPos);
+            if (occupancyGridTexel.r > 0u)
+            {
+                int skippedSteps = max(1, int(ceil(GetEmptyCubeExitDistance(currentPos, rayDir, occupancyGridTexel.r) / stepSize)));
+                i += skippedSteps;
+                currentPos += rayStep * float(skippedSteps);
+                frontDensity = -1.0;
+                continue;
+            }
+
+            sampleDensity = SampleDensity(currentPos);
+            stepMultiplier = GetStepMultiplier(currentPos, rayDir, occupancyGridTexel.g);
+        }
+
+        vec4 sampleColor;
+        if (enablePreIntegration == 1)
+        {
+            sampleColor = (frontDensity >= 0.0 && sampleDensity >= 0.0) ? ClassifySegment(frontDensity, sampleDensity, segmentLength) : vec4(0.0);
+            frontDensity = sampleDensity;
+            segmentLength = float(stepMultiplier) * stepSize;
+        }
+        else
+        {
+            // The sample stands for the segment up to the next sample
+            sampleColor = ClassifySample(sampleDensity, float(stepMultiplier) * stepSize);
+        }
+
+        if (enableShading == 1 && sampleColor.a > 0.0)
+        {
+            sampleColor.rgb = ShadeSample(sampleColor.rgb, currentPos, rayDir);
+        }
 
         sampleColor.rgb *= sampleColor.a;
         accumulatedColor += (1.0 - accumulatedColor.a) * sampleColor;
@@ -94,7 +476,18 @@ void main()
             break;
         }
 
-        currentPos += rayStep;
+        currentPos += rayStep * float(stepMultiplier);
+        i += stepMultiplier;
+    }
+
+    // Alternate between requesting missing bricks and refreshing the bricks in use,
+    // before the discard below, which would drop the key along with the color
+    if (writeFeedback == 1)
+    {
+        bool preferMissingKey = (feedbackFrameIndex % 2) == 0 || touchedKey == NO_BRICK;
+        FeedbackKey = (missingKey != NO_BRICK && preferMissingKey) ? missingKey : touchedKey;
+        FragColor = accumulatedColor;
+        return;
     }
 
     // Discard fragments with low accumulated density
@@ -0,0 +1,21 @@
+#include <storage/GetGpuMemoryUsageInBytes.h>
+
+#include <numeric>
+
+size_t GetGpuMemoryUsageInBytes(const TextureStorage& textureStorage, const FrameBufferStorage& frameBufferStorage)
+{
+    const auto& textures = textureStorage.GetElements();
+    const auto& frameBuffers = frameBufferStorage.GetElements();
+
+    const size_t textureSizeInBytes = std::accumulate(textures.begin(), textures.end(), size_t{0}, [](size_t sum, const Texture& texture)
+    {
+        return sum + texture.GetSizeInBytes();
+    });
+
+    const size_t renderBufferSizeInBytes = std::accumulate(frameBuffers.begin(), frameBuffers.end(), size_t{0}, [](size_t sum, const FrameBuffer& frameBuffer)
+    {
+        return sum + frameBuffer.GetRenderBufferSizeInBytes();
+    });
+
+    return textureSizeInBytes + renderBufferSizeInBytes;
+}
@@ -0,0 +1,29 @@
+/**
+* \file GetGpuMemoryUsageInBytes.h
+*
+* \brief Function for summing up the video memory of all textures and framebuffers.
+*/
+
+#ifndef GET_GPU_MEMORY_USAGE_IN_BYTES_H
+#define GET_GPU_MEMORY_USAGE_IN_BYTES_H
+
+#include <storage/StorageTypes.h>
+
+#include <cstddef>
+
+/**
+* Sums up the estimated video memory of all textures and of the renderbuffers owned by framebuffers.
+*
+* Textures attached to framebuffers are counted once, as textures. Vertex and pixel
+* buffers are not included.
+*
+* @param textureStorage The textures to account for.
+* @param frameBufferStorage The framebuffers whose renderbuffers to account for.
+* @return size_t The total size in bytes.
+*
+* @see Texture::GetSizeInBytes for the size of a single texture.
+* @see FrameBuffer::GetRenderBufferSizeInBytes for the size of the renderbuffers of a framebuffer.
+*/
+size_t GetGpuMemoryUsageInBytes(const TextureStorage& textureStorage, const FrameBufferStorage& frameBufferStorage);
+
+#endif
@@ -21,18 +21,32 @@
 #include <ssao/SsaoKernel.h>
 #include <ssao/SsaoUpdater.h>
 #include <textures/MakeTextures.h>
+#include <textures/MakeVolumeTexture.h>
 #include <textures/TextureId.h>
 #include <transferfunction/TransferFunction.h>
-#include <volumedata/LoadVolumeRaw.h>
+#include <volumedata/ComputeVolumeContentHash.h>
+#include <volumedata/FitVolumeToTextureBudget.h>
+#include <volumedata/BrickedVolumeHeader.h>
+#include <volumedata/GetVolumeDownsamplingFactor.h>
+#include <volumedata/IsVolumeQuantized.h>
+#include <volumedata/LoadOrMakeVolumePyramid.h>
+#include <volumedata/LoadVolume.h>
+#include <volumedata/LoadVolumeMetadata.h>
+#include <volumedata/MakeStreamedVolumeDataTexture.h>
+#include <volumedata/UploadVolumePyramid.h>
+#include <volumedata/MakeVolumeTextureBudget.h>
+#include <volumedata/ReleaseVolumeHostCopy.h>
+#include <volumedata/VolumeHandle.h>
 
 #include <cstdlib>
 #include <iostream>
+#include <optional>
 
 namespace
 {
     VolumeData::VolumeData LoadVolume(const std::filesystem::path& datasetPath)
     {
-        auto volumeLoadingResult = VolumeData::LoadVolumeRaw(datasetPath);
+        auto volumeLoadingResult = VolumeData::LoadVolume(datasetPath, Config::volumeStorageMode, Config::volumeRegion);
         if (!volumeLoadingResult)
         {
             std::cerr << "Failed to load volume from " << datasetPath << std::endl;
@@ -41,6 +55,42 @@ namespace
         return std::move(volumeLoadingResult).value();
     }
 
+    /// Streams the texture of a whole .raw volume straight from the file, before any voxel is held in host memory.
+    /// The file is then only mapped for the CPU-side features, which page in the voxels they read, or held as a sparse volume.
+    /// Returns std::nullopt if the volume has to be loaded into host memory first, which bricked files,
+    /// regions, quantized volumes and volumes exceeding the texture budget need.
+    std::optional<VolumeData::VolumeData> StreamVolume(const std::filesystem::path& datasetPath, const VolumeData::VolumeTextureBudget& volumeTextureBudget, Texture& volumeTexture)
+    {
+        if (Config::volumeUploadMode != VolumeData::VolumeUploadMode::Streamed || datasetPath.extension() == VolumeData::BrickedVolumeFormat::fileExtension || !Config::volumeRegion.IsWholeVolume())
+        {
+            return std::nullopt;
+        }
+
+        auto iniFilePath = datasetPath;
+        iniFilePath.replace_extension(".ini");
+        const auto metadataResult = VolumeData::LoadVolumeMetadata(iniFilePath);
+        if (!metadataResult || VolumeData::IsVolumeQuantized(metadataResult.value()) || VolumeData::GetVolumeDownsamplingFactor(metadataResult.value(), volumeTextureBudget) > 1)
+        {
+            return std::nullopt;
+        }
+
+        auto textureResult = Factory::MakeStreamedVolumeDataTexture(TextureId::VolumeData, volumeTexture.GetTextureUnitEnum(), datasetPath, metadataResult.value());
+        if (!textureResult)
+        {
+            return std::nullopt;
+        }
+
+        const auto storageMode = (Config::volumeStorageMode == VolumeData::VolumeStorageMode::Sparse) ? VolumeData::VolumeStorageMode::Sparse : VolumeData::VolumeStorageMode::Mapped;
+        auto volumeLoadingResult = VolumeData::LoadVolume(datasetPath, storageMode);
+        if (!volumeLoadingResult)
+        {
+            return std::nullopt;
+        }
+
+        volumeTexture = std::move(textureResult).value();
+        return std::move(volumeLoadingResult).value();
+    }
+
     bool IsTransferFunctionValid(const TransferFunction& transferFunction)
     {
         if (transferFunction.GetNumActivePoints() == 0)
@@ -99,7 +149,9 @@ namespace Factory
         auto camera = Camera{applicationState.cameraParameters};
         auto guiParameters = std::move(applicationState.guiParameters);
         auto displayProperties = MakeDisplayProperties();
-        auto volumeData = LoadVolume(Config::datasetPath);
+        auto volumeData = VolumeData::VolumeData{};
+        auto volumeLoadingProgress = VolumeData::VolumeLoadingProgress{};
+        auto timeSeriesPlaybackState = VolumeData::TimeSeriesPlaybackState{};
         auto guiUpdateFlags = GuiUpdateFlags{};
         auto screenQuad = ScreenQuad{};
         auto unitCube = UnitCube{};
@@ -108,6 +160,46 @@ namespace Factory
         auto shaderStorage = ShaderStorage{MakeShaders(guiParameters, ssaoKernel, textureStorage)};
         auto frameBufferStorage = FrameBufferStorage{MakeFrameBuffers(textureStorage)};
 
+        // In progressive mode, the ProgressiveVolumeLoader fills in the volume after the first frame.
+        // A blocking load happens after all other resources are allocated, so that the volume can be fitted into the memory they leave.
+        if (Config::volumeLoadingMode == VolumeData::VolumeLoadingMode::Blocking)
+        {
+            const auto volumeTextureBudget = MakeVolumeTextureBudget(textureStorage, frameBufferStorage);
+            auto& volumeTexture = textureStorage.GetElement(TextureId::VolumeData);
+
+            if (auto streamedVolumeData = StreamVolume(Config::datasetPath, volumeTextureBudget, volumeTexture))
+            {
+                volumeData = std::move(streamedVolumeData).value();
+                volumeLoadingProgress.displayedStride = 1;
+                if (Config::enableDerivedDataCache)
+                {
+                    volumeData.SetContentHash(VolumeData::ComputeVolumeContentHash(volumeData));
+                }
+
+                if (Config::generateVolumePyramid)
+                {
+                    VolumeData::UploadVolumePyramid(volumeTexture, VolumeData::LoadOrMakeVolumePyramid(volumeData));
+                }
+            }
+            else
+            {
+                auto fullResolutionVolumeData = LoadVolume(Config::datasetPath);
+                volumeLoadingProgress.displayedStride = VolumeData::GetVolumeDownsamplingFactor(fullResolutionVolumeData.GetMetadata(), volumeTextureBudget);
+                volumeData = VolumeData::FitVolumeToTextureBudget(std::move(fullResolutionVolumeData), volumeTextureBudget);
+                if (Config::enableDerivedDataCache || Config::volumeResidencyPolicy == VolumeData::VolumeResidencyPolicy::ReleaseAfterUpload)
+                {
+                    volumeData.SetContentHash(VolumeData::ComputeVolumeContentHash(volumeData));
+                }
+
+                volumeTexture = MakeVolumeTexture(TextureId::VolumeData, volumeTexture.GetTextureUnitEnum(), volumeData);
+
+                if (Config::volumeResidencyPolicy == VolumeData::VolumeResidencyPolicy::ReleaseAfterUpload)
+                {
+                    volumeData = VolumeData::ReleaseVolumeHostCopy(std::move(volumeData), Config::derivedDataCachePath);
+                }
+            }
+        }
+
         return Storage {
             std::move(camera),
             std::move(displayProperties),
@@ -119,7 +211,9 @@ namespace Factory
             std::move(shaderStorage),
             std::move(frameBufferStorage),
             std::move(unitCube),
-            std::move(volumeData),
+            VolumeData::VolumeHandle{std::move(volumeData)},
+            std::move(volumeLoadingProgress),
+            std::move(timeSeriesPlaybackState),
             std::move(window)
         };
     }
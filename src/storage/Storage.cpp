@@ -13,7 +13,9 @@ Storage::Storage(
     ShaderStorage&& shaderStorage,
     FrameBufferStorage&& frameBufferStorage,
     UnitCube&& unitCube,
-    VolumeData::VolumeData&& volumeData,
+    VolumeData::VolumeHandle&& volumeData,
+    VolumeData::VolumeLoadingProgress&& volumeLoadingProgress,
+    VolumeData::TimeSeriesPlaybackState&& timeSeriesPlaybackState,
     Context::GlfwWindow&& window)
     : m_camera{std::move(camera)}
     , m_displayProperties{std::move(displayProperties)}
@@ -26,6 +28,8 @@ Storage::Storage(
     , m_shaderStorage{std::move(shaderStorage)}
     , m_frameBufferStorage{std::move(frameBufferStorage)}
     , m_volumeData{std::move(volumeData)}
+    , m_volumeLoadingProgress{std::move(volumeLoadingProgress)}
+    , m_timeSeriesPlaybackState{std::move(timeSeriesPlaybackState)}
     , m_window{std::move(window)}
 {
 }
@@ -50,6 +54,11 @@ const FrameBuffer& Storage::GetFrameBuffer(FrameBufferId frameBufferId) const
     return m_frameBufferStorage.GetElement(frameBufferId);
 }
 
+FrameBuffer& Storage::GetFrameBuffer(FrameBufferId frameBufferId)
+{
+    return m_frameBufferStorage.GetElement(frameBufferId);
+}
+
 Camera& Storage::GetCamera()
 {
     return m_camera;
@@ -135,11 +144,36 @@ const Context::GlfwWindow& Storage::GetWindow() const
     return m_window;
 }
 
-const VolumeData::VolumeData& Storage::GetVolumeData() const
+VolumeData::VolumeHandle& Storage::GetVolumeData()
+{
+    return m_volumeData;
+}
+
+const VolumeData::VolumeHandle& Storage::GetVolumeData() const
 {
     return m_volumeData;
 }
 
+VolumeData::VolumeLoadingProgress& Storage::GetVolumeLoadingProgress()
+{
+    return m_volumeLoadingProgress;
+}
+
+const VolumeData::VolumeLoadingProgress& Storage::GetVolumeLoadingProgress() const
+{
+    return m_volumeLoadingProgress;
+}
+
+VolumeData::TimeSeriesPlaybackState& Storage::GetTimeSeriesPlaybackState()
+{
+    return m_timeSeriesPlaybackState;
+}
+
+const VolumeData::TimeSeriesPlaybackState& Storage::GetTimeSeriesPlaybackState() const
+{
+    return m_timeSeriesPlaybackState;
+}
+
 void Storage::SaveApplicationState() const
 {
     Persistence::ApplicationState applicationState
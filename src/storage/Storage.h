@@ -19,7 +19,9 @@
 #include <primitives/UnitCube.h>
 #include <ssao/SsaoKernel.h>
 #include <ssao/SsaoUpdater.h>
-#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeHandle.h>
+#include <volumedata/TimeSeriesPlaybackState.h>
+#include <volumedata/VolumeLoadingProgress.h>
 
 #include <memory>
 #include <vector>
@@ -61,7 +63,9 @@ public:
     * @param shaderStorage The shader storage as rvalue reference to be moved into the storage.
     * @param frameBufferStorage The framebuffer storage as rvalue reference to be moved into the storage.
     * @param unitCube The unit cube primitive as rvalue reference to be moved into the storage.
-    * @param volumeData The volume data as rvalue reference to be moved into the storage.
+    * @param volumeData The handle of the volume data as rvalue reference to be moved into the storage.
+    * @param volumeLoadingProgress The volume loading progress as rvalue reference to be moved into the storage.
+    * @param timeSeriesPlaybackState The time series playback state as rvalue reference to be moved into the storage.
     * @param window The GLFW window as rvalue reference to be moved into the storage.
     */
     explicit Storage(
@@ -75,7 +79,9 @@ public:
         ShaderStorage&& shaderStorage,
         FrameBufferStorage&& frameBufferStorage,
         UnitCube&& unitCube,
-        VolumeData::VolumeData&& volumeData,
+        VolumeData::VolumeHandle&& volumeData,
+        VolumeData::VolumeLoadingProgress&& volumeLoadingProgress,
+        VolumeData::TimeSeriesPlaybackState&& timeSeriesPlaybackState,
         Context::GlfwWindow&& window);
 
     // TODO use concepts
@@ -121,12 +127,18 @@ public:
     * @return const FrameBuffer& The requested framebuffer.
     */
     const FrameBuffer& GetFrameBuffer(FrameBufferId frameBufferId) const;
+    FrameBuffer& GetFrameBuffer(FrameBufferId frameBufferId);
     const TextureStorage& GetTextureStorage() const;
     const ShaderStorage& GetShaderStorage() const;
     const FrameBufferStorage& GetFrameBufferStorage() const;
     Context::GlfwWindow& GetWindow();
     const Context::GlfwWindow& GetWindow() const;
-    const VolumeData::VolumeData& GetVolumeData() const;
+    VolumeData::VolumeHandle& GetVolumeData();
+    const VolumeData::VolumeHandle& GetVolumeData() const;
+    VolumeData::VolumeLoadingProgress& GetVolumeLoadingProgress();
+    const VolumeData::VolumeLoadingProgress& GetVolumeLoadingProgress() const;
+    VolumeData::TimeSeriesPlaybackState& GetTimeSeriesPlaybackState();
+    const VolumeData::TimeSeriesPlaybackState& GetTimeSeriesPlaybackState() const;
 
     /**
     * Saves the application state to an INI file.
@@ -146,7 +158,9 @@ private:
     TextureStorage m_textureStorage; /**< Storage for all OpenGL textures indexed by TextureId. */
     ShaderStorage m_shaderStorage; /**< Storage for all shader programs indexed by ShaderId. */
     FrameBufferStorage m_frameBufferStorage; /**< Storage for all framebuffers indexed by FrameBufferId. */
-    VolumeData::VolumeData m_volumeData; /**< 3D volume data with metadata (dimensions, bit depth). */
+    VolumeData::VolumeHandle m_volumeData; /**< Shared handle of the 3D volume data with metadata (dimensions, bit depth). */
+    VolumeData::VolumeLoadingProgress m_volumeLoadingProgress; /**< Progress of the background volume loading. */
+    VolumeData::TimeSeriesPlaybackState m_timeSeriesPlaybackState; /**< Playback controls and statistics of the time series. */
     Context::GlfwWindow m_window; /**< GLFW window with custom deleter for OpenGL context. */
 };
 
@@ -0,0 +1,32 @@
+#include <textures/GetGpuMemoryBudgetInBytes.h>
+
+#include <config/Config.h>
+
+namespace
+{
+    size_t GetFraction(size_t sizeInBytes)
+    {
+        return static_cast<size_t>(static_cast<double>(sizeInBytes) * Config::gpuMemoryBudgetFraction);
+    }
+} // anonymous namespace
+
+std::optional<size_t> GetGpuMemoryBudgetInBytes(const GpuMemoryInfo& gpuMemoryInfo, size_t usedMemoryInBytes)
+{
+    if (Config::gpuMemoryBudgetInBytes > 0)
+    {
+        return Config::gpuMemoryBudgetInBytes;
+    }
+
+    if (gpuMemoryInfo.totalMemoryInBytes)
+    {
+        return GetFraction(gpuMemoryInfo.totalMemoryInBytes.value());
+    }
+
+    // The available memory already excludes what the renderer allocated
+    if (gpuMemoryInfo.availableMemoryInBytes)
+    {
+        return GetFraction(gpuMemoryInfo.availableMemoryInBytes.value() + usedMemoryInBytes);
+    }
+
+    return std::nullopt;
+}
@@ -0,0 +1,33 @@
+/**
+* \file GetGpuMemoryBudgetInBytes.h
+*
+* \brief Function for determining how much video memory the renderer may allocate.
+*/
+
+#ifndef GET_GPU_MEMORY_BUDGET_IN_BYTES_H
+#define GET_GPU_MEMORY_BUDGET_IN_BYTES_H
+
+#include <textures/GpuMemoryInfo.h>
+
+#include <cstddef>
+#include <optional>
+
+/**
+* Determines the video memory budget of the renderer.
+*
+* Config::gpuMemoryBudgetInBytes is used if it is not 0. Otherwise the budget is
+* Config::gpuMemoryBudgetFraction of the total video memory reported by the driver, or, if
+* only the available memory is reported, of the available memory plus the memory the
+* renderer already uses. The remaining fraction is left to the driver, the window system
+* and other applications.
+*
+* @param gpuMemoryInfo The memory sizes queried from the current context.
+* @param usedMemoryInBytes The memory currently allocated by the renderer.
+* @return std::optional<size_t> The budget in bytes, or std::nullopt if neither the configuration nor the driver provide one.
+*
+* @see QueryGpuMemoryInfo for querying the memory sizes.
+* @see GetGpuMemoryUsageInBytes for the memory used by the renderer.
+*/
+std::optional<size_t> GetGpuMemoryBudgetInBytes(const GpuMemoryInfo& gpuMemoryInfo, size_t usedMemoryInBytes);
+
+#endif
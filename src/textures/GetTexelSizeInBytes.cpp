@@ -0,0 +1,85 @@
+#include <textures/GetTexelSizeInBytes.h>
+
+#include <glad/glad.h>
+
+namespace
+{
+    unsigned int GetNumChannels(GLenum format)
+    {
+        switch (format)
+        {
+            case GL_RED:
+            case GL_RED_INTEGER:
+            case GL_DEPTH_COMPONENT:
+                return 1;
+            case GL_RG:
+            case GL_RG_INTEGER:
+                return 2;
+            case GL_RGB:
+            case GL_RGB_INTEGER:
+                return 3;
+            default:
+                return 4;
+        }
+    }
+
+    unsigned int GetTypeSizeInBytes(GLenum type)
+    {
+        switch (type)
+        {
+            case GL_UNSIGNED_SHORT:
+            case GL_SHORT:
+            case GL_HALF_FLOAT:
+                return 2;
+            case GL_UNSIGNED_INT:
+            case GL_INT:
+            case GL_FLOAT:
+                return 4;
+            default:
+                return 1;
+        }
+    }
+} // anonymous namespace
+
+unsigned int GetTexelSizeInBytes(GLenum internalFormat, GLenum format, GLenum type)
+{
+    switch (internalFormat)
+    {
+        case GL_R8:
+        case GL_R8UI:
+            return 1;
+        case GL_RG8:
+        case GL_RG8UI:
+        case GL_R16:
+        case GL_R16F:
+        case GL_R16UI:
+        case GL_DEPTH_COMPONENT16:
+            return 2;
+        case GL_RGB8:
+            return 3;
+        case GL_RGBA8:
+        case GL_RGBA8UI:
+        case GL_RG16:
+        case GL_RG16F:
+        case GL_R32F:
+        case GL_R32UI:
+        case GL_DEPTH_COMPONENT:
+        case GL_DEPTH_COMPONENT24:
+        case GL_DEPTH_COMPONENT32F:
+        case GL_DEPTH24_STENCIL8:
+            return 4;
+        case GL_RGB16:
+        case GL_RGB16F:
+            return 6;
+        case GL_RGBA16:
+        case GL_RGBA16F:
+        case GL_RG32F:
+            return 8;
+        case GL_RGB32F:
+            return 12;
+        case GL_RGBA32F:
+            return 16;
+        default:
+            return GetNumChannels(format) * GetTypeSizeInBytes(type);
+    }
+}
@@ -0,0 +1,29 @@
+/**
+* \file GetTexelSizeInBytes.h
+*
+* \brief Function for estimating the video memory of a single texel.
+*/
+
+#ifndef GET_TEXEL_SIZE_IN_BYTES_H
+#define GET_TEXEL_SIZE_IN_BYTES_H
+
+/**
+* Estimates the number of bytes a texel or renderbuffer pixel occupies in video memory.
+*
+* Sized internal formats (e.g., GL_R16, GL_RGBA16F, GL_R32UI) map to their exact size.
+* For unsized internal formats (e.g., GL_RGBA, GL_RED) the driver chooses the storage,
+* which is estimated from the number of channels of the pixel format and the size of the
+* pixel type. Depth formats without an explicit size are counted as 32 bits. Drivers may
+* also pad three-channel formats and add alignment, so the result is an estimate.
+*
+* @param internalFormat The internal format of the texture or renderbuffer.
+* @param format The pixel format of the uploaded data, GL_NONE for renderbuffers.
+* @param type The pixel type of the uploaded data, GL_NONE for renderbuffers.
+* @return unsigned int The size of one texel in bytes.
+*
+* @see Texture::GetSizeInBytes for the size of a whole texture.
+* @see FrameBuffer::GetRenderBufferSizeInBytes for the size of the renderbuffers of a framebuffer.
+*/
+unsigned int GetTexelSizeInBytes(unsigned int internalFormat, unsigned int format, unsigned int type);
+
+#endif
@@ -0,0 +1,46 @@
+#include <textures/GetTextureName.h>
+
+const char* GetTextureName(TextureId textureId)
+{
+    switch (textureId)
+    {
+        case TextureId::VolumeData:
+            return "VolumeData";
+        case TextureId::TransferFunction:
+            return "TransferFunction";
+        case TextureId::SsaoPosition:
+            return "SsaoPosition";
+        case TextureId::SsaoNormal:
+            return "SsaoNormal";
+        case TextureId::SsaoAlbedo:
+            return "SsaoAlbedo";
+        case TextureId::Ssao:
+            return "Ssao";
+        case TextureId::SsaoBlur:
+            return "SsaoBlur";
+        case TextureId::SsaoNoise:
+            return "SsaoNoise";
+        case TextureId::SsaoPointLightsContribution:
+            return "SsaoPointLightsContribution";
+        case TextureId::OccupancyGrid:
+            return "OccupancyGrid";
+        case TextureId::GradientVolume:
+            return "GradientVolume";
+        case TextureId::BrickAtlas:
+            return "BrickAtlas";
+        case TextureId::PageTable:
+            return "PageTable";
+        case TextureId::PagedVolumeFeedback:
+            return "PagedVolumeFeedback";
+        case TextureId::PreIntegrationTable:
+            return "PreIntegrationTable";
+        case TextureId::LastFrame:
+            return "LastFrame";
+        case TextureId::ReducedVolumeColor:
+            return "ReducedVolumeColor";
+        case TextureId::RefinedVolumeColor:
+            return "RefinedVolumeColor";
+        default:
+            return "Unknown";
+    }
+}
@@ -0,0 +1,19 @@
+/**
+* \file GetTextureName.h
+*
+* \brief Function for getting a readable name of a texture.
+*/
+
+#ifndef GET_TEXTURE_NAME_H
+#define GET_TEXTURE_NAME_H
+
+#include <textures/TextureId.h>
+
+/**
+* Gets a readable name of a texture for display in the GUI.
+* @param textureId The ID of the texture.
+* @return const char* The name, matching the TextureId enumerator.
+*/
+const char* GetTextureName(TextureId textureId);
+
+#endif
@@ -0,0 +1,32 @@
+/**
+* \file GpuMemoryInfo.h
+*
+* \brief Texture size limits and video memory reported by the OpenGL implementation.
+*/
+
+#ifndef GPU_MEMORY_INFO_H
+#define GPU_MEMORY_INFO_H
+
+#include <cstddef>
+#include <optional>
+
+/**
+* \struct GpuMemoryInfo
+*
+* \brief Limits and video memory sizes queried from the current OpenGL context.
+*
+* OpenGL 3.3 core has no portable way to query video memory. The sizes are only
+* available if the driver exposes GL_NVX_gpu_memory_info or GL_ATI_meminfo, which
+* report the total and the currently available memory respectively.
+*
+* @see QueryGpuMemoryInfo for querying the current context.
+* @see Factory::MakeVolumeTextureBudget for deriving the memory budget of the volume.
+*/
+struct GpuMemoryInfo
+{
+    unsigned int max3DTextureSize = 0; /**< GL_MAX_3D_TEXTURE_SIZE, the largest width, height and depth of a 3D texture. */
+    std::optional<size_t> totalMemoryInBytes; /**< Dedicated video memory, if reported by the driver. */
+    std::optional<size_t> availableMemoryInBytes; /**< Currently free video memory, if reported by the driver. */
+};
+
+#endif
@@ -1,21 +1,24 @@
 #include <textures/MakeTextures.h>
+#include <textures/MakeVolumeTexture.h>
 #include <textures/TextureId.h>
 
 #include <config/Config.h>
 #include <config/TransferFunctionConstants.h>
 #include <ssao/SsaoKernel.h>
-#include <volumedata/MakeVolumeDataTexture.h>
+#include <volumedata/VolumeData.h>
 
 #include <glad/glad.h>
 
+#include <array>
+
 namespace Factory
 {
     std::vector<Texture> MakeTextures(const VolumeData::VolumeData& volumeData, const SsaoKernel& ssaoKernel)
     {
         std::vector<Texture> textures;
-        textures.reserve(9);
+        textures.reserve(18);
         
-        textures.push_back(MakeVolumeDataTexture(TextureId::VolumeData, GL_TEXTURE1, volumeData));
+        textures.push_back(MakeVolumeTexture(TextureId::VolumeData, GL_TEXTURE1, volumeData));
         textures.emplace_back(TextureId::TransferFunction, GL_TEXTURE2, static_cast<unsigned int>(TransferFunctionConstants::textureSize), GL_RGBA, GL_RGBA, GL_UNSIGNED_BYTE, GL_LINEAR, GL_CLAMP_TO_EDGE, nullptr);
         textures.emplace_back(TextureId::SsaoPosition, GL_TEXTURE3, Config::windowWidth, Config::windowHeight, GL_RGBA16F, GL_RGBA, GL_FLOAT, GL_NEAREST, GL_CLAMP_TO_EDGE);
         textures.emplace_back(TextureId::SsaoNormal, GL_TEXTURE4, Config::windowWidth, Config::windowHeight, GL_RGBA16F, GL_RGBA, GL_FLOAT, GL_NEAREST, GL_REPEAT);
@@ -25,6 +28,30 @@ namespace Factory
         textures.emplace_back(TextureId::SsaoNoise, GL_TEXTURE8, Config::defaultSsaoNoiseSize, Config::defaultSsaoNoiseSize, GL_RGBA32F, GL_RGB, GL_FLOAT, GL_NEAREST, GL_REPEAT, ssaoKernel.GetNoise());
         textures.emplace_back(TextureId::SsaoPointLightsContribution, GL_TEXTURE9, Config::windowWidth, Config::windowHeight, GL_RED, GL_RED, GL_FLOAT, GL_NEAREST, GL_REPEAT);
 
+        // Filled by the OccupancyGridUpdater, a single occupied brick at distance zero sampled at the Nyquist rate skips nothing
+        const std::array<unsigned char, 4> occupiedBrick{0, 1};
+        textures.emplace_back(TextureId::OccupancyGrid, GL_TEXTURE10, 1, 1, 1, GL_RG8UI, GL_RG_INTEGER, GL_UNSIGNED_BYTE, GL_NEAREST, GL_CLAMP_TO_EDGE, occupiedBrick.data());
+
+        // Filled by the GradientVolumeUpdater
+        const std::array<unsigned char, 4> flatGradient{128, 128, 0};
+        textures.emplace_back(TextureId::GradientVolume, GL_TEXTURE11, 1, 1, 1, GL_RGB8, GL_RGB, GL_UNSIGNED_BYTE, GL_LINEAR, GL_CLAMP_TO_EDGE, flatGradient.data());
+
+        // Allocated by the PagedVolumeStreamer, a single non-resident page table entry requests nothing
+        const std::array<unsigned char, 4> nonResidentBrick{};
+        textures.emplace_back(TextureId::BrickAtlas, GL_TEXTURE12, 1, 1, 1, GL_R8, GL_RED, GL_UNSIGNED_BYTE, GL_LINEAR, GL_CLAMP_TO_EDGE, nonResidentBrick.data());
+        textures.emplace_back(TextureId::PageTable, GL_TEXTURE13, 1, 1, 1, GL_RGBA8UI, GL_RGBA_INTEGER, GL_UNSIGNED_BYTE, GL_NEAREST, GL_CLAMP_TO_EDGE, nonResidentBrick.data());
+        textures.emplace_back(TextureId::PagedVolumeFeedback, GL_TEXTURE14, Config::pagedVolumeFeedbackWidth, Config::pagedVolumeFeedbackHeight, GL_R32UI, GL_RED_INTEGER, GL_UNSIGNED_INT, GL_NEAREST, GL_CLAMP_TO_EDGE);
+
+        // Filled by the TransferFunctionTextureUpdater
+        textures.emplace_back(TextureId::PreIntegrationTable, GL_TEXTURE15, static_cast<unsigned int>(TransferFunctionConstants::preIntegrationTableSize), static_cast<unsigned int>(TransferFunctionConstants::preIntegrationTableSize), GL_RGBA16F, GL_RGBA, GL_FLOAT, GL_LINEAR, GL_CLAMP_TO_EDGE);
+
+        // Only written and read by framebuffer blits, never sampled. Resized by the FrameBufferResizer.
+        textures.emplace_back(TextureId::LastFrame, GL_TEXTURE16, Config::windowWidth, Config::windowHeight, GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, GL_NEAREST, GL_CLAMP_TO_EDGE);
+
+        // Progressive refinement, the reduced image only uses the lower left part of its texture. Resized by the FrameBufferResizer.
+        textures.emplace_back(TextureId::ReducedVolumeColor, GL_TEXTURE17, Config::windowWidth, Config::windowHeight, GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, GL_NEAREST, GL_CLAMP_TO_EDGE);
+        textures.emplace_back(TextureId::RefinedVolumeColor, GL_TEXTURE18, Config::windowWidth, Config::windowHeight, GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, GL_NEAREST, GL_CLAMP_TO_EDGE);
+
         return textures;
     }
 }
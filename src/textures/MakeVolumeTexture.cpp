@@ -0,0 +1,42 @@
+#include <textures/MakeVolumeTexture.h>
+
+#include <config/Config.h>
+#include <volumedata/IsVolumeQuantized.h>
+#include <volumedata/LoadOrMakeVolumePyramid.h>
+#include <volumedata/MakeVolumeDataTexture.h>
+#include <volumedata/UploadVolumePyramid.h>
+#include <volumedata/VolumeData.h>
+
+#include <glad/glad.h>
+
+#include <array>
+
+namespace
+{
+    Texture MakeVolumeLevelZeroTexture(TextureId textureId, unsigned int textureUnit, const VolumeData::VolumeData& volumeData)
+    {
+        // Placeholder until a progressively loaded volume is published, or a quantized volume is uploaded by the VolumeQuantizationUpdater
+        if (!volumeData.IsValid() || VolumeData::IsVolumeQuantized(volumeData.GetMetadata()))
+        {
+            const std::array<unsigned char, 4> emptyVoxel{};
+            return Texture{textureId, textureUnit, 1, 1, 1, GL_R8, GL_RED, GL_UNSIGNED_BYTE, GL_LINEAR, GL_CLAMP_TO_EDGE, emptyVoxel.data()};
+        }
+
+        return Factory::MakeVolumeDataTexture(textureId, textureUnit, volumeData);
+    }
+} // anonymous namespace
+
+namespace Factory
+{
+    Texture MakeVolumeTexture(TextureId textureId, unsigned int textureUnit, const VolumeData::VolumeData& volumeData)
+    {
+        auto texture = MakeVolumeLevelZeroTexture(textureId, textureUnit, volumeData);
+
+        if (Config::generateVolumePyramid && volumeData.IsValid() && !VolumeData::IsVolumeQuantized(volumeData.GetMetadata()))
+        {
+            VolumeData::UploadVolumePyramid(texture, VolumeData::LoadOrMakeVolumePyramid(volumeData));
+        }
+
+        return texture;
+    }
+}
@@ -0,0 +1,40 @@
+/**
+* \file MakeVolumeTexture.h
+*
+* \brief Factory function for creating the volume data texture with its mip levels.
+*/
+
+#ifndef MAKE_VOLUME_TEXTURE_H
+#define MAKE_VOLUME_TEXTURE_H
+
+#include <textures/Texture.h>
+#include <textures/TextureId.h>
+
+namespace VolumeData
+{
+    class VolumeData;
+}
+
+namespace Factory
+{
+    /**
+    * Creates the 3D texture of a volume held in host memory, or mapped from its file.
+    *
+    * The volume is uploaded in one call, and its mip levels are downsampled and uploaded
+    * if Config::generateVolumePyramid is set. An invalid or
+    * quantized volume yields a single-voxel placeholder, to be replaced by the
+    * ProgressiveVolumeLoader or the VolumeQuantizationUpdater.
+    *
+    * @param textureId The ID of the texture.
+    * @param textureUnit The texture unit to bind to (e.g., GL_TEXTURE1).
+    * @param volumeData The volume to upload.
+    * @return Texture The volume texture.
+    *
+    * @see Factory::MakeTextures for creating all textures.
+    * @see Factory::MakeVolumeDataTexture for the upload from host memory.
+    * @see Factory::MakeStreamedVolumeDataTexture for streaming a texture from a file before loading the volume.
+    */
+    Texture MakeVolumeTexture(TextureId textureId, unsigned int textureUnit, const VolumeData::VolumeData& volumeData);
+}
+
+#endif
@@ -0,0 +1,69 @@
+#include <textures/QueryGpuMemoryInfo.h>
+
+#include <glad/glad.h>
+
+#include <string_view>
+
+namespace Constants
+{
+    // Not part of the core profile headers, see the GL_NVX_gpu_memory_info and GL_ATI_meminfo specifications
+    constexpr GLenum gpuMemoryInfoTotalAvailableMemoryNvx = 0x9048;
+    constexpr GLenum gpuMemoryInfoCurrentAvailableVideoMemoryNvx = 0x9049;
+    constexpr GLenum textureFreeMemoryAti = 0x87FC;
+    constexpr size_t bytesPerKilobyte = 1024;
+}
+
+namespace
+{
+    bool IsExtensionSupported(std::string_view extensionName)
+    {
+        GLint numExtensions = 0;
+        glGetIntegerv(GL_NUM_EXTENSIONS, &numExtensions);
+        for (GLint i = 0; i < numExtensions; ++i)
+        {
+            const auto* extension = reinterpret_cast<const char*>(glGetStringi(GL_EXTENSIONS, static_cast<GLuint>(i)));
+            if (extension != nullptr && extensionName == extension)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    size_t KilobytesToBytes(GLint kilobytes)
+    {
+        return static_cast<size_t>(kilobytes) * Constants::bytesPerKilobyte;
+    }
+} // anonymous namespace
+
+GpuMemoryInfo QueryGpuMemoryInfo()
+{
+    auto gpuMemoryInfo = GpuMemoryInfo{};
+
+    GLint max3DTextureSize = 0;
+    glGetIntegerv(GL_MAX_3D_TEXTURE_SIZE, &max3DTextureSize);
+    gpuMemoryInfo.max3DTextureSize = static_cast<unsigned int>(max3DTextureSize);
+
+    // Checking the extension list is cheaper than recovering from GL_INVALID_ENUM
+    static const bool isNvxMemoryInfoSupported = IsExtensionSupported("GL_NVX_gpu_memory_info");
+    static const bool isAtiMemInfoSupported = IsExtensionSupported("GL_ATI_meminfo");
+
+    if (isNvxMemoryInfoSupported)
+    {
+        GLint totalMemoryInKilobytes = 0;
+        GLint availableMemoryInKilobytes = 0;
+        glGetIntegerv(Constants::gpuMemoryInfoTotalAvailableMemoryNvx, &totalMemoryInKilobytes);
+        glGetIntegerv(Constants::gpuMemoryInfoCurrentAvailableVideoMemoryNvx, &availableMemoryInKilobytes);
+        gpuMemoryInfo.totalMemoryInBytes = KilobytesToBytes(totalMemoryInKilobytes);
+        gpuMemoryInfo.availableMemoryInBytes = KilobytesToBytes(availableMemoryInKilobytes);
+    }
+    else if (isAtiMemInfoSupported)
+    {
+        // Total free memory, largest free block, total and largest free auxiliary memory
+        GLint textureFreeMemory[4] = {};
+        glGetIntegerv(Constants::textureFreeMemoryAti, textureFreeMemory);
+        gpuMemoryInfo.availableMemoryInBytes = KilobytesToBytes(textureFreeMemory[0]);
+    }
+
+    return gpuMemoryInfo;
+}
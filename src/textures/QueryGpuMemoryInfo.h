@@ -0,0 +1,26 @@
+/**
+* \file QueryGpuMemoryInfo.h
+*
+* \brief Function for querying texture size limits and video memory from OpenGL.
+*/
+
+#ifndef QUERY_GPU_MEMORY_INFO_H
+#define QUERY_GPU_MEMORY_INFO_H
+
+#include <textures/GpuMemoryInfo.h>
+
+/**
+* Queries the texture size limits and, where supported, the video memory of the current context.
+*
+* The maximum 3D texture size is always queried. The total and available video memory are
+* read via GL_NVX_gpu_memory_info on NVIDIA drivers and the available memory via
+* GL_ATI_meminfo on AMD drivers. The queries are cheap and may be repeated every frame.
+* Requires a current OpenGL context.
+*
+* @return GpuMemoryInfo The queried limits and memory sizes.
+*
+* @see GpuMemoryInfo for the returned values.
+*/
+GpuMemoryInfo QueryGpuMemoryInfo();
+
+#endif
@@ -1,4 +1,5 @@
 #include <textures/Texture.h>
+#include <textures/GetTexelSizeInBytes.h>
 #include <textures/TextureUnitMapping.h>
 
 #include <glad/glad.h>
@@ -16,6 +17,7 @@ Texture::Texture(TextureId textureId, GLenum textureUnit, unsigned int width, GL
     , m_glTextureId{}
     , m_textureUnitEnum{textureUnit}
     , m_textureUnitInt{TextureUnitMapping::GLenumToUnsignedInt(textureUnit)}
+    , m_sizeInBytes{0}
 {
     Create1D(width, internalFormat, format, type, filterParameter, wrapParameter, data);
 }
@@ -26,6 +28,7 @@ Texture::Texture(TextureId textureId, GLenum textureUnit, unsigned int width, un
     , m_glTextureId{}
     , m_textureUnitEnum{textureUnit}
     , m_textureUnitInt{TextureUnitMapping::GLenumToUnsignedInt(textureUnit)}
+    , m_sizeInBytes{0}
 {
     Create2D(width, height, internalFormat, format, type, filterParameter, wrapParameter, nullptr);
 }
@@ -36,6 +39,7 @@ Texture::Texture(TextureId textureId, GLenum textureUnit, unsigned int width, un
     , m_glTextureId{}
     , m_textureUnitEnum{textureUnit}
     , m_textureUnitInt{TextureUnitMapping::GLenumToUnsignedInt(textureUnit)}
+    , m_sizeInBytes{0}
 {
     Create2D(width, height, internalFormat, format, type, filterParameter, wrapParameter, data);
 }
@@ -46,6 +50,7 @@ Texture::Texture(TextureId textureId, GLenum textureUnit, unsigned int width, un
     , m_glTextureId{}
     , m_textureUnitEnum{textureUnit}
     , m_textureUnitInt{TextureUnitMapping::GLenumToUnsignedInt(textureUnit)}
+    , m_sizeInBytes{0}
 {
     Create3D(width, height, depth, internalFormat, format, type, filterParameter, wrapParameter, data);
 }
@@ -64,6 +69,7 @@ Texture::Texture(Texture&& other) noexcept
     , m_glTextureId{other.m_glTextureId}
     , m_textureUnitEnum{other.m_textureUnitEnum}
     , m_textureUnitInt{other.m_textureUnitInt}
+    , m_sizeInBytes{other.m_sizeInBytes}
 {
     other.m_glTextureId = 0;
 }
@@ -81,6 +87,7 @@ Texture& Texture::operator=(Texture&& other) noexcept
         m_glTextureId = other.m_glTextureId;
         m_textureUnitEnum = other.m_textureUnitEnum;
         m_textureUnitInt = other.m_textureUnitInt;
+        m_sizeInBytes = other.m_sizeInBytes;
         other.m_glTextureId = 0;
     }
     return *this;
@@ -91,6 +98,7 @@ void Texture::Create1D(unsigned int width, GLenum internalFormat, GLenum format,
     glGenTextures(1, &m_glTextureId);
     glBindTexture(GL_TEXTURE_1D, m_glTextureId);
     glTexImage1D(GL_TEXTURE_1D, 0, internalFormat, width, 0, format, type, data);
+    m_sizeInBytes = size_t{width} * GetTexelSizeInBytes(internalFormat, format, type);
     glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MIN_FILTER, filterParameter);
     glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_MAG_FILTER, filterParameter);
     glTexParameteri(GL_TEXTURE_1D, GL_TEXTURE_WRAP_S, wrapParameter);
@@ -101,6 +109,7 @@ void Texture::Create2D(unsigned int width, unsigned int height, GLenum internalF
     glGenTextures(1, &m_glTextureId);
     glBindTexture(GL_TEXTURE_2D, m_glTextureId);
     glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, format, type, data);
+    m_sizeInBytes = size_t{width} * height * GetTexelSizeInBytes(internalFormat, format, type);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, filterParameter);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, filterParameter);
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, wrapParameter);
@@ -112,6 +121,7 @@ void Texture::Create3D(unsigned int width, unsigned int height, unsigned int dep
     glGenTextures(1, &m_glTextureId);
     glBindTexture(GL_TEXTURE_3D, m_glTextureId);
     glTexImage3D(GL_TEXTURE_3D, 0, internalFormat, width, height, depth, 0, format, type, data);
+    m_sizeInBytes = size_t{width} * height * depth * GetTexelSizeInBytes(internalFormat, format, type);
     glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, filterParameter);
     glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAG_FILTER, filterParameter);
     glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_S, wrapParameter);
@@ -119,12 +129,43 @@ void Texture::Create3D(unsigned int width, unsigned int height, unsigned int dep
     glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_WRAP_R, wrapParameter);
 }
 
+void Texture::SetImage2D(unsigned int width, unsigned int height, GLenum internalFormat, GLenum format, GLenum type, const void* data)
+{
+    glBindTexture(GL_TEXTURE_2D, m_glTextureId);
+    glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, format, type, data);
+    m_sizeInBytes = size_t{width} * height * GetTexelSizeInBytes(internalFormat, format, type);
+}
+
+void Texture::SetImage3D(unsigned int level, unsigned int width, unsigned int height, unsigned int depth, GLenum internalFormat, GLenum format, GLenum type, const void* data)
+{
+    glBindTexture(GL_TEXTURE_3D, m_glTextureId);
+    glTexImage3D(GL_TEXTURE_3D, level, internalFormat, width, height, depth, 0, format, type, data);
+
+    // Reallocating level 0 starts a new chain, the mip levels are counted as they are filled
+    const size_t levelSizeInBytes = size_t{width} * height * depth * GetTexelSizeInBytes(internalFormat, format, type);
+    m_sizeInBytes = (level == 0) ? levelSizeInBytes : m_sizeInBytes + levelSizeInBytes;
+}
+
+void Texture::SetMaxLevel3D(unsigned int maxLevel)
+{
+    glBindTexture(GL_TEXTURE_3D, m_glTextureId);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MAX_LEVEL, maxLevel);
+    glTexParameteri(GL_TEXTURE_3D, GL_TEXTURE_MIN_FILTER, (maxLevel > 0) ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+}
+
 void Texture::AddBorder()
 {
     glBindTexture(GL_TEXTURE_2D, m_glTextureId);
     glTexParameterfv(GL_TEXTURE_2D, GL_TEXTURE_BORDER_COLOR, Constants::borderColor);
 }
 
+void Texture::SetSubImage3D(unsigned int xOffset, unsigned int yOffset, unsigned int zOffset, unsigned int width, unsigned int height, unsigned int depth, GLenum format, GLenum type, const void* data)
+{
+    glBindTexture(GL_TEXTURE_3D, m_glTextureId);
+    glTexSubImage3D(GL_TEXTURE_3D, 0, xOffset, yOffset, zOffset, width, height, depth, format, type, data);
+}
+
 TextureId Texture::GetId() const
 {
     return m_textureId;
@@ -150,6 +191,11 @@ TextureType Texture::GetTextureType() const
     return m_textureType;
 }
 
+size_t Texture::GetSizeInBytes() const
+{
+    return m_sizeInBytes;
+}
+
 void Texture::Bind() const
 {
     glActiveTexture(m_textureUnitEnum);
@@ -9,6 +9,8 @@
 
 #include <textures/TextureId.h>
 #include <textures/TextureType.h>
+
+#include <cstddef>
 #include <string>
 
 /**
@@ -20,6 +22,10 @@
 * and wrapping modes. Each texture is bound to a specific texture unit and identified
 * by a TextureId for type-safe retrieval from Storage.
 *
+* The texture keeps track of the video memory it allocates, estimated from the internal
+* format and the dimensions of each level, so that GPU memory usage can be reported
+* without driver-specific queries.
+*
 * Textures are created via Factory::MakeTextures() which configures all textures needed
 * for the rendering pipeline including volume data textures, transfer function textures,
 * framebuffer attachments, and SSAO noise textures.
@@ -74,12 +80,70 @@ public:
     */
     void AddBorder();
 
+    /**
+    * Reallocates a 2D texture with a new size, keeping its OpenGL object.
+    * Framebuffers the texture is attached to therefore stay valid.
+    * @param width The new width in texels.
+    * @param height The new height in texels.
+    * @param internalFormat The internal format (e.g., GL_RGBA8).
+    * @param format The format of the data (e.g., GL_RGBA).
+    * @param type The data type (e.g., GL_UNSIGNED_BYTE).
+    * @param data Pointer to the texel data, or nullptr to leave the texels uninitialized.
+    * @return void
+    */
+    void SetImage2D(unsigned int width, unsigned int height, unsigned int internalFormat, unsigned int format, unsigned int type, const void* data);
+
+    /**
+    * Replaces a box of texels of a 3D texture.
+    * If a pixel unpack buffer is bound, data is interpreted as an offset into that buffer.
+    * @param xOffset The x offset of the box in texels.
+    * @param yOffset The y offset of the box in texels.
+    * @param zOffset The z offset of the box in texels.
+    * @param width The width of the box in texels.
+    * @param height The height of the box in texels.
+    * @param depth The depth of the box in texels.
+    * @param format The format of the data (e.g., GL_RED).
+    * @param type The data type (e.g., GL_UNSIGNED_BYTE).
+    * @param data Pointer to the texel data, or offset into the bound pixel unpack buffer.
+    * @return void
+    */
+    void SetSubImage3D(unsigned int xOffset, unsigned int yOffset, unsigned int zOffset, unsigned int width, unsigned int height, unsigned int depth, unsigned int format, unsigned int type, const void* data);
+
+    /**
+    * Allocates and fills one mip level of a 3D texture.
+    * @param level The mip level, 0 being the full-resolution level.
+    * @param width The width of the level in texels.
+    * @param height The height of the level in texels.
+    * @param depth The depth of the level in texels.
+    * @param internalFormat The internal format, matching that of level 0.
+    * @param format The format of the data (e.g., GL_RED).
+    * @param type The data type (e.g., GL_UNSIGNED_BYTE).
+    * @param data Pointer to the texel data.
+    * @return void
+    */
+    void SetImage3D(unsigned int level, unsigned int width, unsigned int height, unsigned int depth, unsigned int internalFormat, unsigned int format, unsigned int type, const void* data);
+
+    /**
+    * Sets the highest mip level of a 3D texture that is used for sampling.
+    * Switches minification to trilinear mipmap filtering if maxLevel is greater than 0,
+    * and back to linear filtering of level 0 otherwise.
+    * @param maxLevel The highest mip level that has been filled.
+    * @return void
+    */
+    void SetMaxLevel3D(unsigned int maxLevel);
+
     unsigned int GetGlId() const;
     unsigned int GetTextureUnit() const;
     unsigned int GetTextureUnitEnum() const;
     TextureId GetId() const;
     TextureType GetTextureType() const;
 
+    /**
+    * Gets the estimated video memory of all allocated levels of this texture.
+    * @return size_t The size in bytes.
+    */
+    size_t GetSizeInBytes() const;
+
     /**
     * Binds this texture to its assigned texture unit.
     * @return void
@@ -108,6 +172,7 @@ private:
     unsigned int m_glTextureId; /**< The OpenGL texture object handle. */
     unsigned int m_textureUnitEnum; /**< The GL_TEXTURE# enumeration value. */
     unsigned int m_textureUnitInt; /**< The texture unit as an integer (e.g., 0 for GL_TEXTURE0). */
+    size_t m_sizeInBytes; /**< Estimated video memory of all allocated levels. */
 };
 
 #endif
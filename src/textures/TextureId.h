@@ -14,7 +14,10 @@
 *
 * Each texture ID corresponds to a texture resource created via MakeTextures
 * and stored in Storage. Textures include volume data, transfer functions,
-* G-buffer attachments, SSAO outputs, and noise textures.
+* G-buffer attachments, SSAO outputs, noise textures, the occupancy grid, the gradient volume,
+* the brick atlas, page table and feedback buffer of the paged rendering path, the
+* pre-integrated transfer function, the reduced and refined volume images of progressive
+* refinement and the copy of the last rendered frame.
 *
 * @see Texture for texture creation and management.
 * @see MakeTextures for texture initialization.
@@ -31,6 +34,15 @@ enum class TextureId
     SsaoBlur,                      /**< Blurred SSAO occlusion values (after blur). */
     SsaoNoise,                     /**< Random rotation noise texture for SSAO sampling. */
     SsaoPointLightsContribution,   /**< Point light contribution texture for lighting. */
+    OccupancyGrid,                 /**< 3D integer texture of brick distances to the nearest visible brick and per-brick step multipliers. */
+    GradientVolume,                /**< 3D texture of encoded volume gradients for shading. */
+    BrickAtlas,                    /**< 3D texture holding the resident bricks of a paged volume. */
+    PageTable,                     /**< 3D texture mapping the bricks of all levels of a paged volume to atlas slots. */
+    PagedVolumeFeedback,           /**< Low-resolution 2D texture of the bricks requested by the ray caster. */
+    PreIntegrationTable,           /**< 2D texture of the transfer function integrated between front and back sample values. */
+    LastFrame,                     /**< Copy of the last rendered scene without the GUI. */
+    ReducedVolumeColor,            /**< Volume ray cast at reduced resolution while the scene changes. */
+    RefinedVolumeColor,            /**< Volume at viewport resolution, upscaled from the reduced one and refined tile by tile. */
     Unknown                        /**< Sentinel value for uninitialized or invalid texture IDs. */
 };
 
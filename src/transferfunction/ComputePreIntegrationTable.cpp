@@ -0,0 +1,59 @@
+#include <transferfunction/ComputePreIntegrationTable.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <execution>
+#include <numeric>
+#include <ranges>
+
+namespace Constants
+{
+    constexpr float maxOpacity = 0.999f; /**< Keeps the extinction of fully opaque values finite. */
+}
+
+namespace
+{
+    /// Extinction coefficient and extinction-weighted color of a transfer function sample
+    glm::vec4 GetExtinction(const glm::vec4& rgba)
+    {
+        const float tau = -std::log(1.0f - std::clamp(rgba.a, 0.0f, Constants::maxOpacity));
+        return glm::vec4{glm::clamp(glm::vec3{rgba}, 0.0f, 1.0f) * tau, tau};
+    }
+} // anonymous namespace
+
+std::vector<glm::vec4> ComputePreIntegrationTable(std::span<const glm::vec4> transferFunction)
+{
+    const size_t size = transferFunction.size();
+    if (size < 2)
+    {
+        return {};
+    }
+
+    std::vector<glm::vec4> extinction(size);
+    std::transform(std::execution::par_unseq, transferFunction.begin(), transferFunction.end(), extinction.begin(), GetExtinction);
+
+    // prefixSums[i] is the integral from value 0 to value i with the trapezoidal rule, in units of table entries
+    std::vector<glm::vec4> prefixSums(size);
+    prefixSums[0] = glm::vec4{0.0f};
+    std::transform(std::execution::par_unseq, extinction.begin(), extinction.end() - 1, extinction.begin() + 1, prefixSums.begin() + 1, [](const glm::vec4& lower, const glm::vec4& upper)
+    {
+        return 0.5f * (lower + upper);
+    });
+    std::inclusive_scan(std::execution::par, prefixSums.begin(), prefixSums.end(), prefixSums.begin());
+
+    std::vector<glm::vec4> table(size * size);
+    const auto backIndices = std::views::iota(size_t{0}, size);
+    std::for_each(std::execution::par_unseq, backIndices.begin(), backIndices.end(), [&](size_t back)
+    {
+        glm::vec4* row = table.data() + back * size;
+        for (size_t front = 0; front < size; ++front)
+        {
+            row[front] = (front == back)
+                ? extinction[front]
+                : (prefixSums[back] - prefixSums[front]) / (static_cast<float>(back) - static_cast<float>(front));
+        }
+    });
+
+    return table;
+}
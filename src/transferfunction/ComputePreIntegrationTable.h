@@ -0,0 +1,38 @@
+/**
+* \file ComputePreIntegrationTable.h
+*
+* \brief Pre-integration of the transfer function over ray segments between two sample values.
+*/
+
+#ifndef COMPUTE_PRE_INTEGRATION_TABLE_H
+#define COMPUTE_PRE_INTEGRATION_TABLE_H
+
+#include <glm/glm.hpp>
+
+#include <span>
+#include <vector>
+
+/**
+* Computes the average extinction and emission of the transfer function between every pair of sample values.
+*
+* A ray segment whose value varies linearly from a front to a back sample passes through all
+* values in between, so thin features of the transfer function contribute even if no sample
+* hits them. The opacities of the transfer function refer to a step of one voxel and are
+* converted to extinction coefficients, tau = -ln(1 - alpha). The table stores, per segment,
+* the average of tau and of tau-weighted color over the values between front and back. These
+* are independent of the segment length, so the ray caster derives the opacity of a segment
+* of any length as 1 - exp(-tau * length), and its color as the color average divided by tau.
+*
+* The averages are the differences of prefix sums of the transfer function, which are built
+* with a parallel scan, so the table is cheap enough to rebuild while control points are dragged.
+*
+* @param transferFunction N >= 2 samples of the transfer function at the values i / (N - 1), as vec4(rgb, opacity).
+* @return std::vector<glm::vec4> N * N entries vec4(average tau * rgb, average tau), the front value
+*     varying fastest, or an empty vector for fewer than two samples.
+*
+* @see TransferFunctionTextureUpdater for uploading the table.
+* @see InterpolateTransferFunction for sampling the transfer function.
+*/
+std::vector<glm::vec4> ComputePreIntegrationTable(std::span<const glm::vec4> transferFunction);
+
+#endif
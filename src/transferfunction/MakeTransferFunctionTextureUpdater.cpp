@@ -9,6 +9,7 @@ TransferFunctionTextureUpdater Factory::MakeTransferFunctionTextureUpdater(Stora
     return TransferFunctionTextureUpdater {
         storage.GetGuiUpdateFlags(),
         storage.GetGuiParameters().transferFunction,
-        storage.GetTexture(TextureId::TransferFunction)
+        storage.GetTexture(TextureId::TransferFunction),
+        storage.GetTexture(TextureId::PreIntegrationTable)
     };
 }
@@ -65,6 +65,8 @@ public:
     */
     void RemovePoint(size_t index);
 
+    bool operator==(const TransferFunction&) const = default;
+
 private:
     std::array<TransferFunctionControlPoint, TransferFunctionConstants::maxNumControlPoints> m_controlPoints; /**< Array of transfer function control points. */
     size_t m_numActivePoints; /**< Number of currently active control points. */
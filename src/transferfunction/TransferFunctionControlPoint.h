@@ -30,6 +30,8 @@ struct TransferFunctionControlPoint
     float value; /**< Scalar value in range [0, 1] representing position on transfer function. */
     glm::vec3 color; /**< RGB color components in range [0, 1]. */
     float opacity; /**< Opacity/alpha value in range [0, 1]. */
+
+    bool operator==(const TransferFunctionControlPoint&) const = default;
 };
 
 #endif
@@ -3,6 +3,7 @@
 #include <gui/GuiUpdateFlags.h>
 #include <textures/Texture.h>
 #include <textures/TextureId.h>
+#include <transferfunction/ComputePreIntegrationTable.h>
 #include <transferfunction/InterpolateTransferFunction.h>
 #include <transferfunction/TransferFunction.h>
 
@@ -13,6 +14,7 @@
 #include <execution>
 #include <ranges>
 #include <span>
+#include <vector>
 
 
 namespace
@@ -26,6 +28,15 @@ namespace
 
     constexpr auto textureIndices = MakeTextureIndices();
 
+    constexpr std::array<size_t, TransferFunctionConstants::preIntegrationTableSize> MakePreIntegrationTableIndices()
+    {
+        std::array<size_t, TransferFunctionConstants::preIntegrationTableSize> indices{};
+        std::ranges::copy(std::views::iota(size_t{ 0 }, TransferFunctionConstants::preIntegrationTableSize), indices.begin());
+        return indices;
+    }
+
+    constexpr auto preIntegrationTableIndices = MakePreIntegrationTableIndices();
+
     unsigned char FloatToUnsignedByte(float value)
     {
         return static_cast<unsigned char>(glm::clamp(value, 0.0f, 1.0f) * 255.0f);
@@ -35,15 +46,20 @@ namespace
 TransferFunctionTextureUpdater::TransferFunctionTextureUpdater(
     GuiUpdateFlags& guiUpdateFlags,
     TransferFunction& transferFunction,
-    Texture& transferFunctionTexture
+    Texture& transferFunctionTexture,
+    Texture& preIntegrationTableTexture
 )
     : m_textureData{}
+    , m_preIntegrationTableData{}
     , m_guiUpdateFlags{guiUpdateFlags}
     , m_transferFunction{transferFunction}
     , m_transferFunctionTexture{transferFunctionTexture}
+    , m_preIntegrationTableTexture{preIntegrationTableTexture}
 {
     UpdateTextureData();
     UpdateTexture();
+    UpdatePreIntegrationTableData();
+    UpdatePreIntegrationTableTexture();
 }
 
 void TransferFunctionTextureUpdater::Update()
@@ -52,6 +68,8 @@ void TransferFunctionTextureUpdater::Update()
     {
         UpdateTextureData();
         UpdateTexture();
+        UpdatePreIntegrationTableData();
+        UpdatePreIntegrationTableTexture();
         // TODO don't reset flag here
         m_guiUpdateFlags.transferFunctionChanged = false;
     }
@@ -81,6 +99,22 @@ void TransferFunctionTextureUpdater::UpdateTextureData()
     });
 }
 
+void TransferFunctionTextureUpdater::UpdatePreIntegrationTableData()
+{
+    const size_t numActivePoints = m_transferFunction.GetNumActivePoints();
+    const auto& controlPoints = m_transferFunction.GetControlPoints();
+    const auto activePoints = std::span{controlPoints.data(), numActivePoints};
+
+    std::array<glm::vec4, TransferFunctionConstants::preIntegrationTableSize> samples{};
+    std::for_each(std::execution::par_unseq, preIntegrationTableIndices.begin(), preIntegrationTableIndices.end(), [&](size_t i)
+    {
+        const float normalizedValue = static_cast<float>(i) / static_cast<float>(TransferFunctionConstants::preIntegrationTableSize - 1);
+        samples[i] = InterpolateTransferFunction(normalizedValue, activePoints);
+    });
+
+    m_preIntegrationTableData = ComputePreIntegrationTable(samples);
+}
+
 void TransferFunctionTextureUpdater::UpdateTexture()
 {
     m_transferFunctionTexture = Texture{
@@ -95,3 +129,19 @@ void TransferFunctionTextureUpdater::UpdateTexture()
         m_textureData.data()
     };
 }
+
+void TransferFunctionTextureUpdater::UpdatePreIntegrationTableTexture()
+{
+    m_preIntegrationTableTexture = Texture{
+        TextureId::PreIntegrationTable,
+        m_preIntegrationTableTexture.GetTextureUnitEnum(),
+        static_cast<unsigned int>(TransferFunctionConstants::preIntegrationTableSize),
+        static_cast<unsigned int>(TransferFunctionConstants::preIntegrationTableSize),
+        GL_RGBA16F,
+        GL_RGBA,
+        GL_FLOAT,
+        GL_LINEAR,
+        GL_CLAMP_TO_EDGE,
+        m_preIntegrationTableData.data()
+    };
+}
@@ -1,7 +1,7 @@
 /**
 * \file TransferFunctionTextureUpdater.h
 *
-* \brief Monitors and updates the transfer function 1D texture when control points change.
+* \brief Monitors and updates the transfer function textures when control points change.
 */
 
 #ifndef TRANSFER_FUNCTION_TEXTURE_UPDATER_H
@@ -9,7 +9,10 @@
 
 #include <config/TransferFunctionConstants.h>
 
+#include <glm/glm.hpp>
+
 #include <array>
+#include <vector>
 
 struct GuiUpdateFlags;
 class TransferFunction;
@@ -22,13 +25,16 @@ class Texture;
 *
 * Monitors GuiUpdateFlags to detect when the transfer function control points
 * have been edited via the GUI. When changes are detected, interpolates the
-* control points into a continuous 1D texture and uploads it to the GPU.
+* control points into a continuous 1D texture and pre-integrates them into a 2D
+* table indexed by the front and back sample values of a ray segment, and uploads
+* both to the GPU.
 *
-* The updater owns a buffer for the interpolated texture data and updates the
-* texture in Storage via reference. The update flag is cleared after processing.
+* The updater owns buffers for the texture data and updates the textures in
+* Storage via reference. The update flag is cleared after processing.
 *
 * @see TransferFunction for control point storage and manipulation.
 * @see InterpolateTransferFunction for generating texture data from control points.
+* @see ComputePreIntegrationTable for the pre-integration table.
 * @see GuiUpdateFlags for change detection.
 * @see Texture for OpenGL texture management.
 */
@@ -40,11 +46,13 @@ public:
     * @param guiUpdateFlags Reference to GUI update flags for change detection.
     * @param transferFunction Reference to the transfer function with control points.
     * @param transferFunctionTexture Reference to the 1D texture to update.
+    * @param preIntegrationTableTexture Reference to the 2D pre-integration table texture to update.
     */
     TransferFunctionTextureUpdater(
         GuiUpdateFlags& guiUpdateFlags,
         TransferFunction& transferFunction,
-        Texture& transferFunctionTexture
+        Texture& transferFunctionTexture,
+        Texture& preIntegrationTableTexture
     );
 
     /**
@@ -60,16 +68,28 @@ private:
     */
     void UpdateTextureData();
 
+    /**
+    * Samples the control points and pre-integrates them into the table data.
+    */
+    void UpdatePreIntegrationTableData();
+
     /**
     * Uploads the interpolated texture data to the GPU.
     */
     void UpdateTexture();
 
+    /**
+    * Uploads the pre-integration table data to the GPU.
+    */
+    void UpdatePreIntegrationTableTexture();
+
 private:
     std::array<unsigned char, TransferFunctionConstants::textureDataSize> m_textureData; /**< Buffer for interpolated RGBA texture data. */
+    std::vector<glm::vec4> m_preIntegrationTableData; /**< Buffer for the pre-integration table, front value varying fastest. */
     GuiUpdateFlags& m_guiUpdateFlags; /**< Reference to GUI update flags. */
     TransferFunction& m_transferFunction; /**< Reference to transfer function with control points. */
     Texture& m_transferFunctionTexture; /**< Reference to 1D texture to update. */
+    Texture& m_preIntegrationTableTexture; /**< Reference to 2D pre-integration table texture to update. */
 };
 
 #endif
@@ -0,0 +1,100 @@
+#include <volumedata/BrickAtlasAllocator.h>
+
+#include <algorithm>
+
+VolumeData::BrickAtlasAllocator::BrickAtlasAllocator(uint32_t numSlots, uint64_t numProtectedFrames)
+    : m_numSlots{numSlots}
+    , m_numProtectedFrames{std::max(numProtectedFrames, uint64_t{1})}
+    , m_frame{0}
+    , m_numPinnedBricks{0}
+    , m_freeSlots{}
+    , m_recency{}
+    , m_entries{}
+{
+    // Hand out low slots first, which keeps a sparsely filled atlas compact
+    m_freeSlots.reserve(numSlots);
+    for (uint32_t slot = numSlots; slot > 0; --slot)
+    {
+        m_freeSlots.push_back(slot - 1);
+    }
+}
+
+std::optional<uint32_t> VolumeData::BrickAtlasAllocator::Find(uint32_t key) const
+{
+    if (const auto it = m_entries.find(key); it != m_entries.end())
+    {
+        return it->second.slot;
+    }
+    return std::nullopt;
+}
+
+void VolumeData::BrickAtlasAllocator::Touch(uint32_t key)
+{
+    const auto it = m_entries.find(key);
+    if (it == m_entries.end())
+    {
+        return;
+    }
+
+    auto& entry = it->second;
+    entry.lastUsedFrame = m_frame;
+    if (entry.recencyPosition)
+    {
+        m_recency.splice(m_recency.begin(), m_recency, *entry.recencyPosition);
+    }
+}
+
+void VolumeData::BrickAtlasAllocator::NextFrame()
+{
+    ++m_frame;
+}
+
+std::optional<VolumeData::BrickAtlasAllocator::Allocation> VolumeData::BrickAtlasAllocator::Allocate(uint32_t key, bool isPinned)
+{
+    if (const auto it = m_entries.find(key); it != m_entries.end())
+    {
+        Touch(key);
+        return Allocation{it->second.slot, std::nullopt};
+    }
+
+    auto allocation = Allocation{0, std::nullopt};
+
+    if (!m_freeSlots.empty())
+    {
+        allocation.slot = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    }
+    else
+    {
+        if (m_recency.empty())
+        {
+            return std::nullopt;
+        }
+
+        const uint32_t evictedKey = m_recency.back();
+        const auto evictedIt = m_entries.find(evictedKey);
+        if (evictedIt->second.lastUsedFrame + m_numProtectedFrames > m_frame)
+        {
+            return std::nullopt;
+        }
+
+        allocation.slot = evictedIt->second.slot;
+        allocation.evictedKey = evictedKey;
+        m_recency.pop_back();
+        m_entries.erase(evictedIt);
+    }
+
+    auto entry = Entry{allocation.slot, m_frame, std::nullopt};
+    if (isPinned)
+    {
+        ++m_numPinnedBricks;
+    }
+    else
+    {
+        m_recency.push_front(key);
+        entry.recencyPosition = m_recency.begin();
+    }
+    m_entries.emplace(key, entry);
+
+    return allocation;
+}
@@ -0,0 +1,107 @@
+/**
+* \file BrickAtlasAllocator.h
+*
+* \brief Least-recently-used assignment of bricks to the slots of a brick atlas.
+*/
+
+#ifndef BRICK_ATLAS_ALLOCATOR_H
+#define BRICK_ATLAS_ALLOCATOR_H
+
+#include <cstdint>
+#include <list>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace VolumeData
+{
+    /**
+    * \class BrickAtlasAllocator
+    *
+    * \brief Tracks which brick occupies which slot of a fixed-size brick atlas.
+    *
+    * Bricks are identified by their PagedBrickKey. When all slots are taken, allocating a
+    * new brick evicts the least recently used one. Bricks used within the last
+    * numProtectedFrames frames are never evicted, so that a working set larger than the
+    * atlas makes the renderer fall back to coarser levels instead of thrashing the atlas
+    * every frame. Pinned bricks are never evicted at all.
+    *
+    * The allocator only does the bookkeeping; uploading the brick into the slot and
+    * updating the page table is left to the caller.
+    *
+    * @see PagedBrickKey for the brick keys.
+    * @see PagedVolumeStreamer for the atlas and page table textures.
+    */
+    class BrickAtlasAllocator
+    {
+    public:
+        /**
+        * Result of a successful allocation.
+        */
+        struct Allocation
+        {
+            uint32_t slot; /**< Index of the slot assigned to the brick. */
+            std::optional<uint32_t> evictedKey; /**< Key of the brick previously held by the slot, if any. */
+        };
+
+        /**
+        * Constructor.
+        * @param numSlots Number of slots in the atlas.
+        * @param numProtectedFrames Number of frames after its last use during which a brick cannot be evicted, at least 1.
+        */
+        BrickAtlasAllocator(uint32_t numSlots, uint64_t numProtectedFrames);
+
+        /**
+        * Gets the slot holding a brick.
+        * @param key The key of the brick.
+        * @return std::optional<uint32_t> The slot, or std::nullopt if the brick is not resident.
+        */
+        std::optional<uint32_t> Find(uint32_t key) const;
+
+        /**
+        * Marks a resident brick as used in the current frame.
+        * Does nothing if the brick is not resident.
+        * @param key The key of the brick.
+        * @return void
+        */
+        void Touch(uint32_t key);
+
+        /**
+        * Advances the current frame, ending the frame in which touched bricks are protected.
+        * @return void
+        */
+        void NextFrame();
+
+        /**
+        * Assigns a slot to a brick that is not resident yet.
+        * Takes a free slot if there is one, and otherwise evicts the least recently used brick.
+        * The new brick counts as used in the current frame.
+        * @param key The key of the brick.
+        * @param isPinned True if the brick must never be evicted.
+        * @return std::optional<Allocation> The assigned slot, or std::nullopt if every slot is pinned or protected.
+        */
+        std::optional<Allocation> Allocate(uint32_t key, bool isPinned);
+
+        uint32_t GetNumSlots() const { return m_numSlots; }
+        uint32_t GetNumResidentBricks() const { return static_cast<uint32_t>(m_entries.size()); }
+        uint32_t GetNumPinnedBricks() const { return m_numPinnedBricks; }
+
+    private:
+        struct Entry
+        {
+            uint32_t slot; /**< Slot holding the brick. */
+            uint64_t lastUsedFrame; /**< Frame in which the brick was last touched or allocated. */
+            std::optional<std::list<uint32_t>::iterator> recencyPosition; /**< Position in the recency list, empty for pinned bricks. */
+        };
+
+        uint32_t m_numSlots; /**< Number of slots in the atlas. */
+        uint64_t m_numProtectedFrames; /**< Number of frames a used brick is protected from eviction. */
+        uint64_t m_frame; /**< Current frame. */
+        uint32_t m_numPinnedBricks; /**< Number of pinned resident bricks. */
+        std::vector<uint32_t> m_freeSlots; /**< Slots not holding any brick. */
+        std::list<uint32_t> m_recency; /**< Keys of the unpinned resident bricks, most recently used first. */
+        std::unordered_map<uint32_t, Entry> m_entries; /**< Resident bricks by key. */
+    };
+}
+
+#endif
@@ -0,0 +1,102 @@
+#include <volumedata/BrickCache.h>
+
+#include <utility>
+
+VolumeData::BrickCache::BrickCache(BrickedVolumeReader reader, size_t capacityInBytes)
+    : m_reader{std::move(reader)}
+    , m_capacityInBytes{capacityInBytes}
+    , m_mutex{}
+    , m_recency{}
+    , m_entries{}
+    , m_sizeInBytes{0}
+    , m_numHits{0}
+    , m_numMisses{0}
+{
+}
+
+VolumeData::BrickCache::Brick VolumeData::BrickCache::GetBrick(size_t brickIndex)
+{
+    if (brickIndex >= m_reader.GetNumBricks())
+    {
+        return nullptr;
+    }
+
+    {
+        std::lock_guard lock{m_mutex};
+        if (const auto it = m_entries.find(brickIndex); it != m_entries.end())
+        {
+            m_recency.splice(m_recency.begin(), m_recency, it->second.recencyPosition);
+            ++m_numHits;
+            return it->second.brick;
+        }
+        ++m_numMisses;
+    }
+
+    auto brickData = std::vector<uint8_t>(m_reader.GetBrickSizeInBytes(brickIndex));
+    if (!m_reader.ReadBrick(brickIndex, brickData))
+    {
+        return nullptr;
+    }
+    auto brick = std::make_shared<const std::vector<uint8_t>>(std::move(brickData));
+
+    std::lock_guard lock{m_mutex};
+
+    // Another thread may have read the same brick in the meantime
+    if (const auto it = m_entries.find(brickIndex); it != m_entries.end())
+    {
+        return it->second.brick;
+    }
+
+    m_recency.push_front(brickIndex);
+    m_entries.emplace(brickIndex, Entry{brick, m_recency.begin()});
+    m_sizeInBytes += brick->size();
+    EvictToCapacity();
+
+    return brick;
+}
+
+bool VolumeData::BrickCache::Contains(size_t brickIndex) const
+{
+    std::lock_guard lock{m_mutex};
+    return m_entries.contains(brickIndex);
+}
+
+void VolumeData::BrickCache::Clear()
+{
+    std::lock_guard lock{m_mutex};
+    m_recency.clear();
+    m_entries.clear();
+    m_sizeInBytes = 0;
+}
+
+size_t VolumeData::BrickCache::GetSizeInBytes() const
+{
+    std::lock_guard lock{m_mutex};
+    return m_sizeInBytes;
+}
+
+size_t VolumeData::BrickCache::GetNumHits() const
+{
+    std::lock_guard lock{m_mutex};
+    return m_numHits;
+}
+
+size_t VolumeData::BrickCache::GetNumMisses() const
+{
+    std::lock_guard lock{m_mutex};
+    return m_numMisses;
+}
+
+void VolumeData::BrickCache::EvictToCapacity()
+{
+    // The most recently used brick is always kept, even if it alone exceeds the capacity
+    while (m_sizeInBytes > m_capacityInBytes && m_recency.size() > 1)
+    {
+        const size_t brickIndex = m_recency.back();
+        m_recency.pop_back();
+
+        const auto it = m_entries.find(brickIndex);
+        m_sizeInBytes -= it->second.brick->size();
+        m_entries.erase(it);
+    }
+}
@@ -0,0 +1,103 @@
+/**
+* \file BrickCache.h
+*
+* \brief Least-recently-used cache of decoded volume bricks.
+*/
+
+#ifndef BRICK_CACHE_H
+#define BRICK_CACHE_H
+
+#include <volumedata/BrickedVolumeReader.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace VolumeData
+{
+    /**
+    * \class BrickCache
+    *
+    * \brief Keeps recently used bricks of a bricked volume in host memory.
+    *
+    * Bricks are read through a BrickedVolumeReader on first access and kept until the
+    * total size of cached bricks exceeds the capacity, at which point the least recently
+    * used bricks are evicted. Bricks are handed out as shared pointers, so an evicted brick
+    * stays alive for as long as a caller still uses it.
+    *
+    * All member functions are thread-safe. Bricks are read outside of the lock, so that
+    * misses on different bricks can be served concurrently.
+    *
+    * @see BrickedVolumeReader for reading bricks from disk.
+    * @see UploadBrick for uploading a cached brick into a volume texture.
+    */
+    class BrickCache
+    {
+    public:
+        using Brick = std::shared_ptr<const std::vector<uint8_t>>;
+
+        /**
+        * Constructor.
+        * @param reader The reader used to load bricks on a cache miss.
+        * @param capacityInBytes Maximum total size of cached bricks.
+        */
+        BrickCache(BrickedVolumeReader reader, size_t capacityInBytes);
+
+        BrickCache(const BrickCache&) = delete;
+        BrickCache& operator=(const BrickCache&) = delete;
+
+        /**
+        * Gets a brick, reading it from disk if it is not cached.
+        * @param brickIndex Linear index of the brick.
+        * @return Brick The voxels of the brick, or nullptr if it could not be read.
+        */
+        Brick GetBrick(size_t brickIndex);
+
+        /**
+        * Checks whether a brick is cached, without affecting its recency.
+        * @param brickIndex Linear index of the brick.
+        * @return bool True if the brick is cached.
+        */
+        bool Contains(size_t brickIndex) const;
+
+        /**
+        * Removes all bricks from the cache.
+        * @return void
+        */
+        void Clear();
+
+        const BrickedVolumeReader& GetReader() const { return m_reader; }
+        size_t GetCapacityInBytes() const { return m_capacityInBytes; }
+        size_t GetSizeInBytes() const;
+        size_t GetNumHits() const;
+        size_t GetNumMisses() const;
+
+    private:
+        struct Entry
+        {
+            Brick brick; /**< Voxels of the brick. */
+            std::list<size_t>::iterator recencyPosition; /**< Position of the brick in the recency list. */
+        };
+
+        /**
+        * Evicts least recently used bricks until the cache fits its capacity.
+        * Must be called with the mutex held.
+        */
+        void EvictToCapacity();
+
+        const BrickedVolumeReader m_reader; /**< Reader used to load bricks on a cache miss. */
+        const size_t m_capacityInBytes; /**< Maximum total size of cached bricks. */
+        mutable std::mutex m_mutex; /**< Guards all members below. */
+        std::list<size_t> m_recency; /**< Cached brick indices, most recently used first. */
+        std::unordered_map<size_t, Entry> m_entries; /**< Cached bricks by brick index. */
+        size_t m_sizeInBytes; /**< Total size of cached bricks. */
+        size_t m_numHits; /**< Number of requests served from the cache. */
+        size_t m_numMisses; /**< Number of requests that had to read from disk. */
+    };
+}
+
+#endif
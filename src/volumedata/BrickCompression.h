@@ -0,0 +1,35 @@
+/**
+* \file BrickCompression.h
+*
+* \brief Compression schemes for brick payloads in bricked volume files.
+*/
+
+#ifndef BRICK_COMPRESSION_H
+#define BRICK_COMPRESSION_H
+
+#include <cstdint>
+
+namespace VolumeData
+{
+    /**
+    * \enum BrickCompression
+    *
+    * \brief Selects how brick payloads are encoded in a bricked volume file.
+    *
+    * The scheme applies to the whole file and is stored in BrickedVolumeHeader::compression.
+    * Even in a compressed file, bricks whose encoding would not be smaller than their
+    * voxels are stored uncompressed. This is recognizable from the brick index, since the
+    * stored size then equals the decoded size.
+    *
+    * @see EncodeBrick for the DeltaRle encoder.
+    * @see DecodeBrick for the DeltaRle decoder.
+    * @see WriteBrickedVolume for writing compressed files.
+    */
+    enum class BrickCompression : uint32_t
+    {
+        None = 0,    /**< Brick payloads are stored as plain voxels. */
+        DeltaRle = 1 /**< Brick payloads are delta-coded, split into byte planes and run-length encoded. */
+    };
+}
+
+#endif
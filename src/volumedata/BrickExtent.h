@@ -0,0 +1,35 @@
+/**
+* \file BrickExtent.h
+*
+* \brief Voxel box covered by a single brick.
+*/
+
+#ifndef BRICK_EXTENT_H
+#define BRICK_EXTENT_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace VolumeData
+{
+    /**
+    * \struct BrickExtent
+    *
+    * \brief Origin and size in voxels of a brick within its volume.
+    *
+    * @see BrickedVolumeReader::GetBrickExtent for computing the extent of a brick.
+    */
+    struct BrickExtent
+    {
+        uint32_t x; /**< X coordinate of the first voxel of the brick. */
+        uint32_t y; /**< Y coordinate of the first voxel of the brick. */
+        uint32_t z; /**< Z coordinate of the first voxel of the brick. */
+        uint32_t width; /**< Width of the brick in voxels, clipped to the volume. */
+        uint32_t height; /**< Height of the brick in voxels, clipped to the volume. */
+        uint32_t depth; /**< Depth of the brick in voxels, clipped to the volume. */
+
+        size_t GetVoxelCount() const { return static_cast<size_t>(width) * height * depth; }
+    };
+}
+
+#endif
@@ -0,0 +1,91 @@
+/**
+* \file BrickedVolumeHeader.h
+*
+* \brief On-disk layout of bricked volume files.
+*/
+
+#ifndef BRICKED_VOLUME_HEADER_H
+#define BRICKED_VOLUME_HEADER_H
+
+#include <volumedata/BrickCompression.h>
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace VolumeData
+{
+    /**
+    * \namespace BrickedVolumeFormat
+    *
+    * \brief Constants identifying bricked volume files.
+    */
+    namespace BrickedVolumeFormat
+    {
+        constexpr std::array<char, 8> magic = {'V', 'R', 'B', 'R', 'I', 'C', 'K', '\0'};
+        constexpr uint32_t version = 1;
+        constexpr std::string_view fileExtension = ".bvol";
+        constexpr uint32_t defaultBrickSize = 64;
+    }
+
+    /**
+    * \struct BrickedVolumeHeader
+    *
+    * \brief Fixed-size header at the start of a bricked volume file.
+    *
+    * A bricked volume file stores a volume as a grid of cubic bricks of brickSize voxels
+    * per axis. Bricks at the upper volume boundaries are clipped to the volume extent.
+    * The file consists of this header, followed by one BrickIndexEntry per brick at
+    * indexOffset, followed by the brick payloads. Bricks are numbered x-fastest, then y,
+    * then z, and each payload holds the voxels of its brick in the same order as .raw files,
+    * encoded as given by the compression field.
+    * All values are stored little-endian.
+    *
+    * @see BrickIndexEntry for the per-brick index.
+    * @see BrickCompression for the payload encodings.
+    * @see WriteBrickedVolume for creating bricked volume files.
+    * @see BrickedVolumeReader for reading individual bricks.
+    */
+    struct BrickedVolumeHeader
+    {
+        std::array<char, 8> magic; /**< File signature, BrickedVolumeFormat::magic. */
+        uint32_t version; /**< File format version, BrickedVolumeFormat::version. */
+        uint32_t width; /**< Volume width in voxels. */
+        uint32_t height; /**< Volume height in voxels. */
+        uint32_t depth; /**< Volume depth in voxels. */
+        uint32_t components; /**< Number of components per voxel. */
+        uint32_t bitsPerComponent; /**< Bits per component (8 or 16). */
+        float scaleX; /**< Voxel spacing in x direction. */
+        float scaleY; /**< Voxel spacing in y direction. */
+        float scaleZ; /**< Voxel spacing in z direction. */
+        uint32_t brickSize; /**< Edge length of a brick in voxels. */
+        uint32_t numBricksX; /**< Number of bricks in x direction. */
+        uint32_t numBricksY; /**< Number of bricks in y direction. */
+        uint32_t numBricksZ; /**< Number of bricks in z direction. */
+        BrickCompression compression; /**< Encoding of the brick payloads. */
+        uint64_t indexOffset; /**< Byte offset of the brick index from the start of the file. */
+    };
+
+    /**
+    * \struct BrickIndexEntry
+    *
+    * \brief Location and value range of one brick in a bricked volume file.
+    *
+    * The value range covers all components of all voxels in the brick and allows
+    * skipping bricks that are empty under the current transfer function without reading them.
+    *
+    * @see BrickedVolumeHeader for the file layout.
+    */
+    struct BrickIndexEntry
+    {
+        uint64_t offset; /**< Byte offset of the brick payload from the start of the file. */
+        uint64_t sizeInBytes; /**< Size of the stored brick payload in bytes, smaller than the decoded size if the brick is compressed. */
+        uint32_t minValue; /**< Smallest voxel component value in the brick. */
+        uint32_t maxValue; /**< Largest voxel component value in the brick. */
+    };
+
+    static_assert(sizeof(BrickedVolumeHeader) == 72, "BrickedVolumeHeader must not contain padding");
+    static_assert(sizeof(BrickIndexEntry) == 24, "BrickIndexEntry must not contain padding");
+}
+
+#endif
@@ -0,0 +1,141 @@
+#include <volumedata/BrickedVolumeReader.h>
+#include <volumedata/DecodeBrick.h>
+#include <volumedata/GetBrickExtent.h>
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace
+{
+    bool IsHeaderConsistent(const VolumeData::BrickedVolumeHeader& header)
+    {
+        if (header.brickSize == 0 || header.width == 0 || header.height == 0 || header.depth == 0)
+        {
+            return false;
+        }
+
+        return header.numBricksX == (header.width + header.brickSize - 1) / header.brickSize
+            && header.numBricksY == (header.height + header.brickSize - 1) / header.brickSize
+            && header.numBricksZ == (header.depth + header.brickSize - 1) / header.brickSize;
+    }
+} // anonymous namespace
+
+VolumeData::BrickedVolumeReader::BrickedVolumeReader(std::shared_ptr<const MappedFile> mappedFile, const BrickedVolumeHeader& header, std::vector<BrickIndexEntry> brickIndex)
+    : m_mappedFile{std::move(mappedFile)}
+    , m_header{header}
+    , m_brickIndex{std::move(brickIndex)}
+{
+}
+
+VolumeData::VolumeMetadata VolumeData::BrickedVolumeReader::GetMetadata() const
+{
+    auto metadata = VolumeMetadata{m_header.width, m_header.height, m_header.depth, m_header.components, m_header.bitsPerComponent};
+    metadata.SetScale(m_header.scaleX, m_header.scaleY, m_header.scaleZ);
+    return metadata;
+}
+
+VolumeData::BrickExtent VolumeData::BrickedVolumeReader::GetBrickExtent(size_t brickIndex) const
+{
+    return ::VolumeData::GetBrickExtent(m_header, brickIndex);
+}
+
+size_t VolumeData::BrickedVolumeReader::GetBrickSizeInBytes(size_t brickIndex) const
+{
+    return GetBrickExtent(brickIndex).GetVoxelCount() * (m_header.components * m_header.bitsPerComponent / 8);
+}
+
+std::expected<void, VolumeData::VolumeLoadingError> VolumeData::BrickedVolumeReader::ReadBrick(size_t brickIndex, std::span<uint8_t> destination) const
+{
+    if (brickIndex >= m_brickIndex.size() || destination.size() < GetBrickSizeInBytes(brickIndex))
+    {
+        return std::unexpected(VolumeLoadingError::ReadError);
+    }
+
+    const auto& entry = m_brickIndex[brickIndex];
+    const size_t brickSizeInBytes = GetBrickSizeInBytes(brickIndex);
+    const auto storedData = m_mappedFile->GetData().subspan(entry.offset, entry.sizeInBytes);
+
+    // Bricks that did not shrink are stored uncompressed even in compressed files
+    if (entry.sizeInBytes == brickSizeInBytes)
+    {
+        std::memcpy(destination.data(), storedData.data(), brickSizeInBytes);
+        return {};
+    }
+
+    if (!DecodeBrick(storedData, m_header.components, m_header.bitsPerComponent, destination.first(brickSizeInBytes)))
+    {
+        return std::unexpected(VolumeLoadingError::CorruptBrickIndex);
+    }
+    return {};
+}
+
+std::expected<VolumeData::BrickedVolumeReader, VolumeData::VolumeLoadingError> VolumeData::OpenBrickedVolume(const std::filesystem::path& filePath, MappedFileAccessPattern accessPattern)
+{
+    if (!std::filesystem::exists(filePath))
+    {
+        return std::unexpected(VolumeLoadingError::RawFileNotFound);
+    }
+
+    auto mappedFile = std::make_shared<const MappedFile>(filePath, accessPattern);
+    if (!mappedFile->IsMapped())
+    {
+        return std::unexpected(VolumeLoadingError::CannotMapRawFile);
+    }
+
+    const auto fileData = mappedFile->GetData();
+
+    BrickedVolumeHeader header;
+    if (fileData.size() < sizeof(header))
+    {
+        return std::unexpected(VolumeLoadingError::InvalidBrickedFileHeader);
+    }
+    std::memcpy(&header, fileData.data(), sizeof(header));
+
+    if (header.magic != BrickedVolumeFormat::magic)
+    {
+        return std::unexpected(VolumeLoadingError::InvalidBrickedFileHeader);
+    }
+
+    if (header.version != BrickedVolumeFormat::version)
+    {
+        return std::unexpected(VolumeLoadingError::UnsupportedBrickedFileVersion);
+    }
+
+    if (header.compression != BrickCompression::None && header.compression != BrickCompression::DeltaRle)
+    {
+        return std::unexpected(VolumeLoadingError::UnsupportedBrickedFileVersion);
+    }
+
+    if (!IsHeaderConsistent(header))
+    {
+        return std::unexpected(VolumeLoadingError::InvalidBrickedFileHeader);
+    }
+
+    const size_t numBricks = static_cast<size_t>(header.numBricksX) * header.numBricksY * header.numBricksZ;
+    const size_t indexSizeInBytes = numBricks * sizeof(BrickIndexEntry);
+    if (header.indexOffset > fileData.size() || indexSizeInBytes > fileData.size() - header.indexOffset)
+    {
+        return std::unexpected(VolumeLoadingError::CorruptBrickIndex);
+    }
+
+    std::vector<BrickIndexEntry> brickIndex(numBricks);
+    std::memcpy(brickIndex.data(), fileData.data() + header.indexOffset, indexSizeInBytes);
+
+    auto reader = BrickedVolumeReader{std::move(mappedFile), header, std::move(brickIndex)};
+
+    for (size_t i = 0; i < reader.GetNumBricks(); ++i)
+    {
+        const auto& entry = reader.GetBrickIndexEntry(i);
+        const bool isSizeValid = (header.compression == BrickCompression::None)
+            ? entry.sizeInBytes == reader.GetBrickSizeInBytes(i)
+            : entry.sizeInBytes <= reader.GetBrickSizeInBytes(i);
+
+        if (!isSizeValid || entry.offset > fileData.size() || entry.sizeInBytes > fileData.size() - entry.offset)
+        {
+            return std::unexpected(VolumeLoadingError::CorruptBrickIndex);
+        }
+    }
+
+    return reader;
+}
@@ -0,0 +1,107 @@
+/**
+* \file BrickedVolumeReader.h
+*
+* \brief Random access to the bricks of a bricked volume file.
+*/
+
+#ifndef BRICKED_VOLUME_READER_H
+#define BRICKED_VOLUME_READER_H
+
+#include <volumedata/BrickExtent.h>
+#include <volumedata/BrickedVolumeHeader.h>
+#include <volumedata/MappedFile.h>
+#include <volumedata/VolumeLoadingError.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <memory>
+#include <span>
+#include <vector>
+
+namespace VolumeData
+{
+    /**
+    * \class BrickedVolumeReader
+    *
+    * \brief Reads individual bricks of a bricked volume file.
+    *
+    * Maps the file read-only and keeps a copy of its brick index, so that any brick
+    * can be read independently of the others without touching the rest of the file.
+    * Compressed bricks are decoded by ReadBrick(), so callers always receive plain voxels.
+    * Reading is const and does not modify shared state, so bricks can be read from
+    * several threads at once. Copies of a reader share the mapping.
+    *
+    * Readers are created via OpenBrickedVolume(), which validates the header and the index.
+    *
+    * @see BrickedVolumeHeader for the file layout.
+    * @see BrickCache for caching decoded bricks.
+    * @see LoadVolumeBricked for loading a whole bricked volume into VolumeData.
+    */
+    class BrickedVolumeReader
+    {
+    public:
+        /**
+        * Constructor.
+        * @param mappedFile The mapped bricked volume file.
+        * @param header The validated file header.
+        * @param brickIndex The validated brick index, one entry per brick.
+        */
+        BrickedVolumeReader(std::shared_ptr<const MappedFile> mappedFile, const BrickedVolumeHeader& header, std::vector<BrickIndexEntry> brickIndex);
+
+        const BrickedVolumeHeader& GetHeader() const { return m_header; }
+        size_t GetNumBricks() const { return m_brickIndex.size(); }
+        const BrickIndexEntry& GetBrickIndexEntry(size_t brickIndex) const { return m_brickIndex[brickIndex]; }
+
+        /**
+        * Gets the metadata of the stored volume.
+        * @return VolumeMetadata The volume dimensions, format and scale.
+        */
+        VolumeMetadata GetMetadata() const;
+
+        /**
+        * Gets the voxel box covered by a brick.
+        * @param brickIndex Linear index of the brick.
+        * @return BrickExtent The origin and clipped size of the brick.
+        */
+        BrickExtent GetBrickExtent(size_t brickIndex) const;
+
+        /**
+        * Gets the size of a decoded brick.
+        * @param brickIndex Linear index of the brick.
+        * @return size_t The number of bytes ReadBrick() writes for this brick.
+        */
+        size_t GetBrickSizeInBytes(size_t brickIndex) const;
+
+        /**
+        * Reads the voxels of a brick.
+        * @param brickIndex Linear index of the brick.
+        * @param destination Buffer of at least GetBrickSizeInBytes(brickIndex) bytes receiving the voxels.
+        * @return std::expected<void, VolumeLoadingError> Empty on success, or the error that occurred.
+        */
+        std::expected<void, VolumeLoadingError> ReadBrick(size_t brickIndex, std::span<uint8_t> destination) const;
+
+    private:
+        std::shared_ptr<const MappedFile> m_mappedFile; /**< Read-only mapping of the bricked volume file. */
+        BrickedVolumeHeader m_header; /**< File header. */
+        std::vector<BrickIndexEntry> m_brickIndex; /**< Brick index, one entry per brick. */
+    };
+
+    /**
+    * Opens a bricked volume file for reading.
+    *
+    * Maps the file and validates the header and every brick index entry against the file
+    * size, so that subsequent brick reads cannot access memory outside the mapping.
+    *
+    * @param filePath Path to the bricked volume file.
+    * @param accessPattern How the bricks are going to be read, Random for streaming individual bricks.
+    * @return std::expected<BrickedVolumeReader, VolumeLoadingError> The reader on success, or the error that occurred.
+    *
+    * @see BrickedVolumeReader for reading bricks.
+    */
+    std::expected<BrickedVolumeReader, VolumeLoadingError> OpenBrickedVolume(const std::filesystem::path& filePath, MappedFileAccessPattern accessPattern = MappedFileAccessPattern::Sequential);
+}
+
+#endif
@@ -0,0 +1,68 @@
+#include <volumedata/ClassifyBricks.h>
+
+#include <config/TransferFunctionConstants.h>
+#include <transferfunction/InterpolateTransferFunction.h>
+#include <transferfunction/TransferFunction.h>
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <execution>
+#include <numeric>
+#include <span>
+
+namespace Constants
+{
+    constexpr uint8_t emptyBrick = 0;
+    constexpr uint8_t occupiedBrick = 255;
+}
+
+namespace
+{
+    /// Number of visible transfer function texels before each texel, for constant-time range queries
+    std::vector<size_t> MakeVisibleTexelPrefixSums(const TransferFunction& transferFunction)
+    {
+        constexpr auto textureSize = TransferFunctionConstants::textureSize;
+        const auto activePoints = std::span{transferFunction.GetControlPoints().data(), transferFunction.GetNumActivePoints()};
+
+        std::vector<size_t> prefixSums(textureSize + 1, 0);
+        for (size_t i = 0; i < textureSize; ++i)
+        {
+            const float normalizedValue = static_cast<float>(i) / static_cast<float>(textureSize - 1);
+            const float opacity = InterpolateTransferFunction(normalizedValue, activePoints).a;
+
+            // The texture stores opacity as a truncated byte, so anything below one step is invisible
+            const bool isVisible = glm::clamp(opacity, 0.0f, 1.0f) * 255.0f >= 1.0f;
+            prefixSums[i + 1] = prefixSums[i] + (isVisible ? 1 : 0);
+        }
+        return prefixSums;
+    }
+} // anonymous namespace
+
+std::vector<uint8_t> VolumeData::ClassifyBricks(const VolumeMinMaxGrid& grid, const TransferFunction& transferFunction, float densityMultiplier)
+{
+    constexpr auto textureSize = static_cast<float>(TransferFunctionConstants::textureSize);
+    const auto prefixSums = MakeVisibleTexelPrefixSums(transferFunction);
+
+    // Linear filtering of the texture blends the two texels around coordinate * size - 0.5
+    const auto GetTexelIndex = [textureSize](float density, auto rounding)
+    {
+        const float texelCoordinate = rounding(glm::clamp(density, 0.0f, 1.0f) * textureSize - 0.5f);
+        return static_cast<size_t>(glm::clamp(texelCoordinate, 0.0f, textureSize - 1.0f));
+    };
+
+    std::vector<uint8_t> occupancy(grid.GetNumBricks());
+    std::vector<size_t> brickIndices(grid.GetNumBricks());
+    std::iota(brickIndices.begin(), brickIndices.end(), size_t{0});
+
+    std::for_each(std::execution::par_unseq, brickIndices.begin(), brickIndices.end(), [&](size_t brickIndex)
+    {
+        const size_t firstTexel = GetTexelIndex(grid.minValues[brickIndex] * densityMultiplier, [](float x) { return std::floor(x); });
+        const size_t lastTexel = GetTexelIndex(grid.maxValues[brickIndex] * densityMultiplier, [](float x) { return std::ceil(x); });
+        const bool isOccupied = prefixSums[lastTexel + 1] > prefixSums[firstTexel];
+        occupancy[brickIndex] = isOccupied ? Constants::occupiedBrick : Constants::emptyBrick;
+    });
+
+    return occupancy;
+}
@@ -0,0 +1,39 @@
+/**
+* \file ClassifyBricks.h
+*
+* \brief Function for classifying volume bricks as empty or occupied under a transfer function.
+*/
+
+#ifndef CLASSIFY_BRICKS_H
+#define CLASSIFY_BRICKS_H
+
+#include <volumedata/VolumeMinMaxGrid.h>
+
+#include <cstdint>
+#include <vector>
+
+class TransferFunction;
+
+namespace VolumeData
+{
+    /**
+    * Determines which bricks can contribute to the rendered image.
+    *
+    * A brick is empty if the transfer function texture has zero opacity for every density
+    * the shader can compute from values within the brick's range, that is, for the range
+    * scaled by the density multiplier and widened by the linear filtering of the transfer
+    * function texture. Opacity is evaluated per texel of the transfer function texture and
+    * quantized like the texture, so the classification matches the rendered result exactly.
+    *
+    * @param grid The per-brick value ranges.
+    * @param transferFunction The transfer function.
+    * @param densityMultiplier The density multiplier applied in the shader before the transfer function lookup.
+    * @return std::vector<uint8_t> One value per brick, 255 if the brick is occupied and 0 if it is empty.
+    *
+    * @see MakeVolumeMinMaxGrid for computing the value ranges.
+    * @see OccupancyGridUpdater for uploading the classification.
+    */
+    std::vector<uint8_t> ClassifyBricks(const VolumeMinMaxGrid& grid, const TransferFunction& transferFunction, float densityMultiplier);
+}
+
+#endif
@@ -0,0 +1,21 @@
+#include <volumedata/ComputeBrickStepMultipliers.h>
+
+#include <algorithm>
+#include <execution>
+
+std::vector<uint8_t> VolumeData::ComputeBrickStepMultipliers(const VolumeMinMaxGrid& grid, float densityMultiplier, float maxValueChangePerStep, uint32_t maxStepMultiplier)
+{
+    const float maxMultiplier = static_cast<float>(std::clamp(maxStepMultiplier, 1u, 255u));
+
+    std::vector<uint8_t> stepMultipliers(grid.GetNumBricks());
+    std::transform(std::execution::par_unseq, grid.minValues.begin(), grid.minValues.begin() + static_cast<std::ptrdiff_t>(stepMultipliers.size()), grid.maxValues.begin(), stepMultipliers.begin(), [=](float minValue, float maxValue)
+    {
+        // The transfer function lookup clamps to [0, 1], so only that part of the range can vary
+        const float valueRange = std::clamp(maxValue * densityMultiplier, 0.0f, 1.0f) - std::clamp(minValue * densityMultiplier, 0.0f, 1.0f);
+        const float maxValueChangePerNyquistStep = 0.5f * valueRange;
+        const float multiplier = (maxValueChangePerNyquistStep > 0.0f) ? maxValueChangePerStep / maxValueChangePerNyquistStep : maxMultiplier;
+        return static_cast<uint8_t>(std::clamp(multiplier, 1.0f, maxMultiplier));
+    });
+
+    return stepMultipliers;
+}
@@ -0,0 +1,39 @@
+/**
+* \file ComputeBrickStepMultipliers.h
+*
+* \brief Function for choosing how far apart ray samples may be within each brick of a volume.
+*/
+
+#ifndef COMPUTE_BRICK_STEP_MULTIPLIERS_H
+#define COMPUTE_BRICK_STEP_MULTIPLIERS_H
+
+#include <volumedata/VolumeMinMaxGrid.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace VolumeData
+{
+    /**
+    * Estimates the local frequency of the data per brick and derives the longest step that keeps up with it.
+    *
+    * The value range of a brick, scaled by the density multiplier like the transfer function
+    * lookup in the shader, bounds how much the density can change between two samples within
+    * the brick: by at most the whole range per voxel, that is, half the range per Nyquist step.
+    * A brick may therefore be sampled every k Nyquist steps as long as k times half its range
+    * stays below the given change per step. Bricks of nearly constant value get the largest
+    * steps, bricks with edges fall back to Nyquist-rate sampling.
+    *
+    * @param grid The per-brick value ranges.
+    * @param densityMultiplier The density multiplier applied in the shader before the transfer function lookup.
+    * @param maxValueChangePerStep The largest change of the scaled density, in transfer function coordinates, one step may span.
+    * @param maxStepMultiplier The largest number of Nyquist steps per sample, at most 255.
+    * @return std::vector<uint8_t> One value per brick, the number of Nyquist steps per sample between 1 and maxStepMultiplier.
+    *
+    * @see GetNyquistStepSize for the length of a Nyquist step.
+    * @see OccupancyGridUpdater for uploading the step multipliers.
+    */
+    std::vector<uint8_t> ComputeBrickStepMultipliers(const VolumeMinMaxGrid& grid, float densityMultiplier, float maxValueChangePerStep, uint32_t maxStepMultiplier);
+}
+
+#endif
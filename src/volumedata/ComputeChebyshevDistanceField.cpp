@@ -0,0 +1,132 @@
+#include <volumedata/ComputeChebyshevDistanceField.h>
+
+#include <algorithm>
+#include <execution>
+#include <numeric>
+
+namespace Constants
+{
+    constexpr uint8_t maxDistance = 255;
+}
+
+namespace
+{
+    /// Adds one step to a distance, saturating at the largest representable distance
+    uint8_t AddStep(uint8_t distance)
+    {
+        return static_cast<uint8_t>(distance + (distance < Constants::maxDistance ? 1 : 0));
+    }
+
+    /// Exact 1D distance along a row of the binary occupancy grid, by a forward and a backward scan
+    void TransformRow(std::span<const uint8_t> occupancy, std::span<uint8_t> row)
+    {
+        uint8_t distance = Constants::maxDistance;
+        for (size_t x = 0; x < row.size(); ++x)
+        {
+            distance = (occupancy[x] != 0) ? 0 : AddStep(distance);
+            row[x] = distance;
+        }
+
+        for (size_t x = row.size() - 1; x-- > 0;)
+        {
+            row[x] = std::min(row[x], AddStep(row[x + 1]));
+        }
+    }
+
+    /**
+    * Lowers the distance of every cell of a row to one step more than the nearest cell of its
+    * 3x3 neighborhood in the neighbor rows, which are the previous row of the same slice for y
+    * sweeps and three rows of the previous slice for z sweeps.
+    */
+    void PropagateRow(std::span<const uint8_t> lowerRow, std::span<const uint8_t> centerRow, std::span<const uint8_t> upperRow, std::span<uint8_t> row)
+    {
+        const auto GetNearest = [&](size_t x) { return std::min({lowerRow[x], centerRow[x], upperRow[x]}); };
+
+        const size_t width = row.size();
+        if (width == 1)
+        {
+            row[0] = std::min(row[0], AddStep(GetNearest(0)));
+            return;
+        }
+
+        row[0] = std::min(row[0], AddStep(std::min(GetNearest(0), GetNearest(1))));
+        for (size_t x = 1; x + 1 < width; ++x)
+        {
+            row[x] = std::min(row[x], AddStep(std::min({GetNearest(x - 1), GetNearest(x), GetNearest(x + 1)})));
+        }
+        row[width - 1] = std::min(row[width - 1], AddStep(std::min(GetNearest(width - 2), GetNearest(width - 1))));
+    }
+
+    /// Sweeps the rows of a slice once in increasing and once in decreasing y
+    void PropagateAlongY(std::span<uint8_t> slice, uint32_t width, uint32_t height)
+    {
+        const auto GetRow = [&](uint32_t y) { return slice.subspan(static_cast<size_t>(y) * width, width); };
+
+        for (uint32_t y = 1; y < height; ++y)
+        {
+            PropagateRow(GetRow(y - 1), GetRow(y - 1), GetRow(y - 1), GetRow(y));
+        }
+
+        for (uint32_t y = height - 1; y-- > 0;)
+        {
+            PropagateRow(GetRow(y + 1), GetRow(y + 1), GetRow(y + 1), GetRow(y));
+        }
+    }
+
+    /// Propagates the distances of one slice into the next, in parallel over the rows of the next slice
+    void PropagateSlice(std::span<const uint8_t> previousSlice, std::span<uint8_t> slice, const std::vector<uint32_t>& rows, uint32_t width, uint32_t height)
+    {
+        std::for_each(std::execution::par, rows.begin(), rows.end(), [&](uint32_t y)
+        {
+            const auto GetPreviousRow = [&](uint32_t rowY) { return previousSlice.subspan(static_cast<size_t>(rowY) * width, width); };
+            const auto lowerRow = GetPreviousRow((y > 0) ? y - 1 : y);
+            const auto upperRow = GetPreviousRow((y + 1 < height) ? y + 1 : y);
+
+            PropagateRow(lowerRow, GetPreviousRow(y), upperRow, slice.subspan(static_cast<size_t>(y) * width, width));
+        });
+    }
+} // anonymous namespace
+
+std::vector<uint8_t> VolumeData::ComputeChebyshevDistanceField(std::span<const uint8_t> occupancy, uint32_t width, uint32_t height, uint32_t depth)
+{
+    const size_t sliceSize = static_cast<size_t>(width) * height;
+    const size_t numCells = sliceSize * depth;
+    if (numCells == 0 || occupancy.size() != numCells)
+    {
+        return {};
+    }
+
+    std::vector<uint8_t> distanceField(numCells);
+    const auto GetSlice = [&](uint32_t z) { return std::span<uint8_t>{distanceField}.subspan(z * sliceSize, sliceSize); };
+
+    std::vector<uint32_t> slices(depth);
+    std::iota(slices.begin(), slices.end(), 0u);
+
+    // Distances within each slice: exact along x, then along y through the three nearest cells of the neighboring row
+    std::for_each(std::execution::par, slices.begin(), slices.end(), [&](uint32_t z)
+    {
+        const auto slice = GetSlice(z);
+        for (uint32_t y = 0; y < height; ++y)
+        {
+            const size_t rowOffset = static_cast<size_t>(y) * width;
+            TransformRow(occupancy.subspan(z * sliceSize + rowOffset, width), slice.subspan(rowOffset, width));
+        }
+        PropagateAlongY(slice, width, height);
+    });
+
+    // Distances across slices, through the 3x3 nearest cells of the neighboring slice
+    std::vector<uint32_t> rows(height);
+    std::iota(rows.begin(), rows.end(), 0u);
+
+    for (uint32_t z = 1; z < depth; ++z)
+    {
+        PropagateSlice(GetSlice(z - 1), GetSlice(z), rows, width, height);
+    }
+
+    for (uint32_t z = depth - 1; z-- > 0;)
+    {
+        PropagateSlice(GetSlice(z + 1), GetSlice(z), rows, width, height);
+    }
+
+    return distanceField;
+}
@@ -0,0 +1,39 @@
+/**
+* \file ComputeChebyshevDistanceField.h
+*
+* \brief Function for computing the distance from every empty brick to the nearest occupied brick.
+*/
+
+#ifndef COMPUTE_CHEBYSHEV_DISTANCE_FIELD_H
+#define COMPUTE_CHEBYSHEV_DISTANCE_FIELD_H
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace VolumeData
+{
+    /**
+    * Computes the Chebyshev distance transform of an occupancy grid.
+    *
+    * The distance of a cell is the smallest max(|dx|, |dy|, |dz|) to an occupied cell, so
+    * every cell within distance - 1 of an empty cell is empty as well, and a ray can leap to
+    * the exit of that cube in one step. The transform is separable: an exact 1D transform
+    * along x is followed by a sweep along y and a sweep along z, each of which lowers a cell
+    * to one step more than the nearest cell of its 3x1 or 3x3 neighborhood in the previous
+    * row or slice. Rows of a slice are processed in parallel, and the inner loops vectorize
+    * over 8-bit distances.
+    *
+    * @param occupancy One value per cell, numbered x-fastest, nonzero for occupied cells.
+    * @param width Number of cells in x direction.
+    * @param height Number of cells in y direction.
+    * @param depth Number of cells in z direction.
+    * @return std::vector<uint8_t> One distance per cell, 0 for occupied cells and at most 255, which is also used if no cell is occupied.
+    *
+    * @see ClassifyBricks for the occupancy grid.
+    * @see OccupancyGridUpdater for the upload of the distances.
+    */
+    std::vector<uint8_t> ComputeChebyshevDistanceField(std::span<const uint8_t> occupancy, uint32_t width, uint32_t height, uint32_t depth);
+}
+
+#endif
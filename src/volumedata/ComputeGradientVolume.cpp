@@ -0,0 +1,129 @@
+#include <volumedata/ComputeGradientVolume.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+#include <volumedata/VolumeView.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <execution>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace Constants
+{
+    constexpr uint32_t gradientComponents = 3;
+    constexpr float maxGradientMagnitude = 0.8660254f; // Central differences of normalized values, sqrt(3) / 2
+}
+
+namespace
+{
+    /// Maps [-1, 1] to a byte with rounding
+    uint8_t EncodeSignedUnit(float value)
+    {
+        return static_cast<uint8_t>(std::clamp(value * 0.5f + 0.5f, 0.0f, 1.0f) * 255.0f + 0.5f);
+    }
+
+    template <typename View>
+    void ComputeGradientSlice(const View& view, uint32_t z, uint8_t* gradientSlice)
+    {
+        using T = typename View::ValueType;
+        constexpr size_t components = View::numComponents;
+        const uint32_t width = view.GetWidth();
+        const uint32_t height = view.GetHeight();
+        const uint32_t depth = view.GetDepth();
+
+        // Central differences of normalized values, scaled to texture space so that the
+        // normals match the unit cube the volume is rendered on
+        constexpr float normalization = 0.5f / static_cast<float>(std::numeric_limits<T>::max());
+        const float scaleX = normalization * static_cast<float>(width);
+        const float scaleY = normalization * static_cast<float>(height);
+        const float scaleZ = normalization * static_cast<float>(depth);
+        const float magnitudeScale = normalization / Constants::maxGradientMagnitude;
+
+        std::vector<float> row(width);
+        std::vector<float> gradientX(width);
+        std::vector<float> gradientY(width);
+        std::vector<float> gradientZ(width);
+
+        for (uint32_t y = 0; y < height; ++y)
+        {
+            const auto neighborhood = view.GetRowNeighborhood(y, z);
+
+            for (uint32_t x = 0; x < width; ++x)
+            {
+                row[x] = static_cast<float>(neighborhood.row[x * components]);
+                gradientY[x] = static_cast<float>(neighborhood.nextRow[x * components]) - static_cast<float>(neighborhood.previousRow[x * components]);
+                gradientZ[x] = static_cast<float>(neighborhood.nextSlice[x * components]) - static_cast<float>(neighborhood.previousSlice[x * components]);
+            }
+
+            for (uint32_t x = 1; x + 1 < width; ++x)
+            {
+                gradientX[x] = row[x + 1] - row[x - 1];
+            }
+            gradientX[0] = row[std::min(1u, width - 1)] - row[0];
+            gradientX[width - 1] = row[width - 1] - row[(width > 1) ? width - 2 : 0];
+
+            uint8_t* gradientRow = gradientSlice + static_cast<size_t>(y) * width * Constants::gradientComponents;
+            for (uint32_t x = 0; x < width; ++x)
+            {
+                const float magnitude = std::sqrt(gradientX[x] * gradientX[x] + gradientY[x] * gradientY[x] + gradientZ[x] * gradientZ[x]);
+
+                // The normal points against the gradient, towards less dense material
+                const float nx = -gradientX[x] * scaleX;
+                const float ny = -gradientY[x] * scaleY;
+                const float nz = -gradientZ[x] * scaleZ;
+
+                // Octahedral projection, folding the lower hemisphere over the diagonals.
+                // A zero gradient ends up as (0, 0, 1) with zero magnitude.
+                const float l1Norm = std::abs(nx) + std::abs(ny) + std::abs(nz);
+                const float inverseL1Norm = (l1Norm > 0.0f) ? 1.0f / l1Norm : 0.0f;
+                const float px = nx * inverseL1Norm;
+                const float py = ny * inverseL1Norm;
+                const float u = (nz < 0.0f) ? std::copysign(1.0f - std::abs(py), px) : px;
+                const float v = (nz < 0.0f) ? std::copysign(1.0f - std::abs(px), py) : py;
+
+                gradientRow[x * Constants::gradientComponents + 0] = EncodeSignedUnit(u);
+                gradientRow[x * Constants::gradientComponents + 1] = EncodeSignedUnit(v);
+                gradientRow[x * Constants::gradientComponents + 2] = static_cast<uint8_t>(std::min(std::sqrt(magnitude * magnitudeScale), 1.0f) * 255.0f + 0.5f);
+            }
+        }
+    }
+} // anonymous namespace
+
+VolumeData::VolumeData VolumeData::ComputeGradientVolume(const VolumeData& volumeData)
+{
+    if (!volumeData.IsValid())
+    {
+        return VolumeData{};
+    }
+
+    const auto& metadata = volumeData.GetMetadata();
+    const uint32_t bitsPerComponent = metadata.GetBitsPerComponent();
+    if (bitsPerComponent != 8 && bitsPerComponent != 16)
+    {
+        return VolumeData{};
+    }
+
+    auto gradientMetadata = metadata;
+    gradientMetadata.SetComponents(Constants::gradientComponents);
+    gradientMetadata.SetBitsPerComponent(8);
+    auto gradientVolume = VolumeData{gradientMetadata};
+
+    const size_t gradientSliceLength = static_cast<size_t>(metadata.GetWidth()) * metadata.GetHeight() * Constants::gradientComponents;
+    uint8_t* gradientData = gradientVolume.GetDataPtr();
+
+    std::vector<uint32_t> sliceIndices(metadata.GetDepth());
+    std::iota(sliceIndices.begin(), sliceIndices.end(), 0u);
+
+    VisitVolumeView(volumeData, [&](const auto& view)
+    {
+        std::for_each(std::execution::par, sliceIndices.begin(), sliceIndices.end(), [&](uint32_t z)
+        {
+            ComputeGradientSlice(view, z, gradientData + z * gradientSliceLength);
+        });
+    });
+
+    return gradientVolume;
+}
@@ -0,0 +1,36 @@
+/**
+* \file ComputeGradientVolume.h
+*
+* \brief Function for computing the compactly encoded gradient volume used for shading.
+*/
+
+#ifndef COMPUTE_GRADIENT_VOLUME_H
+#define COMPUTE_GRADIENT_VOLUME_H
+
+namespace VolumeData
+{
+    class VolumeData;
+
+    /**
+    * Computes central-difference gradients of the first component of a volume.
+    *
+    * The result is a three-component 8-bit volume of the same dimensions. The first two
+    * components hold the octahedral encoding of the normal, which is the negated gradient
+    * direction in texture space, so it points from dense to less dense material on the
+    * unit cube the volume is rendered on. The third component holds the square root of
+    * the gradient magnitude, relative to the largest possible central difference, which
+    * keeps precision for the weak gradients that make up most of a volume.
+    * Gradients at the boundary are taken from the clamped neighbors.
+    *
+    * The volume is processed in parallel over slices, and each row is computed in
+    * branch-free loops the compiler can vectorize.
+    *
+    * @param volumeData The 8-bit or 16-bit volume to compute gradients of.
+    * @return VolumeData The encoded gradient volume, or an empty VolumeData if the volume is invalid or unsupported.
+    *
+    * @see GradientVolumeUpdater for keeping the gradient texture up to date.
+    */
+    VolumeData ComputeGradientVolume(const VolumeData& volumeData);
+}
+
+#endif
@@ -0,0 +1,50 @@
+#include <volumedata/ComputePercentileWindow.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+
+VolumeData::VolumeWindow VolumeData::ComputePercentileWindow(const VolumeHistogram& volumeHistogram, float lowerPercentile, float upperPercentile)
+{
+    if (volumeHistogram.IsEmpty())
+    {
+        return VolumeWindow{};
+    }
+
+    const auto counts = volumeHistogram.GetCounts(0);
+    const uint64_t totalCount = std::accumulate(counts.begin(), counts.end(), uint64_t{0});
+    if (totalCount == 0)
+    {
+        return VolumeWindow{};
+    }
+
+    const auto lowerCount = static_cast<double>(totalCount) * std::clamp(lowerPercentile, 0.0f, 1.0f);
+    const auto upperCount = static_cast<double>(totalCount) * std::clamp(upperPercentile, 0.0f, 1.0f);
+
+    size_t lowerBin = 0;
+    size_t upperBin = counts.size() - 1;
+    uint64_t cumulativeCount = 0;
+    bool isLowerBinFound = false;
+
+    for (size_t bin = 0; bin < counts.size(); ++bin)
+    {
+        cumulativeCount += counts[bin];
+        if (!isLowerBinFound && static_cast<double>(cumulativeCount) > lowerCount)
+        {
+            lowerBin = bin;
+            isLowerBinFound = true;
+        }
+        if (static_cast<double>(cumulativeCount) >= upperCount)
+        {
+            upperBin = bin;
+            break;
+        }
+    }
+
+    upperBin = std::max(upperBin, lowerBin);
+
+    const float binWidth = 1.0f / static_cast<float>(volumeHistogram.numBins);
+    const float low = static_cast<float>(lowerBin) * binWidth;
+    const float high = static_cast<float>(upperBin + 1) * binWidth;
+    return VolumeWindow{.center = 0.5f * (low + high), .width = high - low};
+}
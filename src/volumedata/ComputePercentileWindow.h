@@ -0,0 +1,32 @@
+/**
+* \file ComputePercentileWindow.h
+*
+* \brief Function for fitting a volume window to histogram percentiles.
+*/
+
+#ifndef COMPUTE_PERCENTILE_WINDOW_H
+#define COMPUTE_PERCENTILE_WINDOW_H
+
+#include <volumedata/VolumeHistogram.h>
+#include <volumedata/VolumeWindow.h>
+
+namespace VolumeData
+{
+    /**
+    * Computes the window between two percentiles of the first component of a histogram.
+    *
+    * The window starts at the lower edge of the bin containing the lower percentile and ends
+    * at the upper edge of the bin containing the upper percentile, so it never clips the
+    * requested fraction of voxels.
+    *
+    * @param volumeHistogram Histogram of the volume.
+    * @param lowerPercentile Fraction of voxels below the window, in [0, 1].
+    * @param upperPercentile Fraction of voxels up to the end of the window, in [0, 1].
+    * @return VolumeWindow The fitted window, or the full range if the histogram is empty.
+    *
+    * @see ComputeVolumeHistogram for computing the histogram.
+    */
+    VolumeWindow ComputePercentileWindow(const VolumeHistogram& volumeHistogram, float lowerPercentile, float upperPercentile);
+}
+
+#endif
@@ -0,0 +1,157 @@
+#include <volumedata/ComputeVolumeContentHash.h>
+#include <volumedata/SparseVolumeData.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <execution>
+#include <numeric>
+#include <span>
+#include <vector>
+
+namespace Constants
+{
+    constexpr size_t chunkSizeInBytes = 4 * 1024 * 1024;
+    constexpr size_t stripeSizeInBytes = 32;
+    constexpr uint64_t prime1 = 0x9E3779B185EBCA87ull;
+    constexpr uint64_t prime2 = 0xC2B2AE3D27D4EB4Full;
+    constexpr uint64_t prime3 = 0x165667B19E3779F9ull;
+    constexpr uint64_t prime4 = 0x85EBCA77C2B2AE63ull;
+    constexpr uint64_t prime5 = 0x27D4EB2F165667C5ull;
+}
+
+namespace
+{
+    uint64_t ReadWord(const uint8_t* data)
+    {
+        uint64_t word;
+        std::memcpy(&word, data, sizeof(uint64_t));
+        return word;
+    }
+
+    uint64_t Round(uint64_t accumulator, uint64_t word)
+    {
+        accumulator += word * Constants::prime2;
+        accumulator = std::rotl(accumulator, 31);
+        return accumulator * Constants::prime1;
+    }
+
+    uint64_t Mix(uint64_t hash, uint64_t value)
+    {
+        hash ^= Round(0, value);
+        return std::rotl(hash, 27) * Constants::prime1 + Constants::prime4;
+    }
+
+    uint64_t Avalanche(uint64_t hash)
+    {
+        hash ^= hash >> 33;
+        hash *= Constants::prime2;
+        hash ^= hash >> 29;
+        hash *= Constants::prime3;
+        hash ^= hash >> 32;
+        return hash;
+    }
+
+    /// Hashes one chunk, consuming 32-byte stripes with four independent lanes
+    uint64_t HashChunk(std::span<const uint8_t> chunk, uint64_t seed)
+    {
+        uint64_t lane0 = seed + Constants::prime1 + Constants::prime2;
+        uint64_t lane1 = seed + Constants::prime2;
+        uint64_t lane2 = seed;
+        uint64_t lane3 = seed - Constants::prime1;
+
+        const uint8_t* data = chunk.data();
+        const size_t numStripeBytes = chunk.size() - chunk.size() % Constants::stripeSizeInBytes;
+        for (size_t i = 0; i < numStripeBytes; i += Constants::stripeSizeInBytes)
+        {
+            lane0 = Round(lane0, ReadWord(data + i));
+            lane1 = Round(lane1, ReadWord(data + i + 8));
+            lane2 = Round(lane2, ReadWord(data + i + 16));
+            lane3 = Round(lane3, ReadWord(data + i + 24));
+        }
+
+        uint64_t hash = std::rotl(lane0, 1) + std::rotl(lane1, 7) + std::rotl(lane2, 12) + std::rotl(lane3, 18);
+        hash = Mix(Mix(Mix(Mix(hash, lane0), lane1), lane2), lane3);
+        hash += chunk.size();
+
+        for (size_t i = numStripeBytes; i < chunk.size(); ++i)
+        {
+            hash ^= data[i] * Constants::prime5;
+            hash = std::rotl(hash, 11) * Constants::prime1;
+        }
+
+        return Avalanche(hash);
+    }
+
+    /// Copies a byte range of the dense layout of a sparse volume, expanding each row it covers
+    void CopyDenseRange(const VolumeData::SparseVolumeData& sparseVolumeData, size_t offset, std::span<uint8_t> destination)
+    {
+        const auto& metadata = sparseVolumeData.GetMetadata();
+        const size_t rowSizeInBytes = static_cast<size_t>(metadata.GetWidth()) * metadata.GetBytesPerVoxel();
+        std::vector<uint8_t> row(rowSizeInBytes);
+
+        for (size_t copiedSizeInBytes = 0; copiedSizeInBytes < destination.size();)
+        {
+            const size_t rowIndex = (offset + copiedSizeInBytes) / rowSizeInBytes;
+            const size_t offsetInRow = (offset + copiedSizeInBytes) % rowSizeInBytes;
+            const size_t sizeInBytes = std::min(rowSizeInBytes - offsetInRow, destination.size() - copiedSizeInBytes);
+
+            sparseVolumeData.CopyRow(static_cast<uint32_t>(rowIndex % metadata.GetHeight()), static_cast<uint32_t>(rowIndex / metadata.GetHeight()), std::span{row});
+            std::memcpy(destination.data() + copiedSizeInBytes, row.data() + offsetInRow, sizeInBytes);
+            copiedSizeInBytes += sizeInBytes;
+        }
+    }
+} // anonymous namespace
+
+uint64_t VolumeData::ComputeVolumeContentHash(const VolumeData& volumeData)
+{
+    const size_t sizeInBytes = volumeData.GetSizeInBytes();
+    const size_t numChunks = (sizeInBytes + Constants::chunkSizeInBytes - 1) / Constants::chunkSizeInBytes;
+
+    std::vector<uint64_t> chunkIndices(numChunks);
+    std::iota(chunkIndices.begin(), chunkIndices.end(), uint64_t{0});
+
+    std::vector<uint64_t> chunkHashes(numChunks);
+
+    // A sparse volume is hashed chunk by chunk from its rows, so that it yields the hash of its dense voxels without being expanded
+    if (const auto* sparseVolumeData = volumeData.GetSparseData())
+    {
+        std::transform(std::execution::par, chunkIndices.begin(), chunkIndices.end(), chunkHashes.begin(), [sparseVolumeData, sizeInBytes](uint64_t chunkIndex)
+        {
+            const size_t offset = chunkIndex * Constants::chunkSizeInBytes;
+            std::vector<uint8_t> chunk(std::min(Constants::chunkSizeInBytes, sizeInBytes - offset));
+            CopyDenseRange(*sparseVolumeData, offset, std::span{chunk});
+            return HashChunk(chunk, chunkIndex);
+        });
+    }
+    else
+    {
+        const auto data = volumeData.GetData();
+        std::transform(std::execution::par_unseq, chunkIndices.begin(), chunkIndices.end(), chunkHashes.begin(), [data](uint64_t chunkIndex)
+        {
+            const size_t offset = chunkIndex * Constants::chunkSizeInBytes;
+            return HashChunk(data.subspan(offset, std::min(Constants::chunkSizeInBytes, data.size() - offset)), chunkIndex);
+        });
+    }
+
+    const auto& metadata = volumeData.GetMetadata();
+    uint64_t hash = Constants::prime5;
+    hash = Mix(hash, metadata.GetWidth());
+    hash = Mix(hash, metadata.GetHeight());
+    hash = Mix(hash, metadata.GetDepth());
+    hash = Mix(hash, metadata.GetComponents());
+    hash = Mix(hash, metadata.GetBitsPerComponent());
+    hash = Mix(hash, std::bit_cast<uint32_t>(metadata.GetScaleX()));
+    hash = Mix(hash, std::bit_cast<uint32_t>(metadata.GetScaleY()));
+    hash = Mix(hash, std::bit_cast<uint32_t>(metadata.GetScaleZ()));
+    hash = Mix(hash, sizeInBytes);
+
+    for (const uint64_t chunkHash : chunkHashes)
+    {
+        hash = Mix(hash, chunkHash);
+    }
+
+    return Avalanche(hash);
+}
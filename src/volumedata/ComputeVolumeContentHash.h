@@ -0,0 +1,37 @@
+/**
+* \file ComputeVolumeContentHash.h
+*
+* \brief Function for computing a hash of the metadata and voxels of a volume.
+*/
+
+#ifndef COMPUTE_VOLUME_CONTENT_HASH_H
+#define COMPUTE_VOLUME_CONTENT_HASH_H
+
+#include <cstdint>
+
+namespace VolumeData
+{
+    class VolumeData;
+
+    /**
+    * Computes a 64-bit hash of the metadata and voxels of a volume.
+    *
+    * The voxels are split into fixed-size chunks, which are hashed in parallel with
+    * xxHash64-style rounds over four independent lanes, each chunk seeded with its index.
+    * The chunk hashes are then combined in order together with the metadata, so the
+    * result does not depend on the number of threads. Mapped volumes are read in place,
+    * and the chunks of sparse volumes are expanded one at a time, so that a sparse volume
+    * has the same hash as its dense form.
+    *
+    * The hash is not cryptographic. It identifies volumes for the DerivedDataCache,
+    * where a collision would only show stale derived data.
+    *
+    * @param volumeData The volume to hash.
+    * @return uint64_t The hash of the volume.
+    *
+    * @see DerivedDataCache for the cache keyed by the hash.
+    */
+    uint64_t ComputeVolumeContentHash(const VolumeData& volumeData);
+}
+
+#endif
@@ -0,0 +1,199 @@
+#include <volumedata/ComputeVolumeHistogram.h>
+#include <volumedata/SparseVolumeData.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <execution>
+#include <functional>
+#include <numeric>
+#include <span>
+#include <thread>
+#include <vector>
+
+namespace Constants
+{
+    constexpr size_t blockLength = 960; // Divisible by every supported component count
+    constexpr size_t flushLength = blockLength * 16384; // Keeps the 32-bit lane counters far from overflowing
+    constexpr size_t numLanes = 4;
+    constexpr size_t tasksPerThread = 4;
+    constexpr uint32_t maxNumBins = 65536;
+}
+
+namespace
+{
+    /// Adds the histogram of values, which starts at the first component of a voxel, to counts
+    template <typename T>
+    void AccumulateHistogram(std::span<const T> values, uint32_t components, uint32_t numBins, std::span<uint64_t> counts)
+    {
+        constexpr uint32_t bitsPerComponent = sizeof(T) * 8;
+        const size_t histogramLength = counts.size();
+
+        std::vector<uint32_t> laneCounts(Constants::numLanes * histogramLength, 0);
+        uint32_t* lane0 = laneCounts.data();
+        uint32_t* lane1 = lane0 + histogramLength;
+        uint32_t* lane2 = lane1 + histogramLength;
+        uint32_t* lane3 = lane2 + histogramLength;
+
+        std::array<uint32_t, Constants::blockLength> componentOffsets;
+        for (size_t i = 0; i < Constants::blockLength; ++i)
+        {
+            componentOffsets[i] = static_cast<uint32_t>(i % components) * numBins;
+        }
+
+        const auto Flush = [&]()
+        {
+            for (size_t lane = 0; lane < Constants::numLanes; ++lane)
+            {
+                for (size_t i = 0; i < histogramLength; ++i)
+                {
+                    counts[i] += laneCounts[lane * histogramLength + i];
+                }
+            }
+            std::ranges::fill(laneCounts, 0);
+        };
+
+        std::array<uint32_t, Constants::blockLength> binIndices;
+        size_t numValuesSinceFlush = 0;
+
+        for (size_t blockBegin = 0; blockBegin < values.size(); blockBegin += Constants::blockLength)
+        {
+            const size_t length = std::min(Constants::blockLength, values.size() - blockBegin);
+            const T* block = values.data() + blockBegin;
+
+            // Independent and branch-free per value, so this loop is vectorized
+            for (size_t i = 0; i < length; ++i)
+            {
+                binIndices[i] = componentOffsets[i] + ((static_cast<uint32_t>(block[i]) * numBins) >> bitsPerComponent);
+            }
+
+            size_t i = 0;
+            for (; i + Constants::numLanes <= length; i += Constants::numLanes)
+            {
+                ++lane0[binIndices[i]];
+                ++lane1[binIndices[i + 1]];
+                ++lane2[binIndices[i + 2]];
+                ++lane3[binIndices[i + 3]];
+            }
+            for (; i < length; ++i)
+            {
+                ++lane0[binIndices[i]];
+            }
+
+            numValuesSinceFlush += length;
+            if (numValuesSinceFlush >= Constants::flushLength)
+            {
+                Flush();
+                numValuesSinceFlush = 0;
+            }
+        }
+
+        Flush();
+    }
+
+    /// Adds the histogram of whole voxels to counts, split into tasks of whole blocks
+    void AccumulateHistogramInParallel(std::span<const uint8_t> data, bool is16Bit, uint32_t components, uint32_t numBins, std::span<uint64_t> counts)
+    {
+        const size_t histogramLength = counts.size();
+        const size_t numValues = data.size() / (is16Bit ? sizeof(uint16_t) : sizeof(uint8_t));
+        const size_t numBlocks = (numValues + Constants::blockLength - 1) / Constants::blockLength;
+        const size_t numThreads = std::max(1u, std::thread::hardware_concurrency());
+        const size_t numTasks = std::clamp(numThreads * Constants::tasksPerThread, size_t{1}, std::max(numBlocks, size_t{1}));
+
+        // Task ranges are whole blocks, so every range starts at the first component of a voxel
+        const size_t taskLength = ((numBlocks + numTasks - 1) / numTasks) * Constants::blockLength;
+
+        std::vector<std::vector<uint64_t>> taskCounts(numTasks, std::vector<uint64_t>(histogramLength, 0));
+        std::vector<size_t> taskIndices(numTasks);
+        std::iota(taskIndices.begin(), taskIndices.end(), size_t{0});
+
+        std::for_each(std::execution::par, taskIndices.begin(), taskIndices.end(), [&](size_t taskIndex)
+        {
+            const size_t begin = taskIndex * taskLength;
+            if (begin >= numValues)
+            {
+                return;
+            }
+            const size_t length = std::min(taskLength, numValues - begin);
+
+            if (is16Bit)
+            {
+                const auto values = std::span{reinterpret_cast<const uint16_t*>(data.data()) + begin, length};
+                AccumulateHistogram(values, components, numBins, std::span{taskCounts[taskIndex]});
+            }
+            else
+            {
+                const auto values = std::span{data.data() + begin, length};
+                AccumulateHistogram(values, components, numBins, std::span{taskCounts[taskIndex]});
+            }
+        });
+
+        for (const auto& taskCount : taskCounts)
+        {
+            std::transform(counts.begin(), counts.end(), taskCount.begin(), counts.begin(), std::plus<>{});
+        }
+    }
+
+    /// Adds all voxels of each uniform brick of a sparse volume to the bins of its single voxel
+    void AccumulateUniformBricks(const VolumeData::SparseVolumeData& sparseVolumeData, bool is16Bit, uint32_t components, uint32_t numBins, std::span<uint64_t> counts)
+    {
+        const uint32_t bitsPerComponent = is16Bit ? 16 : 8;
+        for (size_t brickIndex = 0; brickIndex < sparseVolumeData.GetNumBricks(); ++brickIndex)
+        {
+            const auto& brick = sparseVolumeData.GetBrick(brickIndex);
+            if (!brick.isUniform)
+            {
+                continue;
+            }
+
+            const size_t voxelCount = sparseVolumeData.GetBrickExtent(brickIndex).GetVoxelCount();
+            const auto* voxel = reinterpret_cast<const uint8_t*>(&brick.uniformVoxel);
+            for (uint32_t c = 0; c < components; ++c)
+            {
+                uint16_t value = voxel[c];
+                if (is16Bit)
+                {
+                    std::memcpy(&value, voxel + c * sizeof(uint16_t), sizeof(uint16_t));
+                }
+                counts[c * numBins + ((static_cast<uint32_t>(value) * numBins) >> bitsPerComponent)] += voxelCount;
+            }
+        }
+    }
+} // anonymous namespace
+
+VolumeData::VolumeHistogram VolumeData::ComputeVolumeHistogram(const VolumeData& volumeData, uint32_t numBins)
+{
+    VolumeHistogram histogram;
+    if (!volumeData.IsValid() || numBins == 0 || numBins > Constants::maxNumBins)
+    {
+        return histogram;
+    }
+
+    const auto& metadata = volumeData.GetMetadata();
+    const uint32_t components = metadata.GetComponents();
+    const uint32_t bitsPerComponent = metadata.GetBitsPerComponent();
+    if ((bitsPerComponent != 8 && bitsPerComponent != 16) || Constants::blockLength % components != 0)
+    {
+        return histogram;
+    }
+
+    const bool is16Bit = (bitsPerComponent == 16);
+    const size_t histogramLength = static_cast<size_t>(numBins) * components;
+
+    histogram.numBins = numBins;
+    histogram.components = components;
+    histogram.counts.assign(histogramLength, 0);
+
+    // The histogram does not depend on the voxel positions, so a sparse volume is read from its brick table without expanding it
+    if (const auto* sparseVolumeData = volumeData.GetSparseData())
+    {
+        AccumulateHistogramInParallel(sparseVolumeData->GetBrickData(), is16Bit, components, numBins, std::span{histogram.counts});
+        AccumulateUniformBricks(*sparseVolumeData, is16Bit, components, numBins, std::span{histogram.counts});
+        return histogram;
+    }
+
+    AccumulateHistogramInParallel(volumeData.GetData(), is16Bit, components, numBins, std::span{histogram.counts});
+    return histogram;
+}
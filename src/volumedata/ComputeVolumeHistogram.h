@@ -0,0 +1,41 @@
+/**
+* \file ComputeVolumeHistogram.h
+*
+* \brief Function for computing the value histogram of a volume.
+*/
+
+#ifndef COMPUTE_VOLUME_HISTOGRAM_H
+#define COMPUTE_VOLUME_HISTOGRAM_H
+
+#include <volumedata/VolumeHistogram.h>
+
+#include <cstdint>
+
+namespace VolumeData
+{
+    class VolumeData;
+
+    /**
+    * Computes the histogram of every component of a volume.
+    *
+    * The volume is split into one range per task, a few tasks per hardware thread, and each
+    * task fills its own sub-histogram, which are summed at the end. Within a task, bin indices
+    * are computed for a block of values in a branch-free loop the compiler can vectorize, and
+    * consecutive values are counted into four interleaved sub-histograms so that runs of equal
+    * values do not stall on a single counter.
+    *
+    * Works for 8-bit and 16-bit volumes with up to four components, and reads mapped
+    * volumes in place without materializing them. Sparse volumes are not expanded either:
+    * the voxels of their non-uniform bricks are counted as above, and each uniform brick
+    * adds its voxel count to the bins of its single voxel.
+    *
+    * @param volumeData The volume to compute the histogram of.
+    * @param numBins Number of bins per component, between 1 and 65536.
+    * @return VolumeHistogram The histogram, or an empty histogram if the volume or numBins is not supported.
+    *
+    * @see VolumeHistogram for the bin layout.
+    */
+    VolumeHistogram ComputeVolumeHistogram(const VolumeData& volumeData, uint32_t numBins);
+}
+
+#endif
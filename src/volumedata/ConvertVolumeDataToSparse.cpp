@@ -0,0 +1,27 @@
+#include <volumedata/ConvertVolumeDataToSparse.h>
+#include <volumedata/MakeSparseVolumeData.h>
+
+#include <utility>
+
+VolumeData::VolumeData VolumeData::ConvertVolumeDataToSparse(VolumeData&& volumeData, uint32_t brickSize)
+{
+    if (!volumeData.IsValid() || volumeData.IsSparse())
+    {
+        return std::move(volumeData);
+    }
+
+    auto sparseVolumeData = MakeSparseVolumeData(volumeData, brickSize);
+    if (!sparseVolumeData.IsValid())
+    {
+        return std::move(volumeData);
+    }
+
+    auto convertedVolumeData = VolumeData{std::move(sparseVolumeData)};
+    convertedVolumeData.SetSourcePath(volumeData.GetSourcePath());
+    if (const auto& contentHash = volumeData.GetContentHash())
+    {
+        convertedVolumeData.SetContentHash(contentHash.value());
+    }
+
+    return convertedVolumeData;
+}
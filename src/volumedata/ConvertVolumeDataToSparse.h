@@ -0,0 +1,36 @@
+/**
+* \file ConvertVolumeDataToSparse.h
+*
+* \brief Function for replacing the dense voxels of a volume by a sparse backing.
+*/
+
+#ifndef CONVERT_VOLUME_DATA_TO_SPARSE_H
+#define CONVERT_VOLUME_DATA_TO_SPARSE_H
+
+#include <volumedata/SparseVolumeData.h>
+#include <volumedata/VolumeData.h>
+
+#include <cstdint>
+
+namespace VolumeData
+{
+    /**
+    * Replaces the owned or mapped voxels of a volume by a SparseVolumeData.
+    *
+    * The dense voxels are released once the sparse volume has been made, so a mapped volume
+    * only pages in its file once and afterwards holds just its non-uniform bricks. Source
+    * path and content hash are preserved, since the voxels do not change.
+    *
+    * A volume that is invalid or already sparse is returned unchanged.
+    *
+    * @param volumeData The volume to convert.
+    * @param brickSize Edge length of a brick in voxels.
+    * @return VolumeData The volume backed by a sparse volume, or the unchanged volume.
+    *
+    * @see VolumeStorageMode for the storage mode that selects sparse volumes.
+    * @see MakeSparseVolumeData for the conversion.
+    */
+    VolumeData ConvertVolumeDataToSparse(VolumeData&& volumeData, uint32_t brickSize = SparseVolumeData::defaultBrickSize);
+}
+
+#endif
@@ -0,0 +1,91 @@
+#include <volumedata/DecodeBrick.h>
+
+#include <algorithm>
+#include <cstring>
+#include <vector>
+
+namespace Constants
+{
+    constexpr uint8_t firstRunControl = 128;
+    constexpr uint8_t runControlOffset = 125;
+}
+
+namespace
+{
+    /// Decode one byte plane of planeSize bytes, advancing position past its encoding
+    bool DecodePlane(std::span<const uint8_t> encoded, size_t& position, std::span<uint8_t> plane)
+    {
+        size_t planePosition = 0;
+        while (planePosition < plane.size())
+        {
+            if (position >= encoded.size())
+            {
+                return false;
+            }
+
+            const uint8_t control = encoded[position++];
+            if (control >= Constants::firstRunControl)
+            {
+                const size_t runLength = control - Constants::runControlOffset;
+                if (position >= encoded.size() || runLength > plane.size() - planePosition)
+                {
+                    return false;
+                }
+
+                std::fill_n(plane.begin() + planePosition, runLength, encoded[position++]);
+                planePosition += runLength;
+            }
+            else
+            {
+                const size_t literalLength = static_cast<size_t>(control) + 1;
+                if (literalLength > encoded.size() - position || literalLength > plane.size() - planePosition)
+                {
+                    return false;
+                }
+
+                std::memcpy(plane.data() + planePosition, encoded.data() + position, literalLength);
+                position += literalLength;
+                planePosition += literalLength;
+            }
+        }
+        return true;
+    }
+} // anonymous namespace
+
+bool VolumeData::DecodeBrick(std::span<const uint8_t> encoded, uint32_t components, uint32_t bitsPerComponent, std::span<uint8_t> voxels)
+{
+    size_t position = 0;
+
+    if (bitsPerComponent == 16)
+    {
+        const size_t numValues = voxels.size() / sizeof(uint16_t);
+        std::vector<uint8_t> lowPlane(numValues);
+        std::vector<uint8_t> highPlane(numValues);
+        if (!DecodePlane(encoded, position, lowPlane) || !DecodePlane(encoded, position, highPlane))
+        {
+            return false;
+        }
+
+        std::vector<uint16_t> values(numValues);
+        for (size_t i = 0; i < numValues; ++i)
+        {
+            const auto residual = static_cast<uint16_t>(lowPlane[i] | (highPlane[i] << 8));
+            values[i] = (i < components) ? residual : static_cast<uint16_t>(values[i - components] + residual);
+        }
+        std::memcpy(voxels.data(), values.data(), numValues * sizeof(uint16_t));
+    }
+    else
+    {
+        if (!DecodePlane(encoded, position, voxels))
+        {
+            return false;
+        }
+
+        for (size_t i = components; i < voxels.size(); ++i)
+        {
+            voxels[i] = static_cast<uint8_t>(voxels[i - components] + voxels[i]);
+        }
+    }
+
+    return position == encoded.size();
+}
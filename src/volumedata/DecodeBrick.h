@@ -0,0 +1,32 @@
+/**
+* \file DecodeBrick.h
+*
+* \brief Function for decompressing the voxels of a brick.
+*/
+
+#ifndef DECODE_BRICK_H
+#define DECODE_BRICK_H
+
+#include <cstdint>
+#include <span>
+
+namespace VolumeData
+{
+    /**
+    * Decompresses a brick encoded with EncodeBrick().
+    *
+    * The decoder checks every run against the bounds of the input and the output,
+    * so corrupt input is rejected instead of reading or writing out of range.
+    *
+    * @param encoded The encoded brick.
+    * @param components Number of components per voxel.
+    * @param bitsPerComponent Bits per component (8 or 16).
+    * @param voxels Buffer receiving the decoded voxels. Its size must equal the decoded size of the brick.
+    * @return bool True if the brick was decoded, false if the input is corrupt.
+    *
+    * @see EncodeBrick for the encoding.
+    */
+    bool DecodeBrick(std::span<const uint8_t> encoded, uint32_t components, uint32_t bitsPerComponent, std::span<uint8_t> voxels);
+}
+
+#endif
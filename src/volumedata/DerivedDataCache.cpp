@@ -0,0 +1,128 @@
+#include <volumedata/DerivedDataCache.h>
+#include <volumedata/DerivedDataHeader.h>
+#include <volumedata/MappedFile.h>
+
+#include <cstddef>
+#include <cstring>
+#include <format>
+#include <fstream>
+#include <numeric>
+#include <system_error>
+#include <vector>
+
+namespace
+{
+    template <typename Part>
+    uint64_t GetPayloadSizeInBytes(std::span<const Part> parts)
+    {
+        return std::accumulate(parts.begin(), parts.end(), uint64_t{0}, [](uint64_t sizeInBytes, const Part& part)
+        {
+            return sizeInBytes + part.size();
+        });
+    }
+
+    bool IsHeaderMatching(const VolumeData::DerivedDataHeader& header, const VolumeData::DerivedDataKey& key, uint64_t payloadSizeInBytes, size_t fileSizeInBytes)
+    {
+        return header.magic == VolumeData::DerivedDataFormat::magic &&
+            header.version == VolumeData::DerivedDataFormat::version &&
+            header.type == key.type &&
+            header.contentHash == key.contentHash &&
+            header.parameter == key.parameter &&
+            header.payloadOffset >= sizeof(VolumeData::DerivedDataHeader) &&
+            header.payloadSizeInBytes == payloadSizeInBytes &&
+            header.payloadOffset <= fileSizeInBytes &&
+            header.payloadSizeInBytes <= fileSizeInBytes - header.payloadOffset;
+    }
+} // anonymous namespace
+
+VolumeData::DerivedDataCache::DerivedDataCache(const std::filesystem::path& directoryPath)
+    : m_directoryPath{directoryPath}
+{
+}
+
+std::filesystem::path VolumeData::DerivedDataCache::GetEntryPath(const DerivedDataKey& key) const
+{
+    const auto fileName = std::format("{:016x}_{}_{}{}", key.contentHash, static_cast<uint32_t>(key.type), key.parameter, DerivedDataFormat::fileExtension);
+    return m_directoryPath / fileName;
+}
+
+bool VolumeData::DerivedDataCache::Read(const DerivedDataKey& key, std::span<const std::span<std::byte>> parts) const
+{
+    const auto mappedFile = MappedFile{GetEntryPath(key), MappedFileAccessPattern::Sequential};
+    if (!mappedFile.IsMapped() || mappedFile.GetSizeInBytes() < sizeof(DerivedDataHeader))
+    {
+        return false;
+    }
+
+    DerivedDataHeader header;
+    std::memcpy(&header, mappedFile.GetDataPtr(), sizeof(DerivedDataHeader));
+    if (!IsHeaderMatching(header, key, GetPayloadSizeInBytes(parts), mappedFile.GetSizeInBytes()))
+    {
+        return false;
+    }
+
+    const auto* source = reinterpret_cast<const std::byte*>(mappedFile.GetDataPtr() + header.payloadOffset);
+    for (const auto part : parts)
+    {
+        std::memcpy(part.data(), source, part.size());
+        source += part.size();
+    }
+
+    return true;
+}
+
+std::expected<void, VolumeData::VolumeWritingError> VolumeData::DerivedDataCache::Write(const DerivedDataKey& key, std::span<const std::span<const std::byte>> parts) const
+{
+    std::error_code errorCode;
+    std::filesystem::create_directories(m_directoryPath, errorCode);
+    if (errorCode)
+    {
+        return std::unexpected(VolumeWritingError::CannotOpenFile);
+    }
+
+    const auto entryPath = GetEntryPath(key);
+    auto temporaryPath = entryPath;
+    temporaryPath += ".tmp";
+
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            return std::unexpected(VolumeWritingError::CannotOpenFile);
+        }
+
+        const auto header = DerivedDataHeader{
+            .magic = DerivedDataFormat::magic,
+            .version = DerivedDataFormat::version,
+            .type = key.type,
+            .contentHash = key.contentHash,
+            .parameter = key.parameter,
+            .payloadOffset = DerivedDataFormat::payloadAlignment,
+            .payloadSizeInBytes = GetPayloadSizeInBytes(parts)
+        };
+
+        const std::vector<char> padding(DerivedDataFormat::payloadAlignment - sizeof(DerivedDataHeader), '\0');
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(padding.data(), static_cast<std::streamsize>(padding.size()));
+        for (const auto part : parts)
+        {
+            file.write(reinterpret_cast<const char*>(part.data()), static_cast<std::streamsize>(part.size()));
+        }
+
+        if (!file.good())
+        {
+            file.close();
+            std::filesystem::remove(temporaryPath, errorCode);
+            return std::unexpected(VolumeWritingError::WriteError);
+        }
+    }
+
+    std::filesystem::rename(temporaryPath, entryPath, errorCode);
+    if (errorCode)
+    {
+        std::filesystem::remove(temporaryPath, errorCode);
+        return std::unexpected(VolumeWritingError::WriteError);
+    }
+
+    return {};
+}
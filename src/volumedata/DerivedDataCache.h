@@ -0,0 +1,83 @@
+/**
+* \file DerivedDataCache.h
+*
+* \brief On-disk cache of data derived from volumes.
+*/
+
+#ifndef DERIVED_DATA_CACHE_H
+#define DERIVED_DATA_CACHE_H
+
+#include <volumedata/DerivedDataKey.h>
+#include <volumedata/VolumeWritingError.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+#include <span>
+
+namespace VolumeData
+{
+    /**
+    * \class DerivedDataCache
+    *
+    * \brief Stores products derived from a volume in a cache directory, one file per DerivedDataKey.
+    *
+    * Preprocessing such as gradient, histogram, min-max grid and pyramid computation only
+    * depends on the voxels of a volume and a parameter, so its results are keyed by the
+    * content hash of the volume and reused across runs. Each entry is a DerivedDataHeader
+    * followed by an aligned payload, which is read through a MappedFile.
+    *
+    * The caller describes a product as a list of byte ranges, which are written back to back
+    * and read into buffers of the sizes it expects from the source metadata and the parameter.
+    * An entry whose header or size does not match, for example one written by an older file
+    * format version, counts as a miss, and the recomputed product replaces it.
+    * Entries are written to a temporary file that is renamed when complete, so concurrent
+    * readers and interrupted runs never see partial entries.
+    *
+    * All member functions are const and may be called from several threads for different keys.
+    *
+    * @see DerivedDataHeader for the file layout.
+    * @see ComputeVolumeContentHash for the hash entries are keyed by.
+    * @see LoadOrComputeGradientVolume for an example of using the cache.
+    */
+    class DerivedDataCache
+    {
+    public:
+        /**
+        * Constructor.
+        * @param directoryPath Directory holding the cache files, created on the first write.
+        */
+        explicit DerivedDataCache(const std::filesystem::path& directoryPath);
+
+        /**
+        * Reads an entry into caller-provided buffers.
+        * @param key The key of the entry.
+        * @param parts The buffers to fill, in the order they were written. Their total size must equal the stored payload size.
+        * @return bool True if a matching entry was found and read, false on a miss, in which case the buffers may be partially filled.
+        */
+        bool Read(const DerivedDataKey& key, std::span<const std::span<std::byte>> parts) const;
+
+        /**
+        * Writes an entry, replacing any existing entry with the same key.
+        * @param key The key of the entry.
+        * @param parts The byte ranges making up the payload.
+        * @return std::expected<void, VolumeWritingError> Empty on success, or the error that occurred.
+        */
+        std::expected<void, VolumeWritingError> Write(const DerivedDataKey& key, std::span<const std::span<const std::byte>> parts) const;
+
+        /**
+        * Gets the path of the file holding an entry.
+        * @param key The key of the entry.
+        * @return std::filesystem::path The path, named after the content hash, type and parameter of the key.
+        */
+        std::filesystem::path GetEntryPath(const DerivedDataKey& key) const;
+
+        const std::filesystem::path& GetDirectoryPath() const { return m_directoryPath; }
+
+    private:
+        std::filesystem::path m_directoryPath; /**< Directory holding the cache files. */
+    };
+}
+
+#endif
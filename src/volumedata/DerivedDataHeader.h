@@ -0,0 +1,59 @@
+/**
+* \file DerivedDataHeader.h
+*
+* \brief On-disk layout of derived data cache files.
+*/
+
+#ifndef DERIVED_DATA_HEADER_H
+#define DERIVED_DATA_HEADER_H
+
+#include <volumedata/DerivedDataType.h>
+
+#include <array>
+#include <cstdint>
+#include <string_view>
+
+namespace VolumeData
+{
+    /**
+    * \namespace DerivedDataFormat
+    *
+    * \brief Constants identifying derived data cache files.
+    */
+    namespace DerivedDataFormat
+    {
+        constexpr std::array<char, 8> magic = {'V', 'R', 'D', 'E', 'R', 'I', 'V', '\0'};
+        constexpr uint32_t version = 1;
+        constexpr std::string_view fileExtension = ".vrcache";
+        constexpr uint64_t payloadAlignment = 64;
+    }
+
+    /**
+    * \struct DerivedDataHeader
+    *
+    * \brief Fixed-size header at the start of a derived data cache file.
+    *
+    * The header repeats the full DerivedDataKey, so that an entry is only used if it was
+    * written for exactly the requested key, even if file names collide or files are renamed.
+    * The payload starts at payloadOffset, aligned to DerivedDataFormat::payloadAlignment
+    * bytes, so that it can be read in place from a file mapping. It holds the raw arrays of
+    * the product back to back, in native byte order.
+    *
+    * @see DerivedDataCache for reading and writing cache files.
+    */
+    struct DerivedDataHeader
+    {
+        std::array<char, 8> magic; /**< File signature, DerivedDataFormat::magic. */
+        uint32_t version; /**< File format version, DerivedDataFormat::version. */
+        DerivedDataType type; /**< Kind of product stored in the file. */
+        uint64_t contentHash; /**< Hash of the source volume. */
+        uint64_t parameter; /**< Parameter the product was computed with. */
+        uint64_t payloadOffset; /**< Byte offset of the payload from the start of the file. */
+        uint64_t payloadSizeInBytes; /**< Size of the payload in bytes. */
+    };
+
+    static_assert(sizeof(DerivedDataHeader) == 48, "DerivedDataHeader must not contain padding");
+    static_assert(sizeof(DerivedDataHeader) <= DerivedDataFormat::payloadAlignment, "DerivedDataHeader must fit before the payload");
+}
+
+#endif
@@ -0,0 +1,34 @@
+/**
+* \file DerivedDataKey.h
+*
+* \brief Key of an entry of the derived data cache.
+*/
+
+#ifndef DERIVED_DATA_KEY_H
+#define DERIVED_DATA_KEY_H
+
+#include <volumedata/DerivedDataType.h>
+
+#include <cstdint>
+
+namespace VolumeData
+{
+    /**
+    * \struct DerivedDataKey
+    *
+    * \brief Identifies a product derived from a volume with given parameters.
+    *
+    * @see ComputeVolumeContentHash for the hash of the source volume.
+    * @see DerivedDataCache for the cache keyed by this struct.
+    */
+    struct DerivedDataKey
+    {
+        uint64_t contentHash = 0; /**< Hash of the metadata and voxels of the source volume. */
+        DerivedDataType type = DerivedDataType::GradientVolume; /**< Kind of product. */
+        uint64_t parameter = 0; /**< Parameter the product was computed with, such as the number of bins, or 0 if it has none. */
+
+        bool operator==(const DerivedDataKey&) const = default;
+    };
+}
+
+#endif
@@ -0,0 +1,33 @@
+/**
+* \file DerivedDataType.h
+*
+* \brief Kinds of data derived from a volume that can be cached on disk.
+*/
+
+#ifndef DERIVED_DATA_TYPE_H
+#define DERIVED_DATA_TYPE_H
+
+#include <cstdint>
+
+namespace VolumeData
+{
+    /**
+    * \enum DerivedDataType
+    *
+    * \brief Identifies the product stored in an entry of the DerivedDataCache.
+    *
+    * The values are stored in DerivedDataHeader::type and in the names of the cache files,
+    * so existing values must not be changed.
+    *
+    * @see DerivedDataKey for the full key of a cache entry.
+    */
+    enum class DerivedDataType : uint32_t
+    {
+        GradientVolume = 0,   /**< Encoded gradient volume, see ComputeGradientVolume. */
+        VolumeHistogram = 1,  /**< Value histogram, parameterized by the number of bins, see ComputeVolumeHistogram. */
+        VolumeMinMaxGrid = 2, /**< Per-brick value ranges, parameterized by the brick size, see MakeVolumeMinMaxGrid. */
+        VolumePyramid = 3     /**< Downsampled levels, see MakeVolumePyramid. */
+    };
+}
+
+#endif
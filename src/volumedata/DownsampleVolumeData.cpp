@@ -0,0 +1,123 @@
+#include <volumedata/DownsampleVolumeData.h>
+#include <volumedata/GetDownsampledVolumeMetadata.h>
+#include <volumedata/SparseVolumeData.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <algorithm>
+#include <cstring>
+#include <execution>
+#include <numeric>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    /// First and one past the last source index averaged into a destination index; the last one also takes the odd boundary voxel
+    std::pair<size_t, size_t> GetSourceRange(size_t index, size_t size, size_t sourceSize)
+    {
+        const size_t begin = std::min(2 * index, sourceSize - 1);
+        const size_t end = (index + 1 == size) ? sourceSize : 2 * index + 2;
+        return {begin, end};
+    }
+
+    template <typename T>
+    void DownsampleSlices(const VolumeData::VolumeData& sourceVolumeData, const VolumeData::VolumeMetadata& metadata, uint8_t* destination)
+    {
+        const auto& sourceMetadata = sourceVolumeData.GetMetadata();
+        const auto* sparseVolumeData = sourceVolumeData.GetSparseData();
+        const auto* source = (sparseVolumeData == nullptr) ? reinterpret_cast<const T*>(sourceVolumeData.GetDataPtr()) : nullptr;
+        const size_t components = sourceMetadata.GetComponents();
+        const size_t sourceWidth = sourceMetadata.GetWidth();
+        const size_t sourceRowLength = sourceWidth * components;
+        const size_t sourceSliceLength = sourceRowLength * sourceMetadata.GetHeight();
+        const size_t rowLength = static_cast<size_t>(metadata.GetWidth()) * components;
+        const size_t sliceLength = rowLength * metadata.GetHeight();
+
+        std::vector<uint32_t> sliceIndices(metadata.GetDepth());
+        std::iota(sliceIndices.begin(), sliceIndices.end(), 0u);
+
+        // Not unsequenced, since each slice allocates its row buffers
+        std::for_each(std::execution::par, sliceIndices.begin(), sliceIndices.end(), [&](uint32_t z)
+        {
+            const auto [zBegin, zEnd] = GetSourceRange(z, metadata.GetDepth(), sourceMetadata.GetDepth());
+
+            // Rows are summed in memory order before the horizontal neighbors are combined
+            std::vector<uint32_t> rowSum(sourceRowLength);
+            std::vector<T> row(rowLength);
+
+            // Rows of a sparse volume are expanded one at a time instead of expanding the whole volume
+            std::vector<T> sparseRow((sparseVolumeData != nullptr) ? sourceRowLength : 0);
+            const auto GetSourceRow = [&](size_t sourceY, size_t sourceZ) -> const T*
+            {
+                if (sparseVolumeData == nullptr)
+                {
+                    return source + sourceZ * sourceSliceLength + sourceY * sourceRowLength;
+                }
+
+                sparseVolumeData->CopyRow(static_cast<uint32_t>(sourceY), static_cast<uint32_t>(sourceZ), std::span<uint8_t>{reinterpret_cast<uint8_t*>(sparseRow.data()), sparseRow.size() * sizeof(T)});
+                return sparseRow.data();
+            };
+
+            for (auto y = 0u; y < metadata.GetHeight(); ++y)
+            {
+                const auto [yBegin, yEnd] = GetSourceRange(y, metadata.GetHeight(), sourceMetadata.GetHeight());
+
+                std::fill(rowSum.begin(), rowSum.end(), 0u);
+                for (size_t sourceZ = zBegin; sourceZ < zEnd; ++sourceZ)
+                {
+                    for (size_t sourceY = yBegin; sourceY < yEnd; ++sourceY)
+                    {
+                        const auto* sourceRow = GetSourceRow(sourceY, sourceZ);
+                        for (size_t i = 0; i < sourceRowLength; ++i)
+                        {
+                            rowSum[i] += sourceRow[i];
+                        }
+                    }
+                }
+
+                const size_t numRowsSummed = (zEnd - zBegin) * (yEnd - yBegin);
+                for (size_t x = 0; x < metadata.GetWidth(); ++x)
+                {
+                    const auto [xBegin, xEnd] = GetSourceRange(x, metadata.GetWidth(), sourceWidth);
+                    const size_t numVoxels = numRowsSummed * (xEnd - xBegin);
+                    for (size_t c = 0; c < components; ++c)
+                    {
+                        uint64_t sum = 0;
+                        for (size_t sourceX = xBegin; sourceX < xEnd; ++sourceX)
+                        {
+                            sum += rowSum[sourceX * components + c];
+                        }
+                        row[x * components + c] = static_cast<T>((sum + numVoxels / 2) / numVoxels);
+                    }
+                }
+
+                std::memcpy(destination + (z * sliceLength + y * rowLength) * sizeof(T), row.data(), rowLength * sizeof(T));
+            }
+        });
+    }
+} // anonymous namespace
+
+VolumeData::VolumeData VolumeData::DownsampleVolumeData(const VolumeData& volumeData)
+{
+    const auto& sourceMetadata = volumeData.GetMetadata();
+    const auto metadata = GetDownsampledVolumeMetadata(sourceMetadata);
+
+    auto downsampledVolumeData = VolumeData{metadata};
+    if (!volumeData.IsValid())
+    {
+        return downsampledVolumeData;
+    }
+
+    if (sourceMetadata.GetBitsPerComponent() == 16)
+    {
+        DownsampleSlices<uint16_t>(volumeData, metadata, downsampledVolumeData.GetDataPtr());
+    }
+    else
+    {
+        DownsampleSlices<uint8_t>(volumeData, metadata, downsampledVolumeData.GetDataPtr());
+    }
+
+    return downsampledVolumeData;
+}
@@ -0,0 +1,37 @@
+/**
+* \file DownsampleVolumeData.h
+*
+* \brief Function for creating a half-resolution copy of volume data.
+*/
+
+#ifndef DOWNSAMPLE_VOLUME_DATA_H
+#define DOWNSAMPLE_VOLUME_DATA_H
+
+namespace VolumeData
+{
+    class VolumeData;
+
+    /**
+    * Creates a half-resolution copy of a volume by averaging 2x2x2 voxel blocks.
+    *
+    * Each component is averaged separately with rounding. Dimensions are halved and rounded
+    * down, as in an OpenGL mip chain, and the last voxel of an odd dimension is averaged into
+    * the last block, which then spans three voxels along that axis, so every voxel of the
+    * source contributes. Supports 8-bit and 16-bit components.
+    *
+    * Slices are processed in parallel, and rows are traversed in memory order so that the
+    * inner loop over a row can be vectorized. The rows of a sparse volume are expanded one
+    * at a time with SparseVolumeData::CopyRow(), so the pyramid of a sparse volume is built
+    * without expanding it.
+    *
+    * @param volumeData The source volume.
+    * @return VolumeData The downsampled volume, owning its data.
+    *
+    * @see GetDownsampledVolumeMetadata for the dimensions and scale of the result.
+    * @see MakeVolumePyramid for building a full chain of downsampled levels.
+    * @see SubsampleVolumeData for a strided copy without filtering.
+    */
+    VolumeData DownsampleVolumeData(const VolumeData& volumeData);
+}
+
+#endif
@@ -0,0 +1,94 @@
+#include <volumedata/EncodeBrick.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace Constants
+{
+    constexpr size_t maxLiteralLength = 128;
+    constexpr size_t minRunLength = 3;
+    constexpr size_t maxRunLength = 130;
+    constexpr uint8_t runControlOffset = 125;
+}
+
+namespace
+{
+    /// Length of the run of equal bytes starting at position
+    size_t GetRunLength(const std::vector<uint8_t>& plane, size_t position)
+    {
+        const size_t end = std::min(plane.size(), position + Constants::maxRunLength);
+        size_t runEnd = position + 1;
+        while (runEnd < end && plane[runEnd] == plane[position])
+        {
+            ++runEnd;
+        }
+        return runEnd - position;
+    }
+
+    void EncodePlane(const std::vector<uint8_t>& plane, std::vector<uint8_t>& encoded)
+    {
+        size_t position = 0;
+        while (position < plane.size())
+        {
+            const size_t runLength = GetRunLength(plane, position);
+            if (runLength >= Constants::minRunLength)
+            {
+                encoded.push_back(static_cast<uint8_t>(runLength + Constants::runControlOffset));
+                encoded.push_back(plane[position]);
+                position += runLength;
+                continue;
+            }
+
+            // Collect literals until the next run that is worth encoding as such
+            const size_t literalBegin = position;
+            while (position < plane.size() && position - literalBegin < Constants::maxLiteralLength && GetRunLength(plane, position) < Constants::minRunLength)
+            {
+                ++position;
+            }
+
+            encoded.push_back(static_cast<uint8_t>(position - literalBegin - 1));
+            encoded.insert(encoded.end(), plane.begin() + literalBegin, plane.begin() + position);
+        }
+    }
+
+    template <typename T>
+    std::vector<T> ComputeResiduals(std::span<const uint8_t> voxels, uint32_t components)
+    {
+        std::vector<T> values(voxels.size() / sizeof(T));
+        std::memcpy(values.data(), voxels.data(), values.size() * sizeof(T));
+
+        std::vector<T> residuals(values.size());
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            residuals[i] = (i < components) ? values[i] : static_cast<T>(values[i] - values[i - components]);
+        }
+        return residuals;
+    }
+} // anonymous namespace
+
+std::vector<uint8_t> VolumeData::EncodeBrick(std::span<const uint8_t> voxels, uint32_t components, uint32_t bitsPerComponent)
+{
+    std::vector<uint8_t> encoded;
+    encoded.reserve(voxels.size() / 4);
+
+    if (bitsPerComponent == 16)
+    {
+        const auto residuals = ComputeResiduals<uint16_t>(voxels, components);
+        std::vector<uint8_t> plane(residuals.size());
+
+        for (auto byteIndex = 0u; byteIndex < sizeof(uint16_t); ++byteIndex)
+        {
+            std::transform(residuals.begin(), residuals.end(), plane.begin(), [byteIndex](uint16_t residual)
+            {
+                return static_cast<uint8_t>(residual >> (8 * byteIndex));
+            });
+            EncodePlane(plane, encoded);
+        }
+    }
+    else
+    {
+        EncodePlane(ComputeResiduals<uint8_t>(voxels, components), encoded);
+    }
+
+    return encoded;
+}
@@ -0,0 +1,41 @@
+/**
+* \file EncodeBrick.h
+*
+* \brief Function for compressing the voxels of a brick.
+*/
+
+#ifndef ENCODE_BRICK_H
+#define ENCODE_BRICK_H
+
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace VolumeData
+{
+    /**
+    * Compresses the voxels of a brick with BrickCompression::DeltaRle.
+    *
+    * Each component value is replaced by its difference to the same component of the
+    * previous voxel, modulo the component range. The differences are then split into byte
+    * planes, least significant byte first, and every plane is run-length encoded.
+    * Homogeneous regions such as the air around a CT scan turn into long runs of zero
+    * bytes, and for 16-bit data the high byte plane of slowly varying tissue compresses
+    * well even where the low byte plane is noisy.
+    *
+    * The run-length encoding uses a control byte per chunk: values 0 to 127 are followed
+    * by that many plus one literal bytes, values 128 to 255 are followed by a single byte
+    * that is repeated the value minus 125 times.
+    *
+    * @param voxels The voxels of the brick.
+    * @param components Number of components per voxel.
+    * @param bitsPerComponent Bits per component (8 or 16).
+    * @return std::vector<uint8_t> The encoded brick.
+    *
+    * @see DecodeBrick for the inverse operation.
+    * @see BrickCompression for how encoded bricks are stored.
+    */
+    std::vector<uint8_t> EncodeBrick(std::span<const uint8_t> voxels, uint32_t components, uint32_t bitsPerComponent);
+}
+
+#endif
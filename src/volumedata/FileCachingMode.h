@@ -0,0 +1,33 @@
+/**
+* \file FileCachingMode.h
+*
+* \brief Whether file reads go through the operating system file cache.
+*/
+
+#ifndef FILE_CACHING_MODE_H
+#define FILE_CACHING_MODE_H
+
+namespace VolumeData
+{
+    /**
+    * \enum FileCachingMode
+    *
+    * \brief Selects between cached and direct reads of a PositionedFileReader.
+    *
+    * Cached reads copy the data through the operating system file cache, which makes
+    * repeated reads of the same file fast but costs a copy per byte and evicts other
+    * cached files. Uncached reads transfer the data straight from the device, which is
+    * what fast NVMe storage needs to reach its bandwidth for volumes read once, but
+    * requires reads that are aligned to PositionedFileReader::uncachedAlignmentInBytes.
+    *
+    * @see PositionedFileReader for the reads these modes apply to.
+    * @see ReadFileInParallel for reading a whole file in either mode.
+    */
+    enum class FileCachingMode
+    {
+        Cached,  /**< Reads go through the operating system file cache. */
+        Uncached /**< Reads bypass the file cache, via O_DIRECT, F_NOCACHE or FILE_FLAG_NO_BUFFERING. */
+    };
+}
+
+#endif
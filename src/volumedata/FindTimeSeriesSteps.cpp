@@ -0,0 +1,88 @@
+#include <volumedata/FindTimeSeriesSteps.h>
+
+#include <algorithm>
+#include <cctype>
+#include <string>
+#include <string_view>
+#include <system_error>
+
+namespace
+{
+    bool IsDigit(char character)
+    {
+        return std::isdigit(static_cast<unsigned char>(character)) != 0;
+    }
+
+    /// Compare two file names, treating runs of digits as numbers
+    bool IsNaturallyLess(const std::string& lhs, const std::string& rhs)
+    {
+        size_t i = 0;
+        size_t j = 0;
+
+        while (i < lhs.size() && j < rhs.size())
+        {
+            if (IsDigit(lhs[i]) && IsDigit(rhs[j]))
+            {
+                const size_t lhsBegin = i;
+                const size_t rhsBegin = j;
+                while (i < lhs.size() && IsDigit(lhs[i])) { ++i; }
+                while (j < rhs.size() && IsDigit(rhs[j])) { ++j; }
+
+                // Without leading zeros, the longer run is the larger number
+                const auto lhsNumber = std::string_view{lhs}.substr(lhsBegin, i - lhsBegin);
+                const auto rhsNumber = std::string_view{rhs}.substr(rhsBegin, j - rhsBegin);
+                const auto lhsDigits = lhsNumber.substr(std::min(lhsNumber.find_first_not_of('0'), lhsNumber.size()));
+                const auto rhsDigits = rhsNumber.substr(std::min(rhsNumber.find_first_not_of('0'), rhsNumber.size()));
+
+                if (lhsDigits.size() != rhsDigits.size())
+                {
+                    return lhsDigits.size() < rhsDigits.size();
+                }
+
+                if (lhsDigits != rhsDigits)
+                {
+                    return lhsDigits < rhsDigits;
+                }
+
+                continue;
+            }
+
+            if (lhs[i] != rhs[j])
+            {
+                return lhs[i] < rhs[j];
+            }
+
+            ++i;
+            ++j;
+        }
+
+        if ((lhs.size() - i) != (rhs.size() - j))
+        {
+            return (lhs.size() - i) < (rhs.size() - j);
+        }
+
+        // Fall back to plain ordering, so that e.g. "1" and "01" still have a strict order
+        return lhs < rhs;
+    }
+} // anonymous namespace
+
+std::vector<std::filesystem::path> VolumeData::FindTimeSeriesSteps(const std::filesystem::path& directoryPath)
+{
+    std::vector<std::filesystem::path> stepPaths;
+
+    std::error_code errorCode;
+    for (const auto& entry : std::filesystem::directory_iterator{directoryPath, errorCode})
+    {
+        if (entry.is_regular_file(errorCode) && entry.path().extension() == ".raw")
+        {
+            stepPaths.push_back(entry.path());
+        }
+    }
+
+    std::sort(stepPaths.begin(), stepPaths.end(), [](const std::filesystem::path& lhs, const std::filesystem::path& rhs)
+    {
+        return IsNaturallyLess(lhs.filename().string(), rhs.filename().string());
+    });
+
+    return stepPaths;
+}
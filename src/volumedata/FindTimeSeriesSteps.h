@@ -0,0 +1,30 @@
+/**
+* \file FindTimeSeriesSteps.h
+*
+* \brief Function for enumerating the timesteps of a volume time series.
+*/
+
+#ifndef FIND_TIME_SERIES_STEPS_H
+#define FIND_TIME_SERIES_STEPS_H
+
+#include <filesystem>
+#include <vector>
+
+namespace VolumeData
+{
+    /**
+    * Finds the .raw files of a volume time series in a directory.
+    *
+    * Each .raw file directly inside the directory is one timestep. The files are sorted
+    * by file name in natural order, comparing runs of digits by their numeric value, so
+    * that "step_2.raw" comes before "step_10.raw" whether or not the numbers are padded.
+    *
+    * @param directoryPath Path to the directory holding the timesteps.
+    * @return std::vector<std::filesystem::path> Paths of the timesteps in playback order, empty if the directory does not exist.
+    *
+    * @see TimeSeriesPlayer for playing back the timesteps.
+    */
+    std::vector<std::filesystem::path> FindTimeSeriesSteps(const std::filesystem::path& directoryPath);
+}
+
+#endif
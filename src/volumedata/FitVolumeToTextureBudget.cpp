@@ -0,0 +1,16 @@
+#include <volumedata/FitVolumeToTextureBudget.h>
+#include <volumedata/DownsampleVolumeData.h>
+#include <volumedata/GetVolumeDownsamplingFactor.h>
+
+#include <utility>
+
+VolumeData::VolumeData VolumeData::FitVolumeToTextureBudget(VolumeData&& volumeData, const VolumeTextureBudget& budget)
+{
+    auto fittedVolumeData = std::move(volumeData);
+    for (auto factor = GetVolumeDownsamplingFactor(fittedVolumeData.GetMetadata(), budget); factor > 1; factor /= 2)
+    {
+        fittedVolumeData = DownsampleVolumeData(fittedVolumeData);
+    }
+
+    return fittedVolumeData;
+}
@@ -0,0 +1,32 @@
+/**
+* \file FitVolumeToTextureBudget.h
+*
+* \brief Function for downsampling a volume until its textures fit into a budget.
+*/
+
+#ifndef FIT_VOLUME_TO_TEXTURE_BUDGET_H
+#define FIT_VOLUME_TO_TEXTURE_BUDGET_H
+
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeTextureBudget.h>
+
+namespace VolumeData
+{
+    /**
+    * Downsamples a volume by the factor chosen by GetVolumeDownsamplingFactor().
+    *
+    * The volume is reduced by repeated DownsampleVolumeData() calls, so every source voxel
+    * contributes and the physical extent is preserved. A volume that already fits is
+    * returned unchanged, including its storage mode and source path.
+    *
+    * @param volumeData The full-resolution volume.
+    * @param budget The budget its textures have to fit into.
+    * @return VolumeData The volume at the highest resolution that fits.
+    *
+    * @see GetVolumeDownsamplingFactor for the choice of the factor.
+    * @see Factory::MakeVolumeTextureBudget for the budget of the current context.
+    */
+    VolumeData FitVolumeToTextureBudget(VolumeData&& volumeData, const VolumeTextureBudget& budget);
+}
+
+#endif
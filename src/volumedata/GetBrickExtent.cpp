@@ -0,0 +1,40 @@
+#include <volumedata/GetBrickExtent.h>
+#include <volumedata/BrickedVolumeHeader.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <algorithm>
+
+namespace
+{
+    VolumeData::BrickExtent GetBrickExtent(uint32_t width, uint32_t height, uint32_t depth, uint32_t brickSize, uint32_t numBricksX, uint32_t numBricksY, size_t brickIndex)
+    {
+        const auto brickX = static_cast<uint32_t>(brickIndex % numBricksX);
+        const auto brickY = static_cast<uint32_t>((brickIndex / numBricksX) % numBricksY);
+        const auto brickZ = static_cast<uint32_t>(brickIndex / (static_cast<size_t>(numBricksX) * numBricksY));
+
+        const uint32_t x = brickX * brickSize;
+        const uint32_t y = brickY * brickSize;
+        const uint32_t z = brickZ * brickSize;
+
+        return VolumeData::BrickExtent{
+            .x = x,
+            .y = y,
+            .z = z,
+            .width = std::min(brickSize, width - x),
+            .height = std::min(brickSize, height - y),
+            .depth = std::min(brickSize, depth - z)
+        };
+    }
+} // anonymous namespace
+
+VolumeData::BrickExtent VolumeData::GetBrickExtent(const BrickedVolumeHeader& header, size_t brickIndex)
+{
+    return ::GetBrickExtent(header.width, header.height, header.depth, header.brickSize, header.numBricksX, header.numBricksY, brickIndex);
+}
+
+VolumeData::BrickExtent VolumeData::GetBrickExtent(const VolumeMetadata& metadata, uint32_t brickSize, size_t brickIndex)
+{
+    const uint32_t numBricksX = (metadata.GetWidth() + brickSize - 1) / brickSize;
+    const uint32_t numBricksY = (metadata.GetHeight() + brickSize - 1) / brickSize;
+    return ::GetBrickExtent(metadata.GetWidth(), metadata.GetHeight(), metadata.GetDepth(), brickSize, numBricksX, numBricksY, brickIndex);
+}
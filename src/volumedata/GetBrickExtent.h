@@ -0,0 +1,48 @@
+/**
+* \file GetBrickExtent.h
+*
+* \brief Function for computing the voxel box of a brick in a bricked volume.
+*/
+
+#ifndef GET_BRICK_EXTENT_H
+#define GET_BRICK_EXTENT_H
+
+#include <volumedata/BrickExtent.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace VolumeData
+{
+    struct BrickedVolumeHeader;
+    class VolumeMetadata;
+
+    /**
+    * Computes the origin and size of a brick from its linear index.
+    *
+    * Bricks are numbered x-fastest, then y, then z. Bricks at the upper volume
+    * boundaries are clipped to the volume extent.
+    *
+    * @param header The bricked volume header (volume dimensions, brick size and counts).
+    * @param brickIndex Linear index of the brick.
+    * @return BrickExtent The voxel box covered by the brick.
+    *
+    * @see BrickedVolumeHeader for the brick numbering.
+    * @see BrickExtent for the returned voxel box.
+    */
+    BrickExtent GetBrickExtent(const BrickedVolumeHeader& header, size_t brickIndex);
+
+    /**
+    * Computes the origin and size of a brick from its linear index in a volume split into cubic bricks.
+    *
+    * Uses the same numbering and clipping as the overload for bricked volume files.
+    *
+    * @param metadata The metadata of the volume.
+    * @param brickSize Edge length of a brick in voxels.
+    * @param brickIndex Linear index of the brick.
+    * @return BrickExtent The voxel box covered by the brick.
+    */
+    BrickExtent GetBrickExtent(const VolumeMetadata& metadata, uint32_t brickSize, size_t brickIndex);
+}
+
+#endif
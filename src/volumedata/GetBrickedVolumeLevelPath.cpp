@@ -0,0 +1,15 @@
+#include <volumedata/GetBrickedVolumeLevelPath.h>
+
+#include <string>
+
+std::filesystem::path VolumeData::GetBrickedVolumeLevelPath(const std::filesystem::path& levelZeroPath, uint32_t level)
+{
+    if (level == 0)
+    {
+        return levelZeroPath;
+    }
+
+    auto levelPath = levelZeroPath;
+    levelPath.replace_filename(levelZeroPath.stem().string() + "_lod" + std::to_string(level) + levelZeroPath.extension().string());
+    return levelPath;
+}
@@ -0,0 +1,31 @@
+/**
+* \file GetBrickedVolumeLevelPath.h
+*
+* \brief Function for naming the level-of-detail files of a bricked volume.
+*/
+
+#ifndef GET_BRICKED_VOLUME_LEVEL_PATH_H
+#define GET_BRICKED_VOLUME_LEVEL_PATH_H
+
+#include <cstdint>
+#include <filesystem>
+
+namespace VolumeData
+{
+    /**
+    * Gets the path of a level-of-detail file of a bricked volume.
+    *
+    * Level 0 is the full-resolution file itself. Each coarser level halves the resolution
+    * of the previous one and is stored next to it, with "_lod" and the level number
+    * appended to the file stem, e.g. "knee_lod2.bvol" for level 2 of "knee.bvol".
+    *
+    * @param levelZeroPath Path to the full-resolution bricked volume file.
+    * @param level The level of detail, 0 being the full resolution.
+    * @return std::filesystem::path The path of the level's file.
+    *
+    * @see PagedVolumeStreamer for streaming bricks from all levels.
+    */
+    std::filesystem::path GetBrickedVolumeLevelPath(const std::filesystem::path& levelZeroPath, uint32_t level);
+}
+
+#endif
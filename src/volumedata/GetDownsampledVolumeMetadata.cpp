@@ -0,0 +1,35 @@
+#include <volumedata/GetDownsampledVolumeMetadata.h>
+
+#include <algorithm>
+
+namespace
+{
+    uint32_t GetDownsampledDimension(uint32_t dimension, uint32_t factor)
+    {
+        return std::max(1u, dimension / factor);
+    }
+
+    float GetDownsampledScale(float scale, uint32_t dimension, uint32_t downsampledDimension)
+    {
+        return scale * static_cast<float>(dimension) / static_cast<float>(downsampledDimension);
+    }
+} // anonymous namespace
+
+VolumeData::VolumeMetadata VolumeData::GetDownsampledVolumeMetadata(const VolumeMetadata& metadata, uint32_t factor)
+{
+    auto downsampledMetadata = metadata;
+    if (factor <= 1 || !metadata.IsValid())
+    {
+        return downsampledMetadata;
+    }
+
+    downsampledMetadata.SetWidth(GetDownsampledDimension(metadata.GetWidth(), factor));
+    downsampledMetadata.SetHeight(GetDownsampledDimension(metadata.GetHeight(), factor));
+    downsampledMetadata.SetDepth(GetDownsampledDimension(metadata.GetDepth(), factor));
+    downsampledMetadata.SetScale(
+        GetDownsampledScale(metadata.GetScaleX(), metadata.GetWidth(), downsampledMetadata.GetWidth()),
+        GetDownsampledScale(metadata.GetScaleY(), metadata.GetHeight(), downsampledMetadata.GetHeight()),
+        GetDownsampledScale(metadata.GetScaleZ(), metadata.GetDepth(), downsampledMetadata.GetDepth())
+    );
+    return downsampledMetadata;
+}
@@ -0,0 +1,35 @@
+/**
+* \file GetDownsampledVolumeMetadata.h
+*
+* \brief Function for computing the metadata of a downsampled volume.
+*/
+
+#ifndef GET_DOWNSAMPLED_VOLUME_METADATA_H
+#define GET_DOWNSAMPLED_VOLUME_METADATA_H
+
+#include <volumedata/VolumeMetadata.h>
+
+#include <cstdint>
+
+namespace VolumeData
+{
+    /**
+    * Computes the metadata of a volume downsampled by a power-of-two factor.
+    *
+    * Each dimension becomes max(1, floor(dimension / factor)), the size OpenGL expects for
+    * the mip level log2(factor) of a texture, so that the levels form a complete mip chain.
+    * Downsampling by 2 twice gives the same dimensions as downsampling by 4 once. The scale
+    * grows by the ratio of the old to the new dimension, so that the physical extent of the
+    * volume is preserved.
+    *
+    * @param metadata The metadata of the source volume.
+    * @param factor The downsampling factor, a power of two.
+    * @return VolumeMetadata The metadata of the downsampled volume.
+    *
+    * @see DownsampleVolumeData for downsampling by a factor of 2.
+    * @see MakeVolumePyramid for the chain of levels down to a single voxel.
+    */
+    VolumeMetadata GetDownsampledVolumeMetadata(const VolumeMetadata& metadata, uint32_t factor = 2);
+}
+
+#endif
@@ -0,0 +1,11 @@
+#include <volumedata/GetNyquistStepSize.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <algorithm>
+#include <cstdint>
+
+float VolumeData::GetNyquistStepSize(const VolumeMetadata& metadata)
+{
+    const uint32_t maxDimension = std::max({metadata.GetWidth(), metadata.GetHeight(), metadata.GetDepth(), 1u});
+    return 0.5f / static_cast<float>(maxDimension);
+}
@@ -0,0 +1,28 @@
+/**
+* \file GetNyquistStepSize.h
+*
+* \brief Function for deriving the ray-casting step size that samples a volume at the Nyquist rate.
+*/
+
+#ifndef GET_NYQUIST_STEP_SIZE_H
+#define GET_NYQUIST_STEP_SIZE_H
+
+namespace VolumeData
+{
+    class VolumeMetadata;
+
+    /**
+    * Computes the longest step along a ray that still takes two samples per voxel.
+    *
+    * Rays traverse the volume in normalized texture coordinates, where a voxel spans
+    * 1 / dimension along each axis, so the step is half the spacing of the axis with the
+    * most voxels. Trilinear interpolation reconstructs no frequencies above the voxel
+    * grid's, so sampling any finer adds no detail.
+    *
+    * @param metadata The metadata of the volume texture, which may be smaller than the volume on disk.
+    * @return float The step size in normalized texture coordinates, 0.5 for a volume without voxels.
+    */
+    float GetNyquistStepSize(const VolumeMetadata& metadata);
+}
+
+#endif
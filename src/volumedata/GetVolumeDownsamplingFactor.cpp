@@ -0,0 +1,35 @@
+#include <volumedata/GetVolumeDownsamplingFactor.h>
+#include <volumedata/GetDownsampledVolumeMetadata.h>
+#include <volumedata/GetVolumeTextureSizeInBytes.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <algorithm>
+
+namespace
+{
+    bool FitsIntoBudget(const VolumeData::VolumeMetadata& metadata, const VolumeData::VolumeTextureBudget& budget)
+    {
+        const uint32_t maxDimension = std::max({metadata.GetWidth(), metadata.GetHeight(), metadata.GetDepth()});
+        return maxDimension <= budget.maxDimension && VolumeData::GetVolumeTextureSizeInBytes(metadata) <= budget.maxSizeInBytes;
+    }
+} // anonymous namespace
+
+uint32_t VolumeData::GetVolumeDownsamplingFactor(const VolumeMetadata& metadata, const VolumeTextureBudget& budget)
+{
+    uint32_t factor = 1;
+    auto downsampledMetadata = metadata;
+
+    while (!FitsIntoBudget(downsampledMetadata, budget))
+    {
+        const bool isSingleVoxel = downsampledMetadata.GetWidth() <= 1 && downsampledMetadata.GetHeight() <= 1 && downsampledMetadata.GetDepth() <= 1;
+        if (isSingleVoxel)
+        {
+            break;
+        }
+
+        factor *= 2;
+        downsampledMetadata = GetDownsampledVolumeMetadata(metadata, factor);
+    }
+
+    return factor;
+}
@@ -0,0 +1,37 @@
+/**
+* \file GetVolumeDownsamplingFactor.h
+*
+* \brief Function for choosing the resolution at which a volume fits into a texture budget.
+*/
+
+#ifndef GET_VOLUME_DOWNSAMPLING_FACTOR_H
+#define GET_VOLUME_DOWNSAMPLING_FACTOR_H
+
+#include <volumedata/VolumeTextureBudget.h>
+
+#include <cstdint>
+
+namespace VolumeData
+{
+    class VolumeMetadata;
+
+    /**
+    * Finds the smallest power-of-two downsampling factor at which the textures of a volume fit into a budget.
+    *
+    * A factor of f corresponds to log2(f) successive 2x2x2 reductions by DownsampleVolumeData,
+    * so each dimension becomes max(1, floor(dimension / f)). The factor is increased until no dimension
+    * exceeds VolumeTextureBudget::maxDimension and GetVolumeTextureSizeInBytes() does not exceed
+    * VolumeTextureBudget::maxSizeInBytes, or until the volume is reduced to a single voxel.
+    *
+    * @param metadata The metadata of the full-resolution volume.
+    * @param budget The budget to fit into.
+    * @return uint32_t The downsampling factor, 1 if the volume fits at full resolution.
+    *
+    * @see FitVolumeToTextureBudget for downsampling a volume by this factor.
+    * @see GetVolumeTextureSizeInBytes for the estimated size at each resolution.
+    * @see GetDownsampledVolumeMetadata for the dimensions at each factor.
+    */
+    uint32_t GetVolumeDownsamplingFactor(const VolumeMetadata& metadata, const VolumeTextureBudget& budget);
+}
+
+#endif
@@ -0,0 +1,31 @@
+#include <volumedata/GetVolumeRegionBox.h>
+
+#include <cstdint>
+
+std::optional<VolumeData::BrickExtent> VolumeData::GetVolumeRegionBox(const VolumeMetadata& metadata, const VolumeRegion& region)
+{
+    if (region.stride == 0)
+    {
+        return std::nullopt;
+    }
+
+    // Compared in 64 bits, so that an offset and size close to the limit cannot wrap around
+    const auto GetSize = [](uint32_t offset, uint32_t size, uint32_t dimension) -> std::optional<uint32_t>
+    {
+        if (offset >= dimension || static_cast<uint64_t>(offset) + size > dimension)
+        {
+            return std::nullopt;
+        }
+        return (size == 0) ? dimension - offset : size;
+    };
+
+    const auto width = GetSize(region.x, region.width, metadata.GetWidth());
+    const auto height = GetSize(region.y, region.height, metadata.GetHeight());
+    const auto depth = GetSize(region.z, region.depth, metadata.GetDepth());
+    if (!width || !height || !depth)
+    {
+        return std::nullopt;
+    }
+
+    return BrickExtent{region.x, region.y, region.z, width.value(), height.value(), depth.value()};
+}
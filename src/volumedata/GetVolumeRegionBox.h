@@ -0,0 +1,30 @@
+/**
+* \file GetVolumeRegionBox.h
+*
+* \brief Function for resolving the box of a volume region.
+*/
+
+#ifndef GET_VOLUME_REGION_BOX_H
+#define GET_VOLUME_REGION_BOX_H
+
+#include <volumedata/BrickExtent.h>
+#include <volumedata/VolumeMetadata.h>
+#include <volumedata/VolumeRegion.h>
+
+#include <optional>
+
+namespace VolumeData
+{
+    /**
+    * Resolves the box of a region within a volume, replacing sizes of 0 by the rest of the volume.
+    * @param metadata The metadata of the whole volume.
+    * @param region The region to resolve.
+    * @return std::optional<BrickExtent> The box in voxels of the volume, or std::nullopt if the stride is 0 or the box is empty or exceeds the volume.
+    *
+    * @see VolumeRegion for the region description.
+    * @see GetVolumeRegionMetadata for the metadata of the loaded region.
+    */
+    std::optional<BrickExtent> GetVolumeRegionBox(const VolumeMetadata& metadata, const VolumeRegion& region);
+}
+
+#endif
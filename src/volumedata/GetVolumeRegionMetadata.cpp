@@ -0,0 +1,19 @@
+#include <volumedata/GetVolumeRegionMetadata.h>
+#include <volumedata/GetVolumeRegionBox.h>
+
+std::optional<VolumeData::VolumeMetadata> VolumeData::GetVolumeRegionMetadata(const VolumeMetadata& metadata, const VolumeRegion& region)
+{
+    const auto box = GetVolumeRegionBox(metadata, region);
+    if (!box)
+    {
+        return std::nullopt;
+    }
+
+    const uint32_t stride = region.stride;
+    auto regionMetadata = metadata;
+    regionMetadata.SetWidth((box->width + stride - 1) / stride);
+    regionMetadata.SetHeight((box->height + stride - 1) / stride);
+    regionMetadata.SetDepth((box->depth + stride - 1) / stride);
+    regionMetadata.SetScale(metadata.GetScaleX() * stride, metadata.GetScaleY() * stride, metadata.GetScaleZ() * stride);
+    return regionMetadata;
+}
@@ -0,0 +1,31 @@
+/**
+* \file GetVolumeRegionMetadata.h
+*
+* \brief Function for computing the metadata of a loaded volume region.
+*/
+
+#ifndef GET_VOLUME_REGION_METADATA_H
+#define GET_VOLUME_REGION_METADATA_H
+
+#include <volumedata/VolumeMetadata.h>
+#include <volumedata/VolumeRegion.h>
+
+#include <optional>
+
+namespace VolumeData
+{
+    /**
+    * Computes the metadata of the voxels loaded for a region of a volume.
+    * The dimensions are those of the region's box divided by the stride and rounded up,
+    * and the scale is multiplied by the stride, so that the physical spacing of the loaded
+    * voxels is preserved.
+    * @param metadata The metadata of the whole volume.
+    * @param region The region to load.
+    * @return std::optional<VolumeMetadata> The metadata of the loaded region, or std::nullopt if the region is invalid for the volume.
+    *
+    * @see GetVolumeRegionBox for the validation of the region.
+    */
+    std::optional<VolumeMetadata> GetVolumeRegionMetadata(const VolumeMetadata& metadata, const VolumeRegion& region);
+}
+
+#endif
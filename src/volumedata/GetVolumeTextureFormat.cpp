@@ -0,0 +1,37 @@
+#include <volumedata/GetVolumeTextureFormat.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <glad/glad.h>
+
+VolumeData::VolumeTextureFormat VolumeData::GetVolumeTextureFormat(const VolumeMetadata& metadata)
+{
+    switch (metadata.GetBitsPerComponent())
+    {
+        case 8:
+            switch (metadata.GetComponents())
+            {
+                case 1:
+                    return VolumeTextureFormat{GL_R8, GL_RED, GL_UNSIGNED_BYTE};
+                case 2:
+                    return VolumeTextureFormat{GL_RG8, GL_RG, GL_UNSIGNED_BYTE};
+                case 3:
+                    return VolumeTextureFormat{GL_RGB8, GL_RGB, GL_UNSIGNED_BYTE};
+                default:
+                    return VolumeTextureFormat{GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE};
+            }
+        case 16:
+            switch (metadata.GetComponents())
+            {
+                case 1:
+                    return VolumeTextureFormat{GL_R16, GL_RED, GL_UNSIGNED_SHORT};
+                case 2:
+                    return VolumeTextureFormat{GL_RG16, GL_RG, GL_UNSIGNED_SHORT};
+                case 3:
+                    return VolumeTextureFormat{GL_RGB16, GL_RGB, GL_UNSIGNED_SHORT};
+                default:
+                    return VolumeTextureFormat{GL_RGBA16, GL_RGBA, GL_UNSIGNED_SHORT};
+            }
+        default:
+            return VolumeTextureFormat{GL_R8, GL_RED, GL_UNSIGNED_BYTE};
+    }
+}
@@ -0,0 +1,32 @@
+/**
+* \file GetVolumeTextureFormat.h
+*
+* \brief Function for mapping volume metadata to OpenGL texture formats.
+*/
+
+#ifndef GET_VOLUME_TEXTURE_FORMAT_H
+#define GET_VOLUME_TEXTURE_FORMAT_H
+
+#include <volumedata/VolumeTextureFormat.h>
+
+namespace VolumeData
+{
+    class VolumeMetadata;
+
+    /**
+    * Determines the OpenGL texture format for a volume.
+    *
+    * Selects an 8-bit or 16-bit normalized internal format with one to four
+    * channels based on the bits per component and the number of components.
+    * Unsupported bit depths fall back to GL_R8.
+    *
+    * @param metadata The volume metadata (components, bit depth).
+    * @return VolumeTextureFormat The internal format, pixel format and pixel type.
+    *
+    * @see VolumeTextureFormat for the returned format parameters.
+    * @see VolumeMetadata for the volume metadata.
+    */
+    VolumeTextureFormat GetVolumeTextureFormat(const VolumeMetadata& metadata);
+}
+
+#endif
@@ -0,0 +1,73 @@
+#include <volumedata/GetVolumeTextureSizeInBytes.h>
+#include <volumedata/GetDownsampledVolumeMetadata.h>
+#include <volumedata/GetVolumeTextureFormat.h>
+#include <volumedata/IsVolumeQuantized.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <config/Config.h>
+#include <textures/GetTexelSizeInBytes.h>
+
+#include <cstdint>
+
+namespace Constants
+{
+    constexpr uint32_t gradientComponents = 3;
+    constexpr uint32_t gradientBitsPerComponent = 8;
+    constexpr uint32_t quantizedBitsPerComponent = 8;
+}
+
+namespace
+{
+    size_t GetNumVoxels(uint32_t width, uint32_t height, uint32_t depth)
+    {
+        return static_cast<size_t>(width) * height * depth;
+    }
+
+    /// Number of voxels of all levels of the pyramid below the given level, down to a single voxel
+    size_t GetNumPyramidVoxels(const VolumeData::VolumeMetadata& metadata)
+    {
+        size_t numVoxels = 0;
+        auto levelMetadata = metadata;
+        while (levelMetadata.GetWidth() > 1 || levelMetadata.GetHeight() > 1 || levelMetadata.GetDepth() > 1)
+        {
+            levelMetadata = VolumeData::GetDownsampledVolumeMetadata(levelMetadata);
+            numVoxels += GetNumVoxels(levelMetadata.GetWidth(), levelMetadata.GetHeight(), levelMetadata.GetDepth());
+        }
+        return numVoxels;
+    }
+
+    size_t GetVolumeTexelSizeInBytes(const VolumeData::VolumeMetadata& metadata)
+    {
+        const auto textureFormat = VolumeData::GetVolumeTextureFormat(metadata);
+        return GetTexelSizeInBytes(textureFormat.internalFormat, textureFormat.format, textureFormat.type);
+    }
+} // anonymous namespace
+
+size_t VolumeData::GetVolumeTextureSizeInBytes(const VolumeMetadata& metadata)
+{
+    const size_t numVoxels = GetNumVoxels(metadata.GetWidth(), metadata.GetHeight(), metadata.GetDepth());
+
+    auto textureMetadata = metadata;
+    if (IsVolumeQuantized(metadata))
+    {
+        textureMetadata.SetBitsPerComponent(Constants::quantizedBitsPerComponent);
+    }
+
+    size_t numVolumeVoxels = numVoxels;
+    if (Config::generateVolumePyramid)
+    {
+        numVolumeVoxels += GetNumPyramidVoxels(metadata);
+    }
+
+    size_t sizeInBytes = numVolumeVoxels * GetVolumeTexelSizeInBytes(textureMetadata);
+
+    if (Config::enableGradientShading)
+    {
+        auto gradientMetadata = metadata;
+        gradientMetadata.SetComponents(Constants::gradientComponents);
+        gradientMetadata.SetBitsPerComponent(Constants::gradientBitsPerComponent);
+        sizeInBytes += numVoxels * GetVolumeTexelSizeInBytes(gradientMetadata);
+    }
+
+    return sizeInBytes;
+}
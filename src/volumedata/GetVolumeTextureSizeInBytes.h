@@ -0,0 +1,32 @@
+/**
+* \file GetVolumeTextureSizeInBytes.h
+*
+* \brief Function for estimating the video memory of the textures derived from a volume.
+*/
+
+#ifndef GET_VOLUME_TEXTURE_SIZE_IN_BYTES_H
+#define GET_VOLUME_TEXTURE_SIZE_IN_BYTES_H
+
+#include <cstddef>
+
+namespace VolumeData
+{
+    class VolumeMetadata;
+
+    /**
+    * Estimates the video memory of all textures that are allocated at the resolution of a volume.
+    *
+    * Counts the TextureId::VolumeData texture in the format it is uploaded with, 8-bit if the
+    * volume is quantized, including its mip levels if Config::generateVolumePyramid is set,
+    * and the TextureId::GradientVolume texture if Config::enableGradientShading is set.
+    *
+    * @param metadata The metadata of the volume.
+    * @return size_t The estimated size in bytes.
+    *
+    * @see GetTexelSizeInBytes for the size of a single texel.
+    * @see GetVolumeDownsamplingFactor for fitting a volume into a budget.
+    */
+    size_t GetVolumeTextureSizeInBytes(const VolumeMetadata& metadata);
+}
+
+#endif
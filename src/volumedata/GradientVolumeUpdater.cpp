@@ -0,0 +1,75 @@
+#include <volumedata/GradientVolumeUpdater.h>
+#include <volumedata/LoadOrComputeGradientVolume.h>
+#include <volumedata/MakeVolumeDataTexture.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeHandle.h>
+
+#include <config/Config.h>
+#include <gui/GuiUpdateFlags.h>
+#include <textures/Texture.h>
+#include <textures/TextureId.h>
+
+#include <glad/glad.h>
+
+#include <array>
+#include <cstdint>
+
+VolumeData::GradientVolumeUpdater::GradientVolumeUpdater(const GuiUpdateFlags& guiUpdateFlags, const VolumeHandle& volumeData, Texture& gradientTexture)
+    : m_guiUpdateFlags{guiUpdateFlags}
+    , m_volumeData{volumeData}
+    , m_gradientTexture{gradientTexture}
+    , m_isTextureCleared{false}
+{
+    UpdateTexture();
+}
+
+void VolumeData::GradientVolumeUpdater::Update()
+{
+    if (m_guiUpdateFlags.volumeDataChanged)
+    {
+        UpdateTexture();
+    }
+    else if (m_guiUpdateFlags.timeStepChanged && !m_isTextureCleared)
+    {
+        ClearTexture();
+    }
+}
+
+void VolumeData::GradientVolumeUpdater::UpdateTexture()
+{
+    if (!Config::enableGradientShading || !m_volumeData->IsValid())
+    {
+        return;
+    }
+
+    const auto gradientVolume = LoadOrComputeGradientVolume(*m_volumeData);
+    if (!gradientVolume.IsValid())
+    {
+        return;
+    }
+
+    // Rows of three-byte texels are not padded to four bytes
+    GLint previousUnpackAlignment = 4;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &previousUnpackAlignment);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    m_gradientTexture = Factory::MakeVolumeDataTexture(TextureId::GradientVolume, m_gradientTexture.GetTextureUnitEnum(), gradientVolume);
+    m_isTextureCleared = false;
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, previousUnpackAlignment);
+}
+
+void VolumeData::GradientVolumeUpdater::ClearTexture()
+{
+    // A zero magnitude blends the shading out, the encoded normal is irrelevant
+    const std::array<uint8_t, 3> flatGradient{128, 128, 0};
+
+    GLint previousUnpackAlignment = 4;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &previousUnpackAlignment);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    m_gradientTexture = Texture{TextureId::GradientVolume, m_gradientTexture.GetTextureUnitEnum(), 1, 1, 1, GL_RGB8, GL_RGB, GL_UNSIGNED_BYTE, GL_LINEAR, GL_CLAMP_TO_EDGE, flatGradient.data()};
+    m_isTextureCleared = true;
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, previousUnpackAlignment);
+}
@@ -0,0 +1,73 @@
+/**
+* \file GradientVolumeUpdater.h
+*
+* \brief Keeps the gradient texture used for shading up to date.
+*/
+
+#ifndef GRADIENT_VOLUME_UPDATER_H
+#define GRADIENT_VOLUME_UPDATER_H
+
+struct GuiUpdateFlags;
+class Texture;
+
+namespace VolumeData
+{
+    class VolumeHandle;
+
+    /**
+    * \class GradientVolumeUpdater
+    *
+    * \brief Recomputes and uploads the encoded gradient volume whenever the volume changes.
+    *
+    * The gradients are computed once per published volume on the CPU and uploaded as an RGB8
+    * 3D texture holding the octahedral-encoded normal and the gradient magnitude. The ray
+    * caster reads a single texel per sample instead of six extra volume fetches for an
+    * on-the-fly gradient.
+    *
+    * With Config::enableGradientShading unset, or while no volume is loaded, the texture is
+    * a single texel and the shader does not read it. While a time series is playing, the
+    * texture is a single flat texel, so the steps are drawn unshaded rather than with the
+    * gradients of another step.
+    *
+    * @see ComputeGradientVolume for the gradient computation and encoding.
+    * @see Factory::MakeGradientVolumeUpdater for construction from Storage.
+    */
+    class GradientVolumeUpdater
+    {
+    public:
+        /**
+        * Constructor.
+        * Computes and uploads the gradients of the current volume.
+        * @param guiUpdateFlags Reference to GUI update flags for change detection.
+        * @param volumeData Reference to the handle of the volume data in Storage.
+        * @param gradientTexture Reference to the gradient texture to update.
+        */
+        GradientVolumeUpdater(const GuiUpdateFlags& guiUpdateFlags, const VolumeHandle& volumeData, Texture& gradientTexture);
+
+        /**
+        * Recomputes the gradients if GuiUpdateFlags::volumeDataChanged is set, or clears them if only GuiUpdateFlags::timeStepChanged is set.
+        * Should be called once per frame after the ProgressiveVolumeLoader and before rendering.
+        * @return void
+        */
+        void Update();
+
+    private:
+        /**
+        * Computes the gradients of the current volume and uploads them.
+        */
+        void UpdateTexture();
+
+        /**
+        * Replaces the gradients by a single flat texel, which disables shading.
+        */
+        void ClearTexture();
+
+    private:
+        const GuiUpdateFlags& m_guiUpdateFlags; /**< Reference to GUI update flags. */
+        const VolumeHandle& m_volumeData; /**< Reference to the handle of the volume data in Storage. */
+        Texture& m_gradientTexture; /**< Reference to the gradient texture in Storage. */
+        bool m_isTextureCleared; /**< True if the texture holds the flat texel instead of gradients. */
+    };
+}
+
+#endif
@@ -0,0 +1,9 @@
+#include <volumedata/IsVolumeQuantized.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <config/Config.h>
+
+bool VolumeData::IsVolumeQuantized(const VolumeMetadata& metadata)
+{
+    return Config::volumeQuantizationMode != VolumeQuantizationMode::Off && metadata.GetBitsPerComponent() == 16;
+}
@@ -0,0 +1,25 @@
+/**
+* \file IsVolumeQuantized.h
+*
+* \brief Function for checking whether a volume is uploaded as a quantized texture.
+*/
+
+#ifndef IS_VOLUME_QUANTIZED_H
+#define IS_VOLUME_QUANTIZED_H
+
+namespace VolumeData
+{
+    class VolumeMetadata;
+
+    /**
+    * Checks whether volumes with the given metadata are quantized to 8 bits on upload.
+    *
+    * @param metadata Metadata of the volume.
+    * @return bool True if Config::volumeQuantizationMode is not Off and the volume has 16 bits per component.
+    *
+    * @see VolumeQuantizationMode for the available modes.
+    */
+    bool IsVolumeQuantized(const VolumeMetadata& metadata);
+}
+
+#endif
@@ -0,0 +1,49 @@
+#include <volumedata/LoadOrComputeGradientVolume.h>
+#include <volumedata/ComputeGradientVolume.h>
+#include <volumedata/DerivedDataCache.h>
+#include <volumedata/DerivedDataKey.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <config/Config.h>
+
+#include <array>
+#include <iostream>
+#include <span>
+#include <utility>
+
+namespace Constants
+{
+    constexpr uint32_t gradientComponents = 3;
+    constexpr uint32_t gradientBitsPerComponent = 8;
+}
+
+VolumeData::VolumeData VolumeData::LoadOrComputeGradientVolume(const VolumeData& volumeData)
+{
+    const auto& contentHash = volumeData.GetContentHash();
+    if (!Config::enableDerivedDataCache || !contentHash || !volumeData.IsValid())
+    {
+        return ComputeGradientVolume(volumeData);
+    }
+
+    const auto cache = DerivedDataCache{Config::derivedDataCachePath};
+    const auto key = DerivedDataKey{*contentHash, DerivedDataType::GradientVolume, 0};
+
+    auto gradientMetadata = volumeData.GetMetadata();
+    gradientMetadata.SetComponents(Constants::gradientComponents);
+    gradientMetadata.SetBitsPerComponent(Constants::gradientBitsPerComponent);
+
+    auto gradientVolume = VolumeData{gradientMetadata};
+    if (cache.Read(key, std::array{std::as_writable_bytes(std::span{gradientVolume.GetData()})}))
+    {
+        return gradientVolume;
+    }
+
+    gradientVolume = ComputeGradientVolume(volumeData);
+    if (gradientVolume.IsValid() && !cache.Write(key, std::array{std::as_bytes(std::as_const(gradientVolume).GetData())}))
+    {
+        std::cerr << "Failed to write " << cache.GetEntryPath(key) << std::endl;
+    }
+
+    return gradientVolume;
+}
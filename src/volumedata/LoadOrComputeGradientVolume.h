@@ -0,0 +1,27 @@
+/**
+* \file LoadOrComputeGradientVolume.h
+*
+* \brief Function for getting the gradient volume of a volume from the derived data cache.
+*/
+
+#ifndef LOAD_OR_COMPUTE_GRADIENT_VOLUME_H
+#define LOAD_OR_COMPUTE_GRADIENT_VOLUME_H
+
+namespace VolumeData
+{
+    class VolumeData;
+
+    /**
+    * Reads the gradient volume of a volume from the DerivedDataCache, or computes it via
+    * ComputeGradientVolume() and stores it in the cache.
+    * Volumes without a content hash, and all volumes if Config::enableDerivedDataCache is
+    * false, are passed directly to ComputeGradientVolume().
+    * @param volumeData The 8-bit or 16-bit volume to compute gradients of.
+    * @return VolumeData The encoded gradient volume, or an empty VolumeData if the volume is invalid or unsupported.
+    * @see ComputeGradientVolume for the encoding.
+    * @see DerivedDataCache for the cache.
+    */
+    VolumeData LoadOrComputeGradientVolume(const VolumeData& volumeData);
+}
+
+#endif
@@ -0,0 +1,42 @@
+#include <volumedata/LoadOrComputeVolumeHistogram.h>
+#include <volumedata/ComputeVolumeHistogram.h>
+#include <volumedata/DerivedDataCache.h>
+#include <volumedata/DerivedDataKey.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <config/Config.h>
+
+#include <array>
+#include <iostream>
+#include <span>
+
+VolumeData::VolumeHistogram VolumeData::LoadOrComputeVolumeHistogram(const VolumeData& volumeData, uint32_t numBins)
+{
+    const auto& contentHash = volumeData.GetContentHash();
+    if (!Config::enableDerivedDataCache || !contentHash || !volumeData.IsValid() || numBins == 0)
+    {
+        return ComputeVolumeHistogram(volumeData, numBins);
+    }
+
+    const auto cache = DerivedDataCache{Config::derivedDataCachePath};
+    const auto key = DerivedDataKey{*contentHash, DerivedDataType::VolumeHistogram, numBins};
+
+    auto histogram = VolumeHistogram{};
+    histogram.numBins = numBins;
+    histogram.components = volumeData.GetMetadata().GetComponents();
+    histogram.counts.resize(static_cast<size_t>(numBins) * histogram.components);
+    if (cache.Read(key, std::array{std::as_writable_bytes(std::span{histogram.counts})}))
+    {
+        return histogram;
+    }
+
+    // Empty histograms of unsupported volumes are not cached
+    histogram = ComputeVolumeHistogram(volumeData, numBins);
+    if (!histogram.IsEmpty() && !cache.Write(key, std::array{std::as_bytes(std::span{histogram.counts})}))
+    {
+        std::cerr << "Failed to write " << cache.GetEntryPath(key) << std::endl;
+    }
+
+    return histogram;
+}
@@ -0,0 +1,33 @@
+/**
+* \file LoadOrComputeVolumeHistogram.h
+*
+* \brief Function for getting the value histogram of a volume from the derived data cache.
+*/
+
+#ifndef LOAD_OR_COMPUTE_VOLUME_HISTOGRAM_H
+#define LOAD_OR_COMPUTE_VOLUME_HISTOGRAM_H
+
+#include <volumedata/VolumeHistogram.h>
+
+#include <cstdint>
+
+namespace VolumeData
+{
+    class VolumeData;
+
+    /**
+    * Reads the histogram of a volume from the DerivedDataCache, or computes it via
+    * ComputeVolumeHistogram() and stores it in the cache. Histograms with different
+    * numbers of bins are separate entries.
+    * Volumes without a content hash, and all volumes if Config::enableDerivedDataCache is
+    * false, are passed directly to ComputeVolumeHistogram().
+    * @param volumeData The volume to compute the histogram of.
+    * @param numBins Number of bins per component, between 1 and 65536.
+    * @return VolumeHistogram The histogram, or an empty histogram if the volume or numBins is not supported.
+    * @see ComputeVolumeHistogram for the computation.
+    * @see DerivedDataCache for the cache.
+    */
+    VolumeHistogram LoadOrComputeVolumeHistogram(const VolumeData& volumeData, uint32_t numBins);
+}
+
+#endif
@@ -0,0 +1,45 @@
+#include <volumedata/LoadOrMakeVolumeMinMaxGrid.h>
+#include <volumedata/DerivedDataCache.h>
+#include <volumedata/DerivedDataKey.h>
+#include <volumedata/MakeVolumeMinMaxGrid.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <config/Config.h>
+
+#include <array>
+#include <iostream>
+#include <span>
+
+VolumeData::VolumeMinMaxGrid VolumeData::LoadOrMakeVolumeMinMaxGrid(const VolumeData& volumeData, uint32_t brickSize)
+{
+    const auto& contentHash = volumeData.GetContentHash();
+    if (!Config::enableDerivedDataCache || !contentHash || !volumeData.IsValid() || brickSize == 0)
+    {
+        return MakeVolumeMinMaxGrid(volumeData, brickSize);
+    }
+
+    const auto cache = DerivedDataCache{Config::derivedDataCachePath};
+    const auto key = DerivedDataKey{*contentHash, DerivedDataType::VolumeMinMaxGrid, brickSize};
+
+    const auto& metadata = volumeData.GetMetadata();
+    auto grid = VolumeMinMaxGrid{};
+    grid.brickSize = brickSize;
+    grid.numBricksX = (metadata.GetWidth() + brickSize - 1) / brickSize;
+    grid.numBricksY = (metadata.GetHeight() + brickSize - 1) / brickSize;
+    grid.numBricksZ = (metadata.GetDepth() + brickSize - 1) / brickSize;
+    grid.minValues.resize(grid.GetNumBricks());
+    grid.maxValues.resize(grid.GetNumBricks());
+    if (cache.Read(key, std::array{std::as_writable_bytes(std::span{grid.minValues}), std::as_writable_bytes(std::span{grid.maxValues})}))
+    {
+        return grid;
+    }
+
+    grid = MakeVolumeMinMaxGrid(volumeData, brickSize);
+    if (!cache.Write(key, std::array{std::as_bytes(std::span{grid.minValues}), std::as_bytes(std::span{grid.maxValues})}))
+    {
+        std::cerr << "Failed to write " << cache.GetEntryPath(key) << std::endl;
+    }
+
+    return grid;
+}
@@ -0,0 +1,33 @@
+/**
+* \file LoadOrMakeVolumeMinMaxGrid.h
+*
+* \brief Function for getting the per-brick value ranges of a volume from the derived data cache.
+*/
+
+#ifndef LOAD_OR_MAKE_VOLUME_MIN_MAX_GRID_H
+#define LOAD_OR_MAKE_VOLUME_MIN_MAX_GRID_H
+
+#include <volumedata/VolumeMinMaxGrid.h>
+
+#include <cstdint>
+
+namespace VolumeData
+{
+    class VolumeData;
+
+    /**
+    * Reads the min-max grid of a volume from the DerivedDataCache, or computes it via
+    * MakeVolumeMinMaxGrid() and stores it in the cache. Grids with different brick sizes
+    * are separate entries.
+    * Volumes without a content hash, and all volumes if Config::enableDerivedDataCache is
+    * false, are passed directly to MakeVolumeMinMaxGrid().
+    * @param volumeData The volume.
+    * @param brickSize Edge length of a brick in voxels.
+    * @return VolumeMinMaxGrid The value ranges, empty if the volume is invalid or brickSize is zero.
+    * @see MakeVolumeMinMaxGrid for the computation.
+    * @see DerivedDataCache for the cache.
+    */
+    VolumeMinMaxGrid LoadOrMakeVolumeMinMaxGrid(const VolumeData& volumeData, uint32_t brickSize);
+}
+
+#endif
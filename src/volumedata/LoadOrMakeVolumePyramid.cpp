@@ -0,0 +1,82 @@
+#include <volumedata/LoadOrMakeVolumePyramid.h>
+#include <volumedata/DerivedDataCache.h>
+#include <volumedata/DerivedDataKey.h>
+#include <volumedata/GetDownsampledVolumeMetadata.h>
+#include <volumedata/MakeVolumePyramid.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <config/Config.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iostream>
+#include <span>
+
+namespace
+{
+    /// Allocates the levels MakeVolumePyramid() would create, with the metadata DownsampleVolumeData() assigns
+    std::vector<VolumeData::VolumeData> AllocateVolumePyramid(const VolumeData::VolumeMetadata& sourceMetadata)
+    {
+        std::vector<VolumeData::VolumeData> levels;
+        auto metadata = sourceMetadata;
+        while (metadata.GetWidth() > 1 || metadata.GetHeight() > 1 || metadata.GetDepth() > 1)
+        {
+            metadata = VolumeData::GetDownsampledVolumeMetadata(metadata);
+            levels.emplace_back(metadata);
+        }
+        return levels;
+    }
+
+    /// Width, height and depth of each level, stored ahead of the voxels so that entries of differently sized levels are rejected
+    std::vector<uint32_t> GetLevelDimensions(std::span<const VolumeData::VolumeData> levels)
+    {
+        std::vector<uint32_t> dimensions;
+        dimensions.reserve(3 * levels.size());
+        for (const auto& level : levels)
+        {
+            const auto& metadata = level.GetMetadata();
+            dimensions.insert(dimensions.end(), {metadata.GetWidth(), metadata.GetHeight(), metadata.GetDepth()});
+        }
+        return dimensions;
+    }
+} // anonymous namespace
+
+std::vector<VolumeData::VolumeData> VolumeData::LoadOrMakeVolumePyramid(const VolumeData& volumeData)
+{
+    const auto& contentHash = volumeData.GetContentHash();
+    if (!Config::enableDerivedDataCache || !contentHash || !volumeData.IsValid())
+    {
+        return MakeVolumePyramid(volumeData);
+    }
+
+    const auto cache = DerivedDataCache{Config::derivedDataCachePath};
+    const auto key = DerivedDataKey{*contentHash, DerivedDataType::VolumePyramid, 0};
+
+    auto levels = AllocateVolumePyramid(volumeData.GetMetadata());
+    const auto expectedDimensions = GetLevelDimensions(levels);
+    std::vector<uint32_t> storedDimensions(expectedDimensions.size());
+    std::vector<std::span<std::byte>> levelBytes{std::as_writable_bytes(std::span{storedDimensions})};
+    for (auto& level : levels)
+    {
+        levelBytes.push_back(std::as_writable_bytes(std::span{level.GetData()}));
+    }
+    if (cache.Read(key, levelBytes) && storedDimensions == expectedDimensions)
+    {
+        return levels;
+    }
+
+    levels = MakeVolumePyramid(volumeData);
+    const auto dimensions = GetLevelDimensions(levels);
+    std::vector<std::span<const std::byte>> constLevelBytes{std::as_bytes(std::span{dimensions})};
+    for (const auto& level : levels)
+    {
+        constLevelBytes.push_back(std::as_bytes(level.GetData()));
+    }
+    if (!cache.Write(key, constLevelBytes))
+    {
+        std::cerr << "Failed to write " << cache.GetEntryPath(key) << std::endl;
+    }
+
+    return levels;
+}
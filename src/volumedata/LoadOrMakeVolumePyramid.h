@@ -0,0 +1,31 @@
+/**
+* \file LoadOrMakeVolumePyramid.h
+*
+* \brief Function for getting the downsampled levels of a volume from the derived data cache.
+*/
+
+#ifndef LOAD_OR_MAKE_VOLUME_PYRAMID_H
+#define LOAD_OR_MAKE_VOLUME_PYRAMID_H
+
+#include <vector>
+
+namespace VolumeData
+{
+    class VolumeData;
+
+    /**
+    * Reads the pyramid of a volume from the DerivedDataCache, or builds it via
+    * MakeVolumePyramid() and stores it in the cache. All levels are stored in one entry,
+    * from fine to coarse, after the dimensions of each level. Entries whose dimensions
+    * differ from those GetDownsampledVolumeMetadata() gives are rebuilt.
+    * Volumes without a content hash, and all volumes if Config::enableDerivedDataCache is
+    * false, are passed directly to MakeVolumePyramid().
+    * @param volumeData The full-resolution volume.
+    * @return std::vector<VolumeData> Levels 1 to N, from fine to coarse. Empty for invalid or single-voxel volumes.
+    * @see MakeVolumePyramid for the computation.
+    * @see DerivedDataCache for the cache.
+    */
+    std::vector<VolumeData> LoadOrMakeVolumePyramid(const VolumeData& volumeData);
+}
+
+#endif
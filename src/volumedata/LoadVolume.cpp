@@ -0,0 +1,36 @@
+#include <volumedata/LoadVolume.h>
+#include <volumedata/BrickedVolumeHeader.h>
+#include <volumedata/ConvertVolumeDataToSparse.h>
+#include <volumedata/LoadVolumeBricked.h>
+#include <volumedata/LoadVolumeRaw.h>
+
+#include <utility>
+
+namespace
+{
+    /// Bricked files and regions are always read into an owned buffer, which is converted afterwards if a sparse volume is requested
+    VolumeData::VolumeLoadingResult ApplyStorageMode(VolumeData::VolumeLoadingResult&& volumeLoadingResult, VolumeData::VolumeStorageMode storageMode)
+    {
+        if (!volumeLoadingResult || storageMode != VolumeData::VolumeStorageMode::Sparse)
+        {
+            return std::move(volumeLoadingResult);
+        }
+
+        return VolumeData::ConvertVolumeDataToSparse(std::move(volumeLoadingResult).value());
+    }
+} // anonymous namespace
+
+VolumeData::VolumeLoadingResult VolumeData::LoadVolume(const std::filesystem::path& filePath, VolumeStorageMode storageMode, const VolumeRegion& region)
+{
+    if (filePath.extension() == BrickedVolumeFormat::fileExtension)
+    {
+        return ApplyStorageMode(LoadVolumeBricked(filePath, region), storageMode);
+    }
+
+    if (!region.IsWholeVolume())
+    {
+        return ApplyStorageMode(LoadVolumeRaw(filePath, region), storageMode);
+    }
+
+    return LoadVolumeRaw(filePath, storageMode);
+}
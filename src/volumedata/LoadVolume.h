@@ -0,0 +1,42 @@
+/**
+* \file LoadVolume.h
+*
+* \brief Function for loading volume files of any supported format.
+*/
+
+#ifndef LOAD_VOLUME_H
+#define LOAD_VOLUME_H
+
+#include <volumedata/VolumeLoadingTypes.h>
+#include <volumedata/VolumeRegion.h>
+#include <volumedata/VolumeStorageMode.h>
+
+#include <filesystem>
+
+namespace VolumeData
+{
+    /**
+    * Loads a volume file, selecting the loader by file extension.
+    *
+    * Files with BrickedVolumeFormat::fileExtension are loaded via LoadVolumeBricked(),
+    * all other files are treated as .raw files with a companion .ini metadata file
+    * and loaded via LoadVolumeRaw(). Bricked volumes are always loaded into an owned
+    * buffer, so apart from VolumeStorageMode::Sparse the storage mode only applies to .raw files.
+    *
+    * If the region is not the whole volume, only the region is loaded, always into an
+    * owned buffer. It is then converted into a sparse volume with VolumeStorageMode::Sparse,
+    * and all other storage modes are ignored.
+    *
+    * @param filePath Path to the volume file.
+    * @param storageMode Whether to read the voxel data of a .raw file into an owned buffer, map the file or hold the volume sparsely.
+    * @param region The box and stride to load, the whole volume by default.
+    * @return VolumeLoadingResult containing VolumeData on success, or VolumeLoadingError on failure.
+    *
+    * @see LoadVolumeRaw for loading .raw files.
+    * @see LoadVolumeBricked for loading bricked volume files.
+    * @see VolumeRegion for loading part of a volume.
+    */
+    VolumeLoadingResult LoadVolume(const std::filesystem::path& filePath, VolumeStorageMode storageMode = VolumeStorageMode::Owning, const VolumeRegion& region = VolumeRegion{});
+}
+
+#endif
@@ -0,0 +1,128 @@
+#include <volumedata/LoadVolumeBricked.h>
+#include <volumedata/BrickedVolumeReader.h>
+#include <volumedata/GetVolumeRegionBox.h>
+#include <volumedata/GetVolumeRegionMetadata.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <execution>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    /// Range of output indices along one axis whose voxels lie within a brick, empty if the brick holds no kept voxel
+    std::pair<uint32_t, uint32_t> GetKeptRange(uint32_t brickBegin, uint32_t brickSize, uint32_t boxBegin, uint32_t boxSize, uint32_t stride)
+    {
+        const uint32_t begin = std::max(brickBegin, boxBegin);
+        const uint32_t end = std::min(brickBegin + brickSize, boxBegin + boxSize);
+        if (begin >= end)
+        {
+            return {0, 0};
+        }
+
+        return {(begin - boxBegin + stride - 1) / stride, (end - boxBegin + stride - 1) / stride};
+    }
+} // anonymous namespace
+
+VolumeData::VolumeLoadingResult VolumeData::LoadVolumeBricked(const std::filesystem::path& filePath)
+{
+    return LoadVolumeBricked(filePath, VolumeRegion{});
+}
+
+VolumeData::VolumeLoadingResult VolumeData::LoadVolumeBricked(const std::filesystem::path& filePath, const VolumeRegion& region)
+{
+    const auto readerResult = OpenBrickedVolume(filePath);
+    if (!readerResult)
+    {
+        return std::unexpected(readerResult.error());
+    }
+    const auto& reader = readerResult.value();
+
+    const auto sourceMetadata = reader.GetMetadata();
+    if (!sourceMetadata.IsValid())
+    {
+        return std::unexpected(VolumeLoadingError::InvalidMetadata);
+    }
+
+    const auto box = GetVolumeRegionBox(sourceMetadata, region);
+    const auto metadata = GetVolumeRegionMetadata(sourceMetadata, region);
+    if (!box || !metadata)
+    {
+        return std::unexpected(VolumeLoadingError::InvalidRegion);
+    }
+
+    auto volumeData = VolumeData{metadata.value()};
+
+    const uint32_t stride = region.stride;
+    const size_t bytesPerVoxel = metadata->GetBytesPerVoxel();
+    const size_t volumeRowSize = static_cast<size_t>(metadata->GetWidth()) * bytesPerVoxel;
+    const size_t volumeSliceSize = volumeRowSize * metadata->GetHeight();
+    uint8_t* const destination = volumeData.GetDataPtr();
+
+    std::vector<size_t> brickIndices(reader.GetNumBricks());
+    std::iota(brickIndices.begin(), brickIndices.end(), size_t{0});
+    std::atomic<bool> readFailed{false};
+
+    std::for_each(std::execution::par, brickIndices.begin(), brickIndices.end(), [&](size_t brickIndex)
+    {
+        // Bricks outside of the region, or between the kept voxels of a large stride, are never read
+        const auto extent = reader.GetBrickExtent(brickIndex);
+        const auto [xBegin, xEnd] = GetKeptRange(extent.x, extent.width, box->x, box->width, stride);
+        const auto [yBegin, yEnd] = GetKeptRange(extent.y, extent.height, box->y, box->height, stride);
+        const auto [zBegin, zEnd] = GetKeptRange(extent.z, extent.depth, box->z, box->depth, stride);
+        if (xBegin == xEnd || yBegin == yEnd || zBegin == zEnd)
+        {
+            return;
+        }
+
+        std::vector<uint8_t> brickData(reader.GetBrickSizeInBytes(brickIndex));
+        if (!reader.ReadBrick(brickIndex, brickData))
+        {
+            readFailed = true;
+            return;
+        }
+
+        const size_t brickRowSize = static_cast<size_t>(extent.width) * bytesPerVoxel;
+        const size_t brickSliceSize = brickRowSize * extent.height;
+        const uint32_t brickX = box->x + xBegin * stride - extent.x;
+
+        for (auto z = zBegin; z < zEnd; ++z)
+        {
+            for (auto y = yBegin; y < yEnd; ++y)
+            {
+                const uint32_t brickY = box->y + y * stride - extent.y;
+                const uint32_t brickZ = box->z + z * stride - extent.z;
+                const uint8_t* source = brickData.data() + brickZ * brickSliceSize + brickY * brickRowSize + brickX * bytesPerVoxel;
+                uint8_t* destinationRow = destination + z * volumeSliceSize + y * volumeRowSize + xBegin * bytesPerVoxel;
+
+                if (stride == 1)
+                {
+                    std::memcpy(destinationRow, source, (xEnd - xBegin) * bytesPerVoxel);
+                    continue;
+                }
+
+                for (auto x = xBegin; x < xEnd; ++x)
+                {
+                    std::memcpy(destinationRow, source, bytesPerVoxel);
+                    destinationRow += bytesPerVoxel;
+                    source += stride * bytesPerVoxel;
+                }
+            }
+        }
+    });
+
+    if (readFailed)
+    {
+        return std::unexpected(VolumeLoadingError::ReadError);
+    }
+
+    if (!volumeData.IsValid())
+    {
+        return std::unexpected(VolumeLoadingError::InvalidVolumeData);
+    }
+
+    return volumeData;
+}
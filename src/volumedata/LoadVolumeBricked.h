@@ -0,0 +1,49 @@
+/**
+* \file LoadVolumeBricked.h
+*
+* \brief Function for loading a whole bricked volume file into volume data.
+*/
+
+#ifndef LOAD_VOLUME_BRICKED_H
+#define LOAD_VOLUME_BRICKED_H
+
+#include <volumedata/VolumeLoadingTypes.h>
+#include <volumedata/VolumeRegion.h>
+
+#include <filesystem>
+
+namespace VolumeData
+{
+    /**
+    * Loads a bricked volume file into a dense volume.
+    *
+    * All bricks are read, decompressed and scattered into an owned buffer in parallel,
+    * so a compressed file trades a fraction of the disk reads for decoding work spread
+    * over all cores. The returned
+    * volume has no source path, since its file layout differs from a .raw file.
+    *
+    * @param filePath Path to the bricked volume file.
+    * @return VolumeLoadingResult containing VolumeData on success, or VolumeLoadingError on failure.
+    *
+    * @see BrickedVolumeReader for reading individual bricks instead.
+    * @see LoadVolume for loading .raw and bricked files by extension.
+    */
+    VolumeLoadingResult LoadVolumeBricked(const std::filesystem::path& filePath);
+
+    /**
+    * Loads a region of a bricked volume file into a dense volume.
+    *
+    * Only the bricks holding kept voxels of the region are read and decompressed, and the
+    * kept voxels are gathered into an owned buffer with the dimensions and spacing returned
+    * by GetVolumeRegionMetadata().
+    *
+    * @param filePath Path to the bricked volume file.
+    * @param region The box and stride to load.
+    * @return VolumeLoadingResult containing the region on success, VolumeLoadingError::InvalidRegion if the region does not fit the volume, or another VolumeLoadingError on failure.
+    *
+    * @see VolumeRegion for the region description.
+    */
+    VolumeLoadingResult LoadVolumeBricked(const std::filesystem::path& filePath, const VolumeRegion& region);
+}
+
+#endif
@@ -0,0 +1,172 @@
+#include <volumedata/LoadVolumeMetadata.h>
+#include <volumedata/GetVolumeMetadataKey.h>
+
+#include <charconv>
+#include <fstream>
+#include <string>
+
+namespace
+{
+    /// Parse a value from a string using std::from_chars
+    /// Returns true on success, false on parse error
+    template<typename T>
+    bool ParseValue(const std::string& str, T& out)
+    {
+        auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), out);
+        return ec == std::errc{};
+    }
+} // anonymous namespace
+
+VolumeData::VolumeMetadataLoadingResult VolumeData::LoadVolumeMetadata(const std::filesystem::path& iniFilePath)
+{
+    auto metadata = VolumeMetadata{};
+
+    if (!std::filesystem::exists(iniFilePath))
+    {
+        return std::unexpected(VolumeLoadingError::MetadataFileNotFound);
+    }
+
+    std::ifstream file(iniFilePath);
+    if (!file.is_open())
+    {
+        return std::unexpected(VolumeLoadingError::CannotOpenMetadataFile);
+    }
+
+    std::string line;
+    bool inVolumeSection = false;
+
+    while (std::getline(file, line))
+    {
+        // Trim whitespace
+        line.erase(0, line.find_first_not_of(" \t\r\n"));
+        line.erase(line.find_last_not_of(" \t\r\n") + 1);
+
+        // Skip empty lines and comments
+        if (line.empty() || line[0] == '#' || line[0] == ';')
+        {
+            continue;
+        }
+
+        // Check for section header
+        if (line[0] == '[')
+        {
+            inVolumeSection = (line == "[Volume]");
+            continue;
+        }
+
+        if (!inVolumeSection)
+        {
+            continue;
+        }
+
+        // Parse key=value pairs
+        size_t equalPos = line.find('=');
+        if (equalPos == std::string::npos)
+        {
+            continue;
+        }
+
+        std::string keyString = line.substr(0, equalPos);
+        std::string valueString = line.substr(equalPos + 1);
+
+        // Trim key and value
+        keyString.erase(0, keyString.find_first_not_of(" \t"));
+        keyString.erase(keyString.find_last_not_of(" \t") + 1);
+        valueString.erase(0, valueString.find_first_not_of(" \t"));
+        valueString.erase(valueString.find_last_not_of(" \t") + 1);
+
+        switch (GetVolumeMetadataKey(keyString))
+        {
+            case VolumeMetadataKey::Width:
+            {
+                size_t width;
+                if (!ParseValue(valueString, width))
+                {
+                    return std::unexpected(VolumeLoadingError::MetadataParseError);
+                }
+                metadata.SetWidth(static_cast<uint32_t>(width));
+                break;
+            }
+            case VolumeMetadataKey::Height:
+            {
+                size_t height;
+                if (!ParseValue(valueString, height))
+                {
+                    return std::unexpected(VolumeLoadingError::MetadataParseError);
+                }
+                metadata.SetHeight(static_cast<uint32_t>(height));
+                break;
+            }
+            case VolumeMetadataKey::Depth:
+            {
+                size_t depth;
+                if (!ParseValue(valueString, depth))
+                {
+                    return std::unexpected(VolumeLoadingError::MetadataParseError);
+                }
+                metadata.SetDepth(static_cast<uint32_t>(depth));
+                break;
+            }
+            case VolumeMetadataKey::Components:
+            {
+                size_t components;
+                if (!ParseValue(valueString, components))
+                {
+                    return std::unexpected(VolumeLoadingError::MetadataParseError);
+                }
+                metadata.SetComponents(static_cast<uint32_t>(components));
+                break;
+            }
+            case VolumeMetadataKey::BitsPerComponent:
+            {
+                size_t bitsPerComponent;
+                if (!ParseValue(valueString, bitsPerComponent))
+                {
+                    return std::unexpected(VolumeLoadingError::MetadataParseError);
+                }
+                metadata.SetBitsPerComponent(static_cast<uint32_t>(bitsPerComponent));
+                break;
+            }
+            case VolumeMetadataKey::ScaleX:
+            {
+                float scaleX;
+                if (!ParseValue(valueString, scaleX))
+                {
+                    return std::unexpected(VolumeLoadingError::MetadataParseError);
+                }
+                metadata.SetScaleX(scaleX);
+                break;
+            }
+            case VolumeMetadataKey::ScaleY:
+            {
+                float scaleY;
+                if (!ParseValue(valueString, scaleY))
+                {
+                    return std::unexpected(VolumeLoadingError::MetadataParseError);
+                }
+                metadata.SetScaleY(scaleY);
+                break;
+            }
+            case VolumeMetadataKey::ScaleZ:
+            {
+                float scaleZ;
+                if (!ParseValue(valueString, scaleZ))
+                {
+                    return std::unexpected(VolumeLoadingError::MetadataParseError);
+                }
+                metadata.SetScaleZ(scaleZ);
+                break;
+            }
+            case VolumeMetadataKey::Unknown:
+                // Ignore unknown keys
+                break;
+        }
+    }
+
+    if (!metadata.IsValid())
+    {
+        return std::unexpected(VolumeLoadingError::InvalidMetadata);
+    }
+
+    return metadata;
+}
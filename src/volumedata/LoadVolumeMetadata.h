@@ -0,0 +1,43 @@
+/**
+* \file LoadVolumeMetadata.h
+*
+* \brief Function for loading volume metadata from .ini files.
+*/
+
+#ifndef LOAD_VOLUME_METADATA_H
+#define LOAD_VOLUME_METADATA_H
+
+#include <volumedata/VolumeLoadingTypes.h>
+
+#include <filesystem>
+
+namespace VolumeData
+{
+    /**
+    * Loads volume metadata from a companion .ini file.
+    *
+    * Reads the [Volume] section of the file. Expected format:
+    * \code
+    * [Volume]
+    * Width=256
+    * Height=256
+    * Depth=512
+    * Components=1
+    * BitsPerComponent=8
+    * ScaleX=1.0
+    * ScaleY=1.0
+    * ScaleZ=1.0
+    * \endcode
+    *
+    * Unknown keys are ignored. The parsed metadata must pass VolumeMetadata::IsValid().
+    *
+    * @param iniFilePath Path to the .ini file.
+    * @return VolumeMetadataLoadingResult containing VolumeMetadata on success, or VolumeLoadingError on failure.
+    *
+    * @see VolumeMetadata for metadata format.
+    * @see LoadVolumeRaw for loading the voxel data described by the metadata.
+    */
+    VolumeMetadataLoadingResult LoadVolumeMetadata(const std::filesystem::path& iniFilePath);
+}
+
+#endif
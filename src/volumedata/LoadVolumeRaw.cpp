@@ -1,187 +1,54 @@
 #include <volumedata/LoadVolumeRaw.h>
-#include <volumedata/GetVolumeMetadataKey.h>
+#include <volumedata/ConvertVolumeDataToSparse.h>
+#include <volumedata/GetVolumeRegionBox.h>
+#include <volumedata/GetVolumeRegionMetadata.h>
+#include <volumedata/LoadVolumeMetadata.h>
+#include <volumedata/MappedFile.h>
+#include <volumedata/PositionedFileReader.h>
+#include <volumedata/ReadFileInParallel.h>
 
-#include <charconv>
-#include <fstream>
-#include <sstream>
-#include <string>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <execution>
+#include <memory>
+#include <numeric>
+#include <span>
+#include <vector>
 
 namespace
 {
-    /// Parse a value from a string using std::from_chars
-    /// Returns true on success, false on parse error
-    template<typename T>
-    bool ParseValue(const std::string& str, T& out)
+    /// Read raw binary data from file into an owned buffer with concurrent positioned reads
+    std::expected<void, VolumeData::VolumeLoadingError> LoadRawData(const std::filesystem::path& rawFilePath, VolumeData::FileCachingMode cachingMode, VolumeData::VolumeData& volumeData)
     {
-        auto [ptr, ec] = std::from_chars(str.data(), str.data() + str.size(), out);
-        return ec == std::errc{};
-    }
-
-    /// Load metadata from a companion .ini file
-    /// Expected format:
-    /// [Volume]
-    /// Width=256
-    /// Height=256
-    /// Depth=512
-    /// Components=1
-    /// BitsPerComponent=8
-    /// ScaleX=1.0
-    /// ScaleY=1.0
-    /// ScaleZ=1.0
-    std::expected<void, VolumeData::VolumeLoadingError> LoadMetadataFromIni(const std::filesystem::path& iniFilePath, VolumeData::VolumeMetadata& metadata)
-    {
-        if (!std::filesystem::exists(iniFilePath))
+        if (!std::filesystem::exists(rawFilePath))
         {
-            return std::unexpected(VolumeData::VolumeLoadingError::MetadataFileNotFound);
+            return std::unexpected(VolumeData::VolumeLoadingError::RawFileNotFound);
         }
 
-        std::ifstream file(iniFilePath);
-        if (!file.is_open())
+        const VolumeData::PositionedFileReader reader{rawFilePath, cachingMode};
+        if (!reader.IsOpen())
         {
-            return std::unexpected(VolumeData::VolumeLoadingError::CannotOpenMetadataFile);
+            return std::unexpected(VolumeData::VolumeLoadingError::CannotOpenRawFile);
         }
 
-        std::string line;
-        bool inVolumeSection = false;
-
-        while (std::getline(file, line))
+        const size_t expectedSize = volumeData.GetMetadata().GetTotalSizeInBytes();
+        if (reader.GetSizeInBytes() != expectedSize)
         {
-            // Trim whitespace
-            line.erase(0, line.find_first_not_of(" \t\r\n"));
-            line.erase(line.find_last_not_of(" \t\r\n") + 1);
-
-            // Skip empty lines and comments
-            if (line.empty() || line[0] == '#' || line[0] == ';')
-            {
-                continue;
-            }
-
-            // Check for section header
-            if (line[0] == '[')
-            {
-                inVolumeSection = (line == "[Volume]");
-                continue;
-            }
-
-            if (!inVolumeSection)
-            {
-                continue;
-            }
-
-            // Parse key=value pairs
-            size_t equalPos = line.find('=');
-            if (equalPos == std::string::npos)
-            {
-                continue;
-            }
-
-            std::string keyString = line.substr(0, equalPos);
-            std::string valueString = line.substr(equalPos + 1);
-
-            // Trim key and value
-            keyString.erase(0, keyString.find_first_not_of(" \t"));
-            keyString.erase(keyString.find_last_not_of(" \t") + 1);
-            valueString.erase(0, valueString.find_first_not_of(" \t"));
-            valueString.erase(valueString.find_last_not_of(" \t") + 1);
-
-            switch (VolumeData::GetVolumeMetadataKey(keyString))
-            {
-                case VolumeData::VolumeMetadataKey::Width:
-                {
-                    size_t width;
-                    if (!ParseValue(valueString, width))
-                    {
-                        return std::unexpected(VolumeData::VolumeLoadingError::MetadataParseError);
-                    }
-                    metadata.SetWidth(static_cast<uint32_t>(width));
-                    break;
-                }
-                case VolumeData::VolumeMetadataKey::Height:
-                {
-                    size_t height;
-                    if (!ParseValue(valueString, height))
-                    {
-                        return std::unexpected(VolumeData::VolumeLoadingError::MetadataParseError);
-                    }
-                    metadata.SetHeight(static_cast<uint32_t>(height));
-                    break;
-                }
-                case VolumeData::VolumeMetadataKey::Depth:
-                {
-                    size_t depth;
-                    if (!ParseValue(valueString, depth))
-                    {
-                        return std::unexpected(VolumeData::VolumeLoadingError::MetadataParseError);
-                    }
-                    metadata.SetDepth(static_cast<uint32_t>(depth));
-                    break;
-                }
-                case VolumeData::VolumeMetadataKey::Components:
-                {
-                    size_t components;
-                    if (!ParseValue(valueString, components))
-                    {
-                        return std::unexpected(VolumeData::VolumeLoadingError::MetadataParseError);
-                    }
-                    metadata.SetComponents(static_cast<uint32_t>(components));
-                    break;
-                }
-                case VolumeData::VolumeMetadataKey::BitsPerComponent:
-                {
-                    size_t bitsPerComponent;
-                    if (!ParseValue(valueString, bitsPerComponent))
-                    {
-                        return std::unexpected(VolumeData::VolumeLoadingError::MetadataParseError);
-                    }
-                    metadata.SetBitsPerComponent(static_cast<uint32_t>(bitsPerComponent));
-                    break;
-                }
-                case VolumeData::VolumeMetadataKey::ScaleX:
-                {
-                    float scaleX;
-                    if (!ParseValue(valueString, scaleX))
-                    {
-                        return std::unexpected(VolumeData::VolumeLoadingError::MetadataParseError);
-                    }
-                    metadata.SetScaleX(scaleX);
-                    break;
-                }
-                case VolumeData::VolumeMetadataKey::ScaleY:
-                {
-                    float scaleY;
-                    if (!ParseValue(valueString, scaleY))
-                    {
-                        return std::unexpected(VolumeData::VolumeLoadingError::MetadataParseError);
-                    }
-                    metadata.SetScaleY(scaleY);
-                    break;
-                }
-                case VolumeData::VolumeMetadataKey::ScaleZ:
-                {
-                    float scaleZ;
-                    if (!ParseValue(valueString, scaleZ))
-                    {
-                        return std::unexpected(VolumeData::VolumeLoadingError::MetadataParseError);
-                    }
-                    metadata.SetScaleZ(scaleZ);
-                    break;
-                }
-                case VolumeData::VolumeMetadataKey::Unknown:
-                    // Ignore unknown keys
-                    break;
-            }
+            return std::unexpected(VolumeData::VolumeLoadingError::FileSizeMismatch);
         }
 
-        if (!metadata.IsValid())
+        volumeData.AllocateData(expectedSize);
+        if (!VolumeData::ReadFileInParallel(reader, std::span{volumeData.GetData()}))
         {
-            return std::unexpected(VolumeData::VolumeLoadingError::InvalidMetadata);
+            return std::unexpected(VolumeData::VolumeLoadingError::ReadError);
         }
 
         return {};
     }
 
-    /// Load raw binary data from file
-    std::expected<void, VolumeData::VolumeLoadingError> LoadRawData(const std::filesystem::path& rawFilePath, VolumeData::VolumeData& volumeData)
+    /// Map raw binary data from file without copying it into a heap buffer
+    std::expected<void, VolumeData::VolumeLoadingError> MapRawData(const std::filesystem::path& rawFilePath, VolumeData::VolumeData& volumeData)
     {
         if (!std::filesystem::exists(rawFilePath))
         {
@@ -196,16 +63,94 @@ namespace
             return std::unexpected(VolumeData::VolumeLoadingError::FileSizeMismatch);
         }
 
-        std::ifstream file(rawFilePath, std::ios::binary);
-        if (!file.is_open())
+        auto mappedFile = std::make_shared<const VolumeData::MappedFile>(rawFilePath);
+        if (!mappedFile->IsMapped())
+        {
+            return std::unexpected(VolumeData::VolumeLoadingError::CannotMapRawFile);
+        }
+
+        volumeData = VolumeData::VolumeData{volumeData.GetMetadata(), std::move(mappedFile)};
+        return {};
+    }
+
+    /// Read the kept voxels of a region with positioned reads, one per row, or one per slice where the rows are contiguous in the file
+    std::expected<void, VolumeData::VolumeLoadingError> ReadRawRegion(const std::filesystem::path& rawFilePath, const VolumeData::VolumeMetadata& metadata, const VolumeData::BrickExtent& box, uint32_t stride, VolumeData::VolumeData& volumeData)
+    {
+        if (!std::filesystem::exists(rawFilePath))
+        {
+            return std::unexpected(VolumeData::VolumeLoadingError::RawFileNotFound);
+        }
+
+        const VolumeData::PositionedFileReader reader{rawFilePath};
+        if (!reader.IsOpen())
         {
             return std::unexpected(VolumeData::VolumeLoadingError::CannotOpenRawFile);
         }
 
-        volumeData.AllocateData(expectedSize);
-        file.read(reinterpret_cast<char*>(volumeData.GetDataPtr()), expectedSize);
+        if (reader.GetSizeInBytes() != metadata.GetTotalSizeInBytes())
+        {
+            return std::unexpected(VolumeData::VolumeLoadingError::FileSizeMismatch);
+        }
+
+        const auto& regionMetadata = volumeData.GetMetadata();
+        const size_t bytesPerVoxel = metadata.GetBytesPerVoxel();
+        const size_t fileRowSize = static_cast<size_t>(metadata.GetWidth()) * bytesPerVoxel;
+        const size_t fileSliceSize = fileRowSize * metadata.GetHeight();
+        const size_t rowSize = static_cast<size_t>(regionMetadata.GetWidth()) * bytesPerVoxel;
+        const size_t sliceSize = rowSize * regionMetadata.GetHeight();
 
-        if (!file.good())
+        // Strided rows are read from the first to the last kept voxel and gathered in memory,
+        // since the skipped voxels share their disk pages with the kept ones anyway
+        const size_t stridedRowSize = ((static_cast<size_t>(regionMetadata.GetWidth()) - 1) * stride + 1) * bytesPerVoxel;
+        const bool areRowsContiguous = (stride == 1 && box.width == metadata.GetWidth());
+
+        volumeData.AllocateData();
+        uint8_t* const destination = volumeData.GetDataPtr();
+
+        std::vector<uint32_t> sliceIndices(regionMetadata.GetDepth());
+        std::iota(sliceIndices.begin(), sliceIndices.end(), 0u);
+        std::atomic<bool> readFailed{false};
+
+        std::for_each(std::execution::par, sliceIndices.begin(), sliceIndices.end(), [&](uint32_t z)
+        {
+            const uint64_t sliceOffset = (static_cast<uint64_t>(box.z) + static_cast<uint64_t>(z) * stride) * fileSliceSize + static_cast<uint64_t>(box.y) * fileRowSize + static_cast<uint64_t>(box.x) * bytesPerVoxel;
+            uint8_t* const destinationSlice = destination + z * sliceSize;
+
+            if (areRowsContiguous)
+            {
+                if (!reader.Read(sliceOffset, std::span{destinationSlice, sliceSize}))
+                {
+                    readFailed = true;
+                }
+                return;
+            }
+
+            std::vector<uint8_t> stridedRow((stride > 1) ? stridedRowSize : 0);
+            for (auto y = 0u; y < regionMetadata.GetHeight(); ++y)
+            {
+                const uint64_t rowOffset = sliceOffset + static_cast<uint64_t>(y) * stride * fileRowSize;
+                uint8_t* const destinationRow = destinationSlice + y * rowSize;
+
+                const auto rowDestination = (stride == 1) ? std::span{destinationRow, rowSize} : std::span{stridedRow};
+                if (!reader.Read(rowOffset, rowDestination))
+                {
+                    readFailed = true;
+                    return;
+                }
+
+                if (stride == 1)
+                {
+                    continue;
+                }
+
+                for (auto x = 0u; x < regionMetadata.GetWidth(); ++x)
+                {
+                    std::memcpy(destinationRow + x * bytesPerVoxel, stridedRow.data() + x * stride * bytesPerVoxel, bytesPerVoxel);
+                }
+            }
+        });
+
+        if (readFailed)
         {
             return std::unexpected(VolumeData::VolumeLoadingError::ReadError);
         }
@@ -215,31 +160,90 @@ namespace
 
 } // anonymous namespace
 
-VolumeData::VolumeLoadingResult VolumeData::LoadVolumeRaw(const std::filesystem::path& rawFilePath)
+VolumeData::VolumeLoadingResult VolumeData::LoadVolumeRaw(const std::filesystem::path& rawFilePath, VolumeStorageMode storageMode)
 {
     // Load metadata from .ini file
     auto iniFilePath = rawFilePath;
     iniFilePath.replace_extension(".ini");
 
-    auto metadata = VolumeMetadata{};
-    if (const auto result = LoadMetadataFromIni(iniFilePath, metadata); !result)
+    const auto metadataResult = LoadVolumeMetadata(iniFilePath);
+    if (!metadataResult)
+    {
+        return std::unexpected(metadataResult.error());
+    }
+
+    return LoadVolumeRaw(rawFilePath, metadataResult.value(), storageMode);
+}
+
+VolumeData::VolumeLoadingResult VolumeData::LoadVolumeRaw(const std::filesystem::path& rawFilePath, const VolumeMetadata& metadata, VolumeStorageMode storageMode)
+{
+    if (!metadata.IsValid())
+    {
+        return std::unexpected(VolumeLoadingError::InvalidMetadata);
+    }
+
+    auto volumeData = VolumeData{};
+    volumeData.SetMetadata(metadata);
+
+    const auto cachingMode = (storageMode == VolumeStorageMode::OwningUncached) ? FileCachingMode::Uncached : FileCachingMode::Cached;
+    // A sparse volume is made from the mapping, so that the dense voxels never occupy host memory at once
+    const auto result = (storageMode == VolumeStorageMode::Mapped || storageMode == VolumeStorageMode::Sparse)
+        ? MapRawData(rawFilePath, volumeData)
+        : LoadRawData(rawFilePath, cachingMode, volumeData);
+
+    if (!result)
     {
         return std::unexpected(result.error());
     }
 
-    return LoadVolumeRaw(rawFilePath, metadata);
+    if (!volumeData.IsValid())
+    {
+        return std::unexpected(VolumeLoadingError::InvalidVolumeData);
+    }
+
+    volumeData.SetSourcePath(rawFilePath);
+
+    if (storageMode == VolumeStorageMode::Sparse)
+    {
+        return ConvertVolumeDataToSparse(std::move(volumeData));
+    }
+
+    return volumeData;
+}
+
+VolumeData::VolumeLoadingResult VolumeData::LoadVolumeRaw(const std::filesystem::path& rawFilePath, const VolumeRegion& region)
+{
+    auto iniFilePath = rawFilePath;
+    iniFilePath.replace_extension(".ini");
+
+    const auto metadataResult = LoadVolumeMetadata(iniFilePath);
+    if (!metadataResult)
+    {
+        return std::unexpected(metadataResult.error());
+    }
+
+    return LoadVolumeRaw(rawFilePath, metadataResult.value(), region);
 }
 
-VolumeData::VolumeLoadingResult VolumeData::LoadVolumeRaw(const std::filesystem::path& rawFilePath, const VolumeMetadata& metadata)
+VolumeData::VolumeLoadingResult VolumeData::LoadVolumeRaw(const std::filesystem::path& rawFilePath, const VolumeMetadata& metadata, const VolumeRegion& region)
 {
     if (!metadata.IsValid())
     {
         return std::unexpected(VolumeLoadingError::InvalidMetadata);
     }
 
-    auto volumeData = VolumeData{metadata};
+    const auto box = GetVolumeRegionBox(metadata, region);
+    const auto regionMetadata = GetVolumeRegionMetadata(metadata, region);
+    if (!box || !regionMetadata)
+    {
+        return std::unexpected(VolumeLoadingError::InvalidRegion);
+    }
+
+    auto volumeData = VolumeData{};
+    volumeData.SetMetadata(regionMetadata.value());
 
-    if (const auto result = LoadRawData(rawFilePath, volumeData); !result)
+    const auto result = ReadRawRegion(rawFilePath, metadata, box.value(), region.stride, volumeData);
+    if (!result)
     {
         return std::unexpected(result.error());
     }
@@ -249,5 +253,11 @@ VolumeData::VolumeLoadingResult VolumeData::LoadVolumeRaw(const std::filesystem:
         return std::unexpected(VolumeLoadingError::InvalidVolumeData);
     }
 
+    // Only a whole volume matches the file layout that streamed uploads read from the source path
+    if (region.IsWholeVolume())
+    {
+        volumeData.SetSourcePath(rawFilePath);
+    }
+
     return volumeData;
 }
@@ -9,6 +9,8 @@
 
 #include <volumedata/VolumeLoadingTypes.h>
 #include <volumedata/VolumeMetadata.h>
+#include <volumedata/VolumeRegion.h>
+#include <volumedata/VolumeStorageMode.h>
 
 #include <filesystem>
 
@@ -25,13 +27,15 @@ namespace VolumeData
     * containing the metadata.
     *
     * @param rawFilePath Path to the .raw file.
+    * @param storageMode Whether to read the voxel data into an owned buffer, map the file or hold the volume sparsely.
     * @return VolumeLoadingResult containing VolumeData on success, or VolumeLoadingError on failure.
     *
     * @see VolumeData for the loaded volume structure.
     * @see VolumeMetadata for metadata format.
+    * @see VolumeStorageMode for the available storage modes.
     * @see VolumeLoadingResult for the result type.
     */
-    VolumeLoadingResult LoadVolumeRaw(const std::filesystem::path& rawFilePath);
+    VolumeLoadingResult LoadVolumeRaw(const std::filesystem::path& rawFilePath, VolumeStorageMode storageMode = VolumeStorageMode::Owning);
 
     /**
     * Loads a raw volume file using provided metadata.
@@ -42,16 +46,58 @@ namespace VolumeData
     * This overload is useful when metadata is already known or comes from a
     * different source than a .dat file.
     *
+    * With VolumeStorageMode::Mapped, the file is mapped read-only instead of being
+    * read into a heap buffer. The returned VolumeData then references the mapping
+    * and its data can be uploaded to the GPU without an intermediate copy.
+    * The owning modes read the file with concurrent positioned reads straight into the
+    * owned buffer, bypassing the file cache with VolumeStorageMode::OwningUncached.
+    * With VolumeStorageMode::Sparse, the mapping is converted into a SparseVolumeData and
+    * then released, so the returned VolumeData only holds the non-uniform bricks.
+    *
     * @param rawFilePath Path to the .raw file.
     * @param metadata Volume metadata (dimensions, components, bit depth, scaling).
+    * @param storageMode Whether to read the voxel data into an owned buffer, map the file or hold the volume sparsely.
     * @return VolumeLoadingResult containing VolumeData on success, or VolumeLoadingError on failure.
     *
     * @see VolumeData for the loaded volume structure.
     * @see VolumeMetadata for metadata format.
+    * @see VolumeStorageMode for the available storage modes.
     * @see VolumeLoadingResult for the result type.
+    * @see ConvertVolumeDataToSparse for the conversion of VolumeStorageMode::Sparse.
+    * @see ReadFileInParallel for the reads of the owning modes.
+    */
+    VolumeLoadingResult LoadVolumeRaw(const std::filesystem::path& rawFilePath, const VolumeMetadata& metadata, VolumeStorageMode storageMode = VolumeStorageMode::Owning);
+
+    /**
+    * Loads a region of a raw volume file using metadata from a companion .ini file.
+    *
+    * @param rawFilePath Path to the .raw file.
+    * @param region The box and stride to load.
+    * @return VolumeLoadingResult containing the region on success, or VolumeLoadingError on failure.
+    *
+    * @see LoadVolumeRaw(const std::filesystem::path&, const VolumeMetadata&, const VolumeRegion&) for details.
     */
-    VolumeLoadingResult LoadVolumeRaw(const std::filesystem::path& rawFilePath, const VolumeMetadata& metadata);
+    VolumeLoadingResult LoadVolumeRaw(const std::filesystem::path& rawFilePath, const VolumeRegion& region);
 
+    /**
+    * Loads a region of a raw volume file using provided metadata.
+    *
+    * Only the rows of the file that hold kept voxels are read, with positioned reads that
+    * run in parallel over the slices of the region. Where the box spans whole rows and the
+    * stride is 1, the rows of a slice are contiguous in the file and read at once. The
+    * voxels are always read into an owned buffer, whose metadata has the dimensions and
+    * spacing returned by GetVolumeRegionMetadata(). Unless the region is the whole volume,
+    * the result has no source path, since its layout differs from the file.
+    *
+    * @param rawFilePath Path to the .raw file.
+    * @param metadata Metadata of the whole volume in the file.
+    * @param region The box and stride to load.
+    * @return VolumeLoadingResult containing the region on success, VolumeLoadingError::InvalidRegion if the region does not fit the volume, or another VolumeLoadingError on failure.
+    *
+    * @see VolumeRegion for the region description.
+    * @see PositionedFileReader for the reads.
+    */
+    VolumeLoadingResult LoadVolumeRaw(const std::filesystem::path& rawFilePath, const VolumeMetadata& metadata, const VolumeRegion& region);
 }
 
 #endif
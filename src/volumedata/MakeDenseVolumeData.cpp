@@ -0,0 +1,37 @@
+#include <volumedata/MakeDenseVolumeData.h>
+#include <volumedata/SparseVolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <algorithm>
+#include <execution>
+#include <numeric>
+#include <span>
+#include <vector>
+
+VolumeData::VolumeData VolumeData::MakeDenseVolumeData(const SparseVolumeData& sparseVolumeData)
+{
+    if (!sparseVolumeData.IsValid())
+    {
+        return VolumeData{};
+    }
+
+    const auto& metadata = sparseVolumeData.GetMetadata();
+    auto volumeData = VolumeData{metadata};
+
+    const size_t rowSizeInBytes = metadata.GetWidth() * metadata.GetBytesPerVoxel();
+    const size_t sliceSizeInBytes = rowSizeInBytes * metadata.GetHeight();
+    auto* data = volumeData.GetDataPtr();
+
+    std::vector<uint32_t> slices(metadata.GetDepth());
+    std::iota(slices.begin(), slices.end(), 0u);
+
+    std::for_each(std::execution::par, slices.begin(), slices.end(), [&](uint32_t z)
+    {
+        for (uint32_t y = 0; y < metadata.GetHeight(); ++y)
+        {
+            sparseVolumeData.CopyRow(y, z, std::span<uint8_t>{data + z * sliceSizeInBytes + y * rowSizeInBytes, rowSizeInBytes});
+        }
+    });
+
+    return volumeData;
+}
@@ -0,0 +1,30 @@
+/**
+* \file MakeDenseVolumeData.h
+*
+* \brief Function for converting a sparse volume back into a dense volume.
+*/
+
+#ifndef MAKE_DENSE_VOLUME_DATA_H
+#define MAKE_DENSE_VOLUME_DATA_H
+
+#include <volumedata/VolumeData.h>
+
+namespace VolumeData
+{
+    class SparseVolumeData;
+
+    /**
+    * Converts a sparse volume into a dense VolumeData owning all of its voxels.
+    *
+    * Slices are filled in parallel with SparseVolumeData::CopyRow(), which expands uniform bricks.
+    *
+    * @param sparseVolumeData The sparse volume.
+    * @return VolumeData The dense volume, invalid if the sparse volume is invalid.
+    *
+    * @see SparseVolumeData for the sparse representation.
+    * @see MakeSparseVolumeData for the conversion into sparse form.
+    */
+    VolumeData MakeDenseVolumeData(const SparseVolumeData& sparseVolumeData);
+}
+
+#endif
@@ -0,0 +1,13 @@
+#include <volumedata/MakeGradientVolumeUpdater.h>
+
+#include <storage/Storage.h>
+#include <textures/TextureId.h>
+
+VolumeData::GradientVolumeUpdater Factory::MakeGradientVolumeUpdater(Storage& storage)
+{
+    return VolumeData::GradientVolumeUpdater {
+        storage.GetGuiUpdateFlags(),
+        storage.GetVolumeData(),
+        storage.GetTexture(TextureId::GradientVolume)
+    };
+}
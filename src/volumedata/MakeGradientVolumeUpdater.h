@@ -0,0 +1,27 @@
+/**
+* \file MakeGradientVolumeUpdater.h
+*
+* \brief Factory function for creating the gradient volume updater.
+*/
+
+#ifndef MAKE_GRADIENT_VOLUME_UPDATER_H
+#define MAKE_GRADIENT_VOLUME_UPDATER_H
+
+#include <volumedata/GradientVolumeUpdater.h>
+
+class Storage;
+
+namespace Factory
+{
+    /**
+    * Creates the gradient volume updater for the volume in Storage.
+    *
+    * @param storage Storage containing GUI update flags, volume data, and textures.
+    * @return Initialized GradientVolumeUpdater object.
+    *
+    * @see VolumeData::GradientVolumeUpdater for the update implementation.
+    */
+    VolumeData::GradientVolumeUpdater MakeGradientVolumeUpdater(Storage& storage);
+}
+
+#endif
@@ -0,0 +1,14 @@
+#include <volumedata/MakeOccupancyGridUpdater.h>
+
+#include <storage/Storage.h>
+#include <textures/TextureId.h>
+
+VolumeData::OccupancyGridUpdater Factory::MakeOccupancyGridUpdater(Storage& storage)
+{
+    return VolumeData::OccupancyGridUpdater {
+        storage.GetGuiUpdateFlags(),
+        storage.GetGuiParameters(),
+        storage.GetVolumeData(),
+        storage.GetTexture(TextureId::OccupancyGrid)
+    };
+}
@@ -0,0 +1,27 @@
+/**
+* \file MakeOccupancyGridUpdater.h
+*
+* \brief Factory function for creating the occupancy grid updater.
+*/
+
+#ifndef MAKE_OCCUPANCY_GRID_UPDATER_H
+#define MAKE_OCCUPANCY_GRID_UPDATER_H
+
+#include <volumedata/OccupancyGridUpdater.h>
+
+class Storage;
+
+namespace Factory
+{
+    /**
+    * Creates the occupancy grid updater for the volume in Storage.
+    *
+    * @param storage Storage containing GUI update flags, GUI parameters, volume data, and textures.
+    * @return Initialized OccupancyGridUpdater object.
+    *
+    * @see VolumeData::OccupancyGridUpdater for the update implementation.
+    */
+    VolumeData::OccupancyGridUpdater MakeOccupancyGridUpdater(Storage& storage);
+}
+
+#endif
@@ -0,0 +1,22 @@
+#include <volumedata/MakePagedVolumeStreamer.h>
+
+#include <config/Config.h>
+#include <shader/ShaderId.h>
+#include <storage/Storage.h>
+#include <textures/TextureId.h>
+
+VolumeData::PagedVolumeStreamer Factory::MakePagedVolumeStreamer(Storage& storage)
+{
+    const auto levelZeroPath = (Config::volumeLoadingMode == VolumeData::VolumeLoadingMode::Paged) ? Config::datasetPath : std::filesystem::path{};
+
+    return VolumeData::PagedVolumeStreamer {
+        levelZeroPath,
+        storage.GetGuiUpdateFlags(),
+        storage.GetGuiParameters(),
+        storage.GetTexture(TextureId::BrickAtlas),
+        storage.GetTexture(TextureId::PageTable),
+        storage.GetTexture(TextureId::PagedVolumeFeedback),
+        storage.GetShader(ShaderId::Volume),
+        storage.GetVolumeLoadingProgress()
+    };
+}
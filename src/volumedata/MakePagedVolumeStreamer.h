@@ -0,0 +1,30 @@
+/**
+* \file MakePagedVolumeStreamer.h
+*
+* \brief Factory function for creating the paged volume streamer.
+*/
+
+#ifndef MAKE_PAGED_VOLUME_STREAMER_H
+#define MAKE_PAGED_VOLUME_STREAMER_H
+
+#include <volumedata/PagedVolumeStreamer.h>
+
+class Storage;
+
+namespace Factory
+{
+    /**
+    * Creates the paged volume streamer for the configured dataset.
+    *
+    * The streamer reads Config::datasetPath and its coarser levels if Config::volumeLoadingMode
+    * is VolumeLoadingMode::Paged, and does nothing otherwise.
+    *
+    * @param storage Storage containing GUI update flags, GUI parameters, textures, shaders, and loading progress.
+    * @return Initialized PagedVolumeStreamer object.
+    *
+    * @see VolumeData::PagedVolumeStreamer for the streaming implementation.
+    */
+    VolumeData::PagedVolumeStreamer MakePagedVolumeStreamer(Storage& storage);
+}
+
+#endif
@@ -0,0 +1,20 @@
+#include <volumedata/MakeProgressiveVolumeLoader.h>
+#include <volumedata/MakeVolumeTextureBudget.h>
+
+#include <config/Config.h>
+#include <storage/Storage.h>
+#include <textures/TextureId.h>
+
+VolumeData::ProgressiveVolumeLoader Factory::MakeProgressiveVolumeLoader(Storage& storage)
+{
+    const auto rawFilePath = (Config::volumeLoadingMode == VolumeData::VolumeLoadingMode::Paged) ? std::filesystem::path{} : Config::datasetPath;
+
+    return VolumeData::ProgressiveVolumeLoader {
+        rawFilePath,
+        storage.GetGuiUpdateFlags(),
+        storage.GetVolumeData(),
+        storage.GetTexture(TextureId::VolumeData),
+        storage.GetVolumeLoadingProgress(),
+        Factory::MakeVolumeTextureBudget(storage.GetTextureStorage(), storage.GetFrameBufferStorage())
+    };
+}
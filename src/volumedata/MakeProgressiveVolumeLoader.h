@@ -0,0 +1,33 @@
+/**
+* \file MakeProgressiveVolumeLoader.h
+*
+* \brief Factory function for creating the progressive volume loader.
+*/
+
+#ifndef MAKE_PROGRESSIVE_VOLUME_LOADER_H
+#define MAKE_PROGRESSIVE_VOLUME_LOADER_H
+
+#include <volumedata/ProgressiveVolumeLoader.h>
+
+class Storage;
+
+namespace Factory
+{
+    /**
+    * Creates the progressive volume loader for the configured dataset.
+    *
+    * The loader starts loading Config::datasetPath in the background if Storage
+    * does not hold a volume yet, i.e. if Config::volumeLoadingMode is Progressive.
+    * Otherwise it does nothing. The published levels are fitted into the budget from
+    * Factory::MakeVolumeTextureBudget() for the textures and framebuffers in Storage.
+    *
+    * @param storage Storage containing GUI update flags, volume data, textures, and loading progress.
+    * @return Initialized ProgressiveVolumeLoader object.
+    *
+    * @see VolumeData::ProgressiveVolumeLoader for the loading implementation.
+    * @see VolumeData::VolumeLoadingMode for selecting progressive loading.
+    */
+    VolumeData::ProgressiveVolumeLoader MakeProgressiveVolumeLoader(Storage& storage);
+}
+
+#endif
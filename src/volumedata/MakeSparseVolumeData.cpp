@@ -0,0 +1,113 @@
+#include <volumedata/MakeSparseVolumeData.h>
+#include <volumedata/BrickExtent.h>
+#include <volumedata/GetBrickExtent.h>
+#include <volumedata/SparseVolumeBrick.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <algorithm>
+#include <cstring>
+#include <execution>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+    /// A brick is uniform if its first row repeats its first voxel and all other rows equal its first row
+    bool IsBrickUniform(const uint8_t* brickBegin, const VolumeData::BrickExtent& extent, size_t bytesPerVoxel, size_t rowStride, size_t sliceStride)
+    {
+        const size_t rowSizeInBytes = extent.width * bytesPerVoxel;
+        if (std::memcmp(brickBegin, brickBegin + bytesPerVoxel, rowSizeInBytes - bytesPerVoxel) != 0)
+        {
+            return false;
+        }
+
+        for (uint32_t z = 0; z < extent.depth; ++z)
+        {
+            for (uint32_t y = 0; y < extent.height; ++y)
+            {
+                if (std::memcmp(brickBegin + z * sliceStride + y * rowStride, brickBegin, rowSizeInBytes) != 0)
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+} // anonymous namespace
+
+VolumeData::SparseVolumeData VolumeData::MakeSparseVolumeData(const VolumeData& volumeData, uint32_t brickSize)
+{
+    const auto& metadata = volumeData.GetMetadata();
+    const size_t bytesPerVoxel = metadata.GetBytesPerVoxel();
+    if (!volumeData.IsValid() || brickSize == 0 || bytesPerVoxel > sizeof(uint64_t))
+    {
+        return SparseVolumeData{};
+    }
+
+    const size_t numBricks = static_cast<size_t>((metadata.GetWidth() + brickSize - 1) / brickSize)
+        * ((metadata.GetHeight() + brickSize - 1) / brickSize)
+        * ((metadata.GetDepth() + brickSize - 1) / brickSize);
+    const size_t rowStride = metadata.GetWidth() * bytesPerVoxel;
+    const size_t sliceStride = rowStride * metadata.GetHeight();
+    const uint8_t* data = volumeData.GetDataPtr();
+
+    const auto GetBrickBegin = [&](const BrickExtent& extent)
+    {
+        return data + extent.z * sliceStride + extent.y * rowStride + extent.x * bytesPerVoxel;
+    };
+
+    std::vector<size_t> brickIndices(numBricks);
+    std::iota(brickIndices.begin(), brickIndices.end(), size_t{0});
+
+    std::vector<SparseVolumeBrick> bricks(numBricks);
+    std::for_each(std::execution::par, brickIndices.begin(), brickIndices.end(), [&](size_t brickIndex)
+    {
+        const auto extent = GetBrickExtent(metadata, brickSize, brickIndex);
+        const auto* brickBegin = GetBrickBegin(extent);
+
+        auto& brick = bricks[brickIndex];
+        brick.isUniform = IsBrickUniform(brickBegin, extent, bytesPerVoxel, rowStride, sliceStride);
+        if (brick.isUniform)
+        {
+            std::memcpy(&brick.uniformVoxel, brickBegin, bytesPerVoxel);
+        }
+    });
+
+    size_t brickDataSizeInBytes = 0;
+    for (size_t brickIndex = 0; brickIndex < numBricks; ++brickIndex)
+    {
+        if (!bricks[brickIndex].isUniform)
+        {
+            bricks[brickIndex].dataOffset = brickDataSizeInBytes;
+            brickDataSizeInBytes += GetBrickExtent(metadata, brickSize, brickIndex).GetVoxelCount() * bytesPerVoxel;
+        }
+    }
+
+    std::vector<uint8_t> brickData(brickDataSizeInBytes);
+    std::for_each(std::execution::par, brickIndices.begin(), brickIndices.end(), [&](size_t brickIndex)
+    {
+        const auto& brick = bricks[brickIndex];
+        if (brick.isUniform)
+        {
+            return;
+        }
+
+        const auto extent = GetBrickExtent(metadata, brickSize, brickIndex);
+        const auto* brickBegin = GetBrickBegin(extent);
+        const size_t rowSizeInBytes = extent.width * bytesPerVoxel;
+        auto* destination = brickData.data() + brick.dataOffset;
+
+        for (uint32_t z = 0; z < extent.depth; ++z)
+        {
+            for (uint32_t y = 0; y < extent.height; ++y)
+            {
+                std::memcpy(destination, brickBegin + z * sliceStride + y * rowStride, rowSizeInBytes);
+                destination += rowSizeInBytes;
+            }
+        }
+    });
+
+    return SparseVolumeData{metadata, brickSize, std::move(bricks), std::move(brickData)};
+}
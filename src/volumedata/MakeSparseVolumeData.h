@@ -0,0 +1,35 @@
+/**
+* \file MakeSparseVolumeData.h
+*
+* \brief Function for converting a dense volume into a sparse volume.
+*/
+
+#ifndef MAKE_SPARSE_VOLUME_DATA_H
+#define MAKE_SPARSE_VOLUME_DATA_H
+
+#include <volumedata/SparseVolumeData.h>
+
+#include <cstdint>
+
+namespace VolumeData
+{
+    class VolumeData;
+
+    /**
+    * Converts a dense volume into a sparse volume that stores uniform bricks as a single value.
+    *
+    * Bricks are classified in parallel, comparing whole rows with memcmp, and the voxels of
+    * the non-uniform bricks are then gathered in parallel into a single buffer. Only the
+    * voxels of the non-uniform bricks are allocated.
+    *
+    * @param volumeData The dense volume.
+    * @param brickSize Edge length of a brick in voxels.
+    * @return SparseVolumeData The sparse volume, invalid if the volume is invalid, brickSize is zero or a voxel is larger than 8 bytes.
+    *
+    * @see SparseVolumeData for the sparse representation.
+    * @see MakeDenseVolumeData for the conversion back.
+    */
+    SparseVolumeData MakeSparseVolumeData(const VolumeData& volumeData, uint32_t brickSize = SparseVolumeData::defaultBrickSize);
+}
+
+#endif
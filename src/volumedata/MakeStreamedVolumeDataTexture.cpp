@@ -0,0 +1,188 @@
+#include <volumedata/MakeStreamedVolumeDataTexture.h>
+#include <volumedata/GetVolumeTextureFormat.h>
+#include <volumedata/PositionedFileReader.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <buffers/PixelUnpackBuffer.h>
+#include <config/Config.h>
+
+#include <glad/glad.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <span>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+namespace
+{
+    /// A slab to read into a mapped pixel unpack buffer
+    struct SlabRead
+    {
+        uint64_t offsetInBytes;
+        std::span<uint8_t> destination;
+    };
+
+    /// Slabs handed from the OpenGL thread to the reader thread, which reads them in order
+    struct SlabReadQueue
+    {
+        std::mutex mutex;
+        std::condition_variable_any condition;
+        std::deque<SlabRead> pendingReads;
+        unsigned int numCompletedReads = 0;
+        bool hasReadFailed = false;
+    };
+
+    void ReadSlabs(std::stop_token stopToken, const VolumeData::PositionedFileReader& fileReader, SlabReadQueue& queue)
+    {
+        while (true)
+        {
+            SlabRead slabRead;
+            {
+                std::unique_lock lock{queue.mutex};
+                if (!queue.condition.wait(lock, stopToken, [&queue] { return !queue.pendingReads.empty(); }))
+                {
+                    return;
+                }
+                slabRead = queue.pendingReads.front();
+                queue.pendingReads.pop_front();
+            }
+
+            const auto succeeded = fileReader.Read(slabRead.offsetInBytes, slabRead.destination);
+
+            {
+                std::lock_guard lock{queue.mutex};
+                ++queue.numCompletedReads;
+                queue.hasReadFailed = queue.hasReadFailed || !succeeded;
+            }
+            queue.condition.notify_all();
+        }
+    }
+} // anonymous namespace
+
+namespace Factory
+{
+    std::expected<Texture, VolumeData::VolumeLoadingError> MakeStreamedVolumeDataTexture(TextureId textureId, unsigned int textureUnit, const std::filesystem::path& rawFilePath, const VolumeData::VolumeMetadata& metadata)
+    {
+        if (!metadata.IsValid())
+        {
+            return std::unexpected(VolumeData::VolumeLoadingError::InvalidMetadata);
+        }
+
+        const auto fileReader = VolumeData::PositionedFileReader{rawFilePath};
+        if (!fileReader.IsOpen())
+        {
+            return std::unexpected(VolumeData::VolumeLoadingError::RawFileNotFound);
+        }
+
+        if (fileReader.GetSizeInBytes() != metadata.GetTotalSizeInBytes())
+        {
+            return std::unexpected(VolumeData::VolumeLoadingError::FileSizeMismatch);
+        }
+
+        const auto width = metadata.GetWidth();
+        const auto height = metadata.GetHeight();
+        const auto depth = metadata.GetDepth();
+        const size_t sliceSizeInBytes = static_cast<size_t>(width) * height * metadata.GetBytesPerVoxel();
+        const auto slicesPerSlab = static_cast<unsigned int>(std::clamp<size_t>(Config::volumeUploadSlabSizeInBytes / sliceSizeInBytes, 1, depth));
+        const auto numSlabs = (depth + slicesPerSlab - 1) / slicesPerSlab;
+        const auto numBuffers = std::min(Config::numVolumeUploadBuffers, numSlabs);
+
+        const auto textureFormat = VolumeData::GetVolumeTextureFormat(metadata);
+        auto texture = Texture{textureId, textureUnit, width, height, depth, textureFormat.internalFormat, textureFormat.format, textureFormat.type, GL_LINEAR, GL_CLAMP_TO_EDGE, nullptr};
+
+        std::vector<PixelUnpackBuffer> pixelUnpackBuffers;
+        pixelUnpackBuffers.reserve(numBuffers);
+        for (auto i = 0u; i < numBuffers; ++i)
+        {
+            pixelUnpackBuffers.emplace_back(slicesPerSlab * sliceSizeInBytes);
+        }
+
+        // Declared after the buffers, so that the reader thread is joined before they are destroyed
+        SlabReadQueue queue;
+        const auto readerThread = std::jthread{ReadSlabs, std::cref(fileReader), std::ref(queue)};
+
+        const auto GetNumSlicesInSlab = [&](unsigned int slabIndex)
+        {
+            return std::min(slicesPerSlab, depth - slabIndex * slicesPerSlab);
+        };
+
+        const auto IssueRead = [&](unsigned int slabIndex)
+        {
+            auto* destination = static_cast<uint8_t*>(pixelUnpackBuffers[slabIndex % numBuffers].Map());
+            if (destination == nullptr)
+            {
+                return false;
+            }
+
+            const uint64_t offsetInBytes = static_cast<uint64_t>(slabIndex) * slicesPerSlab * sliceSizeInBytes;
+            const size_t sizeInBytes = GetNumSlicesInSlab(slabIndex) * sliceSizeInBytes;
+            {
+                std::lock_guard lock{queue.mutex};
+                queue.pendingReads.push_back(SlabRead{offsetInBytes, std::span<uint8_t>{destination, sizeInBytes}});
+            }
+            queue.condition.notify_all();
+            return true;
+        };
+
+        const auto WaitForRead = [&](unsigned int slabIndex)
+        {
+            std::unique_lock lock{queue.mutex};
+            queue.condition.wait(lock, [&] { return queue.numCompletedReads > slabIndex; });
+            return !queue.hasReadFailed;
+        };
+
+        GLint previousUnpackAlignment;
+        glGetIntegerv(GL_UNPACK_ALIGNMENT, &previousUnpackAlignment);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+        auto succeeded = true;
+        auto numIssuedSlabs = 0u;
+
+        while (numIssuedSlabs < numBuffers && IssueRead(numIssuedSlabs))
+        {
+            ++numIssuedSlabs;
+        }
+        succeeded = (numIssuedSlabs == numBuffers);
+
+        // Upload slab k while the reads of slabs k+1 .. k+numBuffers-1 are in flight. The buffer
+        // of slab k is remapped for slab k+numBuffers right after its upload has been queued.
+        // After a failure, no further reads are issued but all pending ones are drained so that
+        // no buffer is still mapped or written to when it is destroyed.
+        for (auto slabIndex = 0u; slabIndex < numIssuedSlabs; ++slabIndex)
+        {
+            const auto bufferIndex = slabIndex % numBuffers;
+            const auto readSucceeded = WaitForRead(slabIndex);
+            const auto unmapSucceeded = pixelUnpackBuffers[bufferIndex].Unmap();
+            succeeded = succeeded && readSucceeded && unmapSucceeded;
+
+            if (!succeeded)
+            {
+                continue;
+            }
+
+            texture.SetSubImage3D(0, 0, slabIndex * slicesPerSlab, width, height, GetNumSlicesInSlab(slabIndex), textureFormat.format, textureFormat.type, nullptr);
+
+            if (numIssuedSlabs < numSlabs)
+            {
+                succeeded = IssueRead(numIssuedSlabs);
+                numIssuedSlabs += succeeded ? 1 : 0;
+            }
+        }
+
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, previousUnpackAlignment);
+
+        if (!succeeded)
+        {
+            return std::unexpected(VolumeData::VolumeLoadingError::ReadError);
+        }
+
+        return texture;
+    }
+}
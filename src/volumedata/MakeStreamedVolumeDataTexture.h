@@ -0,0 +1,52 @@
+/**
+* \file MakeStreamedVolumeDataTexture.h
+*
+* \brief Factory function for creating 3D volume data textures by streaming slabs from disk.
+*/
+
+#ifndef MAKE_STREAMED_VOLUME_DATA_TEXTURE_H
+#define MAKE_STREAMED_VOLUME_DATA_TEXTURE_H
+
+#include <textures/Texture.h>
+#include <textures/TextureId.h>
+#include <volumedata/VolumeLoadingError.h>
+
+#include <expected>
+#include <filesystem>
+
+namespace VolumeData
+{
+    class VolumeMetadata;
+}
+
+namespace Factory
+{
+    /**
+    * Creates a 3D OpenGL texture by streaming a .raw file slab by slab.
+    *
+    * Allocates the texture storage up front and splits the volume into Z-slabs of
+    * roughly Config::volumeUploadSlabSizeInBytes. A single worker thread reads the slabs
+    * in order through one PositionedFileReader, directly into a ring of
+    * Config::numVolumeUploadBuffers mapped pixel unpack buffers, while the calling thread
+    * uploads each finished slab with glTexSubImage3D. Disk reads and GPU transfers therefore
+    * overlap, and host memory is bounded by the ring instead of the whole volume. No
+    * VolumeData is needed, so the texture can be created before, or instead of, loading the
+    * volume into host memory.
+    *
+    * Must be called on the thread owning the OpenGL context.
+    *
+    * @param textureId The identifier for this texture in Storage.
+    * @param textureUnit The OpenGL texture unit to bind to (e.g., GL_TEXTURE0).
+    * @param rawFilePath Path to the .raw file holding the voxels.
+    * @param metadata The metadata of the volume in the file.
+    * @return std::expected containing the Texture on success, or VolumeLoadingError on failure.
+    *
+    * @see MakeVolumeDataTexture for uploading from host memory in one call.
+    * @see PixelUnpackBuffer for the staging buffers.
+    * @see PositionedFileReader for the reads.
+    * @see VolumeUploadMode for selecting the upload strategy.
+    */
+    std::expected<Texture, VolumeData::VolumeLoadingError> MakeStreamedVolumeDataTexture(TextureId textureId, unsigned int textureUnit, const std::filesystem::path& rawFilePath, const VolumeData::VolumeMetadata& metadata);
+}
+
+#endif
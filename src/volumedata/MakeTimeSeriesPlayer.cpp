@@ -0,0 +1,20 @@
+#include <volumedata/MakeTimeSeriesPlayer.h>
+#include <volumedata/FindTimeSeriesSteps.h>
+
+#include <config/Config.h>
+#include <storage/Storage.h>
+#include <textures/TextureId.h>
+
+VolumeData::TimeSeriesPlayer Factory::MakeTimeSeriesPlayer(Storage& storage)
+{
+    auto stepPaths = Config::timeSeriesPath.empty() ? std::vector<std::filesystem::path>{} : VolumeData::FindTimeSeriesSteps(Config::timeSeriesPath);
+
+    return VolumeData::TimeSeriesPlayer {
+        std::move(stepPaths),
+        storage.GetGuiUpdateFlags(),
+        storage.GetVolumeData(),
+        storage.GetTexture(TextureId::VolumeData),
+        storage.GetVolumeLoadingProgress(),
+        storage.GetTimeSeriesPlaybackState()
+    };
+}
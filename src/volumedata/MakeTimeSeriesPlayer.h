@@ -0,0 +1,31 @@
+/**
+* \file MakeTimeSeriesPlayer.h
+*
+* \brief Factory function for creating the time series player.
+*/
+
+#ifndef MAKE_TIME_SERIES_PLAYER_H
+#define MAKE_TIME_SERIES_PLAYER_H
+
+#include <volumedata/TimeSeriesPlayer.h>
+
+class Storage;
+
+namespace Factory
+{
+    /**
+    * Creates the time series player for the configured time series.
+    *
+    * The player plays back the timesteps found in Config::timeSeriesPath. If the
+    * path is empty or holds no .raw files, the player does nothing.
+    *
+    * @param storage Storage containing GUI update flags, volume data, textures, loading progress, and playback state.
+    * @return Initialized TimeSeriesPlayer object.
+    *
+    * @see VolumeData::TimeSeriesPlayer for the playback implementation.
+    * @see VolumeData::FindTimeSeriesSteps for enumerating the timesteps.
+    */
+    VolumeData::TimeSeriesPlayer MakeTimeSeriesPlayer(Storage& storage);
+}
+
+#endif
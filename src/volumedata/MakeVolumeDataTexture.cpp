@@ -1,82 +1,69 @@
 #include <volumedata/MakeVolumeDataTexture.h>
+#include <volumedata/GetVolumeTextureFormat.h>
 #include <volumedata/VolumeData.h>
 
+#include <config/Config.h>
+
 #include <glad/glad.h>
 
-namespace Factory
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace
 {
-    Texture MakeVolumeDataTexture(TextureId textureId, unsigned int textureUnit, const VolumeData::VolumeData& volumeData)
+    /// Uploads a sparse volume slab by slab, expanding only one slab at a time in host memory
+    void UploadSparseVolumeData(Texture& texture, const VolumeData::VolumeData& volumeData)
     {
         const auto& metadata = volumeData.GetMetadata();
-        GLenum internalFormat;
-        GLenum format;
-        GLenum type;
+        const auto textureFormat = VolumeData::GetVolumeTextureFormat(metadata);
+        const auto depth = metadata.GetDepth();
+        const size_t sliceSizeInBytes = static_cast<size_t>(metadata.GetWidth()) * metadata.GetHeight() * metadata.GetBytesPerVoxel();
+        const auto slicesPerSlab = static_cast<unsigned int>(std::clamp<size_t>(Config::volumeUploadSlabSizeInBytes / sliceSizeInBytes, 1, depth));
+        std::vector<uint8_t> slab(slicesPerSlab * sliceSizeInBytes);
+
+        GLint previousUnpackAlignment;
+        glGetIntegerv(GL_UNPACK_ALIGNMENT, &previousUnpackAlignment);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
-        switch (metadata.GetBitsPerComponent())
+        for (auto z = 0u; z < depth; z += slicesPerSlab)
         {
-            case 8:
-                type = GL_UNSIGNED_BYTE;
-                switch (metadata.GetComponents())
-                {
-                    case 1:
-                        internalFormat = GL_R8;
-                        format = GL_RED;
-                        break;
-                    case 2:
-                        internalFormat = GL_RG8;
-                        format = GL_RG;
-                        break;
-                    case 3:
-                        internalFormat = GL_RGB8;
-                        format = GL_RGB;
-                        break;
-                    default:
-                        internalFormat = GL_RGBA8;
-                        format = GL_RGBA;
-                        break;
-                }
-                break;
-            case 16:
-                type = GL_UNSIGNED_SHORT;
-                switch (metadata.GetComponents())
-                {
-                    case 1:
-                        internalFormat = GL_R16;
-                        format = GL_RED;
-                        break;
-                    case 2:
-                        internalFormat = GL_RG16;
-                        format = GL_RG;
-                        break;
-                    case 3:
-                        internalFormat = GL_RGB16;
-                        format = GL_RGB;
-                        break;
-                    default:
-                        internalFormat = GL_RGBA16;
-                        format = GL_RGBA;
-                        break;
-                }
-                break;
-            default:
-                type = GL_UNSIGNED_BYTE;
-                internalFormat = GL_R8;
-                format = GL_RED;
-                break;
+            const auto numSlices = std::min(slicesPerSlab, depth - z);
+            volumeData.CopySlices(z, numSlices, std::span{slab}.first(numSlices * sliceSizeInBytes));
+            texture.SetSubImage3D(0, 0, z, metadata.GetWidth(), metadata.GetHeight(), numSlices, textureFormat.format, textureFormat.type, slab.data());
         }
 
-        return Texture {
+        glPixelStorei(GL_UNPACK_ALIGNMENT, previousUnpackAlignment);
+    }
+} // anonymous namespace
+
+namespace Factory
+{
+    Texture MakeVolumeDataTexture(TextureId textureId, unsigned int textureUnit, const VolumeData::VolumeData& volumeData)
+    {
+        const auto& metadata = volumeData.GetMetadata();
+        const auto textureFormat = VolumeData::GetVolumeTextureFormat(metadata);
+
+        auto texture = Texture {
             textureId,
             textureUnit,
             metadata.GetWidth(),
             metadata.GetHeight(),
             metadata.GetDepth(),
-            internalFormat,
-            format,
-            type,
+            textureFormat.internalFormat,
+            textureFormat.format,
+            textureFormat.type,
             GL_LINEAR,
             GL_CLAMP_TO_EDGE,
-            volumeData.GetDataPtr()
+            volumeData.IsSparse() ? nullptr : volumeData.GetDataPtr()
         };
+
+        if (volumeData.IsSparse())
+        {
+            UploadSparseVolumeData(texture, volumeData);
+        }
+
+        return texture;
     }
 }
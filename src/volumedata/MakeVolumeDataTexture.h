@@ -27,6 +27,10 @@ namespace Factory
     * The texture is configured with linear filtering and clamp-to-edge
     * wrapping for proper volume rendering.
     *
+    * Volumes loaded with VolumeStorageMode::Mapped are uploaded straight from
+    * the file mapping, without an intermediate copy in host memory. Sparse volumes
+    * are expanded and uploaded one slab of slices at a time.
+    *
     * @param textureId The identifier for this texture in Storage.
     * @param textureUnit The OpenGL texture unit to bind to (e.g., GL_TEXTURE0).
     * @param volumeData The volume data containing voxels and metadata.
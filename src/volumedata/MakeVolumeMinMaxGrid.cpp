@@ -0,0 +1,150 @@
+#include <volumedata/MakeVolumeMinMaxGrid.h>
+#include <volumedata/BrickExtent.h>
+#include <volumedata/SparseVolumeData.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+#include <volumedata/VolumeView.h>
+
+#include <algorithm>
+#include <execution>
+#include <limits>
+#include <numeric>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    /// Extends the brick by one voxel on each side, as trilinear samples near its faces read from the neighbors
+    std::pair<uint32_t, uint32_t> GetRange(uint32_t brickCoordinate, uint32_t brickSize, uint32_t dimension)
+    {
+        const uint32_t begin = brickCoordinate * brickSize;
+        return std::pair{begin > 0 ? begin - 1 : 0u, std::min(begin + brickSize + 1, dimension)};
+    }
+
+    template <typename View>
+    std::pair<float, float> GetBrickRange(const View& view, uint32_t brickX, uint32_t brickY, uint32_t brickZ, uint32_t brickSize)
+    {
+        using T = typename View::ValueType;
+        constexpr size_t components = View::numComponents;
+
+        const auto [xBegin, xEnd] = GetRange(brickX, brickSize, view.GetWidth());
+        const auto [yBegin, yEnd] = GetRange(brickY, brickSize, view.GetHeight());
+        const auto [zBegin, zEnd] = GetRange(brickZ, brickSize, view.GetDepth());
+        const auto brickView = view.GetBrick(VolumeData::BrickExtent{xBegin, yBegin, zBegin, xEnd - xBegin, yEnd - yBegin, zEnd - zBegin});
+
+        T minValue = std::numeric_limits<T>::max();
+        T maxValue = std::numeric_limits<T>::min();
+
+        for (const auto row : brickView.GetRows())
+        {
+            for (size_t i = 0; i < row.size(); i += components)
+            {
+                minValue = std::min(minValue, row[i]);
+                maxValue = std::max(maxValue, row[i]);
+            }
+        }
+
+        constexpr float normalization = 1.0f / static_cast<float>(std::numeric_limits<T>::max());
+        return {minValue * normalization, maxValue * normalization};
+    }
+
+    /// Computes the ranges of one row of bricks of a sparse volume, expanding each row they cover only once
+    template <typename T>
+    void SetSparseBrickRowRanges(const VolumeData::SparseVolumeData& sparseVolumeData, uint32_t brickY, uint32_t brickZ, VolumeData::VolumeMinMaxGrid& grid)
+    {
+        const auto& metadata = sparseVolumeData.GetMetadata();
+        const size_t components = metadata.GetComponents();
+        const auto [yBegin, yEnd] = GetRange(brickY, grid.brickSize, metadata.GetHeight());
+        const auto [zBegin, zEnd] = GetRange(brickZ, grid.brickSize, metadata.GetDepth());
+
+        std::vector<T> row(static_cast<size_t>(metadata.GetWidth()) * components);
+        const auto rowBytes = std::span<uint8_t>{reinterpret_cast<uint8_t*>(row.data()), row.size() * sizeof(T)};
+        std::vector<T> minValues(grid.numBricksX, std::numeric_limits<T>::max());
+        std::vector<T> maxValues(grid.numBricksX, std::numeric_limits<T>::min());
+
+        for (auto z = zBegin; z < zEnd; ++z)
+        {
+            for (auto y = yBegin; y < yEnd; ++y)
+            {
+                sparseVolumeData.CopyRow(y, z, rowBytes);
+                for (uint32_t brickX = 0; brickX < grid.numBricksX; ++brickX)
+                {
+                    const auto [xBegin, xEnd] = GetRange(brickX, grid.brickSize, metadata.GetWidth());
+                    for (auto x = xBegin; x < xEnd; ++x)
+                    {
+                        minValues[brickX] = std::min(minValues[brickX], row[x * components]);
+                        maxValues[brickX] = std::max(maxValues[brickX], row[x * components]);
+                    }
+                }
+            }
+        }
+
+        constexpr float normalization = 1.0f / static_cast<float>(std::numeric_limits<T>::max());
+        const size_t firstBrickIndex = (static_cast<size_t>(brickZ) * grid.numBricksY + brickY) * grid.numBricksX;
+        for (uint32_t brickX = 0; brickX < grid.numBricksX; ++brickX)
+        {
+            grid.minValues[firstBrickIndex + brickX] = minValues[brickX] * normalization;
+            grid.maxValues[firstBrickIndex + brickX] = maxValues[brickX] * normalization;
+        }
+    }
+} // anonymous namespace
+
+VolumeData::VolumeMinMaxGrid VolumeData::MakeVolumeMinMaxGrid(const VolumeData& volumeData, uint32_t brickSize)
+{
+    VolumeMinMaxGrid grid;
+    if (!volumeData.IsValid() || brickSize == 0)
+    {
+        return grid;
+    }
+
+    const auto& metadata = volumeData.GetMetadata();
+    grid.brickSize = brickSize;
+    grid.numBricksX = (metadata.GetWidth() + brickSize - 1) / brickSize;
+    grid.numBricksY = (metadata.GetHeight() + brickSize - 1) / brickSize;
+    grid.numBricksZ = (metadata.GetDepth() + brickSize - 1) / brickSize;
+    grid.minValues.resize(grid.GetNumBricks());
+    grid.maxValues.resize(grid.GetNumBricks());
+
+    // A sparse volume is read row by row without expanding it, so bricks are processed in rows along x that share their rows
+    if (const auto* sparseVolumeData = volumeData.GetSparseData())
+    {
+        std::vector<uint32_t> brickRowIndices(grid.numBricksY * grid.numBricksZ);
+        std::iota(brickRowIndices.begin(), brickRowIndices.end(), 0u);
+
+        std::for_each(std::execution::par, brickRowIndices.begin(), brickRowIndices.end(), [&](uint32_t brickRowIndex)
+        {
+            const auto brickY = brickRowIndex % grid.numBricksY;
+            const auto brickZ = brickRowIndex / grid.numBricksY;
+            if (metadata.GetBitsPerComponent() == 16)
+            {
+                SetSparseBrickRowRanges<uint16_t>(*sparseVolumeData, brickY, brickZ, grid);
+            }
+            else
+            {
+                SetSparseBrickRowRanges<uint8_t>(*sparseVolumeData, brickY, brickZ, grid);
+            }
+        });
+
+        return grid;
+    }
+
+    std::vector<size_t> brickIndices(grid.GetNumBricks());
+    std::iota(brickIndices.begin(), brickIndices.end(), size_t{0});
+
+    VisitVolumeView(volumeData, [&](const auto& view)
+    {
+        std::for_each(std::execution::par, brickIndices.begin(), brickIndices.end(), [&](size_t brickIndex)
+        {
+            const auto brickX = static_cast<uint32_t>(brickIndex % grid.numBricksX);
+            const auto brickY = static_cast<uint32_t>((brickIndex / grid.numBricksX) % grid.numBricksY);
+            const auto brickZ = static_cast<uint32_t>(brickIndex / (static_cast<size_t>(grid.numBricksX) * grid.numBricksY));
+
+            const auto [minValue, maxValue] = GetBrickRange(view, brickX, brickY, brickZ, brickSize);
+            grid.minValues[brickIndex] = minValue;
+            grid.maxValues[brickIndex] = maxValue;
+        });
+    });
+
+    return grid;
+}
@@ -0,0 +1,36 @@
+/**
+* \file MakeVolumeMinMaxGrid.h
+*
+* \brief Function for computing the per-brick value ranges of a volume.
+*/
+
+#ifndef MAKE_VOLUME_MIN_MAX_GRID_H
+#define MAKE_VOLUME_MIN_MAX_GRID_H
+
+#include <volumedata/VolumeMinMaxGrid.h>
+
+#include <cstdint>
+
+namespace VolumeData
+{
+    class VolumeData;
+
+    /**
+    * Computes the value range of the first component for every brick of a volume.
+    *
+    * Bricks are processed in parallel. Each range includes the one-voxel apron around
+    * the brick, see VolumeMinMaxGrid. A sparse volume is not expanded: each row of bricks
+    * along x is processed as one task that expands the rows it covers one at a time with
+    * SparseVolumeData::CopyRow().
+    *
+    * @param volumeData The volume.
+    * @param brickSize Edge length of a brick in voxels.
+    * @return VolumeMinMaxGrid The value ranges, empty if the volume is invalid or brickSize is zero.
+    *
+    * @see VolumeMinMaxGrid for the grid layout.
+    * @see OccupancyGridUpdater for the use of the grid during rendering.
+    */
+    VolumeMinMaxGrid MakeVolumeMinMaxGrid(const VolumeData& volumeData, uint32_t brickSize);
+}
+
+#endif
@@ -0,0 +1,27 @@
+#include <volumedata/MakeVolumePyramid.h>
+#include <volumedata/DownsampleVolumeData.h>
+#include <volumedata/VolumeData.h>
+
+std::vector<VolumeData::VolumeData> VolumeData::MakeVolumePyramid(const VolumeData& volumeData)
+{
+    std::vector<VolumeData> levels;
+    if (!volumeData.IsValid())
+    {
+        return levels;
+    }
+
+    const auto IsSingleVoxel = [](const VolumeData& level)
+    {
+        const auto& metadata = level.GetMetadata();
+        return metadata.GetWidth() == 1 && metadata.GetHeight() == 1 && metadata.GetDepth() == 1;
+    };
+
+    const VolumeData* previousLevel = &volumeData;
+    while (!IsSingleVoxel(*previousLevel))
+    {
+        levels.push_back(DownsampleVolumeData(*previousLevel));
+        previousLevel = &levels.back();
+    }
+
+    return levels;
+}
@@ -0,0 +1,32 @@
+/**
+* \file MakeVolumePyramid.h
+*
+* \brief Function for building the downsampled levels of a volume.
+*/
+
+#ifndef MAKE_VOLUME_PYRAMID_H
+#define MAKE_VOLUME_PYRAMID_H
+
+#include <vector>
+
+namespace VolumeData
+{
+    class VolumeData;
+
+    /**
+    * Builds the chain of 2x2x2 downsampled levels of a volume.
+    *
+    * Each level is created from the previous one via DownsampleVolumeData(), down to a
+    * single voxel, matching the mip chain of a 3D texture. The source volume itself is
+    * level 0 and is not copied into the result.
+    *
+    * @param volumeData The full-resolution volume.
+    * @return std::vector<VolumeData> Levels 1 to N, from fine to coarse. Empty for invalid or single-voxel volumes.
+    *
+    * @see DownsampleVolumeData for the filter used per level.
+    * @see UploadVolumePyramid for uploading the levels as mip levels.
+    */
+    std::vector<VolumeData> MakeVolumePyramid(const VolumeData& volumeData);
+}
+
+#endif
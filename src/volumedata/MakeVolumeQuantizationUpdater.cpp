@@ -0,0 +1,15 @@
+#include <volumedata/MakeVolumeQuantizationUpdater.h>
+
+#include <storage/Storage.h>
+#include <textures/TextureId.h>
+
+VolumeData::VolumeQuantizationUpdater Factory::MakeVolumeQuantizationUpdater(Storage& storage)
+{
+    return VolumeData::VolumeQuantizationUpdater {
+        storage.GetGuiUpdateFlags(),
+        storage.GetGuiParameters(),
+        storage.GetVolumeData(),
+        storage.GetVolumeLoadingProgress(),
+        storage.GetTexture(TextureId::VolumeData)
+    };
+}
@@ -0,0 +1,27 @@
+/**
+* \file MakeVolumeQuantizationUpdater.h
+*
+* \brief Factory function for creating the volume quantization updater.
+*/
+
+#ifndef MAKE_VOLUME_QUANTIZATION_UPDATER_H
+#define MAKE_VOLUME_QUANTIZATION_UPDATER_H
+
+#include <volumedata/VolumeQuantizationUpdater.h>
+
+class Storage;
+
+namespace Factory
+{
+    /**
+    * Creates the volume quantization updater for the volume in Storage.
+    *
+    * @param storage Storage containing GUI update flags, GUI parameters, volume data, loading progress, and textures.
+    * @return Initialized VolumeQuantizationUpdater object.
+    *
+    * @see VolumeData::VolumeQuantizationUpdater for the update implementation.
+    */
+    VolumeData::VolumeQuantizationUpdater MakeVolumeQuantizationUpdater(Storage& storage);
+}
+
+#endif
@@ -0,0 +1,28 @@
+#include <volumedata/MakeVolumeTextureBudget.h>
+
+#include <storage/GetGpuMemoryUsageInBytes.h>
+#include <textures/GetGpuMemoryBudgetInBytes.h>
+#include <textures/QueryGpuMemoryInfo.h>
+#include <textures/TextureId.h>
+
+VolumeData::VolumeTextureBudget Factory::MakeVolumeTextureBudget(const TextureStorage& textureStorage, const FrameBufferStorage& frameBufferStorage)
+{
+    const auto gpuMemoryInfo = QueryGpuMemoryInfo();
+    const size_t usedMemoryInBytes = GetGpuMemoryUsageInBytes(textureStorage, frameBufferStorage);
+
+    auto budget = VolumeData::VolumeTextureBudget{};
+    if (gpuMemoryInfo.max3DTextureSize > 0)
+    {
+        budget.maxDimension = gpuMemoryInfo.max3DTextureSize;
+    }
+
+    const auto budgetInBytes = GetGpuMemoryBudgetInBytes(gpuMemoryInfo, usedMemoryInBytes);
+    if (budgetInBytes)
+    {
+        const size_t volumeSizeInBytes = textureStorage.GetElement(TextureId::VolumeData).GetSizeInBytes() + textureStorage.GetElement(TextureId::GradientVolume).GetSizeInBytes();
+        const size_t otherSizeInBytes = usedMemoryInBytes - volumeSizeInBytes;
+        budget.maxSizeInBytes = (budgetInBytes.value() > otherSizeInBytes) ? budgetInBytes.value() - otherSizeInBytes : 0;
+    }
+
+    return budget;
+}
@@ -0,0 +1,34 @@
+/**
+* \file MakeVolumeTextureBudget.h
+*
+* \brief Factory function for the texture budget of the volume in the current context.
+*/
+
+#ifndef MAKE_VOLUME_TEXTURE_BUDGET_H
+#define MAKE_VOLUME_TEXTURE_BUDGET_H
+
+#include <storage/StorageTypes.h>
+#include <volumedata/VolumeTextureBudget.h>
+
+namespace Factory
+{
+    /**
+    * Derives the budget the textures of the volume have to fit into.
+    *
+    * The largest dimension is GL_MAX_3D_TEXTURE_SIZE. The memory available to the volume is
+    * the budget from GetGpuMemoryBudgetInBytes() minus the memory of all textures and
+    * renderbuffers in Storage, except for the TextureId::VolumeData and TextureId::GradientVolume
+    * textures, which are replaced when the volume is uploaded. If no memory budget is known,
+    * only the texture size is limited. Requires a current OpenGL context.
+    *
+    * @param textureStorage The textures allocated so far.
+    * @param frameBufferStorage The framebuffers allocated so far.
+    * @return VolumeData::VolumeTextureBudget The budget of the volume.
+    *
+    * @see VolumeData::FitVolumeToTextureBudget for downsampling a volume into the budget.
+    * @see QueryGpuMemoryInfo for the queried limits.
+    */
+    VolumeData::VolumeTextureBudget MakeVolumeTextureBudget(const TextureStorage& textureStorage, const FrameBufferStorage& frameBufferStorage);
+}
+
+#endif
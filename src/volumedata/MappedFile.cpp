@@ -0,0 +1,216 @@
+#include <volumedata/MappedFile.h>
+
+#include <algorithm>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+VolumeData::MappedFile::MappedFile(const std::filesystem::path& filePath, MappedFileAccessPattern accessPattern)
+    : m_data{nullptr}
+    , m_sizeInBytes{0}
+    , m_fileHandle{nullptr}
+    , m_mappingHandle{nullptr}
+{
+    const DWORD accessFlags = (accessPattern == MappedFileAccessPattern::Random) ? FILE_FLAG_RANDOM_ACCESS
+        : (accessPattern == MappedFileAccessPattern::Sequential) ? FILE_FLAG_SEQUENTIAL_SCAN
+        : FILE_ATTRIBUTE_NORMAL;
+    const HANDLE fileHandle = CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, accessFlags, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        return;
+    }
+    m_fileHandle = fileHandle;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0)
+    {
+        Unmap();
+        return;
+    }
+
+    m_mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (m_mappingHandle == nullptr)
+    {
+        Unmap();
+        return;
+    }
+
+    const void* view = MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr)
+    {
+        Unmap();
+        return;
+    }
+
+    m_data = static_cast<const uint8_t*>(view);
+    m_sizeInBytes = static_cast<size_t>(fileSize.QuadPart);
+}
+
+void VolumeData::MappedFile::Unmap()
+{
+    if (m_data != nullptr)
+    {
+        UnmapViewOfFile(m_data);
+    }
+
+    if (m_mappingHandle != nullptr)
+    {
+        CloseHandle(m_mappingHandle);
+    }
+
+    if (m_fileHandle != nullptr)
+    {
+        CloseHandle(m_fileHandle);
+    }
+
+    m_data = nullptr;
+    m_sizeInBytes = 0;
+    m_fileHandle = nullptr;
+    m_mappingHandle = nullptr;
+}
+
+VolumeData::MappedFile::MappedFile(MappedFile&& other) noexcept
+    : m_data{std::exchange(other.m_data, nullptr)}
+    , m_sizeInBytes{std::exchange(other.m_sizeInBytes, 0)}
+    , m_fileHandle{std::exchange(other.m_fileHandle, nullptr)}
+    , m_mappingHandle{std::exchange(other.m_mappingHandle, nullptr)}
+{
+}
+
+VolumeData::MappedFile& VolumeData::MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        Unmap();
+        m_data = std::exchange(other.m_data, nullptr);
+        m_sizeInBytes = std::exchange(other.m_sizeInBytes, 0);
+        m_fileHandle = std::exchange(other.m_fileHandle, nullptr);
+        m_mappingHandle = std::exchange(other.m_mappingHandle, nullptr);
+    }
+    return *this;
+}
+
+void VolumeData::MappedFile::Prefetch(size_t offsetInBytes, size_t sizeInBytes) const
+{
+    if (m_data == nullptr || offsetInBytes >= m_sizeInBytes)
+    {
+        return;
+    }
+
+    WIN32_MEMORY_RANGE_ENTRY range;
+    range.VirtualAddress = const_cast<uint8_t*>(m_data + offsetInBytes);
+    range.NumberOfBytes = std::min(sizeInBytes, m_sizeInBytes - offsetInBytes);
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+}
+
+#else
+
+VolumeData::MappedFile::MappedFile(const std::filesystem::path& filePath, MappedFileAccessPattern accessPattern)
+    : m_data{nullptr}
+    , m_sizeInBytes{0}
+{
+    const int fileDescriptor = open(filePath.c_str(), O_RDONLY);
+    if (fileDescriptor < 0)
+    {
+        return;
+    }
+
+    struct stat fileStatus;
+    if (fstat(fileDescriptor, &fileStatus) != 0 || fileStatus.st_size == 0)
+    {
+        close(fileDescriptor);
+        return;
+    }
+
+    const size_t sizeInBytes = static_cast<size_t>(fileStatus.st_size);
+    void* mapping = mmap(nullptr, sizeInBytes, PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+
+    // The mapping keeps its own reference to the file
+    close(fileDescriptor);
+
+    if (mapping == MAP_FAILED)
+    {
+        return;
+    }
+
+    // Volumes are consumed front to back by the texture upload, so ask for aggressive
+    // read-ahead and start paging in right away. Streamed bricks are small and scattered,
+    // so read-ahead would only waste I/O and page cache there. On-demand mappings keep the
+    // default behavior. All hints are advisory only.
+    if (accessPattern == MappedFileAccessPattern::Random)
+    {
+        madvise(mapping, sizeInBytes, MADV_RANDOM);
+    }
+    else if (accessPattern == MappedFileAccessPattern::Sequential)
+    {
+        madvise(mapping, sizeInBytes, MADV_SEQUENTIAL);
+        madvise(mapping, sizeInBytes, MADV_WILLNEED);
+    }
+
+    m_data = static_cast<const uint8_t*>(mapping);
+    m_sizeInBytes = sizeInBytes;
+}
+
+void VolumeData::MappedFile::Unmap()
+{
+    if (m_data != nullptr)
+    {
+        munmap(const_cast<uint8_t*>(m_data), m_sizeInBytes);
+    }
+
+    m_data = nullptr;
+    m_sizeInBytes = 0;
+}
+
+VolumeData::MappedFile::MappedFile(MappedFile&& other) noexcept
+    : m_data{std::exchange(other.m_data, nullptr)}
+    , m_sizeInBytes{std::exchange(other.m_sizeInBytes, 0)}
+{
+}
+
+VolumeData::MappedFile& VolumeData::MappedFile::operator=(MappedFile&& other) noexcept
+{
+    if (this != &other)
+    {
+        Unmap();
+        m_data = std::exchange(other.m_data, nullptr);
+        m_sizeInBytes = std::exchange(other.m_sizeInBytes, 0);
+    }
+    return *this;
+}
+
+void VolumeData::MappedFile::Prefetch(size_t offsetInBytes, size_t sizeInBytes) const
+{
+    if (m_data == nullptr || offsetInBytes >= m_sizeInBytes)
+    {
+        return;
+    }
+
+    // madvise() needs a page-aligned start address, the mapping itself starts at a page boundary
+    const size_t pageSizeInBytes = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t alignedOffsetInBytes = offsetInBytes - offsetInBytes % pageSizeInBytes;
+    const size_t endInBytes = offsetInBytes + std::min(sizeInBytes, m_sizeInBytes - offsetInBytes);
+    madvise(const_cast<uint8_t*>(m_data + alignedOffsetInBytes), endInBytes - alignedOffsetInBytes, MADV_WILLNEED);
+}
+
+#endif
+
+VolumeData::MappedFile::~MappedFile()
+{
+    Unmap();
+}
@@ -0,0 +1,96 @@
+/**
+* \file MappedFile.h
+*
+* \brief Read-only memory mapping of a file.
+*/
+
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <volumedata/MappedFileAccessPattern.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+namespace VolumeData
+{
+    /**
+    * \class MappedFile
+    *
+    * \brief RAII wrapper for a read-only memory mapping of a whole file.
+    *
+    * Maps the file into the address space of the process so that its contents can be
+    * accessed without copying them into a heap buffer first. Pages are faulted in by the
+    * operating system on first access and can be dropped again under memory pressure,
+    * since they are backed by the file itself.
+    *
+    * On POSIX systems the mapping is created with mmap() and advised according to the
+    * MappedFileAccessPattern, with MADV_SEQUENTIAL and MADV_WILLNEED for the front-to-back
+    * access of a texture upload and MADV_RANDOM for scattered brick reads.
+    * On Windows, a file mapping object and a read-only view are used instead.
+    *
+    * Move-only type, as the mapping is an owned operating system resource.
+    *
+    * @see VolumeData for volumes backed by a mapped file.
+    * @see LoadVolumeRaw for creating mapped volumes via VolumeStorageMode::Mapped.
+    */
+    class MappedFile
+    {
+    public:
+        /**
+        * Constructor.
+        * Maps the whole file read-only. Check IsMapped() to see whether mapping succeeded.
+        * @param filePath Path to the file to map.
+        * @param accessPattern How the mapping is going to be read.
+        */
+        explicit MappedFile(const std::filesystem::path& filePath, MappedFileAccessPattern accessPattern = MappedFileAccessPattern::Sequential);
+
+        /**
+        * Destructor.
+        * Unmaps the file.
+        */
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        /**
+        * Checks whether the file was mapped successfully.
+        * @return bool True if the mapping is valid, false otherwise.
+        */
+        bool IsMapped() const { return m_data != nullptr; }
+
+        const uint8_t* GetDataPtr() const { return m_data; }
+        size_t GetSizeInBytes() const { return m_sizeInBytes; }
+        std::span<const uint8_t> GetData() const { return {m_data, m_sizeInBytes}; }
+
+        /**
+        * Asks the operating system to start paging in a byte range of the mapping.
+        * Returns right away, the reads complete in the background. Ranges outside of the
+        * mapping are clamped to it. Does nothing if the file is not mapped.
+        * @param offsetInBytes Start of the range in bytes.
+        * @param sizeInBytes Size of the range in bytes.
+        * @return void
+        */
+        void Prefetch(size_t offsetInBytes, size_t sizeInBytes) const;
+
+    private:
+        /**
+        * Releases the mapping and resets all handles.
+        */
+        void Unmap();
+
+        const uint8_t* m_data; /**< Start of the mapped view, or nullptr if not mapped. */
+        size_t m_sizeInBytes; /**< Size of the mapped view in bytes. */
+#ifdef _WIN32
+        void* m_fileHandle; /**< Windows file handle. */
+        void* m_mappingHandle; /**< Windows file mapping object handle. */
+#endif
+    };
+}
+
+#endif
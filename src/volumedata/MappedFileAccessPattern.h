@@ -0,0 +1,34 @@
+/**
+* \file MappedFileAccessPattern.h
+*
+* \brief Expected access patterns of memory-mapped files.
+*/
+
+#ifndef MAPPED_FILE_ACCESS_PATTERN_H
+#define MAPPED_FILE_ACCESS_PATTERN_H
+
+namespace VolumeData
+{
+    /**
+    * \enum MappedFileAccessPattern
+    *
+    * \brief Tells the operating system how a mapped file is going to be read.
+    *
+    * Sequential suits files that are consumed front to back, like a texture upload, and
+    * starts paging in the whole file right away. Random suits files of which only small,
+    * scattered parts are read, like the bricks streamed by the PagedVolumeStreamer, and
+    * disables read-ahead so that a brick read does not pull in megabytes around it.
+    * OnDemand suits files that stay mapped for occasional reads, like the released host
+    * copy of a volume, and leaves read-ahead at the default without paging in up front.
+    *
+    * @see MappedFile for the mapping these hints apply to.
+    */
+    enum class MappedFileAccessPattern
+    {
+        Sequential, /**< The file is read front to back, so aggressive read-ahead pays off. */
+        Random,     /**< Small parts of the file are read in no particular order. */
+        OnDemand    /**< The file is read rarely, so nothing is paged in before it is accessed. */
+    };
+}
+
+#endif
@@ -0,0 +1,125 @@
+#include <volumedata/OccupancyGridUpdater.h>
+#include <volumedata/ClassifyBricks.h>
+#include <volumedata/ComputeBrickStepMultipliers.h>
+#include <volumedata/ComputeChebyshevDistanceField.h>
+#include <volumedata/IsVolumeQuantized.h>
+#include <volumedata/LoadOrMakeVolumeMinMaxGrid.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeHandle.h>
+
+#include <config/Config.h>
+#include <gui/GuiParameters.h>
+#include <gui/GuiUpdateFlags.h>
+#include <textures/Texture.h>
+#include <textures/TextureId.h>
+
+#include <glad/glad.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+VolumeData::OccupancyGridUpdater::OccupancyGridUpdater(
+    const GuiUpdateFlags& guiUpdateFlags,
+    const GuiParameters& guiParameters,
+    const VolumeHandle& volumeData,
+    Texture& occupancyGridTexture
+)
+    : m_guiUpdateFlags{guiUpdateFlags}
+    , m_guiParameters{guiParameters}
+    , m_volumeData{volumeData}
+    , m_occupancyGridTexture{occupancyGridTexture}
+    , m_volumeMinMaxGrid{}
+    , m_classifiedDensityMultiplier{guiParameters.raycastingDensityMultiplier}
+    , m_classifiedVolumeWindow{guiParameters.volumeWindow}
+{
+    if (Config::enableEmptySpaceSkipping)
+    {
+        m_volumeMinMaxGrid = LoadOrMakeVolumeMinMaxGrid(*m_volumeData, Config::occupancyGridBrickSize);
+    }
+    UpdateTexture();
+}
+
+void VolumeData::OccupancyGridUpdater::Update()
+{
+    if (!Config::enableEmptySpaceSkipping)
+    {
+        return;
+    }
+
+    if (m_guiUpdateFlags.volumeDataChanged)
+    {
+        m_volumeMinMaxGrid = LoadOrMakeVolumeMinMaxGrid(*m_volumeData, Config::occupancyGridBrickSize);
+        UpdateTexture();
+    }
+    else if (m_guiUpdateFlags.timeStepChanged && m_volumeMinMaxGrid.GetNumBricks() > 0)
+    {
+        m_volumeMinMaxGrid = VolumeMinMaxGrid{};
+        UpdateTexture();
+    }
+    else if (m_guiUpdateFlags.transferFunctionChanged ||
+        m_guiParameters.raycastingDensityMultiplier != m_classifiedDensityMultiplier ||
+        m_guiParameters.volumeWindow != m_classifiedVolumeWindow)
+    {
+        UpdateTexture();
+    }
+}
+
+void VolumeData::OccupancyGridUpdater::UpdateTexture()
+{
+    m_classifiedDensityMultiplier = m_guiParameters.raycastingDensityMultiplier;
+    m_classifiedVolumeWindow = m_guiParameters.volumeWindow;
+
+    // Without a grid, a single occupied brick at distance zero, sampled at the Nyquist rate
+    auto texels = std::vector<uint8_t>{0, 1};
+    auto width = 1u;
+    auto height = 1u;
+    auto depth = 1u;
+
+    if (m_volumeMinMaxGrid.GetNumBricks() > 0)
+    {
+        auto grid = m_volumeMinMaxGrid;
+        if (IsVolumeQuantized(m_volumeData->GetMetadata()))
+        {
+            // The texture holds the values mapped through the window
+            std::ranges::transform(grid.minValues, grid.minValues.begin(), [this](float value) { return m_classifiedVolumeWindow.Apply(value); });
+            std::ranges::transform(grid.maxValues, grid.maxValues.begin(), [this](float value) { return m_classifiedVolumeWindow.Apply(value); });
+        }
+
+        width = grid.numBricksX;
+        height = grid.numBricksY;
+        depth = grid.numBricksZ;
+
+        const auto occupancy = ClassifyBricks(grid, m_guiParameters.transferFunction, m_classifiedDensityMultiplier);
+        const auto distanceField = ComputeChebyshevDistanceField(occupancy, width, height, depth);
+        const auto stepMultipliers = ComputeBrickStepMultipliers(grid, m_classifiedDensityMultiplier, Config::adaptiveSamplingMaxValueChangePerStep, Config::maxAdaptiveSamplingNyquistSteps);
+
+        texels.resize(2 * grid.GetNumBricks());
+        for (size_t brickIndex = 0; brickIndex < grid.GetNumBricks(); ++brickIndex)
+        {
+            texels[2 * brickIndex] = distanceField[brickIndex];
+            texels[2 * brickIndex + 1] = stepMultipliers[brickIndex];
+        }
+    }
+
+    // Rows of the grid are tightly packed bytes
+    GLint previousUnpackAlignment = 4;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &previousUnpackAlignment);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    m_occupancyGridTexture = Texture{
+        TextureId::OccupancyGrid,
+        m_occupancyGridTexture.GetTextureUnitEnum(),
+        width,
+        height,
+        depth,
+        GL_RG8UI,
+        GL_RG_INTEGER,
+        GL_UNSIGNED_BYTE,
+        GL_NEAREST,
+        GL_CLAMP_TO_EDGE,
+        texels.data()
+    };
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, previousUnpackAlignment);
+}
@@ -0,0 +1,90 @@
+/**
+* \file OccupancyGridUpdater.h
+*
+* \brief Keeps the occupancy grid texture used for empty-space skipping up to date.
+*/
+
+#ifndef OCCUPANCY_GRID_UPDATER_H
+#define OCCUPANCY_GRID_UPDATER_H
+
+#include <volumedata/VolumeMinMaxGrid.h>
+#include <volumedata/VolumeWindow.h>
+
+struct GuiParameters;
+struct GuiUpdateFlags;
+class Texture;
+
+namespace VolumeData
+{
+    class VolumeHandle;
+
+    /**
+    * \class OccupancyGridUpdater
+    *
+    * \brief Maintains a coarse 3D texture guiding the ray caster through the bricks of the volume.
+    *
+    * Holds the per-brick value ranges of the volume in Storage, recomputed whenever
+    * GuiUpdateFlags::volumeDataChanged is set. If only GuiUpdateFlags::timeStepChanged is
+    * set, the ranges are dropped, so that nothing is skipped in the steps of a playing time
+    * series, whose ranges are not computed. The ranges are classified against the
+    * transfer function whenever GuiUpdateFlags::transferFunctionChanged is set or the
+    * density multiplier or, for quantized volumes, the volume window changed, and uploaded
+    * as an RG8UI texture with one texel per brick. The red channel holds the Chebyshev
+    * distance field of the classified bricks: zero for visible bricks, otherwise the number
+    * of bricks to the nearest visible one. The ray caster leaps to the exit of the empty cube
+    * of bricks around a nonzero texel in a single step. The green channel holds the number of
+    * Nyquist steps a sample may span within the brick, for adaptive sampling.
+    *
+    * Must run before TransferFunctionTextureUpdater, which clears the transfer function flag.
+    * With Config::enableEmptySpaceSkipping unset, or while no volume is loaded, the texture
+    * is a single texel at distance zero sampled at the Nyquist rate, so nothing is skipped.
+    *
+    * @see MakeVolumeMinMaxGrid for the value ranges.
+    * @see ClassifyBricks for the classification.
+    * @see ComputeChebyshevDistanceField for the distances.
+    * @see ComputeBrickStepMultipliers for the step multipliers.
+    * @see Factory::MakeOccupancyGridUpdater for construction from Storage.
+    */
+    class OccupancyGridUpdater
+    {
+    public:
+        /**
+        * Constructor.
+        * Computes the grid for the current volume and uploads the initial texture.
+        * @param guiUpdateFlags Reference to GUI update flags for change detection.
+        * @param guiParameters Reference to GUI parameters holding the transfer function and density multiplier.
+        * @param volumeData Reference to the handle of the volume data in Storage.
+        * @param occupancyGridTexture Reference to the occupancy grid texture to update.
+        */
+        OccupancyGridUpdater(
+            const GuiUpdateFlags& guiUpdateFlags,
+            const GuiParameters& guiParameters,
+            const VolumeHandle& volumeData,
+            Texture& occupancyGridTexture
+        );
+
+        /**
+        * Recomputes the grid and reclassifies the bricks as needed.
+        * Should be called once per frame after the ProgressiveVolumeLoader and before rendering.
+        * @return void
+        */
+        void Update();
+
+    private:
+        /**
+        * Classifies the bricks and uploads their distance field and step multipliers.
+        */
+        void UpdateTexture();
+
+    private:
+        const GuiUpdateFlags& m_guiUpdateFlags; /**< Reference to GUI update flags. */
+        const GuiParameters& m_guiParameters; /**< Reference to GUI parameters. */
+        const VolumeHandle& m_volumeData; /**< Reference to the handle of the volume data in Storage. */
+        Texture& m_occupancyGridTexture; /**< Reference to the occupancy grid texture in Storage. */
+        VolumeMinMaxGrid m_volumeMinMaxGrid; /**< Per-brick value ranges of the current volume. */
+        float m_classifiedDensityMultiplier; /**< Density multiplier the current texture was classified with. */
+        VolumeWindow m_classifiedVolumeWindow; /**< Volume window the current texture was classified with. */
+    };
+}
+
+#endif
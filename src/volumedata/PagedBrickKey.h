@@ -0,0 +1,52 @@
+/**
+* \file PagedBrickKey.h
+*
+* \brief Packed identifiers of the bricks of a paged volume.
+*/
+
+#ifndef PAGED_BRICK_KEY_H
+#define PAGED_BRICK_KEY_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace VolumeData
+{
+    /**
+    * \namespace PagedBrickKey
+    *
+    * \brief Encodes a level of detail and a brick index into one 32-bit key.
+    *
+    * The level is stored in the upper numLevelBits bits and the linear brick index within
+    * the level in the remaining bits. Volume.frag computes the same encoding for the bricks
+    * it writes to the feedback buffer, so both sides must be kept in sync.
+    *
+    * @see PagedVolumeStreamer for decoding the feedback buffer.
+    * @see BrickAtlasAllocator for keying atlas slots.
+    */
+    namespace PagedBrickKey
+    {
+        constexpr uint32_t numLevelBits = 5;
+        constexpr uint32_t numBrickIndexBits = 32 - numLevelBits;
+        constexpr uint32_t maxNumLevels = 16; /**< Matches MAX_PAGED_LEVELS in Volume.frag. */
+        constexpr size_t maxNumBricksPerLevel = size_t{1} << numBrickIndexBits;
+        constexpr uint32_t none = 0xFFFFFFFFu; /**< Written to the feedback buffer by pixels that requested no brick. */
+
+        constexpr uint32_t Encode(uint32_t level, size_t brickIndex)
+        {
+            return (level << numBrickIndexBits) | static_cast<uint32_t>(brickIndex);
+        }
+
+        constexpr uint32_t GetLevel(uint32_t key)
+        {
+            return key >> numBrickIndexBits;
+        }
+
+        constexpr size_t GetBrickIndex(uint32_t key)
+        {
+            return key & ((uint32_t{1} << numBrickIndexBits) - 1);
+        }
+    }
+}
+
+#endif
@@ -0,0 +1,564 @@
+#include <volumedata/PagedVolumeStreamer.h>
+#include <volumedata/BrickedVolumeReader.h>
+#include <volumedata/ClassifyBricks.h>
+#include <volumedata/GetBrickExtent.h>
+#include <volumedata/GetBrickedVolumeLevelPath.h>
+#include <volumedata/GetNyquistStepSize.h>
+#include <volumedata/GetVolumeTextureFormat.h>
+#include <volumedata/PagedBrickKey.h>
+#include <volumedata/VolumeMinMaxGrid.h>
+
+#include <config/Config.h>
+#include <context/PostEmptyEvent.h>
+#include <gui/GuiParameters.h>
+#include <gui/GuiUpdateFlags.h>
+#include <shader/Shader.h>
+#include <textures/Texture.h>
+#include <textures/TextureId.h>
+
+#include <glad/glad.h>
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+
+namespace Constants
+{
+    constexpr size_t numFeedbackBuffers = 2;
+    constexpr uint32_t maxNumSlotsPerAxis = 256; /**< Slot coordinates are stored in 8-bit page table channels. */
+    constexpr uint64_t numProtectedFrames = 4; /**< Covers the feedback latency and the alternation of missing and used keys. */
+    constexpr uint8_t missingBrick = 0;
+    constexpr uint8_t residentBrick = 1;
+    constexpr uint8_t emptyBrick = 2;
+}
+
+namespace
+{
+    size_t GetNumBricks(const VolumeData::BrickedVolumeHeader& header)
+    {
+        return static_cast<size_t>(header.numBricksX) * header.numBricksY * header.numBricksZ;
+    }
+
+    size_t GetLevelSizeInBytes(const VolumeData::BrickedVolumeHeader& header)
+    {
+        return static_cast<size_t>(header.width) * header.height * header.depth * header.components * (header.bitsPerComponent / 8);
+    }
+
+    bool IsCompatibleLevel(const VolumeData::BrickedVolumeHeader& levelZeroHeader, const VolumeData::BrickedVolumeHeader& header)
+    {
+        return header.brickSize == levelZeroHeader.brickSize &&
+            header.components == levelZeroHeader.components &&
+            header.bitsPerComponent == levelZeroHeader.bitsPerComponent &&
+            header.numBricksX <= levelZeroHeader.numBricksX &&
+            header.numBricksY <= levelZeroHeader.numBricksY &&
+            GetNumBricks(header) <= VolumeData::PagedBrickKey::maxNumBricksPerLevel;
+    }
+
+    /// Largest number of slots per axis whose cube of bricks fits into the budget
+    uint32_t GetNumSlotsPerAxis(size_t brickSizeInBytes, size_t budgetInBytes)
+    {
+        uint32_t numSlotsPerAxis = 0;
+        while (numSlotsPerAxis < Constants::maxNumSlotsPerAxis)
+        {
+            const size_t next = numSlotsPerAxis + 1;
+            if (next * next * next * brickSizeInBytes > budgetInBytes)
+            {
+                break;
+            }
+            ++numSlotsPerAxis;
+        }
+        return numSlotsPerAxis;
+    }
+} // anonymous namespace
+
+VolumeData::PagedVolumeStreamer::PagedVolumeStreamer(
+    const std::filesystem::path& levelZeroPath,
+    GuiUpdateFlags& guiUpdateFlags,
+    const GuiParameters& guiParameters,
+    Texture& brickAtlasTexture,
+    Texture& pageTableTexture,
+    const Texture& feedbackTexture,
+    const Shader& volumeShader,
+    VolumeLoadingProgress& volumeLoadingProgress
+)
+    : m_guiUpdateFlags{guiUpdateFlags}
+    , m_guiParameters{guiParameters}
+    , m_brickAtlasTexture{brickAtlasTexture}
+    , m_pageTableTexture{pageTableTexture}
+    , m_feedbackTexture{feedbackTexture}
+    , m_volumeShader{volumeShader}
+    , m_volumeLoadingProgress{volumeLoadingProgress}
+    , m_isActive{false}
+    , m_metadata{}
+    , m_levelHeaders{}
+    , m_brickCaches{}
+    , m_levelOffsets{}
+    , m_brickOccupancy{}
+    , m_brickSize{0}
+    , m_numSlotsPerAxis{0}
+    , m_allocator{}
+    , m_isCoarsestLevelPinned{false}
+    , m_pageTable{}
+    , m_feedbackBuffers{}
+    , m_feedbackCounts{}
+    , m_frame{0}
+    , m_classifiedDensityMultiplier{guiParameters.raycastingDensityMultiplier}
+    , m_mutex{}
+    , m_requestCondition{}
+    , m_requestedKeys{}
+    , m_pendingKeys{}
+    , m_completedBricks{}
+    , m_workerThreads{}
+{
+    if (levelZeroPath.empty())
+    {
+        return;
+    }
+
+    if (const auto error = Start(levelZeroPath))
+    {
+        m_volumeLoadingProgress.error = error;
+        return;
+    }
+
+    m_isActive = true;
+    for (unsigned int i = 0; i < std::max(Config::numPagedVolumeStreamingThreads, 1u); ++i)
+    {
+        m_workerThreads.emplace_back([this](std::stop_token stopToken) { Stream(stopToken); });
+    }
+}
+
+void VolumeData::PagedVolumeStreamer::Update(bool isSceneRendered)
+{
+    if (!m_isActive)
+    {
+        return;
+    }
+
+    if (isSceneRendered)
+    {
+        m_allocator->NextFrame();
+    }
+
+    if (m_guiUpdateFlags.transferFunctionChanged || m_guiParameters.raycastingDensityMultiplier != m_classifiedDensityMultiplier)
+    {
+        ReclassifyBricks();
+    }
+
+    // The feedback texture still holds the feedback of the last frame that rendered the scene
+    if (isSceneRendered)
+    {
+        ReadFeedback();
+        RequestBricks();
+    }
+
+    UploadCompletedBricks();
+
+    if (isSceneRendered)
+    {
+        m_volumeShader.Use();
+        m_volumeShader.SetInt("feedbackFrameIndex", static_cast<int>(m_frame & 0xFFFF));
+        ++m_frame;
+    }
+}
+
+std::optional<VolumeData::VolumeLoadingError> VolumeData::PagedVolumeStreamer::Start(const std::filesystem::path& levelZeroPath)
+{
+    auto readers = std::vector<BrickedVolumeReader>{};
+    for (uint32_t level = 0; level < PagedBrickKey::maxNumLevels; ++level)
+    {
+        const auto levelPath = GetBrickedVolumeLevelPath(levelZeroPath, level);
+        if (level > 0 && !std::filesystem::exists(levelPath))
+        {
+            break;
+        }
+
+        // Streamed bricks are scattered across the file, so read-ahead would only waste I/O
+        auto readerResult = OpenBrickedVolume(levelPath, MappedFileAccessPattern::Random);
+        if (!readerResult)
+        {
+            return readerResult.error();
+        }
+
+        if (!readers.empty() && !IsCompatibleLevel(readers.front().GetHeader(), readerResult->GetHeader()))
+        {
+            return VolumeLoadingError::InvalidBrickedFileHeader;
+        }
+        readers.push_back(std::move(readerResult).value());
+    }
+
+    // Level 0 itself must not have more bricks than a key can address
+    const auto levelZeroHeader = readers.front().GetHeader();
+    if (!IsCompatibleLevel(levelZeroHeader, levelZeroHeader))
+    {
+        return VolumeLoadingError::InvalidBrickedFileHeader;
+    }
+
+    m_metadata = readers.front().GetMetadata();
+    m_brickSize = levelZeroHeader.brickSize;
+
+    GLint maxTextureSize3D = 0;
+    glGetIntegerv(GL_MAX_3D_TEXTURE_SIZE, &maxTextureSize3D);
+    const auto maxTextureSize = static_cast<uint32_t>(std::max(maxTextureSize3D, 1));
+
+    // Levels are stacked along z in the page table
+    uint32_t pageTableDepth = 0;
+    size_t totalSizeInBytes = 0;
+    for (const auto& reader : readers)
+    {
+        m_levelOffsets.push_back(pageTableDepth);
+        pageTableDepth += reader.GetHeader().numBricksZ;
+        totalSizeInBytes += GetLevelSizeInBytes(reader.GetHeader());
+    }
+
+    if (levelZeroHeader.numBricksX > maxTextureSize || levelZeroHeader.numBricksY > maxTextureSize || pageTableDepth > maxTextureSize)
+    {
+        return VolumeLoadingError::InvalidBrickedFileHeader;
+    }
+
+    const size_t brickSizeInBytes = static_cast<size_t>(m_brickSize) * m_brickSize * m_brickSize * m_metadata.GetBytesPerVoxel();
+    m_numSlotsPerAxis = std::min(GetNumSlotsPerAxis(brickSizeInBytes, Config::pagedVolumeAtlasSizeInBytes), maxTextureSize / m_brickSize);
+    if (m_numSlotsPerAxis == 0)
+    {
+        return VolumeLoadingError::InvalidBrickedFileHeader;
+    }
+
+    const uint32_t numSlots = m_numSlotsPerAxis * m_numSlotsPerAxis * m_numSlotsPerAxis;
+    m_allocator.emplace(numSlots, Constants::numProtectedFrames);
+    m_isCoarsestLevelPinned = GetNumBricks(readers.back().GetHeader()) <= numSlots / 2;
+
+    // Each level gets a share of the host cache proportional to its size
+    for (auto& reader : readers)
+    {
+        const auto levelShare = static_cast<double>(GetLevelSizeInBytes(reader.GetHeader())) / static_cast<double>(std::max(totalSizeInBytes, size_t{1}));
+        const auto capacityInBytes = static_cast<size_t>(levelShare * static_cast<double>(Config::pagedVolumeHostCacheSizeInBytes));
+        m_levelHeaders.push_back(reader.GetHeader());
+        m_brickOccupancy.emplace_back(GetNumBricks(reader.GetHeader()), uint8_t{255});
+        m_brickCaches.push_back(std::make_unique<BrickCache>(std::move(reader), capacityInBytes));
+    }
+
+    const auto textureFormat = GetVolumeTextureFormat(m_metadata);
+    const uint32_t atlasSize = m_numSlotsPerAxis * m_brickSize;
+    m_brickAtlasTexture = Texture{TextureId::BrickAtlas, m_brickAtlasTexture.GetTextureUnitEnum(), atlasSize, atlasSize, atlasSize, textureFormat.internalFormat, textureFormat.format, textureFormat.type, GL_LINEAR, GL_CLAMP_TO_EDGE, nullptr};
+
+    m_pageTable.assign(static_cast<size_t>(levelZeroHeader.numBricksX) * levelZeroHeader.numBricksY * pageTableDepth * 4, 0);
+    m_pageTableTexture = Texture{TextureId::PageTable, m_pageTableTexture.GetTextureUnitEnum(), levelZeroHeader.numBricksX, levelZeroHeader.numBricksY, pageTableDepth, GL_RGBA8UI, GL_RGBA_INTEGER, GL_UNSIGNED_BYTE, GL_NEAREST, GL_CLAMP_TO_EDGE, nullptr};
+    ReclassifyBricks();
+
+    const size_t feedbackSizeInBytes = static_cast<size_t>(Config::pagedVolumeFeedbackWidth) * Config::pagedVolumeFeedbackHeight * sizeof(uint32_t);
+    for (size_t i = 0; i < Constants::numFeedbackBuffers; ++i)
+    {
+        m_feedbackBuffers.emplace_back(feedbackSizeInBytes);
+    }
+
+    m_volumeShader.Use();
+    m_volumeShader.SetInt("numPagedLevels", static_cast<int>(m_levelHeaders.size()));
+    m_volumeShader.SetFloat("pagedBrickSize", static_cast<float>(m_brickSize));
+    m_volumeShader.SetFloat("pagedAtlasNumSlots", static_cast<float>(m_numSlotsPerAxis));
+    m_volumeShader.SetFloat("nyquistStepSize", GetNyquistStepSize(m_metadata));
+    for (size_t level = 0; level < m_levelHeaders.size(); ++level)
+    {
+        const auto& header = m_levelHeaders[level];
+        const auto index = "[" + std::to_string(level) + "]";
+        m_volumeShader.SetVec3("pagedLevelSizes" + index, glm::vec3{header.width, header.height, header.depth});
+        m_volumeShader.SetVec3("pagedLevelNumBricks" + index, glm::vec3{header.numBricksX, header.numBricksY, header.numBricksZ});
+        m_volumeShader.SetInt("pagedLevelOffsets" + index, static_cast<int>(m_levelOffsets[level]));
+    }
+
+    return std::nullopt;
+}
+
+void VolumeData::PagedVolumeStreamer::ReclassifyBricks()
+{
+    m_classifiedDensityMultiplier = m_guiParameters.raycastingDensityMultiplier;
+
+    // The brick index stores raw values, the shader sees them normalized
+    const auto normalization = 1.0f / static_cast<float>((uint64_t{1} << m_metadata.GetBitsPerComponent()) - 1);
+
+    for (size_t level = 0; level < m_levelHeaders.size(); ++level)
+    {
+        const auto& header = m_levelHeaders[level];
+        const auto& reader = m_brickCaches[level]->GetReader();
+
+        auto grid = VolumeMinMaxGrid{header.brickSize, header.numBricksX, header.numBricksY, header.numBricksZ, {}, {}};
+        grid.minValues.resize(reader.GetNumBricks());
+        grid.maxValues.resize(reader.GetNumBricks());
+        for (size_t brickIndex = 0; brickIndex < reader.GetNumBricks(); ++brickIndex)
+        {
+            const auto& entry = reader.GetBrickIndexEntry(brickIndex);
+            grid.minValues[brickIndex] = static_cast<float>(entry.minValue) * normalization;
+            grid.maxValues[brickIndex] = static_cast<float>(entry.maxValue) * normalization;
+        }
+
+        m_brickOccupancy[level] = ClassifyBricks(grid, m_guiParameters.transferFunction, m_classifiedDensityMultiplier);
+
+        for (size_t brickIndex = 0; brickIndex < reader.GetNumBricks(); ++brickIndex)
+        {
+            WritePageTableEntry(PagedBrickKey::Encode(static_cast<uint32_t>(level), brickIndex));
+        }
+    }
+
+    GLint previousUnpackAlignment = 4;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &previousUnpackAlignment);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    const auto& levelZeroHeader = m_levelHeaders.front();
+    const auto pageTableDepth = static_cast<unsigned int>(m_pageTable.size() / 4 / levelZeroHeader.numBricksX / levelZeroHeader.numBricksY);
+    m_pageTableTexture.SetSubImage3D(0, 0, 0, levelZeroHeader.numBricksX, levelZeroHeader.numBricksY, pageTableDepth, GL_RGBA_INTEGER, GL_UNSIGNED_BYTE, m_pageTable.data());
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, previousUnpackAlignment);
+}
+
+void VolumeData::PagedVolumeStreamer::ReadFeedback()
+{
+    // Queue the copy of the latest feedback, which completes on the GPU while this frame renders
+    auto& writtenBuffer = m_feedbackBuffers[m_frame % Constants::numFeedbackBuffers];
+    writtenBuffer.Bind();
+    m_feedbackTexture.Bind();
+    glGetTexImage(GL_TEXTURE_2D, 0, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+
+    m_feedbackCounts.clear();
+
+    // The buffer written in the previous frame holds the feedback of two frames ago.
+    // The copy queued in the very first frame was taken before any feedback was rendered.
+    if (m_frame >= Constants::numFeedbackBuffers)
+    {
+        auto& readBuffer = m_feedbackBuffers[(m_frame + 1) % Constants::numFeedbackBuffers];
+        if (const auto* keys = static_cast<const uint32_t*>(readBuffer.Map()))
+        {
+            const size_t numKeys = readBuffer.GetSizeInBytes() / sizeof(uint32_t);
+            for (size_t i = 0; i < numKeys; ++i)
+            {
+                if (keys[i] != PagedBrickKey::none)
+                {
+                    ++m_feedbackCounts[keys[i]];
+                }
+            }
+        }
+        readBuffer.Unmap();
+    }
+
+    writtenBuffer.Unbind();
+}
+
+void VolumeData::PagedVolumeStreamer::RequestBricks()
+{
+    auto missingBricks = std::vector<std::pair<uint32_t, uint32_t>>{};
+    for (const auto& [key, numPixels] : m_feedbackCounts)
+    {
+        if (!IsValidKey(key))
+        {
+            continue;
+        }
+
+        if (m_allocator->Find(key))
+        {
+            m_allocator->Touch(key);
+            continue;
+        }
+
+        // The feedback may predate a transfer function change that emptied the brick
+        if (m_brickOccupancy[PagedBrickKey::GetLevel(key)][PagedBrickKey::GetBrickIndex(key)] != 0)
+        {
+            missingBricks.emplace_back(key, numPixels);
+        }
+    }
+
+    // Coarser levels first, as they cover more of the view, then by the number of requesting pixels
+    std::ranges::sort(missingBricks, [](const auto& lhs, const auto& rhs)
+    {
+        const auto lhsLevel = PagedBrickKey::GetLevel(lhs.first);
+        const auto rhsLevel = PagedBrickKey::GetLevel(rhs.first);
+        return (lhsLevel != rhsLevel) ? lhsLevel > rhsLevel : lhs.second > rhs.second;
+    });
+
+    {
+        std::lock_guard lock{m_mutex};
+        m_requestedKeys.clear();
+
+        const auto IsRequestable = [this](uint32_t key)
+        {
+            return m_requestedKeys.size() < Config::maxPendingPagedBrickRequests && !m_allocator->Find(key) && !m_pendingKeys.contains(key);
+        };
+
+        const auto coarsestLevel = static_cast<uint32_t>(m_levelHeaders.size() - 1);
+        const auto numCoarsestBricks = GetNumBricks(m_levelHeaders.back());
+        if (m_isCoarsestLevelPinned && m_allocator->GetNumPinnedBricks() < numCoarsestBricks)
+        {
+            for (size_t brickIndex = 0; brickIndex < numCoarsestBricks; ++brickIndex)
+            {
+                const auto key = PagedBrickKey::Encode(coarsestLevel, brickIndex);
+                if (IsRequestable(key))
+                {
+                    m_requestedKeys.push_back(key);
+                }
+            }
+        }
+
+        for (const auto& [key, numPixels] : missingBricks)
+        {
+            if (IsRequestable(key))
+            {
+                m_requestedKeys.push_back(key);
+            }
+        }
+    }
+
+    m_requestCondition.notify_all();
+}
+
+void VolumeData::PagedVolumeStreamer::UploadCompletedBricks()
+{
+    auto completedBricks = std::vector<CompletedBrick>{};
+    {
+        std::lock_guard lock{m_mutex};
+        const size_t numBricks = std::min<size_t>(m_completedBricks.size(), Config::maxPagedBrickUploadsPerFrame);
+        for (size_t i = 0; i < numBricks; ++i)
+        {
+            m_pendingKeys.erase(m_completedBricks.front().key);
+            completedBricks.push_back(std::move(m_completedBricks.front()));
+            m_completedBricks.pop_front();
+        }
+    }
+
+    if (completedBricks.empty())
+    {
+        return;
+    }
+
+    const auto textureFormat = GetVolumeTextureFormat(m_metadata);
+    const auto coarsestLevel = static_cast<uint32_t>(m_levelHeaders.size() - 1);
+
+    // Rows of clipped bricks are tightly packed and may have any length
+    GLint previousUnpackAlignment = 4;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &previousUnpackAlignment);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    bool isAnyBrickUploaded = false;
+    for (const auto& [key, brick] : completedBricks)
+    {
+        if (!brick)
+        {
+            m_volumeLoadingProgress.error = VolumeLoadingError::ReadError;
+            continue;
+        }
+
+        if (m_allocator->Find(key))
+        {
+            continue;
+        }
+
+        const auto level = PagedBrickKey::GetLevel(key);
+        const auto allocation = m_allocator->Allocate(key, m_isCoarsestLevelPinned && level == coarsestLevel);
+
+        // Every slot holds a brick in view, the shader keeps falling back to a coarser level
+        if (!allocation)
+        {
+            continue;
+        }
+
+        if (allocation->evictedKey)
+        {
+            UpdatePageTableEntry(*allocation->evictedKey);
+        }
+
+        const auto extent = GetBrickExtent(m_levelHeaders[level], PagedBrickKey::GetBrickIndex(key));
+        const uint32_t slotX = allocation->slot % m_numSlotsPerAxis;
+        const uint32_t slotY = (allocation->slot / m_numSlotsPerAxis) % m_numSlotsPerAxis;
+        const uint32_t slotZ = allocation->slot / (m_numSlotsPerAxis * m_numSlotsPerAxis);
+        m_brickAtlasTexture.SetSubImage3D(slotX * m_brickSize, slotY * m_brickSize, slotZ * m_brickSize, extent.width, extent.height, extent.depth, textureFormat.format, textureFormat.type, brick->data());
+
+        UpdatePageTableEntry(key);
+        isAnyBrickUploaded = true;
+    }
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, previousUnpackAlignment);
+
+    // Without new bricks the image would not change, and redrawing would request the same bricks again
+    if (isAnyBrickUploaded)
+    {
+        m_guiUpdateFlags.redrawRequested = true;
+    }
+}
+
+void VolumeData::PagedVolumeStreamer::WritePageTableEntry(uint32_t key)
+{
+    auto* entry = m_pageTable.data() + GetPageTableEntryIndex(key) * 4;
+    const auto slot = m_allocator->Find(key);
+
+    if (slot)
+    {
+        entry[0] = static_cast<uint8_t>(*slot % m_numSlotsPerAxis);
+        entry[1] = static_cast<uint8_t>((*slot / m_numSlotsPerAxis) % m_numSlotsPerAxis);
+        entry[2] = static_cast<uint8_t>(*slot / (m_numSlotsPerAxis * m_numSlotsPerAxis));
+    }
+
+    // Empty bricks keep their slot, so they need no reload if the transfer function changes back
+    if (m_brickOccupancy[PagedBrickKey::GetLevel(key)][PagedBrickKey::GetBrickIndex(key)] == 0)
+    {
+        entry[3] = Constants::emptyBrick;
+    }
+    else
+    {
+        entry[3] = slot ? Constants::residentBrick : Constants::missingBrick;
+    }
+}
+
+void VolumeData::PagedVolumeStreamer::UpdatePageTableEntry(uint32_t key)
+{
+    WritePageTableEntry(key);
+
+    const auto& header = m_levelHeaders[PagedBrickKey::GetLevel(key)];
+    const size_t brickIndex = PagedBrickKey::GetBrickIndex(key);
+    const auto x = static_cast<unsigned int>(brickIndex % header.numBricksX);
+    const auto y = static_cast<unsigned int>((brickIndex / header.numBricksX) % header.numBricksY);
+    const auto z = static_cast<unsigned int>(brickIndex / (static_cast<size_t>(header.numBricksX) * header.numBricksY));
+    m_pageTableTexture.SetSubImage3D(x, y, m_levelOffsets[PagedBrickKey::GetLevel(key)] + z, 1, 1, 1, GL_RGBA_INTEGER, GL_UNSIGNED_BYTE, m_pageTable.data() + GetPageTableEntryIndex(key) * 4);
+}
+
+size_t VolumeData::PagedVolumeStreamer::GetPageTableEntryIndex(uint32_t key) const
+{
+    const auto level = PagedBrickKey::GetLevel(key);
+    const auto& header = m_levelHeaders[level];
+    const auto& levelZeroHeader = m_levelHeaders.front();
+    const size_t brickIndex = PagedBrickKey::GetBrickIndex(key);
+    const size_t x = brickIndex % header.numBricksX;
+    const size_t y = (brickIndex / header.numBricksX) % header.numBricksY;
+    const size_t z = brickIndex / (static_cast<size_t>(header.numBricksX) * header.numBricksY);
+    return ((m_levelOffsets[level] + z) * levelZeroHeader.numBricksY + y) * levelZeroHeader.numBricksX + x;
+}
+
+bool VolumeData::PagedVolumeStreamer::IsValidKey(uint32_t key) const
+{
+    const auto level = PagedBrickKey::GetLevel(key);
+    return level < m_levelHeaders.size() && PagedBrickKey::GetBrickIndex(key) < GetNumBricks(m_levelHeaders[level]);
+}
+
+void VolumeData::PagedVolumeStreamer::Stream(std::stop_token stopToken)
+{
+    while (true)
+    {
+        uint32_t key = PagedBrickKey::none;
+
+        {
+            std::unique_lock lock{m_mutex};
+            if (!m_requestCondition.wait(lock, stopToken, [this] { return !m_requestedKeys.empty(); }))
+            {
+                return;
+            }
+
+            key = m_requestedKeys.front();
+            m_requestedKeys.pop_front();
+            m_pendingKeys.insert(key);
+        }
+
+        auto brick = m_brickCaches[PagedBrickKey::GetLevel(key)]->GetBrick(PagedBrickKey::GetBrickIndex(key));
+
+        {
+            std::lock_guard lock{m_mutex};
+            m_completedBricks.push_back(CompletedBrick{key, std::move(brick)});
+        }
+        Context::PostEmptyEvent();
+    }
+}
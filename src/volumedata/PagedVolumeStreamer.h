@@ -0,0 +1,215 @@
+/**
+* \file PagedVolumeStreamer.h
+*
+* \brief Streams the bricks requested by the ray caster into a fixed-size brick atlas.
+*/
+
+#ifndef PAGED_VOLUME_STREAMER_H
+#define PAGED_VOLUME_STREAMER_H
+
+#include <volumedata/BrickAtlasAllocator.h>
+#include <volumedata/BrickCache.h>
+#include <volumedata/BrickedVolumeHeader.h>
+#include <volumedata/VolumeLoadingError.h>
+#include <volumedata/VolumeLoadingProgress.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <buffers/PixelPackBuffer.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+struct GuiParameters;
+struct GuiUpdateFlags;
+class Shader;
+class Texture;
+
+namespace VolumeData
+{
+    /**
+    * \class PagedVolumeStreamer
+    *
+    * \brief Virtual-texture style out-of-core rendering of multi-level bricked volumes.
+    *
+    * The volume is read from a level-0 bricked volume file and its coarser levels, as
+    * written by VolumeBrickConverter and named by GetBrickedVolumeLevelPath(). All levels
+    * must share the brick size and voxel format. No level is ever loaded as a whole.
+    *
+    * On the GPU, resident bricks live in slots of the TextureId::BrickAtlas 3D texture,
+    * whose size is bounded by Config::pagedVolumeAtlasSizeInBytes. The TextureId::PageTable
+    * texture holds one RGBA8UI entry per brick of every level, with the levels stacked
+    * along z: rgb is the atlas slot and alpha is 0 for bricks that are not resident,
+    * 1 for resident bricks, and 2 for bricks the transfer function maps to zero opacity.
+    * Volume.frag picks a level per sample from its screen-space footprint, resolves it
+    * through the page table, and falls back to coarser resident levels where a brick is
+    * missing.
+    *
+    * During the PagedVolumeFeedback render pass, Volume.frag writes one brick key per pixel
+    * into the low-resolution TextureId::PagedVolumeFeedback texture: alternately the first
+    * missing brick along the ray and a brick it used, so that bricks in view stay recent.
+    * Update() reads the feedback back through two pixel pack buffers, two frames late so
+    * that it never waits for the GPU, marks the used bricks as recently used, and queues
+    * the missing ones for the worker threads, coarser levels and larger screen coverage
+    * first. The workers read bricks through one BrickCache per level, which together are
+    * bounded by Config::pagedVolumeHostCacheSizeInBytes. At most
+    * Config::maxPagedBrickUploadsPerFrame finished bricks are uploaded per frame, into
+    * slots chosen by a BrickAtlasAllocator. The coarsest level is pinned in the atlas if
+    * it fits into half of it, so that every ray has something to fall back to.
+    *
+    * Bricks are classified against the transfer function from the value ranges stored in
+    * the brick index whenever GuiUpdateFlags::transferFunctionChanged is set or the density
+    * multiplier changed, so empty bricks are skipped by the ray caster and never read.
+    *
+    * Does nothing unless Config::volumeLoadingMode is VolumeLoadingMode::Paged. Errors are
+    * reported through VolumeLoadingProgress::error. The worker threads are stopped and
+    * joined on destruction.
+    *
+    * @see PagedBrickKey for the keys in the feedback buffer.
+    * @see BrickAtlasAllocator for the eviction policy.
+    * @see BrickCache for the host-side brick cache.
+    * @see Factory::MakePagedVolumeStreamer for construction from Storage.
+    */
+    class PagedVolumeStreamer
+    {
+    public:
+        /**
+        * Constructor.
+        * Opens all levels, allocates the atlas and page table and starts the worker threads
+        * if levelZeroPath is not empty.
+        * @param levelZeroPath Path to the full-resolution bricked volume file, or an empty path to disable streaming.
+        * @param guiUpdateFlags Reference to GUI update flags for change detection and for requesting a redraw after uploads.
+        * @param guiParameters Reference to GUI parameters holding the transfer function and density multiplier.
+        * @param brickAtlasTexture Reference to the brick atlas texture in Storage to replace.
+        * @param pageTableTexture Reference to the page table texture in Storage to replace.
+        * @param feedbackTexture Reference to the feedback texture in Storage to read back.
+        * @param volumeShader Reference to the volume shader receiving the level layout.
+        * @param volumeLoadingProgress Reference to the loading progress in Storage for reporting errors.
+        */
+        PagedVolumeStreamer(
+            const std::filesystem::path& levelZeroPath,
+            GuiUpdateFlags& guiUpdateFlags,
+            const GuiParameters& guiParameters,
+            Texture& brickAtlasTexture,
+            Texture& pageTableTexture,
+            const Texture& feedbackTexture,
+            const Shader& volumeShader,
+            VolumeLoadingProgress& volumeLoadingProgress
+        );
+
+        PagedVolumeStreamer(const PagedVolumeStreamer&) = delete;
+        PagedVolumeStreamer& operator=(const PagedVolumeStreamer&) = delete;
+        PagedVolumeStreamer(PagedVolumeStreamer&&) = delete;
+        PagedVolumeStreamer& operator=(PagedVolumeStreamer&&) = delete;
+
+        /**
+        * Processes the feedback, uploads finished bricks and queues missing ones.
+        * Should be called once per frame before rendering and before the TransferFunctionTextureUpdater.
+        * The feedback is only read back in frames that render the scene, since it does not change otherwise.
+        * @param isSceneRendered Whether the scene, including the feedback pass, is rendered in this frame.
+        * @return void
+        */
+        void Update(bool isSceneRendered);
+
+    private:
+        /**
+        * A brick read by a worker thread and waiting for upload.
+        */
+        struct CompletedBrick
+        {
+            uint32_t key; /**< Key of the brick. */
+            BrickCache::Brick brick; /**< Voxels of the brick, nullptr if it could not be read. */
+        };
+
+        /**
+        * Opens the levels and creates the GPU resources, returning the first error that occurred.
+        */
+        std::optional<VolumeLoadingError> Start(const std::filesystem::path& levelZeroPath);
+
+        /**
+        * Classifies all bricks against the transfer function and uploads the whole page table.
+        */
+        void ReclassifyBricks();
+
+        /**
+        * Copies the feedback texture into a pack buffer and counts the keys of an older one.
+        */
+        void ReadFeedback();
+
+        /**
+        * Uploads finished bricks into the atlas and updates their page table entries.
+        */
+        void UploadCompletedBricks();
+
+        /**
+        * Replaces the queue of the worker threads with the missing bricks of the latest feedback.
+        */
+        void RequestBricks();
+
+        /**
+        * Writes the page table entry of a brick into the host mirror.
+        */
+        void WritePageTableEntry(uint32_t key);
+
+        /**
+        * Writes the page table entry of a brick into the host mirror and the texture.
+        */
+        void UpdatePageTableEntry(uint32_t key);
+
+        /**
+        * Gets the index of a brick's entry in the host mirror of the page table.
+        */
+        size_t GetPageTableEntryIndex(uint32_t key) const;
+
+        /**
+        * Checks whether a key from the feedback buffer names an existing brick.
+        */
+        bool IsValidKey(uint32_t key) const;
+
+        /**
+        * Worker thread entry point.
+        */
+        void Stream(std::stop_token stopToken);
+
+    private:
+        GuiUpdateFlags& m_guiUpdateFlags; /**< Reference to GUI update flags. */
+        const GuiParameters& m_guiParameters; /**< Reference to GUI parameters. */
+        Texture& m_brickAtlasTexture; /**< Reference to the brick atlas texture in Storage. */
+        Texture& m_pageTableTexture; /**< Reference to the page table texture in Storage. */
+        const Texture& m_feedbackTexture; /**< Reference to the feedback texture in Storage. */
+        const Shader& m_volumeShader; /**< Reference to the volume shader. */
+        VolumeLoadingProgress& m_volumeLoadingProgress; /**< Reference to the loading progress in Storage. */
+        bool m_isActive; /**< True if all levels were opened and the GPU resources created. */
+        VolumeMetadata m_metadata; /**< Metadata of level 0, shared by all levels except for the dimensions. */
+        std::vector<BrickedVolumeHeader> m_levelHeaders; /**< Header of each level, finest first. */
+        std::vector<std::unique_ptr<BrickCache>> m_brickCaches; /**< Host-side brick cache of each level, read by the worker threads. */
+        std::vector<uint32_t> m_levelOffsets; /**< First page table slice of each level. */
+        std::vector<std::vector<uint8_t>> m_brickOccupancy; /**< Classification of each brick of each level, 0 if empty, as returned by ClassifyBricks(). */
+        uint32_t m_brickSize; /**< Edge length of a brick in voxels, shared by all levels. */
+        uint32_t m_numSlotsPerAxis; /**< Number of atlas slots along each axis. */
+        std::optional<BrickAtlasAllocator> m_allocator; /**< Assignment of bricks to atlas slots. */
+        bool m_isCoarsestLevelPinned; /**< True if the coarsest level is kept resident permanently. */
+        std::vector<uint8_t> m_pageTable; /**< Host mirror of the page table texture. */
+        std::vector<PixelPackBuffer> m_feedbackBuffers; /**< Pack buffers receiving the feedback texture, used round robin. */
+        std::unordered_map<uint32_t, uint32_t> m_feedbackCounts; /**< Number of pixels requesting each brick in the latest feedback. */
+        uint64_t m_frame; /**< Number of calls to Update() in frames that rendered the scene so far. */
+        float m_classifiedDensityMultiplier; /**< Density multiplier the bricks were classified with. */
+        std::mutex m_mutex; /**< Guards the members shared with the worker threads below. */
+        std::condition_variable_any m_requestCondition; /**< Signaled when the request queue is replaced. */
+        std::deque<uint32_t> m_requestedKeys; /**< Bricks to read, most important first. */
+        std::unordered_set<uint32_t> m_pendingKeys; /**< Bricks being read or waiting for upload. */
+        std::deque<CompletedBrick> m_completedBricks; /**< Read bricks waiting for upload, in completion order. */
+        std::vector<std::jthread> m_workerThreads; /**< Background reading threads, declared last so they start after all other members. */
+    };
+}
+
+#endif
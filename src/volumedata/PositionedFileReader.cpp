@@ -0,0 +1,254 @@
+#include <volumedata/PositionedFileReader.h>
+
+#include <algorithm>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#include <windows.h>
+#else
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+namespace Constants
+{
+    constexpr size_t maxReadSizeInBytes = 1u << 30;
+}
+
+VolumeData::PositionedFileReader::PositionedFileReader(const std::filesystem::path& filePath, FileCachingMode cachingMode)
+    : m_fileHandle{nullptr}
+    , m_sizeInBytes{0}
+    , m_cachingMode{cachingMode}
+{
+    const DWORD cachingFlags = (cachingMode == FileCachingMode::Uncached) ? FILE_FLAG_NO_BUFFERING : 0;
+    const HANDLE fileHandle = CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_RANDOM_ACCESS | cachingFlags, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE)
+    {
+        return;
+    }
+    m_fileHandle = fileHandle;
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(fileHandle, &fileSize))
+    {
+        Close();
+        return;
+    }
+    m_sizeInBytes = static_cast<size_t>(fileSize.QuadPart);
+}
+
+bool VolumeData::PositionedFileReader::IsOpen() const
+{
+    return m_fileHandle != nullptr;
+}
+
+std::optional<size_t> VolumeData::PositionedFileReader::ReadUpTo(uint64_t offset, std::span<uint8_t> destination) const
+{
+    if (!IsOpen())
+    {
+        return std::nullopt;
+    }
+
+    size_t totalNumBytesRead = 0;
+    while (totalNumBytesRead < destination.size())
+    {
+        OVERLAPPED overlapped{};
+        overlapped.Offset = static_cast<DWORD>(offset);
+        overlapped.OffsetHigh = static_cast<DWORD>(offset >> 32);
+
+        const auto readSize = static_cast<DWORD>(std::min(destination.size() - totalNumBytesRead, Constants::maxReadSizeInBytes));
+        DWORD numBytesRead = 0;
+        if (!ReadFile(m_fileHandle, destination.data() + totalNumBytesRead, readSize, &numBytesRead, &overlapped))
+        {
+            return (GetLastError() == ERROR_HANDLE_EOF) ? std::optional{totalNumBytesRead} : std::nullopt;
+        }
+        if (numBytesRead == 0)
+        {
+            break;
+        }
+
+        offset += numBytesRead;
+        totalNumBytesRead += numBytesRead;
+    }
+
+    return totalNumBytesRead;
+}
+
+void VolumeData::PositionedFileReader::Close()
+{
+    if (m_fileHandle != nullptr)
+    {
+        CloseHandle(m_fileHandle);
+    }
+
+    m_fileHandle = nullptr;
+    m_sizeInBytes = 0;
+}
+
+VolumeData::PositionedFileReader::PositionedFileReader(PositionedFileReader&& other) noexcept
+    : m_fileHandle{std::exchange(other.m_fileHandle, nullptr)}
+    , m_sizeInBytes{std::exchange(other.m_sizeInBytes, 0)}
+    , m_cachingMode{other.m_cachingMode}
+{
+}
+
+VolumeData::PositionedFileReader& VolumeData::PositionedFileReader::operator=(PositionedFileReader&& other) noexcept
+{
+    if (this != &other)
+    {
+        Close();
+        m_fileHandle = std::exchange(other.m_fileHandle, nullptr);
+        m_sizeInBytes = std::exchange(other.m_sizeInBytes, 0);
+        m_cachingMode = other.m_cachingMode;
+    }
+    return *this;
+}
+
+#else
+
+VolumeData::PositionedFileReader::PositionedFileReader(const std::filesystem::path& filePath, FileCachingMode cachingMode)
+    : m_fileDescriptor{-1}
+    , m_sizeInBytes{0}
+    , m_cachingMode{cachingMode}
+{
+    int fileDescriptor = -1;
+#ifdef O_DIRECT
+    if (cachingMode == FileCachingMode::Uncached)
+    {
+        // File systems without direct I/O, like tmpfs, reject O_DIRECT with EINVAL
+        fileDescriptor = open(filePath.c_str(), O_RDONLY | O_DIRECT);
+        if (fileDescriptor < 0 && errno == EINVAL)
+        {
+            m_cachingMode = FileCachingMode::Cached;
+        }
+    }
+    else
+#endif
+    {
+        m_cachingMode = FileCachingMode::Cached;
+    }
+
+    if (fileDescriptor < 0)
+    {
+        fileDescriptor = open(filePath.c_str(), O_RDONLY);
+    }
+    if (fileDescriptor < 0)
+    {
+        return;
+    }
+    m_fileDescriptor = fileDescriptor;
+
+#if defined(F_NOCACHE)
+    if (cachingMode == FileCachingMode::Uncached && fcntl(fileDescriptor, F_NOCACHE, 1) == 0)
+    {
+        m_cachingMode = FileCachingMode::Uncached;
+    }
+#endif
+
+    struct stat fileStatus;
+    if (fstat(fileDescriptor, &fileStatus) != 0)
+    {
+        Close();
+        return;
+    }
+    m_sizeInBytes = static_cast<size_t>(fileStatus.st_size);
+
+    // Only parts of the file are read, so read-ahead beyond each request would be wasted
+#ifdef POSIX_FADV_RANDOM
+    posix_fadvise(fileDescriptor, 0, 0, POSIX_FADV_RANDOM);
+#endif
+}
+
+bool VolumeData::PositionedFileReader::IsOpen() const
+{
+    return m_fileDescriptor >= 0;
+}
+
+std::optional<size_t> VolumeData::PositionedFileReader::ReadUpTo(uint64_t offset, std::span<uint8_t> destination) const
+{
+    if (!IsOpen())
+    {
+        return std::nullopt;
+    }
+
+    // pread may return fewer bytes than requested, for example when interrupted by a signal
+    size_t totalNumBytesRead = 0;
+    while (totalNumBytesRead < destination.size())
+    {
+        const ssize_t numBytesRead = pread(m_fileDescriptor, destination.data() + totalNumBytesRead, destination.size() - totalNumBytesRead, static_cast<off_t>(offset));
+        if (numBytesRead < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        if (numBytesRead < 0)
+        {
+            return std::nullopt;
+        }
+        if (numBytesRead == 0)
+        {
+            break;
+        }
+
+        offset += static_cast<uint64_t>(numBytesRead);
+        totalNumBytesRead += static_cast<size_t>(numBytesRead);
+    }
+
+    return totalNumBytesRead;
+}
+
+void VolumeData::PositionedFileReader::Close()
+{
+    if (m_fileDescriptor >= 0)
+    {
+        close(m_fileDescriptor);
+    }
+
+    m_fileDescriptor = -1;
+    m_sizeInBytes = 0;
+}
+
+VolumeData::PositionedFileReader::PositionedFileReader(PositionedFileReader&& other) noexcept
+    : m_fileDescriptor{std::exchange(other.m_fileDescriptor, -1)}
+    , m_sizeInBytes{std::exchange(other.m_sizeInBytes, 0)}
+    , m_cachingMode{other.m_cachingMode}
+{
+}
+
+VolumeData::PositionedFileReader& VolumeData::PositionedFileReader::operator=(PositionedFileReader&& other) noexcept
+{
+    if (this != &other)
+    {
+        Close();
+        m_fileDescriptor = std::exchange(other.m_fileDescriptor, -1);
+        m_sizeInBytes = std::exchange(other.m_sizeInBytes, 0);
+        m_cachingMode = other.m_cachingMode;
+    }
+    return *this;
+}
+
+#endif
+
+VolumeData::PositionedFileReader::~PositionedFileReader()
+{
+    Close();
+}
+
+bool VolumeData::PositionedFileReader::Read(uint64_t offset, std::span<uint8_t> destination) const
+{
+    if (!IsOpen() || offset + destination.size() > m_sizeInBytes)
+    {
+        return false;
+    }
+
+    return ReadUpTo(offset, destination) == destination.size();
+}
@@ -0,0 +1,111 @@
+/**
+* \file PositionedFileReader.h
+*
+* \brief Read-only file supporting concurrent reads at explicit offsets.
+*/
+
+#ifndef POSITIONED_FILE_READER_H
+#define POSITIONED_FILE_READER_H
+
+#include <volumedata/FileCachingMode.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <optional>
+#include <span>
+
+namespace VolumeData
+{
+    /**
+    * \class PositionedFileReader
+    *
+    * \brief RAII wrapper for a read-only file handle read with positioned reads.
+    *
+    * Each read names its own file offset, so reads do not share a file position and any
+    * number of threads can read from the same reader concurrently. Used to read the parts
+    * of a file that are actually needed, where mapping or streaming the whole file would
+    * touch far more data.
+    *
+    * On POSIX systems reads use pread(). On Windows, ReadFile() is called with the offset
+    * in an OVERLAPPED structure on a synchronous handle.
+    *
+    * With FileCachingMode::Uncached, the file is opened for direct I/O. Offsets, sizes and
+    * buffer addresses of all reads must then be multiples of uncachedAlignmentInBytes. If
+    * the file system does not support direct I/O, the file is opened for cached reads
+    * instead, which GetCachingMode() reports.
+    *
+    * Move-only type, as the file handle is an owned operating system resource.
+    *
+    * @see LoadVolumeRaw for loading a region of a .raw file.
+    * @see ReadFileInParallel for reading a whole file.
+    */
+    class PositionedFileReader
+    {
+    public:
+        static constexpr size_t uncachedAlignmentInBytes = 4096; /**< Logical block size of common NVMe drives, a multiple of all smaller block sizes. */
+
+        /**
+        * Constructor.
+        * Opens the file for reading. Check IsOpen() to see whether opening succeeded.
+        * @param filePath Path to the file to open.
+        * @param cachingMode Whether reads go through the operating system file cache.
+        */
+        explicit PositionedFileReader(const std::filesystem::path& filePath, FileCachingMode cachingMode = FileCachingMode::Cached);
+
+        /**
+        * Destructor.
+        * Closes the file.
+        */
+        ~PositionedFileReader();
+
+        PositionedFileReader(const PositionedFileReader&) = delete;
+        PositionedFileReader& operator=(const PositionedFileReader&) = delete;
+        PositionedFileReader(PositionedFileReader&& other) noexcept;
+        PositionedFileReader& operator=(PositionedFileReader&& other) noexcept;
+
+        /**
+        * Checks whether the file was opened successfully.
+        * @return bool True if the file can be read, false otherwise.
+        */
+        bool IsOpen() const;
+
+        size_t GetSizeInBytes() const { return m_sizeInBytes; }
+        FileCachingMode GetCachingMode() const { return m_cachingMode; }
+
+        /**
+        * Reads a range of the file, retrying until the range is complete.
+        * Safe to call from several threads at once.
+        * @param offset Offset of the first byte to read.
+        * @param destination Buffer receiving destination.size() bytes.
+        * @return bool True if the whole range was read, false on errors or if it extends past the end of the file.
+        */
+        bool Read(uint64_t offset, std::span<uint8_t> destination) const;
+
+        /**
+        * Reads a range of the file that may extend past the end of the file, which direct
+        * I/O needs for the last, partial block of a file.
+        * Safe to call from several threads at once.
+        * @param offset Offset of the first byte to read.
+        * @param destination Buffer receiving up to destination.size() bytes.
+        * @return std::optional<size_t> The number of bytes read, less than destination.size() only at the end of the file, or std::nullopt on errors.
+        */
+        std::optional<size_t> ReadUpTo(uint64_t offset, std::span<uint8_t> destination) const;
+
+    private:
+        /**
+        * Closes the file and resets the handle.
+        */
+        void Close();
+
+#ifdef _WIN32
+        void* m_fileHandle; /**< Windows file handle, or nullptr if not open. */
+#else
+        int m_fileDescriptor; /**< POSIX file descriptor, or -1 if not open. */
+#endif
+        size_t m_sizeInBytes; /**< Size of the file in bytes. */
+        FileCachingMode m_cachingMode; /**< Whether the file was opened for cached or direct reads. */
+    };
+}
+
+#endif
@@ -0,0 +1,327 @@
+#include <volumedata/ProgressiveVolumeLoader.h>
+#include <volumedata/ComputeVolumeContentHash.h>
+#include <volumedata/ConvertVolumeDataToSparse.h>
+#include <volumedata/FitVolumeToTextureBudget.h>
+#include <volumedata/GetVolumeDownsamplingFactor.h>
+#include <volumedata/GetVolumeTextureFormat.h>
+#include <volumedata/IsVolumeQuantized.h>
+#include <volumedata/LoadOrMakeVolumePyramid.h>
+#include <volumedata/LoadVolume.h>
+#include <volumedata/ReleaseVolumeHostCopy.h>
+#include <volumedata/SubsampleVolumeData.h>
+#include <volumedata/UploadVolumePyramid.h>
+
+#include <config/Config.h>
+#include <context/PostEmptyEvent.h>
+#include <gui/GuiUpdateFlags.h>
+#include <textures/Texture.h>
+#include <textures/TextureId.h>
+
+#include <glad/glad.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace Constants
+{
+    constexpr size_t prefetchChunkSizeInBytes = 64 * 1024 * 1024;
+}
+
+namespace
+{
+    /// Relative cost of a level, proportional to the number of voxels it reads
+    float GetLevelWeight(uint32_t stride)
+    {
+        return 1.0f / static_cast<float>(stride * stride * stride);
+    }
+
+    float GetTotalWeight()
+    {
+        float totalWeight = GetLevelWeight(1);
+        for (const auto stride : Config::progressiveLoadingStrides)
+        {
+            totalWeight += GetLevelWeight(stride);
+        }
+        return totalWeight;
+    }
+}
+
+VolumeData::ProgressiveVolumeLoader::ProgressiveVolumeLoader(
+    const std::filesystem::path& rawFilePath,
+    GuiUpdateFlags& guiUpdateFlags,
+    VolumeHandle& volumeData,
+    Texture& volumeDataTexture,
+    VolumeLoadingProgress& volumeLoadingProgress,
+    const VolumeTextureBudget& volumeTextureBudget
+)
+    : m_guiUpdateFlags{guiUpdateFlags}
+    , m_volumeData{volumeData}
+    , m_volumeDataTexture{volumeDataTexture}
+    , m_volumeLoadingProgress{volumeLoadingProgress}
+    , m_volumeTextureBudget{volumeTextureBudget}
+    , m_mutex{}
+    , m_pendingVolumeData{}
+    , m_pendingPyramidLevels{}
+    , m_pendingStride{0}
+    , m_uploadingVolumeData{}
+    , m_uploadingPyramidLevels{}
+    , m_uploadingStride{0}
+    , m_uploadingTexture{}
+    , m_numUploadedSlices{0}
+    , m_workerProgress{}
+    , m_workerThread{}
+{
+    if (m_volumeData->IsValid())
+    {
+        // A blocking load reports the factor it downsampled the volume by to fit the budget
+        const auto displayedStride = std::max(m_volumeLoadingProgress.displayedStride, 1u);
+        m_volumeLoadingProgress = VolumeLoadingProgress{.isLoading = false, .fraction = 1.0f, .displayedStride = displayedStride, .error = std::nullopt};
+        return;
+    }
+
+    // Paged volumes are never loaded as a whole, the PagedVolumeStreamer reports their progress
+    if (rawFilePath.empty())
+    {
+        return;
+    }
+
+    m_workerProgress.isLoading = true;
+    m_volumeLoadingProgress = m_workerProgress;
+    m_workerThread = std::jthread{[this](std::stop_token stopToken, std::filesystem::path path) { Load(stopToken, std::move(path)); }, rawFilePath};
+}
+
+void VolumeData::ProgressiveVolumeLoader::Update()
+{
+    // A published level is visible to the other updaters for exactly one frame
+    m_guiUpdateFlags.volumeDataChanged = false;
+
+    // Without a worker there is nothing to publish, and the progress belongs to whoever set it
+    if (!m_workerThread.joinable())
+    {
+        return;
+    }
+
+    std::optional<VolumeData> pendingVolumeData;
+    std::vector<VolumeData> pendingPyramidLevels;
+    uint32_t pendingStride = 0;
+    {
+        std::lock_guard lock{m_mutex};
+        pendingVolumeData = std::exchange(m_pendingVolumeData, std::nullopt);
+        pendingPyramidLevels = std::exchange(m_pendingPyramidLevels, {});
+        pendingStride = m_pendingStride;
+        m_volumeLoadingProgress.fraction = m_workerProgress.fraction;
+        m_volumeLoadingProgress.error = m_workerProgress.error;
+        m_volumeLoadingProgress.isLoading = m_workerProgress.isLoading;
+    }
+
+    if (pendingVolumeData)
+    {
+        // Quantized volumes are uploaded by the VolumeQuantizationUpdater instead
+        if (IsVolumeQuantized(pendingVolumeData->GetMetadata()))
+        {
+            PublishToStorage(std::move(pendingVolumeData).value(), pendingStride);
+        }
+        else
+        {
+            // A finer level supersedes the one still being uploaded
+            BeginUpload(std::move(pendingVolumeData).value(), std::move(pendingPyramidLevels), pendingStride);
+        }
+    }
+
+    if (m_uploadingTexture && UploadNextSlab())
+    {
+        UploadVolumePyramid(*m_uploadingTexture, m_uploadingPyramidLevels);
+        m_volumeDataTexture = std::move(m_uploadingTexture).value();
+        m_uploadingTexture.reset();
+        m_uploadingPyramidLevels.clear();
+        PublishToStorage(std::move(m_uploadingVolumeData).value(), m_uploadingStride);
+        m_uploadingVolumeData.reset();
+    }
+
+    // The last level is still loading until its texture is complete
+    m_volumeLoadingProgress.isLoading = m_volumeLoadingProgress.isLoading || m_uploadingTexture.has_value();
+}
+
+void VolumeData::ProgressiveVolumeLoader::BeginUpload(VolumeData&& volumeData, std::vector<VolumeData>&& pyramidLevels, uint32_t stride)
+{
+    const auto& metadata = volumeData.GetMetadata();
+    const auto textureFormat = GetVolumeTextureFormat(metadata);
+    m_uploadingTexture.emplace(
+        TextureId::VolumeData,
+        m_volumeDataTexture.GetTextureUnitEnum(),
+        metadata.GetWidth(),
+        metadata.GetHeight(),
+        metadata.GetDepth(),
+        textureFormat.internalFormat,
+        textureFormat.format,
+        textureFormat.type,
+        GL_LINEAR,
+        GL_CLAMP_TO_EDGE,
+        nullptr
+    );
+    m_uploadingVolumeData = std::move(volumeData);
+    m_uploadingPyramidLevels = std::move(pyramidLevels);
+    m_uploadingStride = stride;
+    m_numUploadedSlices = 0;
+}
+
+bool VolumeData::ProgressiveVolumeLoader::UploadNextSlab()
+{
+    const auto& metadata = m_uploadingVolumeData->GetMetadata();
+    const auto width = metadata.GetWidth();
+    const auto height = metadata.GetHeight();
+    const auto depth = metadata.GetDepth();
+    const size_t sliceSizeInBytes = static_cast<size_t>(width) * height * metadata.GetBytesPerVoxel();
+    const auto slicesPerSlab = static_cast<unsigned int>(std::clamp<size_t>(Config::volumeUploadSlabSizeInBytes / sliceSizeInBytes, 1, depth));
+    const auto numSlices = std::min(slicesPerSlab, depth - m_numUploadedSlices);
+    const auto textureFormat = GetVolumeTextureFormat(metadata);
+
+    GLint previousUnpackAlignment;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &previousUnpackAlignment);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    // A sparse volume is expanded one slab at a time rather than through its dense view
+    const auto& volumeData = std::as_const(*m_uploadingVolumeData);
+    std::vector<uint8_t> sparseSlab;
+    const uint8_t* slabData = nullptr;
+    if (volumeData.IsSparse())
+    {
+        sparseSlab.resize(numSlices * sliceSizeInBytes);
+        volumeData.CopySlices(m_numUploadedSlices, numSlices, std::span{sparseSlab});
+        slabData = sparseSlab.data();
+    }
+    else
+    {
+        slabData = volumeData.GetDataPtr() + static_cast<size_t>(m_numUploadedSlices) * sliceSizeInBytes;
+    }
+    m_uploadingTexture->SetSubImage3D(0, 0, m_numUploadedSlices, width, height, numSlices, textureFormat.format, textureFormat.type, slabData);
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, previousUnpackAlignment);
+
+    m_numUploadedSlices += numSlices;
+    return m_numUploadedSlices == depth;
+}
+
+void VolumeData::ProgressiveVolumeLoader::PublishToStorage(VolumeData&& volumeData, uint32_t stride)
+{
+    m_volumeData = VolumeHandle{std::move(volumeData)};
+    m_volumeLoadingProgress.displayedStride = stride;
+    m_guiUpdateFlags.volumeDataChanged = true;
+}
+
+void VolumeData::ProgressiveVolumeLoader::Load(std::stop_token stopToken, std::filesystem::path rawFilePath)
+{
+    // Mapping only reads the metadata; voxels are paged in as the levels below touch them.
+    // Bricked files and regions of a volume are read in full here, the levels below then read from memory.
+    auto volumeLoadingResult = LoadVolume(rawFilePath, VolumeStorageMode::Mapped, Config::volumeRegion);
+    if (!volumeLoadingResult)
+    {
+        Fail(volumeLoadingResult.error());
+        return;
+    }
+    auto volumeData = std::move(volumeLoadingResult).value();
+
+    // Proxies finer than the resolution that fits the budget would not fit either
+    const uint32_t downsamplingFactor = GetVolumeDownsamplingFactor(volumeData.GetMetadata(), m_volumeTextureBudget);
+
+    const float totalWeight = GetTotalWeight();
+    float doneWeight = 0.0f;
+
+    for (const auto stride : Config::progressiveLoadingStrides)
+    {
+        if (stopToken.stop_requested())
+        {
+            return;
+        }
+
+        doneWeight += GetLevelWeight(stride);
+        if (stride < downsamplingFactor)
+        {
+            continue;
+        }
+
+        auto proxyVolumeData = SubsampleVolumeData(volumeData, stride);
+        Publish(std::move(proxyVolumeData), stride, doneWeight / totalWeight);
+    }
+
+    // Start paging in the whole file here, so that the slabs uploaded on the main thread are read ahead of time
+    const size_t sizeInBytes = volumeData.GetSizeInBytes();
+    for (size_t chunkBegin = 0; chunkBegin < sizeInBytes; chunkBegin += Constants::prefetchChunkSizeInBytes)
+    {
+        if (stopToken.stop_requested())
+        {
+            return;
+        }
+
+        const size_t chunkEnd = std::min(chunkBegin + Constants::prefetchChunkSizeInBytes, sizeInBytes);
+        volumeData.Prefetch(chunkBegin, chunkEnd - chunkBegin);
+
+        std::lock_guard lock{m_mutex};
+        m_workerProgress.fraction = (doneWeight + GetLevelWeight(1) * static_cast<float>(chunkEnd) / static_cast<float>(sizeInBytes)) / totalWeight;
+    }
+
+    if (downsamplingFactor > 1)
+    {
+        volumeData = FitVolumeToTextureBudget(std::move(volumeData), m_volumeTextureBudget);
+    }
+
+    // Converted after the prefetch above, so that the conversion reads the mapping from the file cache
+    if (Config::volumeStorageMode == VolumeStorageMode::Sparse && Config::volumeResidencyPolicy == VolumeResidencyPolicy::KeepResident)
+    {
+        volumeData = ConvertVolumeDataToSparse(std::move(volumeData));
+    }
+    else if (downsamplingFactor == 1 && Config::volumeStorageMode != VolumeStorageMode::Mapped && Config::volumeResidencyPolicy == VolumeResidencyPolicy::KeepResident)
+    {
+        volumeData.Materialize();
+    }
+
+    // Only the final level is hashed, so that its derived data can be taken from the cache
+    if (Config::enableDerivedDataCache || Config::volumeResidencyPolicy == VolumeResidencyPolicy::ReleaseAfterUpload)
+    {
+        volumeData.SetContentHash(ComputeVolumeContentHash(volumeData));
+    }
+
+    // Released here rather than after the upload on the main thread, since a spill file may have to be written.
+    // The mapping holds the same bytes, which are still in the file cache when the main thread uploads them.
+    if (Config::volumeResidencyPolicy == VolumeResidencyPolicy::ReleaseAfterUpload)
+    {
+        volumeData = ReleaseVolumeHostCopy(std::move(volumeData), Config::derivedDataCachePath);
+    }
+
+    Publish(std::move(volumeData), downsamplingFactor, 1.0f);
+
+    {
+        std::lock_guard lock{m_mutex};
+        m_workerProgress.isLoading = false;
+    }
+    Context::PostEmptyEvent();
+}
+
+void VolumeData::ProgressiveVolumeLoader::Publish(VolumeData&& volumeData, uint32_t stride, float fraction)
+{
+    // Downsampling runs here, so that the main thread only uploads the finished levels
+    const bool isPyramidNeeded = Config::generateVolumePyramid && !IsVolumeQuantized(volumeData.GetMetadata());
+    auto pyramidLevels = isPyramidNeeded ? LoadOrMakeVolumePyramid(volumeData) : std::vector<VolumeData>{};
+
+    {
+        std::lock_guard lock{m_mutex};
+        m_pendingVolumeData = std::move(volumeData);
+        m_pendingPyramidLevels = std::move(pyramidLevels);
+        m_pendingStride = stride;
+        m_workerProgress.fraction = fraction;
+    }
+    Context::PostEmptyEvent();
+}
+
+void VolumeData::ProgressiveVolumeLoader::Fail(VolumeLoadingError error)
+{
+    {
+        std::lock_guard lock{m_mutex};
+        m_workerProgress.isLoading = false;
+        m_workerProgress.error = error;
+    }
+    Context::PostEmptyEvent();
+}
@@ -0,0 +1,146 @@
+/**
+* \file ProgressiveVolumeLoader.h
+*
+* \brief Loads the dataset in the background while displaying coarse proxies.
+*/
+
+#ifndef PROGRESSIVE_VOLUME_LOADER_H
+#define PROGRESSIVE_VOLUME_LOADER_H
+
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeHandle.h>
+#include <volumedata/VolumeLoadingError.h>
+#include <volumedata/VolumeLoadingProgress.h>
+#include <volumedata/VolumeTextureBudget.h>
+
+#include <textures/Texture.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+struct GuiUpdateFlags;
+
+namespace VolumeData
+{
+    /**
+    * \class ProgressiveVolumeLoader
+    *
+    * \brief Loads a volume on a background thread and publishes it coarse-to-fine.
+    *
+    * If the volume in Storage is empty at construction, a worker thread maps the .raw
+    * file and produces proxies subsampled with each stride in Config::progressiveLoadingStrides,
+    * from coarse to fine. Each proxy only reads the voxels it keeps, so the first one is
+    * available after a small fraction of the file has been read. Finally the worker asks
+    * the operating system to page in the whole file and publishes the full-resolution volume.
+    *
+    * If the textures of the full-resolution volume exceed the VolumeTextureBudget, the final
+    * level is downsampled by the factor chosen by GetVolumeDownsamplingFactor() and proxies
+    * finer than that factor are skipped, so no published level exceeds the budget.
+    *
+    * Update() runs on the main thread once per frame. It uploads the latest published level
+    * into a new TextureId::VolumeData texture, one slab of about Config::volumeUploadSlabSizeInBytes
+    * per frame, so that no frame stalls on the upload of a whole volume. Once all slabs and
+    * the mip levels the worker downsampled, if Config::generateVolumePyramid is set, are
+    * uploaded, it moves the level and its texture into Storage and sets
+    * GuiUpdateFlags::volumeDataChanged for the rest of the frame. Until then the previous
+    * level stays on screen. Errors are reported via
+    * VolumeLoadingProgress instead of terminating the application.
+    *
+    * The worker thread is stopped and joined on destruction.
+    *
+    * @see SubsampleVolumeData for the proxy generation.
+    * @see VolumeLoadingProgress for the progress shown in the GUI.
+    * @see VolumeLoadingMode for selecting progressive loading.
+    * @see Factory::MakeProgressiveVolumeLoader for construction from Storage.
+    */
+    class ProgressiveVolumeLoader
+    {
+    public:
+        /**
+        * Constructor.
+        * Starts the worker thread if volumeData does not hold a valid volume and rawFilePath is not empty.
+        * @param rawFilePath Path to the .raw or bricked volume file to load, or an empty path if the volume is paged.
+        * @param guiUpdateFlags Reference to GUI update flags for signaling volume changes.
+        * @param volumeData Reference to the handle of the volume data in Storage to replace.
+        * @param volumeDataTexture Reference to the volume data texture in Storage to replace.
+        * @param volumeLoadingProgress Reference to the loading progress in Storage to update.
+        * @param volumeTextureBudget The budget the textures of the published levels have to fit into.
+        */
+        ProgressiveVolumeLoader(
+            const std::filesystem::path& rawFilePath,
+            GuiUpdateFlags& guiUpdateFlags,
+            VolumeHandle& volumeData,
+            Texture& volumeDataTexture,
+            VolumeLoadingProgress& volumeLoadingProgress,
+            const VolumeTextureBudget& volumeTextureBudget
+        );
+
+        ProgressiveVolumeLoader(const ProgressiveVolumeLoader&) = delete;
+        ProgressiveVolumeLoader& operator=(const ProgressiveVolumeLoader&) = delete;
+        ProgressiveVolumeLoader(ProgressiveVolumeLoader&&) = delete;
+        ProgressiveVolumeLoader& operator=(ProgressiveVolumeLoader&&) = delete;
+
+        /**
+        * Publishes the latest finished level, if any, and refreshes the loading progress.
+        * Should be called once per frame before any other updater.
+        * @return void
+        */
+        void Update();
+
+    private:
+        /**
+        * Worker thread entry point.
+        */
+        void Load(std::stop_token stopToken, std::filesystem::path rawFilePath);
+
+        /**
+        * Hands a finished level over to the main thread.
+        */
+        void Publish(VolumeData&& volumeData, uint32_t stride, float fraction);
+
+        /**
+        * Allocates the texture of a published level, replacing an unfinished upload.
+        */
+        void BeginUpload(VolumeData&& volumeData, std::vector<VolumeData>&& pyramidLevels, uint32_t stride);
+
+        /**
+        * Uploads the next slab of the level being uploaded and returns whether it is complete.
+        */
+        bool UploadNextSlab();
+
+        /**
+        * Moves a level into Storage on the main thread and flags the change.
+        */
+        void PublishToStorage(VolumeData&& volumeData, uint32_t stride);
+
+        /**
+        * Records a loading error and ends loading.
+        */
+        void Fail(VolumeLoadingError error);
+
+    private:
+        GuiUpdateFlags& m_guiUpdateFlags; /**< Reference to GUI update flags. */
+        VolumeHandle& m_volumeData; /**< Reference to the handle of the volume data in Storage. */
+        Texture& m_volumeDataTexture; /**< Reference to the volume data texture in Storage. */
+        VolumeLoadingProgress& m_volumeLoadingProgress; /**< Reference to the loading progress in Storage. */
+        const VolumeTextureBudget m_volumeTextureBudget; /**< Budget of the published levels, read by the worker thread. */
+        std::mutex m_mutex; /**< Guards the members shared with the worker thread below. */
+        std::optional<VolumeData> m_pendingVolumeData; /**< Latest finished level not yet moved into Storage. */
+        std::vector<VolumeData> m_pendingPyramidLevels; /**< Downsampled levels of the pending level, uploaded as mip levels. */
+        uint32_t m_pendingStride; /**< Subsampling or downsampling factor of the pending level. */
+        std::optional<VolumeData> m_uploadingVolumeData; /**< Level whose texture is being uploaded by the main thread. */
+        std::vector<VolumeData> m_uploadingPyramidLevels; /**< Downsampled levels of the level being uploaded. */
+        uint32_t m_uploadingStride; /**< Subsampling or downsampling factor of the level being uploaded. */
+        std::optional<Texture> m_uploadingTexture; /**< Texture of the level being uploaded, moved into Storage once complete. */
+        unsigned int m_numUploadedSlices; /**< Number of slices of the level being uploaded that are on the GPU. */
+        VolumeLoadingProgress m_workerProgress; /**< Progress as seen by the worker thread. */
+        std::jthread m_workerThread; /**< Background loading thread, declared last so it starts after all other members. */
+    };
+}
+
+#endif
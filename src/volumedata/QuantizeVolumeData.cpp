@@ -0,0 +1,57 @@
+#include <volumedata/QuantizeVolumeData.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <execution>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace Constants
+{
+    constexpr size_t chunkLength = 1024 * 1024;
+}
+
+VolumeData::VolumeData VolumeData::QuantizeVolumeData(const VolumeData& volumeData, const VolumeWindow& volumeWindow)
+{
+    if (!volumeData.IsValid() || volumeData.GetMetadata().GetBitsPerComponent() != 16 || volumeWindow.width <= 0.0f)
+    {
+        return VolumeData{};
+    }
+
+    auto quantizedMetadata = volumeData.GetMetadata();
+    quantizedMetadata.SetBitsPerComponent(8);
+    auto quantizedVolumeData = VolumeData{quantizedMetadata};
+
+    const size_t numValues = volumeData.GetSizeInBytes() / sizeof(uint16_t);
+    const auto* values = reinterpret_cast<const uint16_t*>(volumeData.GetDataPtr());
+    uint8_t* quantizedValues = quantizedVolumeData.GetDataPtr();
+
+    // Done in raw value units, so the inner loop is a single multiply-add and clamp
+    constexpr float maxValue = static_cast<float>(std::numeric_limits<uint16_t>::max());
+    const float low = volumeWindow.GetLow() * maxValue;
+    const float scale = 255.0f / (volumeWindow.width * maxValue);
+
+    std::vector<size_t> chunkIndices((numValues + Constants::chunkLength - 1) / Constants::chunkLength);
+    std::iota(chunkIndices.begin(), chunkIndices.end(), size_t{0});
+
+    std::for_each(std::execution::par, chunkIndices.begin(), chunkIndices.end(), [=](size_t chunkIndex)
+    {
+        const size_t begin = chunkIndex * Constants::chunkLength;
+        const size_t length = std::min(Constants::chunkLength, numValues - begin);
+
+        // Local pointers, so the loop does not reload them through the closure and gets vectorized
+        const uint16_t* chunkValues = values + begin;
+        uint8_t* chunkQuantizedValues = quantizedValues + begin;
+
+        for (size_t i = 0; i < length; ++i)
+        {
+            const float quantizedValue = std::clamp((static_cast<float>(chunkValues[i]) - low) * scale + 0.5f, 0.0f, 255.0f);
+            chunkQuantizedValues[i] = static_cast<uint8_t>(quantizedValue);
+        }
+    });
+
+    return quantizedVolumeData;
+}
@@ -0,0 +1,32 @@
+/**
+* \file QuantizeVolumeData.h
+*
+* \brief Function for remapping a 16-bit volume to 8 bits through a window.
+*/
+
+#ifndef QUANTIZE_VOLUME_DATA_H
+#define QUANTIZE_VOLUME_DATA_H
+
+#include <volumedata/VolumeWindow.h>
+
+namespace VolumeData
+{
+    class VolumeData;
+
+    /**
+    * Remaps every component of a 16-bit volume to 8 bits.
+    *
+    * Normalized values inside the window are mapped linearly to [0, 255] with rounding,
+    * values outside are clamped. The volume is processed in parallel chunks, each converted
+    * by a branch-free loop the compiler vectorizes. Mapped volumes are read in place.
+    *
+    * @param volumeData The 16-bit volume to quantize.
+    * @param volumeWindow The window mapped to the full 8-bit range.
+    * @return VolumeData The 8-bit volume with the same dimensions, components and scale, or an empty VolumeData if the input is not a valid 16-bit volume or the window is empty.
+    *
+    * @see VolumeQuantizationUpdater for quantizing the volume in Storage.
+    */
+    VolumeData QuantizeVolumeData(const VolumeData& volumeData, const VolumeWindow& volumeWindow);
+}
+
+#endif
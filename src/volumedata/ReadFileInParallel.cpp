@@ -0,0 +1,94 @@
+#include <volumedata/ReadFileInParallel.h>
+#include <volumedata/PositionedFileReader.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <thread>
+#include <vector>
+
+namespace Constants
+{
+    constexpr size_t chunkSizeInBytes = 8 * 1024 * 1024; // A multiple of PositionedFileReader::uncachedAlignmentInBytes
+    constexpr size_t tasksPerThread = 2;
+}
+
+namespace
+{
+    struct AlignedDeleter
+    {
+        void operator()(uint8_t* data) const
+        {
+            ::operator delete[](data, std::align_val_t{VolumeData::PositionedFileReader::uncachedAlignmentInBytes});
+        }
+    };
+
+    using AlignedBuffer = std::unique_ptr<uint8_t[], AlignedDeleter>;
+
+    AlignedBuffer MakeAlignedBuffer(size_t sizeInBytes)
+    {
+        return AlignedBuffer{static_cast<uint8_t*>(::operator new[](sizeInBytes, std::align_val_t{VolumeData::PositionedFileReader::uncachedAlignmentInBytes}))};
+    }
+
+    /// Reads a chunk through an aligned buffer, rounding its size up to the alignment
+    bool ReadChunkUncached(const VolumeData::PositionedFileReader& reader, uint64_t offset, std::span<uint8_t> destination, uint8_t* alignedBuffer)
+    {
+        constexpr size_t alignment = VolumeData::PositionedFileReader::uncachedAlignmentInBytes;
+        const size_t alignedSize = (destination.size() + alignment - 1) / alignment * alignment;
+
+        const auto numBytesRead = reader.ReadUpTo(offset, std::span{alignedBuffer, alignedSize});
+        if (!numBytesRead || numBytesRead.value() < destination.size())
+        {
+            return false;
+        }
+
+        std::memcpy(destination.data(), alignedBuffer, destination.size());
+        return true;
+    }
+} // anonymous namespace
+
+bool VolumeData::ReadFileInParallel(const PositionedFileReader& reader, std::span<uint8_t> destination)
+{
+    if (!reader.IsOpen() || destination.size() > reader.GetSizeInBytes())
+    {
+        return false;
+    }
+
+    const size_t numChunks = (destination.size() + Constants::chunkSizeInBytes - 1) / Constants::chunkSizeInBytes;
+    const size_t numTasks = std::min(numChunks, std::max(1u, std::thread::hardware_concurrency()) * Constants::tasksPerThread);
+    const bool isUncached = (reader.GetCachingMode() == FileCachingMode::Uncached);
+
+    std::atomic<bool> readFailed{false};
+
+    // Each worker reads every numTasks-th chunk, so that all workers progress through the file together.
+    // The workers are explicit threads, since the parallel algorithms may run serially without a backend.
+    auto readChunks = [&](size_t taskIndex)
+    {
+        const auto alignedBuffer = isUncached ? MakeAlignedBuffer(Constants::chunkSizeInBytes) : AlignedBuffer{};
+
+        for (size_t chunkIndex = taskIndex; chunkIndex < numChunks && !readFailed; chunkIndex += numTasks)
+        {
+            const size_t offset = chunkIndex * Constants::chunkSizeInBytes;
+            const auto chunk = destination.subspan(offset, std::min(Constants::chunkSizeInBytes, destination.size() - offset));
+
+            const bool isChunkRead = isUncached ? ReadChunkUncached(reader, offset, chunk, alignedBuffer.get()) : reader.Read(offset, chunk);
+            if (!isChunkRead)
+            {
+                readFailed = true;
+            }
+        }
+    };
+
+    {
+        std::vector<std::jthread> workers;
+        workers.reserve(numTasks);
+        for (size_t taskIndex = 0; taskIndex < numTasks; ++taskIndex)
+        {
+            workers.emplace_back(readChunks, taskIndex);
+        }
+    } // Joins the workers
+
+    return !readFailed;
+}
@@ -0,0 +1,39 @@
+/**
+* \file ReadFileInParallel.h
+*
+* \brief Function for reading the start of a file with many concurrent large reads.
+*/
+
+#ifndef READ_FILE_IN_PARALLEL_H
+#define READ_FILE_IN_PARALLEL_H
+
+#include <cstdint>
+#include <span>
+
+namespace VolumeData
+{
+    class PositionedFileReader;
+
+    /**
+    * Reads the first destination.size() bytes of a file with concurrent positioned reads.
+    *
+    * The range is split into large chunks, which are read by a pool of worker threads,
+    * so that many requests are in flight at once. This keeps the queues of NVMe drives
+    * and RAIDs filled, which a single sequential read cannot do.
+    *
+    * Cached readers read each chunk straight into the destination. Uncached readers read
+    * each chunk into an aligned buffer of the worker reading it, since the destination is
+    * generally not aligned for direct I/O, and copy it from there. The last chunk is
+    * rounded up to the alignment and may extend past the end of the file.
+    *
+    * @param reader The open reader of the file.
+    * @param destination Buffer receiving the bytes, at most the size of the file.
+    * @return bool True if the whole range was read, false on errors.
+    *
+    * @see PositionedFileReader for the reads and their alignment requirements.
+    * @see LoadVolumeRaw for loading whole .raw files with this function.
+    */
+    bool ReadFileInParallel(const PositionedFileReader& reader, std::span<uint8_t> destination);
+}
+
+#endif
@@ -0,0 +1,78 @@
+#include <volumedata/ReleaseVolumeHostCopy.h>
+#include <volumedata/MappedFile.h>
+#include <volumedata/WriteVolumeRaw.h>
+
+#include <format>
+#include <memory>
+#include <optional>
+#include <system_error>
+#include <utility>
+
+namespace Constants
+{
+    constexpr const char* spillFileExtension = ".raw";
+}
+
+namespace
+{
+    bool IsFileOfSize(const std::filesystem::path& filePath, size_t sizeInBytes)
+    {
+        std::error_code errorCode;
+        const auto fileSizeInBytes = std::filesystem::file_size(filePath, errorCode);
+        return !errorCode && fileSizeInBytes == sizeInBytes;
+    }
+
+    /// Finds or creates a file holding exactly the voxels of the volume
+    std::optional<std::filesystem::path> GetBackingFilePath(const VolumeData::VolumeData& volumeData, const std::filesystem::path& spillDirectoryPath)
+    {
+        const auto& sourcePath = volumeData.GetSourcePath();
+        if (!sourcePath.empty() && IsFileOfSize(sourcePath, volumeData.GetSizeInBytes()))
+        {
+            return sourcePath;
+        }
+
+        const auto& contentHash = volumeData.GetContentHash();
+        if (!contentHash)
+        {
+            return std::nullopt;
+        }
+
+        // The content hash covers the voxels, so a spill file of the right size from an earlier session can be reused
+        const auto spillFilePath = spillDirectoryPath / std::format("{:016x}{}", contentHash.value(), Constants::spillFileExtension);
+        if (!IsFileOfSize(spillFilePath, volumeData.GetSizeInBytes()) && !VolumeData::WriteVolumeRaw(volumeData, spillFilePath))
+        {
+            return std::nullopt;
+        }
+
+        return spillFilePath;
+    }
+} // anonymous namespace
+
+VolumeData::VolumeData VolumeData::ReleaseVolumeHostCopy(VolumeData&& volumeData, const std::filesystem::path& spillDirectoryPath)
+{
+    if (!volumeData.IsValid() || volumeData.IsMapped())
+    {
+        return std::move(volumeData);
+    }
+
+    const auto backingFilePath = GetBackingFilePath(volumeData, spillDirectoryPath);
+    if (!backingFilePath)
+    {
+        return std::move(volumeData);
+    }
+
+    auto mappedFile = std::make_shared<const MappedFile>(backingFilePath.value(), MappedFileAccessPattern::OnDemand);
+    if (!mappedFile->IsMapped() || mappedFile->GetSizeInBytes() != volumeData.GetSizeInBytes())
+    {
+        return std::move(volumeData);
+    }
+
+    auto releasedVolumeData = VolumeData{volumeData.GetMetadata(), std::move(mappedFile)};
+    releasedVolumeData.SetSourcePath(volumeData.GetSourcePath());
+    if (const auto& contentHash = volumeData.GetContentHash())
+    {
+        releasedVolumeData.SetContentHash(contentHash.value());
+    }
+
+    return releasedVolumeData;
+}
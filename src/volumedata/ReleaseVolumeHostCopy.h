@@ -0,0 +1,40 @@
+/**
+* \file ReleaseVolumeHostCopy.h
+*
+* \brief Function for replacing the owned voxels of a volume by an on-demand file mapping.
+*/
+
+#ifndef RELEASE_VOLUME_HOST_COPY_H
+#define RELEASE_VOLUME_HOST_COPY_H
+
+#include <volumedata/VolumeData.h>
+
+#include <filesystem>
+
+namespace VolumeData
+{
+    /**
+    * Releases the owned voxel buffer of a volume that is only kept for CPU-side features once its texture exists.
+    *
+    * The voxels are replaced by a read-only MappedFile with MappedFileAccessPattern::OnDemand,
+    * so they no longer count towards the resident memory of the process until a CPU-side
+    * feature reads them, which faults them back in transparently through the const accessors
+    * of VolumeData. A volume loaded from a whole .raw file maps its source file. Any other
+    * volume, for example one downsampled to fit the texture budget, is first spilled into a
+    * .raw file named after its content hash in the spill directory, which is reused by later
+    * sessions with the same volume. Metadata, source path and content hash are preserved.
+    *
+    * A volume that is already mapped, has neither a source file nor a content hash, or whose
+    * spill file cannot be written is returned unchanged.
+    *
+    * @param volumeData The volume to release the host copy of.
+    * @param spillDirectoryPath Directory for the spill files of volumes without a source file.
+    * @return VolumeData The volume backed by a mapping, or the unchanged volume.
+    *
+    * @see VolumeResidencyPolicy for when the host copy is released.
+    * @see WriteVolumeRaw for writing the spill file.
+    */
+    VolumeData ReleaseVolumeHostCopy(VolumeData&& volumeData, const std::filesystem::path& spillDirectoryPath);
+}
+
+#endif
@@ -0,0 +1,29 @@
+/**
+* \file SparseVolumeBrick.h
+*
+* \brief Brick table entry of a sparse volume.
+*/
+
+#ifndef SPARSE_VOLUME_BRICK_H
+#define SPARSE_VOLUME_BRICK_H
+
+#include <cstdint>
+
+namespace VolumeData
+{
+    /**
+    * \struct SparseVolumeBrick
+    *
+    * \brief Either the single voxel value of a uniform brick or the location of the voxels of a non-uniform brick.
+    *
+    * @see SparseVolumeData for the brick table holding these entries.
+    */
+    struct SparseVolumeBrick
+    {
+        bool isUniform; /**< Whether all voxels of the brick are equal. */
+        uint64_t uniformVoxel; /**< Bytes of the voxel shared by all voxels of a uniform brick, in memory order. */
+        uint64_t dataOffset; /**< Offset of the voxels of a non-uniform brick in the brick data, in bytes. */
+    };
+}
+
+#endif
@@ -0,0 +1,157 @@
+#include <volumedata/SparseVolumeData.h>
+#include <volumedata/GetBrickExtent.h>
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+namespace
+{
+    uint32_t GetNumBricksAlongAxis(uint32_t dimension, uint32_t brickSize)
+    {
+        return (brickSize > 0) ? (dimension + brickSize - 1) / brickSize : 0;
+    }
+} // anonymous namespace
+
+VolumeData::SparseVolumeData::SparseVolumeData()
+    : m_metadata{}
+    , m_brickSize{0}
+    , m_numBricksX{0}
+    , m_numBricksY{0}
+    , m_numBricksZ{0}
+    , m_bricks{}
+    , m_brickData{}
+{
+}
+
+VolumeData::SparseVolumeData::SparseVolumeData(const VolumeMetadata& metadata, uint32_t brickSize, std::vector<SparseVolumeBrick>&& bricks, std::vector<uint8_t>&& brickData)
+    : m_metadata{metadata}
+    , m_brickSize{brickSize}
+    , m_numBricksX{GetNumBricksAlongAxis(metadata.GetWidth(), brickSize)}
+    , m_numBricksY{GetNumBricksAlongAxis(metadata.GetHeight(), brickSize)}
+    , m_numBricksZ{GetNumBricksAlongAxis(metadata.GetDepth(), brickSize)}
+    , m_bricks{std::move(bricks)}
+    , m_brickData{std::move(brickData)}
+{
+}
+
+bool VolumeData::SparseVolumeData::IsValid() const
+{
+    return m_metadata.IsValid() && m_brickSize > 0 && m_metadata.GetBytesPerVoxel() <= sizeof(uint64_t) &&
+        m_bricks.size() == static_cast<size_t>(m_numBricksX) * m_numBricksY * m_numBricksZ;
+}
+
+size_t VolumeData::SparseVolumeData::GetNumUniformBricks() const
+{
+    return static_cast<size_t>(std::ranges::count_if(m_bricks, &SparseVolumeBrick::isUniform));
+}
+
+size_t VolumeData::SparseVolumeData::GetSizeInBytes() const
+{
+    return m_bricks.size() * sizeof(SparseVolumeBrick) + m_brickData.size();
+}
+
+VolumeData::BrickExtent VolumeData::SparseVolumeData::GetBrickExtent(size_t brickIndex) const
+{
+    return ::VolumeData::GetBrickExtent(m_metadata, m_brickSize, brickIndex);
+}
+
+std::span<const uint8_t> VolumeData::SparseVolumeData::GetBrickData(size_t brickIndex) const
+{
+    const auto& brick = m_bricks[brickIndex];
+    if (brick.isUniform)
+    {
+        return {};
+    }
+
+    return {m_brickData.data() + brick.dataOffset, GetBrickExtent(brickIndex).GetVoxelCount() * m_metadata.GetBytesPerVoxel()};
+}
+
+bool VolumeData::SparseVolumeData::CopyRow(uint32_t y, uint32_t z, std::span<uint8_t> row) const
+{
+    const size_t bytesPerVoxel = m_metadata.GetBytesPerVoxel();
+    if (!IsValid() || y >= m_metadata.GetHeight() || z >= m_metadata.GetDepth() || row.size() != m_metadata.GetWidth() * bytesPerVoxel)
+    {
+        return false;
+    }
+
+    const size_t firstBrickIndex = GetBrickIndex(0, y, z);
+    for (uint32_t brickX = 0; brickX < m_numBricksX; ++brickX)
+    {
+        const size_t brickIndex = firstBrickIndex + brickX;
+        const auto& brick = m_bricks[brickIndex];
+        const auto extent = GetBrickExtent(brickIndex);
+        auto* destination = row.data() + extent.x * bytesPerVoxel;
+        const size_t rowSizeInBytes = extent.width * bytesPerVoxel;
+
+        if (brick.isUniform)
+        {
+            // Expand the first voxel by doubling the filled prefix, so that every copy is a single memcpy
+            std::memcpy(destination, &brick.uniformVoxel, bytesPerVoxel);
+            for (size_t filledSizeInBytes = bytesPerVoxel; filledSizeInBytes < rowSizeInBytes; filledSizeInBytes *= 2)
+            {
+                std::memcpy(destination + filledSizeInBytes, destination, std::min(filledSizeInBytes, rowSizeInBytes - filledSizeInBytes));
+            }
+        }
+        else
+        {
+            const size_t rowIndex = static_cast<size_t>(z - extent.z) * extent.height + (y - extent.y);
+            std::memcpy(destination, m_brickData.data() + brick.dataOffset + rowIndex * rowSizeInBytes, rowSizeInBytes);
+        }
+    }
+
+    return true;
+}
+
+uint8_t VolumeData::SparseVolumeData::GetVoxel8(uint32_t x, uint32_t y, uint32_t z) const
+{
+    if (m_metadata.GetBitsPerComponent() != 8 || m_metadata.GetComponents() != 1)
+    {
+        return 0;
+    }
+
+    const auto* voxel = GetVoxelPtr(x, y, z);
+    return (voxel != nullptr) ? *voxel : 0;
+}
+
+uint16_t VolumeData::SparseVolumeData::GetVoxel16(uint32_t x, uint32_t y, uint32_t z) const
+{
+    if (m_metadata.GetBitsPerComponent() != 16 || m_metadata.GetComponents() != 1)
+    {
+        return 0;
+    }
+
+    const auto* voxel = GetVoxelPtr(x, y, z);
+    if (voxel == nullptr)
+    {
+        return 0;
+    }
+
+    uint16_t value;
+    std::memcpy(&value, voxel, sizeof(uint16_t));
+    return value;
+}
+
+const uint8_t* VolumeData::SparseVolumeData::GetVoxelPtr(uint32_t x, uint32_t y, uint32_t z) const
+{
+    if (!IsValid() || x >= m_metadata.GetWidth() || y >= m_metadata.GetHeight() || z >= m_metadata.GetDepth())
+    {
+        return nullptr;
+    }
+
+    const size_t brickIndex = GetBrickIndex(x, y, z);
+    const auto& brick = m_bricks[brickIndex];
+    if (brick.isUniform)
+    {
+        return reinterpret_cast<const uint8_t*>(&brick.uniformVoxel);
+    }
+
+    const auto extent = GetBrickExtent(brickIndex);
+    const size_t voxelIndex = (static_cast<size_t>(z - extent.z) * extent.height + (y - extent.y)) * extent.width + (x - extent.x);
+    return m_brickData.data() + brick.dataOffset + voxelIndex * m_metadata.GetBytesPerVoxel();
+}
+
+size_t VolumeData::SparseVolumeData::GetBrickIndex(uint32_t x, uint32_t y, uint32_t z) const
+{
+    return (static_cast<size_t>(z / m_brickSize) * m_numBricksY + y / m_brickSize) * m_numBricksX + x / m_brickSize;
+}
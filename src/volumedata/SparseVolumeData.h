@@ -0,0 +1,166 @@
+/**
+* \file SparseVolumeData.h
+*
+* \brief Host-side volume representation that stores uniform bricks as a single value.
+*/
+
+#ifndef SPARSE_VOLUME_DATA_H
+#define SPARSE_VOLUME_DATA_H
+
+#include <volumedata/BrickExtent.h>
+#include <volumedata/SparseVolumeBrick.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace VolumeData
+{
+    /**
+    * \class SparseVolumeData
+    *
+    * \brief Stores a volume as a table of cubic bricks, of which only the non-uniform ones own voxel storage.
+    *
+    * Scans are often largely made of exact-zero background. A brick whose voxels are all
+    * equal is stored as that single voxel value in its SparseVolumeBrick, and only the
+    * remaining bricks keep their voxels, one after the other in a single buffer, each in
+    * x-fastest order within the brick. Bricks are numbered x-fastest, then y, then z, and
+    * are clipped at the upper volume boundaries, like in bricked volume files.
+    *
+    * Sparse volumes are created from and converted back to dense form with
+    * MakeSparseVolumeData() and MakeDenseVolumeData(). Consumers that process a volume row
+    * by row read it densely through CopyRow(), which expands uniform bricks on the fly, and
+    * GetVoxel8() and GetVoxel16() behave like their VolumeData counterparts.
+    *
+    * Loading with VolumeStorageMode::Sparse yields a VolumeData backed by a sparse volume,
+    * which serves as the dense view for consumers that only read contiguous voxels.
+    *
+    * Move-only type like VolumeData.
+    *
+    * @see MakeSparseVolumeData for converting a dense volume.
+    * @see MakeDenseVolumeData for converting back into a VolumeData.
+    * @see ConvertVolumeDataToSparse for replacing the voxels of a VolumeData by a sparse volume.
+    * @see VolumeData for the dense representation.
+    */
+    class SparseVolumeData
+    {
+    public:
+        static constexpr uint32_t defaultBrickSize = 32;
+
+        /**
+        * Default constructor.
+        * Creates an empty, invalid volume.
+        */
+        SparseVolumeData();
+
+        /**
+        * Constructor.
+        * @param metadata The volume metadata (dimensions, bit depth).
+        * @param brickSize Edge length of a brick in voxels.
+        * @param bricks The brick table, one entry per brick.
+        * @param brickData The voxels of all non-uniform bricks, addressed by SparseVolumeBrick::dataOffset.
+        */
+        SparseVolumeData(const VolumeMetadata& metadata, uint32_t brickSize, std::vector<SparseVolumeBrick>&& bricks, std::vector<uint8_t>&& brickData);
+
+        SparseVolumeData(const SparseVolumeData&) = delete;
+        SparseVolumeData& operator=(const SparseVolumeData&) = delete;
+        SparseVolumeData(SparseVolumeData&&) noexcept = default;
+        SparseVolumeData& operator=(SparseVolumeData&&) noexcept = default;
+
+        const VolumeMetadata& GetMetadata() const { return m_metadata; }
+        uint32_t GetBrickSize() const { return m_brickSize; }
+        uint32_t GetNumBricksX() const { return m_numBricksX; }
+        uint32_t GetNumBricksY() const { return m_numBricksY; }
+        uint32_t GetNumBricksZ() const { return m_numBricksZ; }
+        size_t GetNumBricks() const { return m_bricks.size(); }
+        const SparseVolumeBrick& GetBrick(size_t brickIndex) const { return m_bricks[brickIndex]; }
+
+        /**
+        * Checks whether the volume has valid metadata and a complete brick table.
+        * @return bool True if valid, false otherwise.
+        */
+        bool IsValid() const;
+
+        /**
+        * Counts the bricks stored as a single value.
+        * @return size_t The number of uniform bricks.
+        */
+        size_t GetNumUniformBricks() const;
+
+        /**
+        * Gets the host memory held by the brick table and the voxels of the non-uniform bricks.
+        * @return size_t The size in bytes.
+        */
+        size_t GetSizeInBytes() const;
+
+        /**
+        * Computes the voxel box covered by a brick.
+        * @param brickIndex Linear index of the brick.
+        * @return BrickExtent The voxel box, clipped to the volume.
+        */
+        BrickExtent GetBrickExtent(size_t brickIndex) const;
+
+        /**
+        * Gets the voxels of a non-uniform brick in x-fastest order within the brick.
+        * @param brickIndex Linear index of the brick.
+        * @return std::span<const uint8_t> The voxel bytes of the brick, or an empty span for a uniform brick.
+        */
+        std::span<const uint8_t> GetBrickData(size_t brickIndex) const;
+
+        /**
+        * Gets the voxels of all non-uniform bricks, brick after brick, for consumers that do not depend on the voxel positions.
+        * @return std::span<const uint8_t> The voxel bytes of all non-uniform bricks.
+        */
+        std::span<const uint8_t> GetBrickData() const { return m_brickData; }
+
+        /**
+        * Copies a row of voxels into a dense buffer, expanding uniform bricks.
+        * @param y The y coordinate of the row.
+        * @param z The z coordinate of the row.
+        * @param row Destination of width * bytes per voxel bytes.
+        * @return bool True if the row was copied, false if it is out of bounds or the destination has the wrong size.
+        */
+        bool CopyRow(uint32_t y, uint32_t z, std::span<uint8_t> row) const;
+
+        /**
+        * Gets an 8-bit voxel value at the specified coordinates.
+        * @param x The x coordinate.
+        * @param y The y coordinate.
+        * @param z The z coordinate.
+        * @return uint8_t The voxel value, or 0 if out of bounds or not an 8-bit single-component volume.
+        */
+        uint8_t GetVoxel8(uint32_t x, uint32_t y, uint32_t z) const;
+
+        /**
+        * Gets a 16-bit voxel value at the specified coordinates.
+        * @param x The x coordinate.
+        * @param y The y coordinate.
+        * @param z The z coordinate.
+        * @return uint16_t The voxel value, or 0 if out of bounds or not a 16-bit single-component volume.
+        */
+        uint16_t GetVoxel16(uint32_t x, uint32_t y, uint32_t z) const;
+
+    private:
+        /**
+        * Gets a pointer to the bytes of a voxel, which lie in the brick table for uniform bricks.
+        */
+        const uint8_t* GetVoxelPtr(uint32_t x, uint32_t y, uint32_t z) const;
+
+        /**
+        * Computes the linear index of the brick containing a voxel.
+        */
+        size_t GetBrickIndex(uint32_t x, uint32_t y, uint32_t z) const;
+
+        VolumeMetadata m_metadata; /**< Volume metadata (dimensions, bit depth). */
+        uint32_t m_brickSize; /**< Edge length of a brick in voxels. */
+        uint32_t m_numBricksX; /**< Number of bricks in x direction. */
+        uint32_t m_numBricksY; /**< Number of bricks in y direction. */
+        uint32_t m_numBricksZ; /**< Number of bricks in z direction. */
+        std::vector<SparseVolumeBrick> m_bricks; /**< Brick table, numbered x-fastest, then y, then z. */
+        std::vector<uint8_t> m_brickData; /**< Voxels of all non-uniform bricks, brick after brick. */
+    };
+}
+
+#endif
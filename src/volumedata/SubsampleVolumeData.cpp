@@ -0,0 +1,51 @@
+#include <volumedata/SubsampleVolumeData.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <algorithm>
+#include <cstring>
+#include <execution>
+#include <numeric>
+#include <vector>
+
+VolumeData::VolumeData VolumeData::SubsampleVolumeData(const VolumeData& volumeData, uint32_t stride)
+{
+    const auto& sourceMetadata = volumeData.GetMetadata();
+    stride = std::max(stride, 1u);
+
+    auto metadata = sourceMetadata;
+    metadata.SetWidth((sourceMetadata.GetWidth() + stride - 1) / stride);
+    metadata.SetHeight((sourceMetadata.GetHeight() + stride - 1) / stride);
+    metadata.SetDepth((sourceMetadata.GetDepth() + stride - 1) / stride);
+    metadata.SetScale(sourceMetadata.GetScaleX() * stride, sourceMetadata.GetScaleY() * stride, sourceMetadata.GetScaleZ() * stride);
+
+    auto subsampledVolumeData = VolumeData{metadata};
+
+    const size_t bytesPerVoxel = sourceMetadata.GetBytesPerVoxel();
+    const size_t sourceRowSize = static_cast<size_t>(sourceMetadata.GetWidth()) * bytesPerVoxel;
+    const size_t sourceSliceSize = sourceRowSize * sourceMetadata.GetHeight();
+    const size_t rowSize = static_cast<size_t>(metadata.GetWidth()) * bytesPerVoxel;
+    const size_t sliceSize = rowSize * metadata.GetHeight();
+
+    const uint8_t* const source = volumeData.GetDataPtr();
+    uint8_t* const destination = subsampledVolumeData.GetDataPtr();
+
+    std::vector<uint32_t> sliceIndices(metadata.GetDepth());
+    std::iota(sliceIndices.begin(), sliceIndices.end(), 0u);
+
+    std::for_each(std::execution::par_unseq, sliceIndices.begin(), sliceIndices.end(), [&](uint32_t z)
+    {
+        for (auto y = 0u; y < metadata.GetHeight(); ++y)
+        {
+            const uint8_t* sourceRow = source + z * stride * sourceSliceSize + y * stride * sourceRowSize;
+            uint8_t* destinationRow = destination + z * sliceSize + y * rowSize;
+
+            for (auto x = 0u; x < metadata.GetWidth(); ++x)
+            {
+                std::memcpy(destinationRow + x * bytesPerVoxel, sourceRow + x * stride * bytesPerVoxel, bytesPerVoxel);
+            }
+        }
+    });
+
+    return subsampledVolumeData;
+}
@@ -0,0 +1,36 @@
+/**
+* \file SubsampleVolumeData.h
+*
+* \brief Function for creating strided, reduced-resolution copies of volume data.
+*/
+
+#ifndef SUBSAMPLE_VOLUME_DATA_H
+#define SUBSAMPLE_VOLUME_DATA_H
+
+#include <cstdint>
+
+namespace VolumeData
+{
+    class VolumeData;
+
+    /**
+    * Creates a reduced-resolution copy of a volume by taking every stride-th voxel along each axis.
+    *
+    * Only the voxels that are kept are read from the source, so subsampling a mapped
+    * volume touches roughly one row in stride of each kept slice. The resulting metadata
+    * has dimensions rounded up to include the last partial stride, and the scale is
+    * multiplied by the stride so that the physical extent of the volume is preserved.
+    *
+    * Slices are processed in parallel.
+    *
+    * @param volumeData The source volume.
+    * @param stride The sampling stride along each axis. A stride of 1 copies the volume.
+    * @return VolumeData The subsampled volume, owning its data.
+    *
+    * @see VolumeData for the volume data structure.
+    * @see ProgressiveVolumeLoader for publishing subsampled proxies while a volume loads.
+    */
+    VolumeData SubsampleVolumeData(const VolumeData& volumeData, uint32_t stride);
+}
+
+#endif
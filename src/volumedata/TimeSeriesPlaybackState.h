@@ -0,0 +1,39 @@
+/**
+* \file TimeSeriesPlaybackState.h
+*
+* \brief Playback state of a volume time series.
+*/
+
+#ifndef TIME_SERIES_PLAYBACK_STATE_H
+#define TIME_SERIES_PLAYBACK_STATE_H
+
+#include <volumedata/VolumeLoadingError.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace VolumeData
+{
+    /**
+    * \struct TimeSeriesPlaybackState
+    *
+    * \brief Playback controls and statistics of the time series shown in the GUI.
+    *
+    * isPlaying is toggled by the Gui and read by the TimeSeriesPlayer, all other
+    * members are written by TimeSeriesPlayer::Update() on the main thread.
+    *
+    * @see TimeSeriesPlayer for the player updating this state.
+    * @see Gui for displaying the playback controls.
+    */
+    struct TimeSeriesPlaybackState
+    {
+        bool isPlaying = true; /**< True while playback advances, false while paused. */
+        size_t numSteps = 0; /**< Number of timesteps in the series, 0 if no time series is loaded. */
+        size_t displayedStep = 0; /**< Index of the displayed timestep. */
+        uint64_t numDroppedFrames = 0; /**< Number of timesteps skipped because reading or uploading could not keep up with the playback rate. */
+        std::optional<VolumeLoadingError> error; /**< The most recent error reading a timestep, if any. */
+    };
+}
+
+#endif
@@ -0,0 +1,387 @@
+#include <volumedata/TimeSeriesPlayer.h>
+#include <volumedata/ConvertVolumeDataToSparse.h>
+#include <volumedata/GetVolumeTextureFormat.h>
+#include <volumedata/IsVolumeQuantized.h>
+#include <volumedata/LoadVolumeMetadata.h>
+#include <volumedata/LoadVolumeRaw.h>
+
+#include <config/Config.h>
+#include <context/PostEmptyEvent.h>
+#include <gui/GuiUpdateFlags.h>
+#include <textures/TextureId.h>
+
+#include <glad/glad.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <utility>
+
+namespace
+{
+    /// Map one timestep and copy it into the destination buffer, and into host memory if there is none or the storage mode asks for it
+    VolumeData::VolumeLoadingResult ReadStep(const std::filesystem::path& rawFilePath, const VolumeData::VolumeMetadata& metadata, uint8_t* destination)
+    {
+        auto volumeLoadingResult = VolumeData::LoadVolumeRaw(rawFilePath, metadata, VolumeData::VolumeStorageMode::Mapped);
+        if (!volumeLoadingResult)
+        {
+            return volumeLoadingResult;
+        }
+        auto volumeData = std::move(volumeLoadingResult).value();
+
+        if (destination != nullptr)
+        {
+            // Faults in the whole mapping, so the updaters reading the presented step on the main thread hit the page cache
+            const auto data = std::as_const(volumeData).GetData();
+            std::memcpy(destination, data.data(), data.size());
+        }
+
+        // Sparse steps take a fraction of the host memory, so more steps can be held at once
+        if (Config::volumeStorageMode == VolumeData::VolumeStorageMode::Sparse)
+        {
+            volumeData = VolumeData::ConvertVolumeDataToSparse(std::move(volumeData));
+        }
+        else if (destination == nullptr || Config::volumeStorageMode != VolumeData::VolumeStorageMode::Mapped)
+        {
+            volumeData.Materialize();
+        }
+
+        return volumeData;
+    }
+} // anonymous namespace
+
+VolumeData::TimeSeriesPlayer::TimeSeriesPlayer(
+    std::vector<std::filesystem::path> stepPaths,
+    GuiUpdateFlags& guiUpdateFlags,
+    VolumeHandle& volumeData,
+    Texture& volumeDataTexture,
+    const VolumeLoadingProgress& volumeLoadingProgress,
+    TimeSeriesPlaybackState& timeSeriesPlaybackState
+)
+    : m_stepPaths{std::move(stepPaths)}
+    , m_guiUpdateFlags{guiUpdateFlags}
+    , m_volumeData{volumeData}
+    , m_volumeDataTexture{volumeDataTexture}
+    , m_volumeLoadingProgress{volumeLoadingProgress}
+    , m_timeSeriesPlaybackState{timeSeriesPlaybackState}
+    , m_metadata{}
+    , m_isStarted{false}
+    , m_isUploading{false}
+    , m_slots{}
+    , m_backTexture{}
+    , m_uploadedVolumeData{}
+    , m_uploadedFrame{-1}
+    , m_nextRequestedFrame{0}
+    , m_isFrontTextureOwned{false}
+    , m_isDerivedDataOutdated{false}
+    , m_playbackTime{0.0}
+    , m_lastUpdateTime{}
+    , m_mutex{}
+    , m_requestCondition{}
+    , m_requestedSlots{}
+    , m_oldestWantedFrame{0}
+    , m_workerError{}
+    , m_workerThread{}
+{
+    m_timeSeriesPlaybackState.numSteps = m_stepPaths.size();
+
+    if (m_stepPaths.empty())
+    {
+        return;
+    }
+
+    m_workerThread = std::jthread{[this](std::stop_token stopToken) { Prefetch(stopToken); }};
+}
+
+void VolumeData::TimeSeriesPlayer::Update()
+{
+    if (m_stepPaths.empty())
+    {
+        return;
+    }
+
+    m_guiUpdateFlags.timeStepChanged = false;
+
+    // Wait for the initial volume, so that the loader does not replace a presented step
+    if (!m_isStarted && (m_volumeLoadingProgress.isLoading || !Start()))
+    {
+        return;
+    }
+
+    // The clock starts with the first frame, so that the initial read is not counted as dropped frames
+    const auto now = std::chrono::steady_clock::now();
+    if (m_timeSeriesPlaybackState.isPlaying && m_uploadedFrame >= 0)
+    {
+        m_playbackTime += now - m_lastUpdateTime;
+    }
+    m_lastUpdateTime = now;
+
+    PresentUploadedFrame();
+
+    // The derived data of a paused step is computed once, while playing it would be outdated within a frame
+    if (m_isDerivedDataOutdated && !m_timeSeriesPlaybackState.isPlaying)
+    {
+        m_guiUpdateFlags.volumeDataChanged = true;
+        m_isDerivedDataOutdated = false;
+    }
+
+    const auto dueFrame = static_cast<uint64_t>(m_playbackTime.count() * Config::timeSeriesPlaybackRate);
+    UploadDueFrame(dueFrame);
+    RequestFrames(dueFrame);
+}
+
+double VolumeData::TimeSeriesPlayer::GetSecondsUntilNextStep() const
+{
+    if (m_uploadedVolumeData)
+    {
+        return 0.0;
+    }
+
+    if (!m_isStarted || !m_timeSeriesPlaybackState.isPlaying || m_uploadedFrame < 0)
+    {
+        return std::numeric_limits<double>::infinity();
+    }
+
+    const double playbackRate = Config::timeSeriesPlaybackRate;
+    const double nextDueTime = (std::floor(m_playbackTime.count() * playbackRate) + 1.0) / playbackRate;
+    const std::chrono::duration<double> timeSinceLastUpdate = std::chrono::steady_clock::now() - m_lastUpdateTime;
+    return std::max(nextDueTime - m_playbackTime.count() - timeSinceLastUpdate.count(), 0.0);
+}
+
+bool VolumeData::TimeSeriesPlayer::Start()
+{
+    auto iniFilePath = m_stepPaths.front();
+    iniFilePath.replace_extension(".ini");
+
+    const auto metadataResult = LoadVolumeMetadata(iniFilePath);
+    if (!metadataResult)
+    {
+        m_timeSeriesPlaybackState.error = metadataResult.error();
+        m_timeSeriesPlaybackState.numSteps = 0;
+        m_stepPaths.clear();
+        return false;
+    }
+
+    m_metadata = metadataResult.value();
+    m_isUploading = !IsVolumeQuantized(m_metadata);
+
+    m_slots.resize(Config::numTimeSeriesUploadBuffers);
+    if (m_isUploading)
+    {
+        for (auto& slot : m_slots)
+        {
+            slot.pixelUnpackBuffer.emplace(m_metadata.GetTotalSizeInBytes());
+        }
+        m_backTexture.emplace(MakeStepTexture());
+    }
+
+    m_lastUpdateTime = std::chrono::steady_clock::now();
+    m_isStarted = true;
+    return true;
+}
+
+void VolumeData::TimeSeriesPlayer::PresentUploadedFrame()
+{
+    if (!m_uploadedVolumeData)
+    {
+        return;
+    }
+
+    if (m_isUploading)
+    {
+        std::swap(m_volumeDataTexture, *m_backTexture);
+
+        // The texture created by the loader may differ in size and mip levels from the steps
+        if (!m_isFrontTextureOwned)
+        {
+            *m_backTexture = MakeStepTexture();
+            m_isFrontTextureOwned = true;
+        }
+    }
+
+    m_volumeData = VolumeHandle{std::move(m_uploadedVolumeData).value()};
+    m_uploadedVolumeData.reset();
+    m_timeSeriesPlaybackState.displayedStep = static_cast<size_t>(m_uploadedFrame) % m_stepPaths.size();
+    m_guiUpdateFlags.timeStepChanged = true;
+    m_isDerivedDataOutdated = true;
+}
+
+void VolumeData::TimeSeriesPlayer::UploadDueFrame(uint64_t dueFrame)
+{
+    const auto firstUnuploadedFrame = static_cast<uint64_t>(m_uploadedFrame + 1);
+    std::optional<size_t> uploadSlotIndex;
+    std::optional<VolumeData> volumeData;
+
+    {
+        std::lock_guard lock{m_mutex};
+        m_oldestWantedFrame = std::max(dueFrame, firstUnuploadedFrame);
+
+        if (m_workerError)
+        {
+            m_timeSeriesPlaybackState.error = std::exchange(m_workerError, std::nullopt);
+        }
+
+        for (size_t slotIndex = 0; slotIndex < m_slots.size(); ++slotIndex)
+        {
+            const auto& slot = m_slots[slotIndex];
+            const bool isDue = slot.state == SlotState::Ready && slot.frame >= firstUnuploadedFrame && slot.frame <= dueFrame;
+            if (isDue && (!uploadSlotIndex || slot.frame > m_slots[*uploadSlotIndex].frame))
+            {
+                uploadSlotIndex = slotIndex;
+            }
+        }
+
+        // Finished slots older than the uploaded frame can never be shown anymore
+        const auto newestUploadedFrame = uploadSlotIndex ? m_slots[*uploadSlotIndex].frame : firstUnuploadedFrame;
+        for (size_t slotIndex = 0; slotIndex < m_slots.size(); ++slotIndex)
+        {
+            auto& slot = m_slots[slotIndex];
+            const bool isUploaded = (uploadSlotIndex == slotIndex);
+            const bool isStale = slot.state == SlotState::Ready && slot.frame < newestUploadedFrame;
+            if (!isUploaded && !isStale && slot.state != SlotState::Discarded)
+            {
+                continue;
+            }
+
+            if (isUploaded)
+            {
+                volumeData = std::exchange(slot.volumeData, std::nullopt);
+            }
+
+            if (slot.pixelUnpackBuffer)
+            {
+                slot.pixelUnpackBuffer->Unmap();
+            }
+            slot.state = SlotState::Free;
+            slot.destination = nullptr;
+            slot.volumeData.reset();
+        }
+    }
+
+    if (!uploadSlotIndex)
+    {
+        if (m_isUploading)
+        {
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        }
+        return;
+    }
+
+    const auto frame = m_slots[*uploadSlotIndex].frame;
+    m_timeSeriesPlaybackState.numDroppedFrames += frame - firstUnuploadedFrame;
+    m_uploadedFrame = static_cast<int64_t>(frame);
+
+    if (m_isUploading)
+    {
+        // Unmapped above; the buffer keeps the step until it is mapped again with invalidation
+        const auto textureFormat = GetVolumeTextureFormat(m_metadata);
+
+        GLint previousUnpackAlignment;
+        glGetIntegerv(GL_UNPACK_ALIGNMENT, &previousUnpackAlignment);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+        m_slots[*uploadSlotIndex].pixelUnpackBuffer->Bind();
+        m_backTexture->SetSubImage3D(0, 0, 0, m_metadata.GetWidth(), m_metadata.GetHeight(), m_metadata.GetDepth(), textureFormat.format, textureFormat.type, nullptr);
+
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, previousUnpackAlignment);
+    }
+
+    m_uploadedVolumeData = std::move(volumeData);
+}
+
+void VolumeData::TimeSeriesPlayer::RequestFrames(uint64_t dueFrame)
+{
+    m_nextRequestedFrame = std::max(m_nextRequestedFrame, dueFrame);
+
+    {
+        std::lock_guard lock{m_mutex};
+        for (size_t slotIndex = 0; slotIndex < m_slots.size(); ++slotIndex)
+        {
+            auto& slot = m_slots[slotIndex];
+            if (slot.state != SlotState::Free)
+            {
+                continue;
+            }
+
+            uint8_t* destination = nullptr;
+            if (m_isUploading)
+            {
+                destination = static_cast<uint8_t*>(slot.pixelUnpackBuffer->Map());
+                if (destination == nullptr)
+                {
+                    break;
+                }
+            }
+
+            slot.state = SlotState::Requested;
+            slot.frame = m_nextRequestedFrame++;
+            slot.destination = destination;
+            m_requestedSlots.push_back(slotIndex);
+        }
+    }
+
+    if (m_isUploading)
+    {
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    }
+
+    m_requestCondition.notify_one();
+}
+
+Texture VolumeData::TimeSeriesPlayer::MakeStepTexture() const
+{
+    const auto textureFormat = GetVolumeTextureFormat(m_metadata);
+    return Texture{TextureId::VolumeData, m_volumeDataTexture.GetTextureUnitEnum(), m_metadata.GetWidth(), m_metadata.GetHeight(), m_metadata.GetDepth(), textureFormat.internalFormat, textureFormat.format, textureFormat.type, GL_LINEAR, GL_CLAMP_TO_EDGE, nullptr};
+}
+
+void VolumeData::TimeSeriesPlayer::Prefetch(std::stop_token stopToken)
+{
+    while (true)
+    {
+        size_t slotIndex = 0;
+        uint64_t frame = 0;
+        uint8_t* destination = nullptr;
+
+        {
+            std::unique_lock lock{m_mutex};
+            if (!m_requestCondition.wait(lock, stopToken, [this] { return !m_requestedSlots.empty(); }))
+            {
+                return;
+            }
+
+            slotIndex = m_requestedSlots.front();
+            m_requestedSlots.pop_front();
+
+            // Playback has moved past this frame, so skip the read to catch up
+            auto& slot = m_slots[slotIndex];
+            if (slot.frame < m_oldestWantedFrame)
+            {
+                slot.state = SlotState::Discarded;
+                continue;
+            }
+
+            frame = slot.frame;
+            destination = slot.destination;
+        }
+
+        auto stepResult = ReadStep(m_stepPaths[frame % m_stepPaths.size()], m_metadata, destination);
+
+        {
+            std::lock_guard lock{m_mutex};
+            auto& slot = m_slots[slotIndex];
+            if (stepResult)
+            {
+                slot.volumeData = std::move(stepResult).value();
+                slot.state = SlotState::Ready;
+            }
+            else
+            {
+                slot.state = SlotState::Discarded;
+                m_workerError = stepResult.error();
+            }
+        }
+        Context::PostEmptyEvent();
+    }
+}
@@ -0,0 +1,196 @@
+/**
+* \file TimeSeriesPlayer.h
+*
+* \brief Plays back a sequence of same-sized volumes at a target rate.
+*/
+
+#ifndef TIME_SERIES_PLAYER_H
+#define TIME_SERIES_PLAYER_H
+
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeHandle.h>
+#include <volumedata/VolumeLoadingError.h>
+#include <volumedata/VolumeLoadingProgress.h>
+#include <volumedata/VolumeMetadata.h>
+#include <volumedata/TimeSeriesPlaybackState.h>
+
+#include <buffers/PixelUnpackBuffer.h>
+#include <textures/Texture.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+struct GuiUpdateFlags;
+
+namespace VolumeData
+{
+    /**
+    * \class TimeSeriesPlayer
+    *
+    * \brief Prefetches timesteps on a background thread and uploads them through pixel unpack buffers.
+    *
+    * Playback is driven by frame numbers: frame n is due once the playback time has reached
+    * n / Config::timeSeriesPlaybackRate seconds and shows timestep n modulo the number of steps,
+    * so the series loops. The playback time only advances while playing and after the first
+    * frame has been shown.
+    *
+    * Each of Config::numTimeSeriesUploadBuffers slots owns a pixel unpack buffer holding a whole
+    * timestep. Update() maps free buffers and hands them to the worker thread together with the
+    * next frames to prefetch, and the worker maps the step's .raw file and copies it into the
+    * buffer. Update() then uploads the newest ready frame that is due into a back texture, which
+    * is swapped with the TextureId::VolumeData texture in Storage in the following frame. The
+    * transfer from the buffer therefore overlaps the rendering of one frame, and the main thread
+    * never waits on disk reads or on the worker.
+    *
+    * Frames that were due but skipped because no newer one was ready in time are counted as
+    * dropped. Stale requests are discarded by the worker without reading them, so that playback
+    * catches up instead of falling further behind.
+    *
+    * Presenting a timestep moves its memory-mapped VolumeData into Storage. While playing,
+    * this sets GuiUpdateFlags::timeStepChanged only, so the updaters do not recompute the
+    * gradients, the min-max grid and the histogram of every step: they fall back to their
+    * volume-independent defaults instead. Once playback is paused, the displayed step sets
+    * GuiUpdateFlags::volumeDataChanged, so that its derived data is computed once.
+    * Quantized volumes are left to the VolumeQuantizationUpdater, in which case the worker
+    * reads the step into host memory and no buffers are used.
+    *
+    * Playback starts once the ProgressiveVolumeLoader has finished. The worker thread is
+    * stopped and joined on destruction.
+    *
+    * @see FindTimeSeriesSteps for enumerating the timesteps.
+    * @see TimeSeriesPlaybackState for the playback controls and statistics.
+    * @see PixelUnpackBuffer for the staging buffers.
+    * @see Factory::MakeTimeSeriesPlayer for construction from Storage.
+    */
+    class TimeSeriesPlayer
+    {
+    public:
+        /**
+        * Constructor.
+        * Starts the worker thread if stepPaths is not empty.
+        * @param stepPaths Paths of the .raw files of the timesteps, in playback order.
+        * @param guiUpdateFlags Reference to GUI update flags for signaling timestep and volume changes.
+        * @param volumeData Reference to the handle of the volume data in Storage to replace.
+        * @param volumeDataTexture Reference to the volume data texture in Storage to replace.
+        * @param volumeLoadingProgress Reference to the loading progress in Storage, to wait for the initial volume.
+        * @param timeSeriesPlaybackState Reference to the playback state in Storage to update.
+        */
+        TimeSeriesPlayer(
+            std::vector<std::filesystem::path> stepPaths,
+            GuiUpdateFlags& guiUpdateFlags,
+            VolumeHandle& volumeData,
+            Texture& volumeDataTexture,
+            const VolumeLoadingProgress& volumeLoadingProgress,
+            TimeSeriesPlaybackState& timeSeriesPlaybackState
+        );
+
+        TimeSeriesPlayer(const TimeSeriesPlayer&) = delete;
+        TimeSeriesPlayer& operator=(const TimeSeriesPlayer&) = delete;
+        TimeSeriesPlayer(TimeSeriesPlayer&&) = delete;
+        TimeSeriesPlayer& operator=(TimeSeriesPlayer&&) = delete;
+
+        /**
+        * Presents the frame uploaded in the previous call, uploads the newest due frame and requests further frames.
+        * Should be called once per frame, right after the ProgressiveVolumeLoader.
+        * @return void
+        */
+        void Update();
+
+        /**
+        * Gets the time until Update() has the next step to present, for the main loop to wait while idle.
+        * The prefetch thread wakes the main loop itself once a step has been read.
+        * @return double The time in seconds, 0 if an uploaded step waits to be presented, or infinity while paused.
+        */
+        double GetSecondsUntilNextStep() const;
+
+    private:
+        /**
+        * State of a prefetch slot.
+        */
+        enum class SlotState
+        {
+            Free,      /**< Not in use, the buffer is unmapped. */
+            Requested, /**< Queued for or being read by the worker, the buffer is mapped. */
+            Ready,     /**< Read successfully, the buffer is mapped. */
+            Discarded  /**< Skipped by the worker or failed to read, the buffer is mapped. */
+        };
+
+        /**
+        * A pixel unpack buffer and the frame prefetched into it.
+        */
+        struct Slot
+        {
+            std::optional<PixelUnpackBuffer> pixelUnpackBuffer; /**< Staging buffer, empty for quantized volumes. */
+            SlotState state = SlotState::Free; /**< Guarded by m_mutex. */
+            uint64_t frame = 0; /**< Frame number requested for this slot. */
+            uint8_t* destination = nullptr; /**< Mapped buffer storage, or nullptr for quantized volumes. */
+            std::optional<VolumeData> volumeData; /**< The read timestep, guarded by m_mutex. */
+        };
+
+        /**
+        * Loads the metadata of the series and allocates the buffers and the back texture.
+        */
+        bool Start();
+
+        /**
+        * Swaps in the frame uploaded in the previous call, if any.
+        */
+        void PresentUploadedFrame();
+
+        /**
+        * Uploads the newest ready frame that is due and releases all older slots.
+        */
+        void UploadDueFrame(uint64_t dueFrame);
+
+        /**
+        * Maps the free buffers and queues them for the next frames.
+        */
+        void RequestFrames(uint64_t dueFrame);
+
+        /**
+        * Creates an uninitialized texture matching the timesteps.
+        */
+        Texture MakeStepTexture() const;
+
+        /**
+        * Worker thread entry point.
+        */
+        void Prefetch(std::stop_token stopToken);
+
+    private:
+        std::vector<std::filesystem::path> m_stepPaths; /**< Paths of the timesteps in playback order. */
+        GuiUpdateFlags& m_guiUpdateFlags; /**< Reference to GUI update flags. */
+        VolumeHandle& m_volumeData; /**< Reference to the handle of the volume data in Storage. */
+        Texture& m_volumeDataTexture; /**< Reference to the volume data texture in Storage. */
+        const VolumeLoadingProgress& m_volumeLoadingProgress; /**< Reference to the loading progress in Storage. */
+        TimeSeriesPlaybackState& m_timeSeriesPlaybackState; /**< Reference to the playback state in Storage. */
+        VolumeMetadata m_metadata; /**< Metadata shared by all timesteps, read from the first step's .ini file. */
+        bool m_isStarted; /**< True once the buffers are allocated and prefetching has begun. */
+        bool m_isUploading; /**< True if steps are uploaded by the player, false if they are quantized by the VolumeQuantizationUpdater. */
+        std::vector<Slot> m_slots; /**< Prefetch slots, sized once in Start(). */
+        std::optional<Texture> m_backTexture; /**< Texture receiving the next upload while the front texture is rendered. */
+        std::optional<VolumeData> m_uploadedVolumeData; /**< Host volume of the frame uploaded into the back texture, not yet presented. */
+        int64_t m_uploadedFrame; /**< Latest frame uploaded, -1 if none. */
+        uint64_t m_nextRequestedFrame; /**< Next frame to request from the worker. */
+        bool m_isFrontTextureOwned; /**< True once the front texture was allocated by the player rather than the loader. */
+        bool m_isDerivedDataOutdated; /**< True if a step was presented while playing and volumeDataChanged has not been set for it since. */
+        std::chrono::duration<double> m_playbackTime; /**< Time played back since the first frame was shown. */
+        std::chrono::steady_clock::time_point m_lastUpdateTime; /**< Time of the previous call to Update(). */
+        std::mutex m_mutex; /**< Guards the slot states and the members shared with the worker thread below. */
+        std::condition_variable_any m_requestCondition; /**< Signaled when a slot is queued. */
+        std::deque<size_t> m_requestedSlots; /**< Indices of the slots queued for the worker, in frame order. */
+        uint64_t m_oldestWantedFrame; /**< Requests for older frames are discarded by the worker without reading them. */
+        std::optional<VolumeLoadingError> m_workerError; /**< Latest read error not yet reported in the playback state. */
+        std::jthread m_workerThread; /**< Background prefetching thread, declared last so it starts after all other members. */
+    };
+}
+
+#endif
@@ -0,0 +1,25 @@
+#include <volumedata/UploadBrick.h>
+#include <volumedata/GetVolumeTextureFormat.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <textures/Texture.h>
+
+#include <glad/glad.h>
+
+void VolumeData::UploadBrick(Texture& texture, const VolumeMetadata& metadata, const BrickExtent& extent, std::span<const uint8_t> brickData)
+{
+    if (brickData.size() < extent.GetVoxelCount() * metadata.GetBytesPerVoxel())
+    {
+        return;
+    }
+
+    const auto textureFormat = GetVolumeTextureFormat(metadata);
+
+    GLint previousUnpackAlignment = 4;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &previousUnpackAlignment);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    texture.SetSubImage3D(extent.x, extent.y, extent.z, extent.width, extent.height, extent.depth, textureFormat.format, textureFormat.type, brickData.data());
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, previousUnpackAlignment);
+}
@@ -0,0 +1,40 @@
+/**
+* \file UploadBrick.h
+*
+* \brief Function for uploading a single brick into a volume texture.
+*/
+
+#ifndef UPLOAD_BRICK_H
+#define UPLOAD_BRICK_H
+
+#include <volumedata/BrickExtent.h>
+
+#include <cstdint>
+#include <span>
+
+class Texture;
+
+namespace VolumeData
+{
+    class VolumeMetadata;
+
+    /**
+    * Uploads the voxels of a brick into the matching region of a 3D volume texture.
+    *
+    * The texture must have been created with the dimensions and format of the volume
+    * the brick belongs to. The unpack alignment is set to 1 for the upload and restored
+    * afterwards, since brick rows are tightly packed.
+    *
+    * @param texture The volume texture to update.
+    * @param metadata The metadata of the volume the brick belongs to.
+    * @param extent The voxel box of the brick.
+    * @param brickData The voxels of the brick, as returned by BrickedVolumeReader::ReadBrick().
+    * @return void
+    *
+    * @see BrickCache for obtaining brick voxels.
+    * @see Texture::SetSubImage3D for the underlying upload.
+    */
+    void UploadBrick(Texture& texture, const VolumeMetadata& metadata, const BrickExtent& extent, std::span<const uint8_t> brickData);
+}
+
+#endif
@@ -0,0 +1,30 @@
+#include <volumedata/UploadVolumePyramid.h>
+#include <volumedata/GetVolumeTextureFormat.h>
+#include <volumedata/VolumeData.h>
+
+#include <textures/Texture.h>
+
+#include <glad/glad.h>
+
+void VolumeData::UploadVolumePyramid(Texture& texture, std::span<const VolumeData> pyramidLevels)
+{
+    if (pyramidLevels.empty())
+    {
+        return;
+    }
+
+    GLint previousUnpackAlignment = 4;
+    glGetIntegerv(GL_UNPACK_ALIGNMENT, &previousUnpackAlignment);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+
+    for (size_t i = 0; i < pyramidLevels.size(); ++i)
+    {
+        const auto& metadata = pyramidLevels[i].GetMetadata();
+        const auto textureFormat = GetVolumeTextureFormat(metadata);
+        texture.SetImage3D(static_cast<unsigned int>(i + 1), metadata.GetWidth(), metadata.GetHeight(), metadata.GetDepth(), textureFormat.internalFormat, textureFormat.format, textureFormat.type, pyramidLevels[i].GetDataPtr());
+    }
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, previousUnpackAlignment);
+
+    texture.SetMaxLevel3D(static_cast<unsigned int>(pyramidLevels.size()));
+}
@@ -0,0 +1,36 @@
+/**
+* \file UploadVolumePyramid.h
+*
+* \brief Function for uploading downsampled volume levels as texture mip levels.
+*/
+
+#ifndef UPLOAD_VOLUME_PYRAMID_H
+#define UPLOAD_VOLUME_PYRAMID_H
+
+#include <span>
+
+class Texture;
+
+namespace VolumeData
+{
+    class VolumeData;
+
+    /**
+    * Uploads downsampled volume levels into the mip levels of a 3D volume texture.
+    *
+    * Level i of the span is uploaded to mip level i + 1, and the texture is switched to
+    * trilinear mipmap filtering over the uploaded levels. The texture must hold the
+    * full-resolution volume in mip level 0. With an empty span, the texture is left
+    * with level 0 only.
+    *
+    * @param texture The volume texture to extend.
+    * @param pyramidLevels The downsampled levels, as returned by MakeVolumePyramid().
+    * @return void
+    *
+    * @see MakeVolumePyramid for creating the levels.
+    * @see Texture::SetImage3D for the underlying upload.
+    */
+    void UploadVolumePyramid(Texture& texture, std::span<const VolumeData> pyramidLevels);
+}
+
+#endif
@@ -1,41 +1,179 @@
 #include <volumedata/VolumeData.h>
+#include <volumedata/MakeDenseVolumeData.h>
 #include <cstring>
+#include <utility>
 
 
 VolumeData::VolumeData::VolumeData()
     : m_metadata{}
     , m_data{}
+    , m_mappedFile{}
+    , m_sparseBacking{}
+    , m_sourcePath{}
+    , m_contentHash{}
 {
 }
 
 VolumeData::VolumeData::VolumeData(const VolumeMetadata& metadata)
     : m_metadata{metadata}
     , m_data{}
+    , m_mappedFile{}
+    , m_sparseBacking{}
+    , m_sourcePath{}
+    , m_contentHash{}
 {
     AllocateData();
 }
 
+VolumeData::VolumeData::VolumeData(const VolumeMetadata& metadata, std::shared_ptr<const MappedFile> mappedFile)
+    : m_metadata{metadata}
+    , m_data{}
+    , m_mappedFile{std::move(mappedFile)}
+    , m_sparseBacking{}
+    , m_sourcePath{}
+    , m_contentHash{}
+{
+}
+
+VolumeData::VolumeData::VolumeData(SparseVolumeData&& sparseVolumeData)
+    : m_metadata{sparseVolumeData.GetMetadata()}
+    , m_data{}
+    , m_mappedFile{}
+    , m_sparseBacking{std::make_shared<SparseBacking>()}
+    , m_sourcePath{}
+    , m_contentHash{}
+{
+    m_sparseBacking->sparseData = std::move(sparseVolumeData);
+}
+
+VolumeData::VolumeData VolumeData::VolumeData::Clone() const
+{
+    auto volumeData = VolumeData{};
+    volumeData.m_metadata = m_metadata;
+    volumeData.m_data = m_data;
+    volumeData.m_mappedFile = m_mappedFile;
+    volumeData.m_sparseBacking = m_sparseBacking;
+    volumeData.m_sourcePath = m_sourcePath;
+    volumeData.m_contentHash = m_contentHash;
+    return volumeData;
+}
+
+std::span<const uint8_t> VolumeData::VolumeData::GetData() const
+{
+    if (m_mappedFile)
+    {
+        return m_mappedFile->GetData();
+    }
+
+    if (m_sparseBacking)
+    {
+        // Expanded at most once, even if the volume is shared between threads through a VolumeHandle
+        auto& sparseBacking = *m_sparseBacking;
+        std::call_once(sparseBacking.denseDataFlag, [&sparseBacking]()
+        {
+            sparseBacking.denseData = std::move(MakeDenseVolumeData(sparseBacking.sparseData).GetData());
+        });
+        return sparseBacking.denseData;
+    }
+
+    return m_data;
+}
+
+size_t VolumeData::VolumeData::GetSizeInBytes() const
+{
+    if (m_mappedFile)
+    {
+        return m_mappedFile->GetSizeInBytes();
+    }
+
+    // The size of the dense view, which consumers index into
+    if (m_sparseBacking)
+    {
+        return m_sparseBacking->sparseData.IsValid() ? m_metadata.GetTotalSizeInBytes() : 0;
+    }
+
+    return m_data.size();
+}
+
+void VolumeData::VolumeData::Materialize()
+{
+    if (m_mappedFile)
+    {
+        const auto mappedData = m_mappedFile->GetData();
+        m_data.assign(mappedData.begin(), mappedData.end());
+        m_mappedFile.reset();
+    }
+    else if (m_sparseBacking)
+    {
+        // The dense view is taken over if no clone shares it, and copied otherwise
+        const auto denseData = std::as_const(*this).GetData();
+        m_data = (m_sparseBacking.use_count() == 1) ? std::move(m_sparseBacking->denseData) : std::vector<uint8_t>(denseData.begin(), denseData.end());
+        m_sparseBacking.reset();
+    }
+}
+
+bool VolumeData::VolumeData::CopySlices(uint32_t z, uint32_t numSlices, std::span<uint8_t> destination) const
+{
+    const size_t rowSizeInBytes = static_cast<size_t>(m_metadata.GetWidth()) * m_metadata.GetBytesPerVoxel();
+    const size_t sliceSizeInBytes = rowSizeInBytes * m_metadata.GetHeight();
+    if (!IsValid() || z > m_metadata.GetDepth() || numSlices > m_metadata.GetDepth() - z || destination.size() != numSlices * sliceSizeInBytes)
+    {
+        return false;
+    }
+
+    if (!m_sparseBacking)
+    {
+        std::memcpy(destination.data(), GetDataPtr() + z * sliceSizeInBytes, destination.size());
+        return true;
+    }
+
+    for (uint32_t slice = 0; slice < numSlices; ++slice)
+    {
+        for (uint32_t y = 0; y < m_metadata.GetHeight(); ++y)
+        {
+            m_sparseBacking->sparseData.CopyRow(y, z + slice, destination.subspan(slice * sliceSizeInBytes + y * rowSizeInBytes, rowSizeInBytes));
+        }
+    }
+
+    return true;
+}
+
+void VolumeData::VolumeData::Prefetch(size_t offsetInBytes, size_t sizeInBytes) const
+{
+    if (m_mappedFile)
+    {
+        m_mappedFile->Prefetch(offsetInBytes, sizeInBytes);
+    }
+}
+
 void VolumeData::VolumeData::AllocateData()
 {
     if (m_metadata.IsValid())
     {
-        m_data.resize(m_metadata.GetTotalSizeInBytes());
+        AllocateData(m_metadata.GetTotalSizeInBytes());
     }
 }
 
 void VolumeData::VolumeData::AllocateData(size_t sizeInBytes)
 {
+    m_mappedFile.reset();
+    m_sparseBacking.reset();
+    m_contentHash.reset();
     m_data.resize(sizeInBytes);
 }
 
 bool VolumeData::VolumeData::IsValid() const
 {
-    return m_metadata.IsValid() && m_data.size() == m_metadata.GetTotalSizeInBytes();
+    return m_metadata.IsValid() && GetSizeInBytes() == m_metadata.GetTotalSizeInBytes();
 }
 
 void VolumeData::VolumeData::Clear()
 {
     m_data.clear();
+    m_mappedFile.reset();
+    m_sparseBacking.reset();
+    m_sourcePath.clear();
+    m_contentHash.reset();
     m_metadata = VolumeMetadata{};
 }
 
@@ -62,8 +200,13 @@ uint8_t VolumeData::VolumeData::GetVoxel8(uint32_t x, uint32_t y, uint32_t z) co
         return 0;
     }
 
+    if (m_sparseBacking)
+    {
+        return m_sparseBacking->sparseData.GetVoxel8(x, y, z);
+    }
+
     const size_t index = GetVoxelIndex(x, y, z);
-    return m_data[index];
+    return GetDataPtr()[index];
 }
 
 bool VolumeData::VolumeData::SetVoxel8(uint32_t x, uint32_t y, uint32_t z, uint8_t value)
@@ -74,6 +217,8 @@ bool VolumeData::VolumeData::SetVoxel8(uint32_t x, uint32_t y, uint32_t z, uint8
     }
 
     const size_t index = GetVoxelIndex(x, y, z);
+    Materialize();
+    m_contentHash.reset();
     m_data[index] = value;
     return true;
 }
@@ -85,9 +230,14 @@ uint16_t VolumeData::VolumeData::GetVoxel16(uint32_t x, uint32_t y, uint32_t z)
         return 0;
     }
 
+    if (m_sparseBacking)
+    {
+        return m_sparseBacking->sparseData.GetVoxel16(x, y, z);
+    }
+
     const size_t index = GetVoxelIndex(x, y, z);
     uint16_t value;
-    std::memcpy(&value, &m_data[index], sizeof(uint16_t));
+    std::memcpy(&value, GetDataPtr() + index, sizeof(uint16_t));
     return value;
 }
 
@@ -99,6 +249,8 @@ bool VolumeData::VolumeData::SetVoxel16(uint32_t x, uint32_t y, uint32_t z, uint
     }
 
     const size_t index = GetVoxelIndex(x, y, z);
+    Materialize();
+    m_contentHash.reset();
     std::memcpy(&m_data[index], &value, sizeof(uint16_t));
     return true;
 }
@@ -7,8 +7,15 @@
 #ifndef VOLUME_DATA_H
 #define VOLUME_DATA_H
 
+#include <volumedata/MappedFile.h>
+#include <volumedata/SparseVolumeData.h>
 #include <volumedata/VolumeMetadata.h>
 #include <cstdint>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <span>
 #include <vector>
 
 /**
@@ -26,12 +33,41 @@ namespace VolumeData
     * Encapsulates volumetric data as a contiguous array of bytes with associated metadata
     * (dimensions, bit depth). Supports both 8-bit and 16-bit voxel data with indexed access.
     *
+    * The voxel bytes are either owned in a heap buffer or referenced from a read-only
+    * MappedFile of the source .raw file. Const accessors read from whichever backing is
+    * active, so a mapped volume can be uploaded to the GPU without an intermediate copy.
+    * Mutable accessors first copy a mapped volume into an owned buffer, so edits never
+    * write through to the mapping.
+    *
+    * A volume can also be backed by a SparseVolumeData, which stores uniform bricks as a
+    * single value. Consumers that know the sparse form reach it via GetSparseData() and read
+    * it brick by brick or row by row, as do CopySlices(), the texture upload, the histogram,
+    * the min/max grid, the content hash and the downsampling. For all other consumers the
+    * const accessors act as a dense view: the first of them expands the sparse volume into a
+    * dense buffer, which is then kept and shared by all clones of the volume.
+    *
+    * Volumes are move-only, since a single accidental copy of a multi-GB volume doubles the
+    * memory use. Copies are made explicitly with Clone(), and a VolumeHandle shares one
+    * immutable volume between its users without copying it.
+    *
     * Volume data is loaded from raw files via LoadVolumeRaw() and converted to a 3D OpenGL
     * texture via MakeVolumeDataTexture(). The volume is rendered using ray-casting in the
     * fragment shader.
     *
+    * A volume can carry a hash of its metadata and voxels, set by the loader via
+    * ComputeVolumeContentHash() once the voxels are final. It keys the entries of the
+    * DerivedDataCache. All mutable accessors drop the hash, so a modified volume is never
+    * matched with products derived from its original voxels.
+    *
+    * The per-voxel accessors check bounds and format on every call and are meant for
+    * occasional access. Bulk processing should go through a VolumeView instead.
+    *
     * @see VolumeMetadata for volume dimensions and bit depth information.
+    * @see VolumeView for unchecked typed access to the voxels.
+    * @see SparseVolumeData for the sparse backing.
+    * @see VolumeHandle for sharing a volume.
     * @see LoadVolumeRaw for loading volume data from raw files.
+    * @see DerivedDataCache for the on-disk cache keyed by the content hash.
     * @see Factory::MakeVolumeDataTexture for creating 3D textures from volume data.
     */
     class VolumeData
@@ -48,24 +84,79 @@ namespace VolumeData
         */
         explicit VolumeData(const VolumeMetadata& metadata);
 
-        VolumeData(const VolumeData&) = default;
-        VolumeData& operator=(const VolumeData&) = default;
+        /**
+        * Constructor.
+        * Creates a volume whose voxel data is backed by a read-only file mapping.
+        * @param metadata The volume metadata (dimensions, bit depth).
+        * @param mappedFile The mapped file holding the voxel data.
+        */
+        VolumeData(const VolumeMetadata& metadata, std::shared_ptr<const MappedFile> mappedFile);
+
+        /**
+        * Constructor.
+        * Creates a volume whose voxel data is backed by a sparse volume.
+        * @param sparseVolumeData The sparse volume, which also provides the metadata.
+        */
+        explicit VolumeData(SparseVolumeData&& sparseVolumeData);
+
+        VolumeData(const VolumeData&) = delete;
+        VolumeData& operator=(const VolumeData&) = delete;
         VolumeData(VolumeData&&) noexcept = default;
         VolumeData& operator=(VolumeData&&) noexcept = default;
 
+        /**
+        * Creates an explicit copy of the volume.
+        * Owned voxels are duplicated, while a mapped or sparse volume shares its read-only backing with the copy.
+        * @return VolumeData The copy, including metadata, source path and content hash.
+        */
+        VolumeData Clone() const;
+
         const VolumeMetadata& GetMetadata() const { return m_metadata; }
-        VolumeMetadata& GetMetadata() { return m_metadata; }
-        void SetMetadata(const VolumeMetadata& metadata) { m_metadata = metadata; }
+        void SetMetadata(const VolumeMetadata& metadata) { m_metadata = metadata; m_contentHash.reset(); }
+        const std::filesystem::path& GetSourcePath() const { return m_sourcePath; }
+        void SetSourcePath(const std::filesystem::path& sourcePath) { m_sourcePath = sourcePath; }
 
         // TODO check which functions we actually need
-        const std::vector<uint8_t>& GetData() const { return m_data; }
-        std::vector<uint8_t>& GetData() { return m_data; }
-        const uint8_t* GetDataPtr() const { return m_data.data(); }
-        uint8_t* GetDataPtr() { return m_data.data(); }
-        size_t GetSizeInBytes() const { return m_data.size(); }
+        std::span<const uint8_t> GetData() const;
+        std::vector<uint8_t>& GetData() { Materialize(); m_contentHash.reset(); return m_data; }
+        const uint8_t* GetDataPtr() const { return GetData().data(); }
+        uint8_t* GetDataPtr() { Materialize(); m_contentHash.reset(); return m_data.data(); }
+        size_t GetSizeInBytes() const;
+        bool IsMapped() const { return m_mappedFile != nullptr; }
+        bool IsSparse() const { return m_sparseBacking != nullptr; }
+        const SparseVolumeData* GetSparseData() const { return m_sparseBacking ? &m_sparseBacking->sparseData : nullptr; }
+        const std::optional<uint64_t>& GetContentHash() const { return m_contentHash; }
+        void SetContentHash(uint64_t contentHash) { m_contentHash = contentHash; }
+
+        /**
+        * Copies the voxel data of a mapped or sparse volume into an owned buffer and releases the backing.
+        * Does nothing if the volume already owns its data.
+        * @return void
+        */
+        void Materialize();
+
+        /**
+        * Copies consecutive slices into a dense buffer, expanding the uniform bricks of a sparse volume.
+        * Unlike the const accessors, this never expands a whole sparse volume.
+        * @param z The first slice.
+        * @param numSlices The number of slices.
+        * @param destination Destination of numSlices * width * height * bytes per voxel bytes.
+        * @return bool True if the slices were copied, false if they are out of bounds or the destination has the wrong size.
+        */
+        bool CopySlices(uint32_t z, uint32_t numSlices, std::span<uint8_t> destination) const;
+
+        /**
+        * Asks the operating system to start paging in a byte range of a mapped volume.
+        * Does nothing if the volume owns its data, which is resident already.
+        * @param offsetInBytes Start of the range in bytes.
+        * @param sizeInBytes Size of the range in bytes.
+        * @return void
+        */
+        void Prefetch(size_t offsetInBytes, size_t sizeInBytes) const;
 
         /**
         * Allocates data storage based on metadata dimensions.
+        * Releases any file mapping or sparse volume backing the volume.
         * @return void
         */
         void AllocateData();
@@ -128,8 +219,22 @@ namespace VolumeData
         bool SetVoxel16(uint32_t x, uint32_t y, uint32_t z, uint16_t value);
 
     private:
+        /**
+        * A sparse volume together with its dense view, which is expanded once on first use.
+        */
+        struct SparseBacking
+        {
+            SparseVolumeData sparseData; /**< The sparse volume. */
+            std::once_flag denseDataFlag; /**< Guards the expansion of the dense view. */
+            std::vector<uint8_t> denseData; /**< Dense view of the sparse volume, empty until first use. */
+        };
+
         VolumeMetadata m_metadata; /**< Volume metadata (dimensions, bit depth). */
-        std::vector<uint8_t> m_data; /**< Contiguous array of voxel data. */
+        std::vector<uint8_t> m_data; /**< Contiguous array of voxel data, empty if the volume is mapped or sparse. */
+        std::shared_ptr<const MappedFile> m_mappedFile; /**< Read-only file mapping backing the voxel data, or nullptr if owned. */
+        std::shared_ptr<SparseBacking> m_sparseBacking; /**< Sparse volume backing the voxel data, or nullptr if owned or mapped. */
+        std::filesystem::path m_sourcePath; /**< Path of the .raw file the volume was loaded from, empty if not loaded from a file. */
+        std::optional<uint64_t> m_contentHash; /**< Hash of metadata and voxels, or std::nullopt if not computed or the volume was modified since. */
 
         /**
         * Computes the linear index for 3D voxel coordinates.
@@ -0,0 +1,38 @@
+#include <volumedata/VolumeHandle.h>
+
+#include <utility>
+
+VolumeData::VolumeHandle::VolumeHandle()
+    : m_volumeData{std::make_shared<const VolumeData>()}
+{
+}
+
+VolumeData::VolumeHandle::VolumeHandle(VolumeData&& volumeData)
+    : m_volumeData{std::make_shared<const VolumeData>(std::move(volumeData))}
+{
+}
+
+const VolumeData::VolumeData& VolumeData::VolumeHandle::operator*() const
+{
+    return *m_volumeData;
+}
+
+const VolumeData::VolumeData* VolumeData::VolumeHandle::operator->() const
+{
+    return m_volumeData.get();
+}
+
+const VolumeData::VolumeData& VolumeData::VolumeHandle::Get() const
+{
+    return *m_volumeData;
+}
+
+VolumeData::VolumeData VolumeData::VolumeHandle::Clone() const
+{
+    return m_volumeData->Clone();
+}
+
+long VolumeData::VolumeHandle::GetUseCount() const
+{
+    return m_volumeData.use_count();
+}
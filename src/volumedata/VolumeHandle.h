@@ -0,0 +1,69 @@
+/**
+* \file VolumeHandle.h
+*
+* \brief Reference-counted handle to an immutable volume.
+*/
+
+#ifndef VOLUME_HANDLE_H
+#define VOLUME_HANDLE_H
+
+#include <volumedata/VolumeData.h>
+
+#include <memory>
+
+namespace VolumeData
+{
+    /**
+    * \class VolumeHandle
+    *
+    * \brief Shares a single immutable VolumeData between its users without copying the voxels.
+    *
+    * Copying a handle only increments a reference count, so the storage, loaders,
+    * preprocessing stages and views can each hold the same volume, and the voxels are
+    * released together with the last handle. The volume cannot be modified through a
+    * handle. A modified volume is made from an explicit Clone() of the shared one and
+    * published by assigning a new handle, which leaves the volume seen by other holders
+    * of the old handle untouched.
+    *
+    * A handle is never empty: a default-constructed handle refers to an invalid volume.
+    *
+    * @see VolumeData for the shared volume.
+    * @see Storage for the handle of the rendered volume.
+    */
+    class VolumeHandle
+    {
+    public:
+        /**
+        * Default constructor.
+        * Creates a handle to an empty, invalid volume.
+        */
+        VolumeHandle();
+
+        /**
+        * Constructor.
+        * @param volumeData The volume as rvalue reference to be moved into the shared state.
+        */
+        explicit VolumeHandle(VolumeData&& volumeData);
+
+        const VolumeData& operator*() const;
+        const VolumeData* operator->() const;
+        const VolumeData& Get() const;
+
+        /**
+        * Creates an editable copy of the shared volume.
+        * @return VolumeData The copy, which is independent of all handles.
+        */
+        VolumeData Clone() const;
+
+        /**
+        * Gets the number of handles sharing the volume.
+        * @return long The number of handles, including this one.
+        */
+        long GetUseCount() const;
+
+    private:
+        std::shared_ptr<const VolumeData> m_volumeData; /**< The shared volume, never null. */
+    };
+}
+
+#endif
@@ -0,0 +1,43 @@
+/**
+* \file VolumeHistogram.h
+*
+* \brief Value histogram of a volume, per component.
+*/
+
+#ifndef VOLUME_HISTOGRAM_H
+#define VOLUME_HISTOGRAM_H
+
+#include <algorithm>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace VolumeData
+{
+    /**
+    * \struct VolumeHistogram
+    *
+    * \brief Number of voxels per value bin, stored separately for each component.
+    *
+    * The bins split the full value range of the component type evenly, so bin i of
+    * an N-bin histogram covers normalized values in [i / N, (i + 1) / N). This matches
+    * the [0, 1] domain of the transfer function.
+    *
+    * Counts are stored component-major: all bins of component 0, then all bins of component 1.
+    *
+    * @see ComputeVolumeHistogram for computing the histogram of a volume.
+    * @see TransferFunctionGui for drawing the histogram behind the transfer function.
+    */
+    struct VolumeHistogram
+    {
+        uint32_t numBins = 0; /**< Number of bins per component. */
+        uint32_t components = 0; /**< Number of components of the volume. */
+        std::vector<uint64_t> counts; /**< Voxel counts, numBins per component. */
+
+        bool IsEmpty() const { return counts.empty(); }
+        std::span<const uint64_t> GetCounts(uint32_t component) const { return std::span{counts}.subspan(static_cast<size_t>(component) * numBins, numBins); }
+        uint64_t GetMaxCount(uint32_t component) const { return IsEmpty() ? 0 : std::ranges::max(GetCounts(component)); }
+    };
+}
+
+#endif
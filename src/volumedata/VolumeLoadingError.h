@@ -15,7 +15,8 @@ namespace VolumeData
     * \brief Error codes returned by volume loading functions.
     *
     * Enumerates all possible error conditions that can occur when loading
-    * volume data from .raw files and their companion .dat metadata files.
+    * volume data from .raw files and their companion .dat metadata files,
+    * and from bricked volume files.
     * Used with std::expected in VolumeLoadingResult to provide type-safe
     * error handling without exceptions.
     *
@@ -33,7 +34,12 @@ namespace VolumeData
         CannotOpenMetadataFile,  /**< Could not open the .dat metadata file for reading. */
         MetadataParseError,      /**< Failed to parse metadata values from .dat file. */
         InvalidMetadata,         /**< Metadata validation failed (invalid dimensions, components, etc.). */
-        InvalidVolumeData        /**< Volume data validation failed after loading. */
+        InvalidVolumeData,       /**< Volume data validation failed after loading. */
+        CannotMapRawFile,        /**< Could not create a memory mapping of the .raw file. */
+        InvalidBrickedFileHeader, /**< The bricked volume file header is missing, truncated or inconsistent. */
+        UnsupportedBrickedFileVersion, /**< The bricked volume file uses an unsupported format version or brick compression. */
+        CorruptBrickIndex,       /**< A brick index entry points outside the file or has an unexpected size. */
+        InvalidRegion            /**< The requested region is empty, exceeds the volume or has a stride of 0. */
     };
 }
 
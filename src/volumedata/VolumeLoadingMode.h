@@ -0,0 +1,38 @@
+/**
+* \file VolumeLoadingMode.h
+*
+* \brief Startup loading strategies for the dataset.
+*/
+
+#ifndef VOLUME_LOADING_MODE_H
+#define VOLUME_LOADING_MODE_H
+
+namespace VolumeData
+{
+    /**
+    * \enum VolumeLoadingMode
+    *
+    * \brief Selects whether the dataset is loaded before or after the first frame, or streamed on demand.
+    *
+    * Blocking loads the whole volume in Factory::MakeStorage and exits the application
+    * if loading fails. Progressive starts with an empty volume and lets the
+    * ProgressiveVolumeLoader publish coarse proxies and finally the full-resolution
+    * volume from a background thread while the application stays interactive.
+    * Paged never loads the whole volume: Config::datasetPath names the level-0 file of
+    * a bricked volume with precomputed coarser levels, and the PagedVolumeStreamer keeps
+    * only the bricks the ray caster asks for in a fixed-size brick atlas, so that volumes
+    * larger than GPU or host memory can be viewed.
+    *
+    * @see Factory::MakeStorage for the blocking load.
+    * @see ProgressiveVolumeLoader for the progressive load.
+    * @see PagedVolumeStreamer for the paged rendering path.
+    */
+    enum class VolumeLoadingMode
+    {
+        Blocking,   /**< Load the full volume before the first frame. */
+        Progressive, /**< Load in the background, refining from coarse proxies to full resolution. */
+        Paged        /**< Stream the bricks needed for the current view from a multi-level bricked volume. */
+    };
+}
+
+#endif
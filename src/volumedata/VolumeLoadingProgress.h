@@ -0,0 +1,36 @@
+/**
+* \file VolumeLoadingProgress.h
+*
+* \brief Progress of the background volume loading.
+*/
+
+#ifndef VOLUME_LOADING_PROGRESS_H
+#define VOLUME_LOADING_PROGRESS_H
+
+#include <volumedata/VolumeLoadingError.h>
+
+#include <cstdint>
+#include <optional>
+
+namespace VolumeData
+{
+    /**
+    * \struct VolumeLoadingProgress
+    *
+    * \brief Snapshot of the background volume loading state for display in the GUI.
+    *
+    * Written by ProgressiveVolumeLoader::Update() on the main thread and read by the Gui.
+    *
+    * @see ProgressiveVolumeLoader for the loader updating this snapshot.
+    * @see Gui for displaying the loading progress.
+    */
+    struct VolumeLoadingProgress
+    {
+        bool isLoading = false; /**< True while the loader is still refining the volume. */
+        float fraction = 0.0f; /**< Estimated fraction of the total loading work done, in [0, 1]. */
+        uint32_t displayedStride = 0; /**< Subsampling stride of the displayed volume, 1 for full resolution, 0 if none is displayed yet. */
+        std::optional<VolumeLoadingError> error; /**< The error that stopped loading, if any. */
+    };
+}
+
+#endif
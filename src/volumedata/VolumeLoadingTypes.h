@@ -32,6 +32,17 @@ namespace VolumeData
     * @see LoadVolumeRaw for volume loading functions returning this type.
     */
     using VolumeLoadingResult = std::expected<VolumeData, VolumeLoadingError>;
+
+    /**
+    * \typedef VolumeMetadataLoadingResult
+    *
+    * \brief Result type for volume metadata loading operations.
+    *
+    * @see VolumeMetadata for the successfully loaded metadata.
+    * @see VolumeLoadingError for error information.
+    * @see LoadVolumeMetadata for the function returning this type.
+    */
+    using VolumeMetadataLoadingResult = std::expected<VolumeMetadata, VolumeLoadingError>;
 }
 
 #endif
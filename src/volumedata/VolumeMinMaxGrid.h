@@ -0,0 +1,42 @@
+/**
+* \file VolumeMinMaxGrid.h
+*
+* \brief Coarse grid of value ranges over the bricks of a volume.
+*/
+
+#ifndef VOLUME_MIN_MAX_GRID_H
+#define VOLUME_MIN_MAX_GRID_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace VolumeData
+{
+    /**
+    * \struct VolumeMinMaxGrid
+    *
+    * \brief Normalized value range of the first component per brick of a volume.
+    *
+    * Bricks are cubes of brickSize voxels, numbered x-fastest, then y, then z. Values are
+    * normalized to [0, 1] the same way the volume texture returns them in the shader.
+    * Each range also covers a one-voxel apron around its brick, so that trilinear samples
+    * taken inside a brick always lie within the brick's range.
+    *
+    * @see MakeVolumeMinMaxGrid for computing the grid.
+    * @see ClassifyBricks for classifying bricks against a transfer function.
+    */
+    struct VolumeMinMaxGrid
+    {
+        uint32_t brickSize = 0; /**< Edge length of a brick in voxels. */
+        uint32_t numBricksX = 0; /**< Number of bricks in x direction. */
+        uint32_t numBricksY = 0; /**< Number of bricks in y direction. */
+        uint32_t numBricksZ = 0; /**< Number of bricks in z direction. */
+        std::vector<float> minValues; /**< Smallest normalized value per brick. */
+        std::vector<float> maxValues; /**< Largest normalized value per brick. */
+
+        size_t GetNumBricks() const { return static_cast<size_t>(numBricksX) * numBricksY * numBricksZ; }
+    };
+}
+
+#endif
@@ -0,0 +1,34 @@
+/**
+* \file VolumeQuantizationMode.h
+*
+* \brief Quantization modes for uploading 16-bit volumes as 8-bit textures.
+*/
+
+#ifndef VOLUME_QUANTIZATION_MODE_H
+#define VOLUME_QUANTIZATION_MODE_H
+
+namespace VolumeData
+{
+    /**
+    * \enum VolumeQuantizationMode
+    *
+    * \brief Selects whether and how 16-bit volumes are remapped to an 8-bit texture.
+    *
+    * Off uploads 16-bit volumes as they are. WindowLevel remaps the values inside the
+    * VolumeWindow in GuiParameters to the full 8-bit range and clamps the rest, which halves
+    * the texture memory and bandwidth. Percentile does the same, but fits the window to
+    * the histogram percentiles in Config whenever a new volume is published.
+    * 8-bit volumes are never quantized.
+    *
+    * @see QuantizeVolumeData for the conversion.
+    * @see VolumeQuantizationUpdater for re-quantizing when the window changes.
+    */
+    enum class VolumeQuantizationMode
+    {
+        Off,         /**< Upload 16-bit volumes without conversion. */
+        WindowLevel, /**< Remap 16-bit volumes through the window set in the GUI. */
+        Percentile   /**< Remap 16-bit volumes through a window fitted to histogram percentiles. */
+    };
+}
+
+#endif
@@ -0,0 +1,156 @@
+#include <volumedata/VolumeQuantizationUpdater.h>
+#include <volumedata/ComputePercentileWindow.h>
+#include <volumedata/IsVolumeQuantized.h>
+#include <volumedata/LoadOrComputeVolumeHistogram.h>
+#include <volumedata/MakeVolumeDataTexture.h>
+#include <volumedata/MakeVolumePyramid.h>
+#include <volumedata/QuantizeVolumeData.h>
+#include <volumedata/UploadVolumePyramid.h>
+#include <volumedata/VolumeLoadingProgress.h>
+
+#include <config/Config.h>
+#include <context/PostEmptyEvent.h>
+#include <gui/GuiParameters.h>
+#include <gui/GuiUpdateFlags.h>
+#include <textures/Texture.h>
+#include <textures/TextureId.h>
+
+#include <utility>
+
+namespace
+{
+    std::vector<VolumeData::VolumeData> MakePyramidLevels(const VolumeData::VolumeData& volumeData)
+    {
+        return Config::generateVolumePyramid ? VolumeData::MakeVolumePyramid(volumeData) : std::vector<VolumeData::VolumeData>{};
+    }
+} // anonymous namespace
+
+VolumeData::VolumeQuantizationUpdater::VolumeQuantizationUpdater(
+    GuiUpdateFlags& guiUpdateFlags,
+    GuiParameters& guiParameters,
+    const VolumeHandle& volumeData,
+    const VolumeLoadingProgress& volumeLoadingProgress,
+    Texture& volumeDataTexture
+)
+    : m_guiUpdateFlags{guiUpdateFlags}
+    , m_guiParameters{guiParameters}
+    , m_volumeData{volumeData}
+    , m_volumeLoadingProgress{volumeLoadingProgress}
+    , m_volumeDataTexture{volumeDataTexture}
+    , m_requestedVolumeWindow{guiParameters.volumeWindow}
+    , m_mutex{}
+    , m_isQuantizing{false}
+    , m_isTimeStepOutdated{false}
+    , m_pendingVolumeData{}
+    , m_pendingPyramidLevels{}
+    , m_workerThread{}
+{
+    if (m_volumeData->IsValid() && IsVolumeQuantized(m_volumeData->GetMetadata()))
+    {
+        if (Config::volumeQuantizationMode == VolumeQuantizationMode::Percentile)
+        {
+            FitVolumeWindow();
+        }
+        Quantize();
+    }
+}
+
+void VolumeData::VolumeQuantizationUpdater::Update()
+{
+    const bool isFitRequested = std::exchange(m_guiUpdateFlags.volumeWindowFitRequested, false);
+
+    if (!m_volumeData->IsValid() || !IsVolumeQuantized(m_volumeData->GetMetadata()))
+    {
+        return;
+    }
+
+    if (m_guiUpdateFlags.volumeDataChanged)
+    {
+        if (Config::volumeQuantizationMode == VolumeQuantizationMode::Percentile)
+        {
+            FitVolumeWindow();
+        }
+        Quantize();
+        return;
+    }
+
+    if (isFitRequested)
+    {
+        FitVolumeWindow();
+    }
+
+    if (m_guiUpdateFlags.timeStepChanged)
+    {
+        m_isTimeStepOutdated = true;
+    }
+
+    std::optional<VolumeData> pendingVolumeData;
+    std::vector<VolumeData> pendingPyramidLevels;
+    bool isQuantizing = false;
+    {
+        std::lock_guard lock{m_mutex};
+        pendingVolumeData = std::exchange(m_pendingVolumeData, std::nullopt);
+        pendingPyramidLevels = std::exchange(m_pendingPyramidLevels, {});
+        isQuantizing = m_isQuantizing;
+    }
+
+    if (pendingVolumeData)
+    {
+        Upload(pendingVolumeData.value(), pendingPyramidLevels);
+    }
+
+    // Levels of a volume that is still loading are replaced anyway. The worker holds its own handle,
+    // so the volume it reads stays alive even if it is replaced before the worker is done.
+    if (isQuantizing || m_volumeLoadingProgress.isLoading || (m_guiParameters.volumeWindow == m_requestedVolumeWindow && !m_isTimeStepOutdated))
+    {
+        return;
+    }
+
+    m_requestedVolumeWindow = m_guiParameters.volumeWindow;
+    m_isTimeStepOutdated = false;
+    {
+        std::lock_guard lock{m_mutex};
+        m_isQuantizing = true;
+    }
+    m_workerThread = std::jthread{[this](VolumeHandle volumeData, VolumeWindow volumeWindow) { QuantizeInBackground(std::move(volumeData), volumeWindow); }, m_volumeData, m_requestedVolumeWindow};
+}
+
+void VolumeData::VolumeQuantizationUpdater::FitVolumeWindow()
+{
+    const auto volumeHistogram = LoadOrComputeVolumeHistogram(*m_volumeData, Config::volumeQuantizationHistogramNumBins);
+    m_guiParameters.volumeWindow = ComputePercentileWindow(volumeHistogram, Config::volumeQuantizationLowerPercentile, Config::volumeQuantizationUpperPercentile);
+}
+
+void VolumeData::VolumeQuantizationUpdater::Quantize()
+{
+    m_requestedVolumeWindow = m_guiParameters.volumeWindow;
+    m_isTimeStepOutdated = false;
+    const auto quantizedVolumeData = QuantizeVolumeData(*m_volumeData, m_requestedVolumeWindow);
+    Upload(quantizedVolumeData, MakePyramidLevels(quantizedVolumeData));
+}
+
+void VolumeData::VolumeQuantizationUpdater::QuantizeInBackground(VolumeHandle volumeData, VolumeWindow volumeWindow)
+{
+    auto quantizedVolumeData = QuantizeVolumeData(*volumeData, volumeWindow);
+    auto pyramidLevels = MakePyramidLevels(quantizedVolumeData);
+
+    {
+        std::lock_guard lock{m_mutex};
+        m_pendingVolumeData = std::move(quantizedVolumeData);
+        m_pendingPyramidLevels = std::move(pyramidLevels);
+        m_isQuantizing = false;
+    }
+    Context::PostEmptyEvent();
+}
+
+void VolumeData::VolumeQuantizationUpdater::Upload(const VolumeData& quantizedVolumeData, const std::vector<VolumeData>& pyramidLevels)
+{
+    if (!quantizedVolumeData.IsValid())
+    {
+        return;
+    }
+
+    m_volumeDataTexture = Factory::MakeVolumeDataTexture(TextureId::VolumeData, m_volumeDataTexture.GetTextureUnitEnum(), quantizedVolumeData);
+    UploadVolumePyramid(m_volumeDataTexture, pyramidLevels);
+    m_guiUpdateFlags.redrawRequested = true;
+}
@@ -0,0 +1,123 @@
+/**
+* \file VolumeQuantizationUpdater.h
+*
+* \brief Keeps the quantized 8-bit volume texture in sync with the volume window.
+*/
+
+#ifndef VOLUME_QUANTIZATION_UPDATER_H
+#define VOLUME_QUANTIZATION_UPDATER_H
+
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeHandle.h>
+#include <volumedata/VolumeWindow.h>
+
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <vector>
+
+struct GuiParameters;
+struct GuiUpdateFlags;
+class Texture;
+
+namespace VolumeData
+{
+    struct VolumeLoadingProgress;
+
+    /**
+    * \class VolumeQuantizationUpdater
+    *
+    * \brief Uploads 16-bit volumes as 8-bit textures remapped through the volume window.
+    *
+    * Only active if IsVolumeQuantized() holds for the volume in Storage. Whenever a volume
+    * is published, the updater quantizes it on the main thread and replaces the
+    * TextureId::VolumeData texture, including its mip levels. In Percentile mode, the window
+    * in GuiParameters is fitted to the histogram first. A fit can also be requested from the
+    * GUI via GuiUpdateFlags::volumeWindowFitRequested.
+    *
+    * When the window changes afterwards, the volume is re-quantized on a background thread
+    * and the texture is replaced once the result is ready. While a job is running, further
+    * changes are coalesced into a single follow-up job for the latest window. Background jobs
+    * only start after loading has finished, as the loader replaces the volume in Storage
+    * anyway. Timesteps presented while a time series is playing, signaled by
+    * GuiUpdateFlags::timeStepChanged, are quantized by background jobs with the current
+    * window as well, coalesced in the same way.
+    *
+    * The worker thread is joined on destruction.
+    *
+    * @see QuantizeVolumeData for the conversion.
+    * @see VolumeQuantizationMode for selecting the mode.
+    * @see Factory::MakeVolumeQuantizationUpdater for construction from Storage.
+    */
+    class VolumeQuantizationUpdater
+    {
+    public:
+        /**
+        * Constructor.
+        * Quantizes and uploads the current volume if it is quantized.
+        * @param guiUpdateFlags Reference to GUI update flags for change detection.
+        * @param guiParameters Reference to GUI parameters holding the volume window.
+        * @param volumeData Reference to the handle of the volume data in Storage.
+        * @param volumeLoadingProgress Reference to the loading progress in Storage.
+        * @param volumeDataTexture Reference to the volume data texture in Storage to replace.
+        */
+        VolumeQuantizationUpdater(
+            GuiUpdateFlags& guiUpdateFlags,
+            GuiParameters& guiParameters,
+            const VolumeHandle& volumeData,
+            const VolumeLoadingProgress& volumeLoadingProgress,
+            Texture& volumeDataTexture
+        );
+
+        VolumeQuantizationUpdater(const VolumeQuantizationUpdater&) = delete;
+        VolumeQuantizationUpdater& operator=(const VolumeQuantizationUpdater&) = delete;
+        VolumeQuantizationUpdater(VolumeQuantizationUpdater&&) = delete;
+        VolumeQuantizationUpdater& operator=(VolumeQuantizationUpdater&&) = delete;
+
+        /**
+        * Quantizes newly published volumes, uploads finished background jobs and starts new ones.
+        * Should be called once per frame after the ProgressiveVolumeLoader.
+        * @return void
+        */
+        void Update();
+
+    private:
+        /**
+        * Fits the volume window in GuiParameters to the histogram percentiles in Config.
+        */
+        void FitVolumeWindow();
+
+        /**
+        * Quantizes the volume with the current window on the calling thread and uploads it.
+        */
+        void Quantize();
+
+        /**
+        * Worker thread entry point.
+        * @param volumeData Handle of the volume to quantize, shared with the Storage for the lifetime of the worker.
+        * @param volumeWindow The window to quantize with.
+        */
+        void QuantizeInBackground(VolumeHandle volumeData, VolumeWindow volumeWindow);
+
+        /**
+        * Replaces the volume data texture with a quantized volume and its mip levels.
+        */
+        void Upload(const VolumeData& quantizedVolumeData, const std::vector<VolumeData>& pyramidLevels);
+
+    private:
+        GuiUpdateFlags& m_guiUpdateFlags; /**< Reference to GUI update flags. */
+        GuiParameters& m_guiParameters; /**< Reference to GUI parameters. */
+        const VolumeHandle& m_volumeData; /**< Reference to the handle of the volume data in Storage. */
+        const VolumeLoadingProgress& m_volumeLoadingProgress; /**< Reference to the loading progress in Storage. */
+        Texture& m_volumeDataTexture; /**< Reference to the volume data texture in Storage. */
+        VolumeWindow m_requestedVolumeWindow; /**< Window of the uploaded texture or of the running job. */
+        std::mutex m_mutex; /**< Guards the members shared with the worker thread below. */
+        bool m_isQuantizing; /**< Whether a background job is running. */
+        bool m_isTimeStepOutdated; /**< True if a timestep was presented after the running job or the uploaded texture was started. */
+        std::optional<VolumeData> m_pendingVolumeData; /**< Finished quantized volume not yet uploaded. */
+        std::vector<VolumeData> m_pendingPyramidLevels; /**< Downsampled levels of the pending volume. */
+        std::jthread m_workerThread; /**< Background quantization thread, declared last so it is joined first. */
+    };
+}
+
+#endif
@@ -0,0 +1,44 @@
+/**
+* \file VolumeRegion.h
+*
+* \brief Box and sampling stride selecting the part of a volume to load.
+*/
+
+#ifndef VOLUME_REGION_H
+#define VOLUME_REGION_H
+
+#include <cstdint>
+
+namespace VolumeData
+{
+    /**
+    * \struct VolumeRegion
+    *
+    * \brief Region of interest and sampling stride for loading part of a volume.
+    *
+    * The box is given in voxels of the volume on disk. A size of 0 extends the box to the
+    * end of the volume along that axis, so a default-constructed region covers the whole
+    * volume at full resolution. Within the box, every stride-th voxel is loaded along each
+    * axis, starting with the first voxel of the box.
+    *
+    * @see GetVolumeRegionMetadata for the metadata of the loaded region.
+    * @see LoadVolume for loading a region of a volume file.
+    */
+    struct VolumeRegion
+    {
+        uint32_t x = 0; /**< X coordinate of the first voxel of the box. */
+        uint32_t y = 0; /**< Y coordinate of the first voxel of the box. */
+        uint32_t z = 0; /**< Z coordinate of the first voxel of the box. */
+        uint32_t width = 0; /**< Width of the box in voxels, 0 to extend it to the end of the volume. */
+        uint32_t height = 0; /**< Height of the box in voxels, 0 to extend it to the end of the volume. */
+        uint32_t depth = 0; /**< Depth of the box in voxels, 0 to extend it to the end of the volume. */
+        uint32_t stride = 1; /**< Sampling stride along each axis. */
+
+        /// True if the region selects the whole volume at full resolution, whatever its size
+        bool IsWholeVolume() const { return x == 0 && y == 0 && z == 0 && width == 0 && height == 0 && depth == 0 && stride == 1; }
+
+        bool operator==(const VolumeRegion&) const = default;
+    };
+}
+
+#endif
@@ -0,0 +1,34 @@
+/**
+* \file VolumeResidencyPolicy.h
+*
+* \brief Policies for keeping the host copy of an uploaded volume.
+*/
+
+#ifndef VOLUME_RESIDENCY_POLICY_H
+#define VOLUME_RESIDENCY_POLICY_H
+
+namespace VolumeData
+{
+    /**
+    * \enum VolumeResidencyPolicy
+    *
+    * \brief Selects whether the voxels of a volume stay in host memory once its texture exists.
+    *
+    * The render loop only reads the texture, so the host copy is needed only by CPU-side
+    * features such as histograms, gradients, the occupancy grid and quantization.
+    * KeepResident holds the voxels in memory for the whole session. ReleaseAfterUpload
+    * replaces an owned buffer by a read-only mapping of a file with the same bytes, so the
+    * pages are read back on demand when a CPU-side feature touches them and can be dropped
+    * again by the operating system under memory pressure.
+    *
+    * @see ReleaseVolumeHostCopy for the release of the host copy.
+    * @see VolumeStorageMode for how the voxels are held before the release.
+    */
+    enum class VolumeResidencyPolicy
+    {
+        KeepResident,      /**< The voxels stay in host memory for the whole session. */
+        ReleaseAfterUpload /**< The owned voxels are replaced by an on-demand file mapping after the upload. */
+    };
+}
+
+#endif
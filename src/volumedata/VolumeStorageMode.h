@@ -0,0 +1,43 @@
+/**
+* \file VolumeStorageMode.h
+*
+* \brief Host-side storage modes for loaded volume data.
+*/
+
+#ifndef VOLUME_STORAGE_MODE_H
+#define VOLUME_STORAGE_MODE_H
+
+namespace VolumeData
+{
+    /**
+    * \enum VolumeStorageMode
+    *
+    * \brief Selects how the voxel bytes of a loaded volume are held in host memory.
+    *
+    * Owning reads the file into a heap buffer owned by VolumeData, which is required
+    * for volumes that are edited after loading. Mapped maps the file read-only and lets
+    * VolumeData reference the mapping directly, which avoids the zero-fill and copy of
+    * the owning path and keeps peak memory at roughly one copy of the volume. A mapped
+    * volume is converted into an owning one on first mutable access. OwningUncached reads
+    * like Owning but bypasses the operating system file cache, for volumes on fast storage
+    * that are read once and would otherwise evict everything else from the cache. Sparse
+    * maps the file and converts it into a SparseVolumeData, so that only the bricks that
+    * are not uniform occupy host memory, which lets mostly empty volumes share the RAM of
+    * a workstation.
+    *
+    * @see LoadVolumeRaw for loading volumes with a given storage mode.
+    * @see MappedFile for the read-only file mapping.
+    * @see SparseVolumeData for the sparse representation.
+    * @see ReadFileInParallel for the reads of the owning modes.
+    * @see VolumeData for the volume data structure.
+    */
+    enum class VolumeStorageMode
+    {
+        Owning,         /**< Voxel data is read into a heap buffer owned by VolumeData. */
+        OwningUncached, /**< Voxel data is read into a heap buffer owned by VolumeData with direct I/O. */
+        Mapped,         /**< Voxel data is referenced from a read-only memory mapping of the .raw file. */
+        Sparse          /**< Voxel data is held as a SparseVolumeData, with uniform bricks stored as a single value. */
+    };
+}
+
+#endif
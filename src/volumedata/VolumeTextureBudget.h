@@ -0,0 +1,32 @@
+/**
+* \file VolumeTextureBudget.h
+*
+* \brief Limits the textures derived from a volume have to fit into.
+*/
+
+#ifndef VOLUME_TEXTURE_BUDGET_H
+#define VOLUME_TEXTURE_BUDGET_H
+
+#include <cstddef>
+#include <limits>
+
+namespace VolumeData
+{
+    /**
+    * \struct VolumeTextureBudget
+    *
+    * \brief Largest 3D texture size and video memory available to the textures of a volume.
+    *
+    * A default-constructed budget does not limit the volume.
+    *
+    * @see Factory::MakeVolumeTextureBudget for deriving the budget from the OpenGL context and Storage.
+    * @see GetVolumeDownsamplingFactor for fitting a volume into the budget.
+    */
+    struct VolumeTextureBudget
+    {
+        unsigned int maxDimension = std::numeric_limits<unsigned int>::max(); /**< Largest width, height and depth of a 3D texture. */
+        size_t maxSizeInBytes = std::numeric_limits<size_t>::max(); /**< Video memory available to all textures at the resolution of the volume. */
+    };
+}
+
+#endif
@@ -0,0 +1,28 @@
+/**
+* \file VolumeTextureFormat.h
+*
+* \brief OpenGL texture format parameters for volume data.
+*/
+
+#ifndef VOLUME_TEXTURE_FORMAT_H
+#define VOLUME_TEXTURE_FORMAT_H
+
+namespace VolumeData
+{
+    /**
+    * \struct VolumeTextureFormat
+    *
+    * \brief OpenGL internal format, pixel format and pixel type used to upload a volume.
+    *
+    * @see GetVolumeTextureFormat for deriving the format from volume metadata.
+    * @see Factory::MakeVolumeDataTexture for uploading volume data with this format.
+    */
+    struct VolumeTextureFormat
+    {
+        unsigned int internalFormat; /**< The internal format of the texture (e.g., GL_R8, GL_R16). */
+        unsigned int format; /**< The format of the uploaded data (e.g., GL_RED). */
+        unsigned int type; /**< The data type of the uploaded data (e.g., GL_UNSIGNED_BYTE). */
+    };
+}
+
+#endif
@@ -0,0 +1,36 @@
+/**
+* \file VolumeUploadMode.h
+*
+* \brief Upload strategies for the volume data texture.
+*/
+
+#ifndef VOLUME_UPLOAD_MODE_H
+#define VOLUME_UPLOAD_MODE_H
+
+namespace VolumeData
+{
+    /**
+    * \enum VolumeUploadMode
+    *
+    * \brief Selects how the volume data texture is filled.
+    *
+    * Direct uploads the whole volume with a single glTexImage3D call from the host copy
+    * held by VolumeData. Streamed allocates the texture storage up front and fills it slab
+    * by slab from the .raw file before the volume is loaded, overlapping disk reads on a
+    * worker thread with uploads on the OpenGL thread and keeping only a few slabs in host
+    * memory. The VolumeData of a streamed volume then only maps the file, regardless of
+    * Config::volumeStorageMode, so that the voxels are not read twice. Volumes that must be
+    * loaded into host memory first, such as bricked files, regions, quantized volumes and
+    * volumes exceeding the texture budget, fall back to Direct.
+    *
+    * @see Factory::MakeVolumeDataTexture for the direct upload.
+    * @see Factory::MakeStreamedVolumeDataTexture for the streamed upload.
+    */
+    enum class VolumeUploadMode
+    {
+        Direct,  /**< Upload the whole volume at once from host memory. */
+        Streamed /**< Stream Z-slabs from the source file through pixel unpack buffers. */
+    };
+}
+
+#endif
@@ -0,0 +1,313 @@
+/**
+* \file VolumeView.h
+*
+* \brief Typed, unchecked view of the voxels of a volume for CPU-side processing.
+*/
+
+#ifndef VOLUME_VIEW_H
+#define VOLUME_VIEW_H
+
+#include <volumedata/BrickExtent.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <type_traits>
+
+namespace VolumeData
+{
+    /**
+    * \class VolumeView
+    *
+    * \brief Non-owning view of a box of voxels with the voxel type and component count fixed at compile time.
+    *
+    * Unlike VolumeData::GetVoxel8() and VolumeData::GetVoxel16(), which check bounds, bit
+    * depth and component count on every call, the format is checked once when the view is
+    * created by MakeVolumeView() or VisitVolumeView(), and the accessors perform no checks.
+    * Coordinates must be within the view.
+    *
+    * Rows are always contiguous, so processing is best written as loops over the spans
+    * returned by GetRow(), GetRowNeighborhood() or GetRows(), which the compiler can
+    * vectorize. Slices and bricks are views of their own that share the strides of the
+    * volume. Voxels are stored x-fastest with their components interleaved.
+    *
+    * @tparam T uint8_t or uint16_t, const-qualified for read-only views.
+    * @tparam Components Number of components per voxel.
+    *
+    * @see MakeVolumeView for creating a view of a VolumeData.
+    * @see VisitVolumeView for dispatching on the format of a VolumeData.
+    */
+    template <typename T, uint32_t Components = 1>
+    class VolumeView
+    {
+    public:
+        using ValueType = std::remove_const_t<T>;
+
+        static_assert(std::is_same_v<ValueType, uint8_t> || std::is_same_v<ValueType, uint16_t>, "VolumeView supports 8-bit and 16-bit voxels");
+        static_assert(Components >= 1 && Components <= 4, "VolumeView supports one to four components");
+
+        static constexpr uint32_t numComponents = Components;
+
+        /**
+        * The row of a voxel line together with its four clamped face neighbor rows.
+        * At the volume boundary a neighbor row is the row itself, which matches GL_CLAMP_TO_EDGE.
+        */
+        struct RowNeighborhood
+        {
+            std::span<T> row; /**< The row itself. */
+            std::span<T> previousRow; /**< The row at y - 1. */
+            std::span<T> nextRow; /**< The row at y + 1. */
+            std::span<T> previousSlice; /**< The row at z - 1. */
+            std::span<T> nextSlice; /**< The row at z + 1. */
+        };
+
+        /**
+        * Constructor.
+        * @param data Pointer to the first component of the first voxel of the view.
+        * @param width Width of the view in voxels.
+        * @param height Height of the view in voxels.
+        * @param depth Depth of the view in voxels.
+        * @param rowStride Distance between consecutive rows in values.
+        * @param sliceStride Distance between consecutive slices in values.
+        */
+        VolumeView(T* data, uint32_t width, uint32_t height, uint32_t depth, size_t rowStride, size_t sliceStride)
+            : m_data{data}
+            , m_width{width}
+            , m_height{height}
+            , m_depth{depth}
+            , m_rowStride{rowStride}
+            , m_sliceStride{sliceStride}
+        {
+        }
+
+        uint32_t GetWidth() const { return m_width; }
+        uint32_t GetHeight() const { return m_height; }
+        uint32_t GetDepth() const { return m_depth; }
+        size_t GetRowStride() const { return m_rowStride; }
+        size_t GetSliceStride() const { return m_sliceStride; }
+        size_t GetRowLength() const { return static_cast<size_t>(m_width) * Components; }
+        size_t GetNumVoxels() const { return static_cast<size_t>(m_width) * m_height * m_depth; }
+        T* GetDataPtr() const { return m_data; }
+
+        /**
+        * Checks whether the voxels of the view are stored without gaps, which is the case for whole volumes and slices.
+        * @return bool True if GetVoxels() covers exactly the voxels of the view.
+        */
+        bool IsContiguous() const
+        {
+            return (m_height <= 1 || m_rowStride == GetRowLength()) && (m_depth <= 1 || m_sliceStride == m_rowStride * m_height);
+        }
+
+        /**
+        * Gets all values of a contiguous view as a single span.
+        * @return std::span<T> The values of the view, or an empty span if the view is not contiguous.
+        */
+        std::span<T> GetVoxels() const
+        {
+            return IsContiguous() ? std::span<T>{m_data, GetNumVoxels() * Components} : std::span<T>{};
+        }
+
+        /**
+        * Gets a component of a voxel without any checks.
+        * @param x The x coordinate.
+        * @param y The y coordinate.
+        * @param z The z coordinate.
+        * @param component The component index.
+        * @return T& The value.
+        */
+        T& At(uint32_t x, uint32_t y, uint32_t z, uint32_t component = 0) const
+        {
+            return m_data[z * m_sliceStride + y * m_rowStride + static_cast<size_t>(x) * Components + component];
+        }
+
+        /**
+        * Gets a component of a voxel with the coordinates clamped to the view, like GL_CLAMP_TO_EDGE.
+        * @param x The x coordinate, may be outside of the view.
+        * @param y The y coordinate, may be outside of the view.
+        * @param z The z coordinate, may be outside of the view.
+        * @param component The component index.
+        * @return ValueType The value of the nearest voxel inside the view.
+        */
+        ValueType GetClamped(int64_t x, int64_t y, int64_t z, uint32_t component = 0) const
+        {
+            return At(Clamp(x, m_width), Clamp(y, m_height), Clamp(z, m_depth), component);
+        }
+
+        /**
+        * Gets a row of voxels.
+        * @param y The y coordinate of the row.
+        * @param z The z coordinate of the row.
+        * @return std::span<T> The GetRowLength() values of the row.
+        */
+        std::span<T> GetRow(uint32_t y, uint32_t z) const
+        {
+            return {m_data + z * m_sliceStride + y * m_rowStride, GetRowLength()};
+        }
+
+        /**
+        * Gets a row and its face neighbor rows, clamped to the view.
+        * @param y The y coordinate of the row.
+        * @param z The z coordinate of the row.
+        * @return RowNeighborhood The row and its neighbors.
+        */
+        RowNeighborhood GetRowNeighborhood(uint32_t y, uint32_t z) const
+        {
+            return RowNeighborhood{
+                GetRow(y, z),
+                GetRow((y > 0) ? y - 1 : 0, z),
+                GetRow(std::min(y + 1, m_height - 1), z),
+                GetRow(y, (z > 0) ? z - 1 : 0),
+                GetRow(y, std::min(z + 1, m_depth - 1))
+            };
+        }
+
+        /**
+        * Gets all rows of the view in memory order, y-fastest, then z.
+        * @return A range of std::span<T>, one per row.
+        */
+        auto GetRows() const
+        {
+            return std::views::iota(size_t{0}, static_cast<size_t>(m_height) * m_depth)
+                | std::views::transform([view = *this](size_t rowIndex)
+                {
+                    return view.GetRow(static_cast<uint32_t>(rowIndex % view.m_height), static_cast<uint32_t>(rowIndex / view.m_height));
+                });
+        }
+
+        /**
+        * Gets a single slice of the view.
+        * @param z The z coordinate of the slice.
+        * @return VolumeView A view of depth one.
+        */
+        VolumeView GetSlice(uint32_t z) const
+        {
+            return VolumeView{m_data + z * m_sliceStride, m_width, m_height, 1, m_rowStride, m_sliceStride};
+        }
+
+        /**
+        * Gets a box of voxels of the view.
+        * @param brickExtent The origin and size of the box, which must lie within the view.
+        * @return VolumeView A view of the box sharing the strides of this view.
+        */
+        VolumeView GetBrick(const BrickExtent& brickExtent) const
+        {
+            return VolumeView{&At(brickExtent.x, brickExtent.y, brickExtent.z), brickExtent.width, brickExtent.height, brickExtent.depth, m_rowStride, m_sliceStride};
+        }
+
+    private:
+        static uint32_t Clamp(int64_t coordinate, uint32_t size)
+        {
+            return static_cast<uint32_t>(std::clamp<int64_t>(coordinate, 0, static_cast<int64_t>(size) - 1));
+        }
+
+        T* m_data; /**< First value of the view. */
+        uint32_t m_width; /**< Width of the view in voxels. */
+        uint32_t m_height; /**< Height of the view in voxels. */
+        uint32_t m_depth; /**< Depth of the view in voxels. */
+        size_t m_rowStride; /**< Distance between consecutive rows in values. */
+        size_t m_sliceStride; /**< Distance between consecutive slices in values. */
+    };
+
+    /**
+    * Checks whether a volume can be viewed with the given voxel type and component count.
+    * @param metadata The metadata of the volume.
+    * @return bool True if bit depth and component count match.
+    */
+    template <typename T, uint32_t Components = 1>
+    bool IsVolumeViewCompatible(const VolumeMetadata& metadata)
+    {
+        return metadata.GetBitsPerComponent() == sizeof(T) * 8 && metadata.GetComponents() == Components;
+    }
+
+    /**
+    * Creates a read-only view of the voxels of a volume.
+    * @param volumeData The volume, which must outlive the view.
+    * @return A view of the whole volume, or std::nullopt if the volume is invalid or has a different format.
+    */
+    template <typename T, uint32_t Components = 1>
+    std::optional<VolumeView<const T, Components>> MakeVolumeView(const VolumeData& volumeData)
+    {
+        const auto& metadata = volumeData.GetMetadata();
+        if (!volumeData.IsValid() || !IsVolumeViewCompatible<T, Components>(metadata))
+        {
+            return std::nullopt;
+        }
+
+        const size_t rowStride = static_cast<size_t>(metadata.GetWidth()) * Components;
+        return VolumeView<const T, Components>{reinterpret_cast<const T*>(volumeData.GetDataPtr()), metadata.GetWidth(), metadata.GetHeight(), metadata.GetDepth(), rowStride, rowStride * metadata.GetHeight()};
+    }
+
+    /**
+    * Creates a writable view of the voxels of a volume.
+    * A mapped volume is materialized first, like all mutable accessors of VolumeData.
+    * @param volumeData The volume, which must outlive the view and must not be reallocated while it is in use.
+    * @return A view of the whole volume, or std::nullopt if the volume is invalid or has a different format.
+    */
+    template <typename T, uint32_t Components = 1>
+    std::optional<VolumeView<T, Components>> MakeVolumeView(VolumeData& volumeData)
+    {
+        const auto& metadata = volumeData.GetMetadata();
+        if (!volumeData.IsValid() || !IsVolumeViewCompatible<T, Components>(metadata))
+        {
+            return std::nullopt;
+        }
+
+        const size_t rowStride = static_cast<size_t>(metadata.GetWidth()) * Components;
+        return VolumeView<T, Components>{reinterpret_cast<T*>(volumeData.GetDataPtr()), metadata.GetWidth(), metadata.GetHeight(), metadata.GetDepth(), rowStride, rowStride * metadata.GetHeight()};
+    }
+
+    /**
+    * Calls a generic function with a read-only view of matching type for any 8-bit or 16-bit volume with one to four components.
+    * The function is instantiated once per format, so its loops are compiled for a fixed voxel layout.
+    * @param volumeData The volume to view.
+    * @param function Callable taking a VolumeView<const T, Components>.
+    * @return bool True if the function was called, false if the volume is invalid or has an unsupported format.
+    */
+    template <typename Function>
+    bool VisitVolumeView(const VolumeData& volumeData, Function&& function)
+    {
+        const auto& metadata = volumeData.GetMetadata();
+        if (!volumeData.IsValid())
+        {
+            return false;
+        }
+
+        const auto VisitWithType = [&]<typename T>()
+        {
+            switch (metadata.GetComponents())
+            {
+                case 1:
+                    function(MakeVolumeView<T, 1>(volumeData).value());
+                    return true;
+                case 2:
+                    function(MakeVolumeView<T, 2>(volumeData).value());
+                    return true;
+                case 3:
+                    function(MakeVolumeView<T, 3>(volumeData).value());
+                    return true;
+                case 4:
+                    function(MakeVolumeView<T, 4>(volumeData).value());
+                    return true;
+                default:
+                    return false;
+            }
+        };
+
+        switch (metadata.GetBitsPerComponent())
+        {
+            case 8:
+                return VisitWithType.template operator()<uint8_t>();
+            case 16:
+                return VisitWithType.template operator()<uint16_t>();
+            default:
+                return false;
+        }
+    }
+}
+
+#endif
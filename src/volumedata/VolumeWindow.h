@@ -0,0 +1,40 @@
+/**
+* \file VolumeWindow.h
+*
+* \brief Window/level range used to quantize volumes.
+*/
+
+#ifndef VOLUME_WINDOW_H
+#define VOLUME_WINDOW_H
+
+#include <algorithm>
+
+namespace VolumeData
+{
+    /**
+    * \struct VolumeWindow
+    *
+    * \brief Range of normalized volume values mapped to the full range of a quantized texture.
+    *
+    * Values are normalized by the maximum of the component type, so that a window of
+    * center 0.5 and width 1 covers every value and leaves the data unchanged.
+    *
+    * @see QuantizeVolumeData for applying the window to a volume.
+    * @see ComputePercentileWindow for fitting a window to a histogram.
+    */
+    struct VolumeWindow
+    {
+        float center = 0.5f; /**< Normalized value at the center of the window. */
+        float width = 1.0f; /**< Normalized width of the window. */
+
+        float GetLow() const { return center - 0.5f * width; }
+        float GetHigh() const { return center + 0.5f * width; }
+
+        /// Maps a normalized value into the window, clamped to [0, 1]
+        float Apply(float value) const { return std::clamp((value - GetLow()) / width, 0.0f, 1.0f); }
+
+        bool operator==(const VolumeWindow&) const = default;
+    };
+}
+
+#endif
@@ -0,0 +1,30 @@
+/**
+* \file VolumeWritingError.h
+*
+* \brief Error codes for volume writing operations.
+*/
+
+#ifndef VOLUME_WRITING_ERROR_H
+#define VOLUME_WRITING_ERROR_H
+
+namespace VolumeData
+{
+    /**
+    * \enum VolumeWritingError
+    *
+    * \brief Error codes returned by volume writing functions.
+    *
+    * @see WriteBrickedVolume for writing bricked volume files.
+    * @see DerivedDataCache::Write for writing cache entries.
+    * @see WriteVolumeRaw for writing raw files.
+    */
+    enum class VolumeWritingError
+    {
+        InvalidVolumeData, /**< The volume to write is not valid. */
+        InvalidBrickSize,  /**< The requested brick size is zero. */
+        CannotOpenFile,    /**< Could not open the output file for writing. */
+        WriteError         /**< Error occurred while writing the output file. */
+    };
+}
+
+#endif
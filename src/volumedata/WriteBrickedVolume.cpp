@@ -0,0 +1,175 @@
+#include <volumedata/WriteBrickedVolume.h>
+#include <volumedata/BrickExtent.h>
+#include <volumedata/EncodeBrick.h>
+#include <volumedata/GetBrickExtent.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <algorithm>
+#include <cstring>
+#include <execution>
+#include <fstream>
+#include <limits>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace
+{
+    VolumeData::BrickedVolumeHeader MakeHeader(const VolumeData::VolumeMetadata& metadata, uint32_t brickSize, VolumeData::BrickCompression compression)
+    {
+        return VolumeData::BrickedVolumeHeader{
+            .magic = VolumeData::BrickedVolumeFormat::magic,
+            .version = VolumeData::BrickedVolumeFormat::version,
+            .width = metadata.GetWidth(),
+            .height = metadata.GetHeight(),
+            .depth = metadata.GetDepth(),
+            .components = metadata.GetComponents(),
+            .bitsPerComponent = metadata.GetBitsPerComponent(),
+            .scaleX = metadata.GetScaleX(),
+            .scaleY = metadata.GetScaleY(),
+            .scaleZ = metadata.GetScaleZ(),
+            .brickSize = brickSize,
+            .numBricksX = (metadata.GetWidth() + brickSize - 1) / brickSize,
+            .numBricksY = (metadata.GetHeight() + brickSize - 1) / brickSize,
+            .numBricksZ = (metadata.GetDepth() + brickSize - 1) / brickSize,
+            .compression = compression,
+            .indexOffset = sizeof(VolumeData::BrickedVolumeHeader)
+        };
+    }
+
+    /// Copy the voxels of a brick out of the dense volume, row by row
+    void ExtractBrick(const VolumeData::VolumeData& volumeData, const VolumeData::BrickExtent& extent, std::vector<uint8_t>& brickData)
+    {
+        const auto& metadata = volumeData.GetMetadata();
+        const size_t bytesPerVoxel = metadata.GetBytesPerVoxel();
+        const size_t volumeRowSize = static_cast<size_t>(metadata.GetWidth()) * bytesPerVoxel;
+        const size_t volumeSliceSize = volumeRowSize * metadata.GetHeight();
+        const size_t brickRowSize = static_cast<size_t>(extent.width) * bytesPerVoxel;
+
+        brickData.resize(extent.GetVoxelCount() * bytesPerVoxel);
+
+        const uint8_t* const source = volumeData.GetDataPtr();
+        uint8_t* destination = brickData.data();
+
+        for (auto z = 0u; z < extent.depth; ++z)
+        {
+            for (auto y = 0u; y < extent.height; ++y)
+            {
+                const size_t sourceOffset = (extent.z + z) * volumeSliceSize + (extent.y + y) * volumeRowSize + extent.x * bytesPerVoxel;
+                std::memcpy(destination, source + sourceOffset, brickRowSize);
+                destination += brickRowSize;
+            }
+        }
+    }
+
+    /// Value range over all components of all voxels in a brick
+    std::pair<uint32_t, uint32_t> GetValueRange(const std::vector<uint8_t>& brickData, uint32_t bitsPerComponent)
+    {
+        uint32_t minValue = std::numeric_limits<uint32_t>::max();
+        uint32_t maxValue = 0;
+
+        if (bitsPerComponent == 16)
+        {
+            for (size_t i = 0; i + 1 < brickData.size(); i += sizeof(uint16_t))
+            {
+                uint16_t value;
+                std::memcpy(&value, brickData.data() + i, sizeof(uint16_t));
+                minValue = std::min<uint32_t>(minValue, value);
+                maxValue = std::max<uint32_t>(maxValue, value);
+            }
+        }
+        else
+        {
+            const auto [minIt, maxIt] = std::minmax_element(brickData.begin(), brickData.end());
+            if (minIt != brickData.end())
+            {
+                minValue = *minIt;
+                maxValue = *maxIt;
+            }
+        }
+
+        return {std::min(minValue, maxValue), maxValue};
+    }
+} // anonymous namespace
+
+std::expected<void, VolumeData::VolumeWritingError> VolumeData::WriteBrickedVolume(const VolumeData& volumeData, const std::filesystem::path& filePath, uint32_t brickSize, BrickCompression compression)
+{
+    if (!volumeData.IsValid())
+    {
+        return std::unexpected(VolumeWritingError::InvalidVolumeData);
+    }
+
+    if (brickSize == 0)
+    {
+        return std::unexpected(VolumeWritingError::InvalidBrickSize);
+    }
+
+    std::ofstream file(filePath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open())
+    {
+        return std::unexpected(VolumeWritingError::CannotOpenFile);
+    }
+
+    const auto header = MakeHeader(volumeData.GetMetadata(), brickSize, compression);
+    const size_t bricksPerLayer = static_cast<size_t>(header.numBricksX) * header.numBricksY;
+    const size_t numBricks = bricksPerLayer * header.numBricksZ;
+
+    std::vector<BrickIndexEntry> brickIndex(numBricks);
+
+    // The index is written again once all brick offsets are known
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(brickIndex.data()), static_cast<std::streamsize>(numBricks * sizeof(BrickIndexEntry)));
+    uint64_t offset = header.indexOffset + numBricks * sizeof(BrickIndexEntry);
+
+    std::vector<std::vector<uint8_t>> layerBricks(bricksPerLayer);
+    std::vector<size_t> layerBrickIndices(bricksPerLayer);
+    std::iota(layerBrickIndices.begin(), layerBrickIndices.end(), size_t{0});
+
+    for (auto brickZ = 0u; brickZ < header.numBricksZ && file.good(); ++brickZ)
+    {
+        const size_t firstBrickIndex = brickZ * bricksPerLayer;
+
+        // Not unsequenced, since extracting and encoding a brick allocate
+        std::for_each(std::execution::par, layerBrickIndices.begin(), layerBrickIndices.end(), [&](size_t layerBrickIndex)
+        {
+            const size_t brickIndexInVolume = firstBrickIndex + layerBrickIndex;
+            auto& brickData = layerBricks[layerBrickIndex];
+            ExtractBrick(volumeData, GetBrickExtent(header, brickIndexInVolume), brickData);
+
+            const auto [minValue, maxValue] = GetValueRange(brickData, header.bitsPerComponent);
+            brickIndex[brickIndexInVolume].minValue = minValue;
+            brickIndex[brickIndexInVolume].maxValue = maxValue;
+
+            if (compression == BrickCompression::DeltaRle)
+            {
+                auto encodedBrickData = EncodeBrick(brickData, header.components, header.bitsPerComponent);
+                if (encodedBrickData.size() < brickData.size())
+                {
+                    brickData = std::move(encodedBrickData);
+                }
+            }
+        });
+
+        for (size_t layerBrickIndex = 0; layerBrickIndex < bricksPerLayer; ++layerBrickIndex)
+        {
+            const auto& brickData = layerBricks[layerBrickIndex];
+            auto& entry = brickIndex[firstBrickIndex + layerBrickIndex];
+            entry.offset = offset;
+            entry.sizeInBytes = brickData.size();
+
+            file.write(reinterpret_cast<const char*>(brickData.data()), static_cast<std::streamsize>(brickData.size()));
+            offset += brickData.size();
+        }
+    }
+
+    file.seekp(static_cast<std::streamoff>(header.indexOffset));
+    file.write(reinterpret_cast<const char*>(brickIndex.data()), static_cast<std::streamsize>(numBricks * sizeof(BrickIndexEntry)));
+
+    if (!file.good())
+    {
+        return std::unexpected(VolumeWritingError::WriteError);
+    }
+
+    return {};
+}
@@ -0,0 +1,44 @@
+/**
+* \file WriteBrickedVolume.h
+*
+* \brief Function for writing volume data as a bricked volume file.
+*/
+
+#ifndef WRITE_BRICKED_VOLUME_H
+#define WRITE_BRICKED_VOLUME_H
+
+#include <volumedata/BrickCompression.h>
+#include <volumedata/BrickedVolumeHeader.h>
+#include <volumedata/VolumeWritingError.h>
+
+#include <cstdint>
+#include <expected>
+#include <filesystem>
+
+namespace VolumeData
+{
+    class VolumeData;
+
+    /**
+    * Writes a volume as a bricked volume file.
+    *
+    * Splits the volume into cubic bricks of brickSize voxels per axis and writes the
+    * header, the brick index and the brick payloads. The value range of each brick is
+    * recorded in the index. Bricks are gathered from the dense volume one layer of bricks
+    * at a time, in parallel, so that the additional memory needed stays at one layer.
+    * With compression, each brick is encoded independently on the thread that gathered it,
+    * and bricks that do not shrink are stored uncompressed.
+    *
+    * @param volumeData The volume to write.
+    * @param filePath Path of the bricked volume file to create, conventionally with BrickedVolumeFormat::fileExtension.
+    * @param brickSize Edge length of a brick in voxels, typically 32 or 64.
+    * @param compression Encoding of the brick payloads.
+    * @return std::expected<void, VolumeWritingError> Empty on success, or the error that occurred.
+    *
+    * @see BrickedVolumeHeader for the file layout.
+    * @see BrickedVolumeReader for reading the written file.
+    */
+    std::expected<void, VolumeWritingError> WriteBrickedVolume(const VolumeData& volumeData, const std::filesystem::path& filePath, uint32_t brickSize = BrickedVolumeFormat::defaultBrickSize, BrickCompression compression = BrickCompression::None);
+}
+
+#endif
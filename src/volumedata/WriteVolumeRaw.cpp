@@ -0,0 +1,53 @@
+#include <volumedata/WriteVolumeRaw.h>
+#include <volumedata/VolumeData.h>
+
+#include <fstream>
+#include <system_error>
+
+std::expected<void, VolumeData::VolumeWritingError> VolumeData::WriteVolumeRaw(const VolumeData& volumeData, const std::filesystem::path& rawFilePath)
+{
+    if (!volumeData.IsValid())
+    {
+        return std::unexpected(VolumeWritingError::InvalidVolumeData);
+    }
+
+    std::error_code errorCode;
+    if (rawFilePath.has_parent_path())
+    {
+        std::filesystem::create_directories(rawFilePath.parent_path(), errorCode);
+        if (errorCode)
+        {
+            return std::unexpected(VolumeWritingError::CannotOpenFile);
+        }
+    }
+
+    auto temporaryPath = rawFilePath;
+    temporaryPath += ".tmp";
+
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        if (!file.is_open())
+        {
+            return std::unexpected(VolumeWritingError::CannotOpenFile);
+        }
+
+        const auto data = volumeData.GetData();
+        file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+
+        if (!file.good())
+        {
+            file.close();
+            std::filesystem::remove(temporaryPath, errorCode);
+            return std::unexpected(VolumeWritingError::WriteError);
+        }
+    }
+
+    std::filesystem::rename(temporaryPath, rawFilePath, errorCode);
+    if (errorCode)
+    {
+        std::filesystem::remove(temporaryPath, errorCode);
+        return std::unexpected(VolumeWritingError::WriteError);
+    }
+
+    return {};
+}
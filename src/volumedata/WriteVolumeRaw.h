@@ -0,0 +1,34 @@
+/**
+* \file WriteVolumeRaw.h
+*
+* \brief Function for writing the voxels of a volume as a raw file.
+*/
+
+#ifndef WRITE_VOLUME_RAW_H
+#define WRITE_VOLUME_RAW_H
+
+#include <volumedata/VolumeWritingError.h>
+
+#include <expected>
+#include <filesystem>
+
+namespace VolumeData
+{
+    class VolumeData;
+
+    /**
+    * Writes the voxels of a volume as a headerless .raw file, the layout read by LoadVolumeRaw().
+    *
+    * The file is written under a temporary name and renamed when complete, so a reader never
+    * sees a partially written file. The metadata .ini file is not written.
+    *
+    * @param volumeData The volume to write.
+    * @param rawFilePath Path of the .raw file to create.
+    * @return std::expected<void, VolumeWritingError> Empty on success, or the error that occurred.
+    *
+    * @see LoadVolumeRaw for reading the written file.
+    */
+    std::expected<void, VolumeWritingError> WriteVolumeRaw(const VolumeData& volumeData, const std::filesystem::path& rawFilePath);
+}
+
+#endif
@@ -64,3 +64,26 @@ TEST_F(FrameBufferTest, CanAttachRenderBuffer)
 
     frameBuffer->Unbind();
 }
+
+TEST_F(FrameBufferTest, GetRenderBufferSizeInBytesSumsRenderBuffers)
+{
+    EXPECT_EQ(frameBuffer->GetRenderBufferSizeInBytes(), 0u);
+
+    frameBuffer->Bind();
+    frameBuffer->AttachRenderBuffer(GL_DEPTH_STENCIL_ATTACHMENT, GL_DEPTH24_STENCIL8, 800, 600);
+    frameBuffer->Unbind();
+
+    EXPECT_EQ(frameBuffer->GetRenderBufferSizeInBytes(), 800u * 600u * 4u);
+    EXPECT_TRUE(frameBuffer->GetAttachedTextureIds().empty());
+}
+
+TEST_F(FrameBufferTest, ResizeRenderBuffersUpdatesSize)
+{
+    frameBuffer->Bind();
+    frameBuffer->AttachRenderBuffer(GL_DEPTH_STENCIL_ATTACHMENT, GL_DEPTH24_STENCIL8, 800, 600);
+    frameBuffer->ResizeRenderBuffers(1024, 768);
+    frameBuffer->Unbind();
+
+    EXPECT_EQ(frameBuffer->GetRenderBufferSizeInBytes(), 1024u * 768u * 4u);
+    EXPECT_EQ(glGetError(), static_cast<GLenum>(GL_NO_ERROR));
+}
@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+
+#include <buffers/PixelUnpackBuffer.h>
+#include <context/InitGl.h>
+#include <context/GlfwWindow.h>
+
+#include <glad/glad.h>
+
+#include <cstring>
+#include <memory>
+#include <utility>
+
+class PixelUnpackBufferTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        window = std::make_unique<Context::GlfwWindow>();
+        Context::InitGl();
+    }
+
+    void TearDown() override
+    {
+        window.reset();
+    }
+
+    std::unique_ptr<Context::GlfwWindow> window;
+};
+
+TEST_F(PixelUnpackBufferTest, CanCreatePixelUnpackBuffer)
+{
+    PixelUnpackBuffer pixelUnpackBuffer{1024};
+    EXPECT_EQ(pixelUnpackBuffer.GetSizeInBytes(), 1024u);
+}
+
+TEST_F(PixelUnpackBufferTest, CanMapAndUnmapBuffer)
+{
+    PixelUnpackBuffer pixelUnpackBuffer{1024};
+
+    void* data = pixelUnpackBuffer.Map();
+    ASSERT_NE(data, nullptr);
+    std::memset(data, 42, 1024);
+
+    EXPECT_TRUE(pixelUnpackBuffer.Unmap());
+    pixelUnpackBuffer.Unbind();
+    EXPECT_EQ(glGetError(), static_cast<GLenum>(GL_NO_ERROR));
+}
+
+TEST_F(PixelUnpackBufferTest, CanMovePixelUnpackBuffer)
+{
+    PixelUnpackBuffer original{1024};
+
+    PixelUnpackBuffer moved = std::move(original);
+
+    EXPECT_EQ(moved.GetSizeInBytes(), 1024u);
+    EXPECT_EQ(original.GetSizeInBytes(), 0u);
+}
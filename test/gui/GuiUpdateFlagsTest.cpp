@@ -17,6 +17,16 @@ TEST_F(GuiUpdateFlagsTest, InitialFlagsAreFalse)
 {
     EXPECT_FALSE(flags.ssaoParametersChanged);
     EXPECT_FALSE(flags.transferFunctionChanged);
+    EXPECT_FALSE(flags.volumeDataChanged);
+    EXPECT_FALSE(flags.timeStepChanged);
+    EXPECT_FALSE(flags.redrawRequested);
+}
+
+TEST_F(GuiUpdateFlagsTest, CanSetVolumeDataChangedFlag)
+{
+    flags.volumeDataChanged = true;
+    EXPECT_TRUE(flags.volumeDataChanged);
+    EXPECT_FALSE(flags.transferFunctionChanged);
 }
 
 TEST_F(GuiUpdateFlagsTest, CanSetSsaoParametersChangedFlag)
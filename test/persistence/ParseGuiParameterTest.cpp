@@ -193,6 +193,63 @@ TEST_F(ParseGuiParameterTest, CanParseDensityMultiplier)
     EXPECT_FLOAT_EQ(guiParams.raycastingDensityMultiplier, 2.5f);
 }
 
+TEST_F(ParseGuiParameterTest, CanParseVolumeWindow)
+{
+    const auto centerResult = Persistence::ParseGuiParameter(
+        Persistence::ApplicationStateIniFileSection::Rendering,
+        Persistence::ApplicationStateIniFileKey::WindowCenter,
+        0,
+        "0.3",
+        guiParams);
+    const auto widthResult = Persistence::ParseGuiParameter(
+        Persistence::ApplicationStateIniFileSection::Rendering,
+        Persistence::ApplicationStateIniFileKey::WindowWidth,
+        0,
+        "0.2",
+        guiParams);
+
+    ASSERT_TRUE(centerResult.has_value());
+    ASSERT_TRUE(widthResult.has_value());
+    EXPECT_FLOAT_EQ(guiParams.volumeWindow.center, 0.3f);
+    EXPECT_FLOAT_EQ(guiParams.volumeWindow.width, 0.2f);
+}
+
+TEST_F(ParseGuiParameterTest, CanParseRaycastingQuality)
+{
+    const auto result = Persistence::ParseGuiParameter(
+        Persistence::ApplicationStateIniFileSection::Rendering,
+        Persistence::ApplicationStateIniFileKey::RaycastingQuality,
+        0,
+        "2",
+        guiParams);
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(guiParams.raycastingQuality, RaycastingQuality::High);
+
+    const auto outOfRangeResult = Persistence::ParseGuiParameter(
+        Persistence::ApplicationStateIniFileSection::Rendering,
+        Persistence::ApplicationStateIniFileKey::RaycastingQuality,
+        0,
+        "42",
+        guiParams);
+
+    ASSERT_TRUE(outOfRangeResult.has_value());
+    EXPECT_EQ(guiParams.raycastingQuality, RaycastingQuality::Reference);
+}
+
+TEST_F(ParseGuiParameterTest, CanParsePreIntegration)
+{
+    const auto result = Persistence::ParseGuiParameter(
+        Persistence::ApplicationStateIniFileSection::Rendering,
+        Persistence::ApplicationStateIniFileKey::PreIntegration,
+        0,
+        "0",
+        guiParams);
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_FALSE(guiParams.enablePreIntegration);
+}
+
 // Error handling
 TEST_F(ParseGuiParameterTest, ReturnsErrorForInvalidUnsignedInt)
 {
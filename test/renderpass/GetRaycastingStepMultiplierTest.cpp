@@ -0,0 +1,46 @@
+#include <gtest/gtest.h>
+
+#include <renderpass/GetRaycastingQualitySettings.h>
+#include <renderpass/GetRaycastingStepMultiplier.h>
+#include <renderpass/RaycastingQuality.h>
+#include <renderpass/RaycastingQualitySettings.h>
+
+namespace
+{
+    /// Effective step of a preset in Nyquist steps, for a sample at the given level of detail in a brick with edges
+    float GetEffectiveStep(RaycastingQuality raycastingQuality, float sampleLod)
+    {
+        const auto qualitySettings = GetRaycastingQualitySettings(raycastingQuality);
+        return static_cast<float>(GetRaycastingStepMultiplier(sampleLod, 1, qualitySettings)) / qualitySettings.samplingRate;
+    }
+}
+
+TEST(GetRaycastingStepMultiplierTest, PresetsKeepTheirSamplingRateAtLodZero)
+{
+    EXPECT_FLOAT_EQ(GetEffectiveStep(RaycastingQuality::Interactive, 0.0f), 2.0f);
+    EXPECT_FLOAT_EQ(GetEffectiveStep(RaycastingQuality::Balanced, 0.0f), 1.0f);
+    EXPECT_FLOAT_EQ(GetEffectiveStep(RaycastingQuality::High, 0.0f), 0.5f);
+    EXPECT_FLOAT_EQ(GetEffectiveStep(RaycastingQuality::Reference, 0.0f), 0.25f);
+}
+
+TEST(GetRaycastingStepMultiplierTest, CoarseLodSpansNyquistStepOfMipLevel)
+{
+    const auto qualitySettings = GetRaycastingQualitySettings(RaycastingQuality::High);
+    EXPECT_EQ(GetRaycastingStepMultiplier(0.9f, 1, qualitySettings), 1u);
+    EXPECT_EQ(GetRaycastingStepMultiplier(1.0f, 1, qualitySettings), 4u);
+    EXPECT_EQ(GetRaycastingStepMultiplier(1.5f, 1, qualitySettings), 4u);
+    EXPECT_EQ(GetRaycastingStepMultiplier(2.0f, 1, qualitySettings), qualitySettings.maxStepMultiplier);
+}
+
+TEST(GetRaycastingStepMultiplierTest, SmoothBrickSpansItsNyquistSteps)
+{
+    const auto qualitySettings = GetRaycastingQualitySettings(RaycastingQuality::Balanced);
+    EXPECT_EQ(GetRaycastingStepMultiplier(0.0f, 3, qualitySettings), 3u);
+    EXPECT_EQ(GetRaycastingStepMultiplier(0.0f, 255, qualitySettings), qualitySettings.maxStepMultiplier);
+}
+
+TEST(GetRaycastingStepMultiplierTest, ReferenceDoesNotAdapt)
+{
+    const auto qualitySettings = GetRaycastingQualitySettings(RaycastingQuality::Reference);
+    EXPECT_EQ(GetRaycastingStepMultiplier(3.0f, 255, qualitySettings), 1u);
+}
@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+
+#include <gui/GuiParameters.h>
+#include <renderpass/ProgressiveRefinement.h>
+#include <renderpass/RaycastingQuality.h>
+#include <renderpass/RefinementTile.h>
+
+#include <memory>
+
+class ProgressiveRefinementTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        guiParameters = GuiParameters{};
+        guiParameters.raycastingQuality = RaycastingQuality::Balanced;
+        // 4 x 3 tiles of 100 x 100 pixels, with a budget of two and a half tiles
+        progressiveRefinement = std::make_unique<ProgressiveRefinement>(guiParameters, 100, 25000);
+    }
+
+    void Update(bool hasSceneChanged)
+    {
+        progressiveRefinement->Update(hasSceneChanged, 400, 300);
+    }
+
+    /// Runs frames without changes until the refinement is complete and returns the number of frames and refined pixels
+    std::pair<unsigned int, size_t> RefineUntilComplete()
+    {
+        unsigned int numFrames = 0;
+        size_t numPixels = 0;
+        while (!progressiveRefinement->IsComplete())
+        {
+            Update(false);
+            ++numFrames;
+            for (const auto& tile : progressiveRefinement->GetTiles())
+            {
+                numPixels += static_cast<size_t>(tile.width) * tile.height;
+            }
+        }
+        return {numFrames, numPixels};
+    }
+
+    GuiParameters guiParameters;
+    std::unique_ptr<ProgressiveRefinement> progressiveRefinement;
+};
+
+TEST_F(ProgressiveRefinementTest, ChangeRendersReducedImageWithoutTiles)
+{
+    Update(true);
+
+    EXPECT_TRUE(progressiveRefinement->IsInteracting());
+    EXPECT_FALSE(progressiveRefinement->IsComplete());
+    EXPECT_TRUE(progressiveRefinement->GetTiles().empty());
+    EXPECT_EQ(progressiveRefinement->GetReducedViewportWidth(), 200u);
+    EXPECT_EQ(progressiveRefinement->GetReducedViewportHeight(), 150u);
+    EXPECT_FLOAT_EQ(progressiveRefinement->GetSamplingRateScale(), 0.5f);
+}
+
+TEST_F(ProgressiveRefinementTest, RefinesCenterTilesFirst)
+{
+    Update(true);
+    Update(false);
+
+    const auto tiles = progressiveRefinement->GetTiles();
+    ASSERT_EQ(tiles.size(), 2u);
+    EXPECT_FALSE(progressiveRefinement->IsInteracting());
+    EXPECT_EQ(tiles[0], (RefinementTile{100, 100, 100, 100}));
+    EXPECT_EQ(tiles[1], (RefinementTile{200, 100, 100, 100}));
+}
+
+TEST_F(ProgressiveRefinementTest, RefinesWholeViewportWithinBudget)
+{
+    Update(true);
+    const auto [numFrames, numPixels] = RefineUntilComplete();
+
+    EXPECT_EQ(numFrames, 6u);
+    EXPECT_EQ(numPixels, 400u * 300u);
+
+    Update(false);
+    EXPECT_TRUE(progressiveRefinement->GetTiles().empty());
+}
+
+TEST_F(ProgressiveRefinementTest, RefinesAtLeastOneTilePerFrame)
+{
+    progressiveRefinement = std::make_unique<ProgressiveRefinement>(guiParameters, 100, 0);
+    Update(true);
+    const auto [numFrames, numPixels] = RefineUntilComplete();
+
+    EXPECT_EQ(numFrames, 12u);
+    EXPECT_EQ(numPixels, 400u * 300u);
+}
+
+TEST_F(ProgressiveRefinementTest, ChangeRestartsRefinement)
+{
+    Update(true);
+    Update(false);
+    Update(true);
+
+    EXPECT_TRUE(progressiveRefinement->IsInteracting());
+    EXPECT_EQ(RefineUntilComplete().second, 400u * 300u);
+}
+
+TEST_F(ProgressiveRefinementTest, ReferenceRendersWholeViewportAtOnce)
+{
+    guiParameters.raycastingQuality = RaycastingQuality::Reference;
+    Update(true);
+
+    EXPECT_FALSE(progressiveRefinement->IsInteracting());
+    EXPECT_TRUE(progressiveRefinement->IsComplete());
+    EXPECT_EQ(progressiveRefinement->GetTiles().size(), 12u);
+}
@@ -0,0 +1,115 @@
+#include <gtest/gtest.h>
+
+#include <camera/Camera.h>
+#include <camera/CameraParameters.h>
+#include <config/Config.h>
+#include <gui/GuiParameters.h>
+#include <gui/GuiUpdateFlags.h>
+#include <input/DisplayProperties.h>
+#include <renderpass/RedrawScope.h>
+#include <renderpass/RedrawTracker.h>
+#include <volumedata/VolumeLoadingProgress.h>
+
+#include <glm/glm.hpp>
+
+#include <memory>
+
+class RedrawTrackerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        camera = std::make_unique<Camera>(CameraParameters
+        {
+            .position = glm::vec3{0.0f, 0.0f, 3.0f},
+            .lookAt = glm::vec3{0.0f, 0.0f, 0.0f},
+            .up = glm::vec3{0.0f, 1.0f, 0.0f},
+            .zoom = 45.0f
+        });
+        displayProperties = DisplayProperties{};
+        guiParameters = GuiParameters{};
+        guiUpdateFlags = GuiUpdateFlags{};
+        volumeLoadingProgress = VolumeData::VolumeLoadingProgress{};
+        redrawTracker = std::make_unique<RedrawTracker>(*camera, displayProperties, guiParameters, guiUpdateFlags, volumeLoadingProgress);
+    }
+
+    RedrawScope Update(bool hasPendingInput = false)
+    {
+        return redrawTracker->Update(800, 600, 300.0f, hasPendingInput);
+    }
+
+    /// Runs frames until the tracker goes idle and returns the number of frames drawn with the given scope
+    unsigned int CountFramesUntilIdle(RedrawScope redrawScope)
+    {
+        unsigned int numFrames = 0;
+        for (auto scope = Update(); scope != RedrawScope::None; scope = Update())
+        {
+            numFrames += (scope == redrawScope) ? 1 : 0;
+        }
+        return numFrames;
+    }
+
+    std::unique_ptr<Camera> camera;
+    DisplayProperties displayProperties;
+    GuiParameters guiParameters;
+    GuiUpdateFlags guiUpdateFlags;
+    VolumeData::VolumeLoadingProgress volumeLoadingProgress;
+    std::unique_ptr<RedrawTracker> redrawTracker;
+};
+
+TEST_F(RedrawTrackerTest, RendersSceneAfterConstructionThenGoesIdle)
+{
+    EXPECT_EQ(CountFramesUntilIdle(RedrawScope::Scene), Config::numRedrawFramesAfterChange);
+    EXPECT_EQ(Update(), RedrawScope::None);
+}
+
+TEST_F(RedrawTrackerTest, CameraMovementRedrawsScene)
+{
+    CountFramesUntilIdle(RedrawScope::Scene);
+
+    camera->ProcessMouseScroll(1.0f);
+    EXPECT_EQ(Update(), RedrawScope::Scene);
+    EXPECT_TRUE(redrawTracker->HasSceneChanged());
+    EXPECT_EQ(CountFramesUntilIdle(RedrawScope::Scene), Config::numRedrawFramesAfterChange - 1);
+    EXPECT_FALSE(redrawTracker->HasSceneChanged());
+}
+
+TEST_F(RedrawTrackerTest, ParameterAndWindowChangesRedrawScene)
+{
+    CountFramesUntilIdle(RedrawScope::Scene);
+
+    guiParameters.raycastingDensityMultiplier += 1.0f;
+    EXPECT_EQ(Update(), RedrawScope::Scene);
+    CountFramesUntilIdle(RedrawScope::Scene);
+
+    displayProperties.showSsaoMap = !displayProperties.showSsaoMap;
+    EXPECT_EQ(Update(), RedrawScope::Scene);
+    CountFramesUntilIdle(RedrawScope::Scene);
+
+    EXPECT_EQ(redrawTracker->Update(1024, 600, 300.0f, false), RedrawScope::Scene);
+}
+
+TEST_F(RedrawTrackerTest, RedrawRequestIsConsumed)
+{
+    CountFramesUntilIdle(RedrawScope::Scene);
+
+    guiUpdateFlags.redrawRequested = true;
+    EXPECT_EQ(Update(), RedrawScope::Scene);
+    EXPECT_FALSE(guiUpdateFlags.redrawRequested);
+
+    guiUpdateFlags.transferFunctionChanged = true;
+    EXPECT_EQ(Update(), RedrawScope::Scene);
+    EXPECT_TRUE(guiUpdateFlags.transferFunctionChanged);
+}
+
+TEST_F(RedrawTrackerTest, PendingInputRedrawsOnlyGui)
+{
+    CountFramesUntilIdle(RedrawScope::Scene);
+
+    EXPECT_EQ(Update(true), RedrawScope::Gui);
+    EXPECT_EQ(CountFramesUntilIdle(RedrawScope::Scene), 0u);
+
+    volumeLoadingProgress.isLoading = true;
+    EXPECT_EQ(Update(), RedrawScope::Gui);
+    EXPECT_EQ(Update(), RedrawScope::Gui);
+}
@@ -336,3 +336,51 @@ TEST_F(TextureTest, CanBindMultipleTextures)
     EXPECT_NO_THROW(texture1.Bind());
     EXPECT_NO_THROW(texture2.Bind());
 }
+
+TEST_F(TextureTest, GetSizeInBytesCountsAllMipLevels)
+{
+    unsigned short data[8 * 8 * 8] = {0};
+    Texture texture{
+        TextureId::VolumeData,
+        GL_TEXTURE3,
+        8,
+        8,
+        8,
+        GL_R16,
+        GL_RED,
+        GL_UNSIGNED_SHORT,
+        GL_LINEAR,
+        GL_CLAMP_TO_EDGE,
+        data
+    };
+
+    EXPECT_EQ(texture.GetSizeInBytes(), 8u * 8u * 8u * 2u);
+
+    texture.SetImage3D(1, 4, 4, 4, GL_R16, GL_RED, GL_UNSIGNED_SHORT, data);
+    EXPECT_EQ(texture.GetSizeInBytes(), (8u * 8u * 8u + 4u * 4u * 4u) * 2u);
+
+    texture.SetImage3D(0, 2, 2, 2, GL_R16, GL_RED, GL_UNSIGNED_SHORT, data);
+    EXPECT_EQ(texture.GetSizeInBytes(), 2u * 2u * 2u * 2u);
+}
+
+TEST_F(TextureTest, SetImage2DResizesTextureInPlace)
+{
+    Texture texture{
+        TextureId::LastFrame,
+        GL_TEXTURE1,
+        800,
+        600,
+        GL_RGBA8,
+        GL_RGBA,
+        GL_UNSIGNED_BYTE,
+        GL_NEAREST,
+        GL_CLAMP_TO_EDGE
+    };
+    const auto glId = texture.GetGlId();
+
+    texture.SetImage2D(1024, 768, GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+
+    EXPECT_EQ(texture.GetGlId(), glId);
+    EXPECT_EQ(texture.GetSizeInBytes(), 1024u * 768u * 4u);
+    EXPECT_EQ(glGetError(), static_cast<GLenum>(GL_NO_ERROR));
+}
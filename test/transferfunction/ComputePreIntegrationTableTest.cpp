@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+
+#include <transferfunction/ComputePreIntegrationTable.h>
+
+#include <glm/glm.hpp>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+TEST(ComputePreIntegrationTableTest, ReturnsEmptyTableForFewerThanTwoSamples)
+{
+    const std::vector<glm::vec4> transferFunction{glm::vec4{1.0f}};
+
+    EXPECT_TRUE(ComputePreIntegrationTable(transferFunction).empty());
+}
+
+TEST(ComputePreIntegrationTableTest, ConstantTransferFunctionGivesConstantTable)
+{
+    const std::vector<glm::vec4> transferFunction(16, glm::vec4{0.5f, 0.25f, 1.0f, 0.5f});
+
+    const auto table = ComputePreIntegrationTable(transferFunction);
+    ASSERT_EQ(table.size(), 16u * 16u);
+
+    const float tau = -std::log(0.5f);
+    for (const auto& entry : table)
+    {
+        EXPECT_NEAR(entry.r, 0.5f * tau, 1e-5f);
+        EXPECT_NEAR(entry.g, 0.25f * tau, 1e-5f);
+        EXPECT_NEAR(entry.b, tau, 1e-5f);
+        EXPECT_NEAR(entry.a, tau, 1e-5f);
+    }
+}
+
+TEST(ComputePreIntegrationTableTest, SegmentsAverageOverAllValuesBetweenFrontAndBack)
+{
+    // A thin opaque feature at value 4 that samples at values 2 and 6 would both miss
+    const size_t size = 9;
+    std::vector<glm::vec4> transferFunction(size, glm::vec4{0.0f});
+    transferFunction[4] = glm::vec4{1.0f, 0.0f, 0.0f, 0.5f};
+
+    const auto table = ComputePreIntegrationTable(transferFunction);
+    ASSERT_EQ(table.size(), size * size);
+
+    const float tau = -std::log(0.5f);
+    const auto& entry = table[6 * size + 2];
+    // The triangle of the feature integrates to tau over a segment of four entries
+    EXPECT_NEAR(entry.a, tau / 4.0f, 1e-5f);
+    EXPECT_NEAR(entry.r, tau / 4.0f, 1e-5f);
+    EXPECT_FLOAT_EQ(entry.g, 0.0f);
+
+    // Segments are symmetric, and segments outside of the feature see nothing
+    EXPECT_NEAR(table[2 * size + 6].a, entry.a, 1e-5f);
+    EXPECT_FLOAT_EQ(table[2 * size + 0].a, 0.0f);
+    EXPECT_FLOAT_EQ(table[2 * size + 2].a, 0.0f);
+    EXPECT_NEAR(table[4 * size + 4].a, tau, 1e-5f);
+}
@@ -38,12 +38,26 @@ protected:
             GL_CLAMP_TO_EDGE,
             nullptr
         );
+
+        // Create a 2D texture for the pre-integration table
+        preIntegrationTableTexture = std::make_unique<Texture>(
+            TextureId::PreIntegrationTable,
+            GL_TEXTURE1,
+            64,
+            64,
+            GL_RGBA16F,
+            GL_RGBA,
+            GL_FLOAT,
+            GL_LINEAR,
+            GL_CLAMP_TO_EDGE
+        );
     }
 
     std::unique_ptr<Context::GlfwWindow> window;
     std::unique_ptr<TransferFunction> transferFunction;
     std::unique_ptr<GuiUpdateFlags> guiUpdateFlags;
     std::unique_ptr<Texture> texture;
+    std::unique_ptr<Texture> preIntegrationTableTexture;
 };
 
 TEST_F(TransferFunctionTextureUpdaterTest, CanCreateUpdater)
@@ -51,7 +65,8 @@ TEST_F(TransferFunctionTextureUpdaterTest, CanCreateUpdater)
     EXPECT_NO_THROW(TransferFunctionTextureUpdater(
         *guiUpdateFlags,
         *transferFunction,
-        *texture
+        *texture,
+        *preIntegrationTableTexture
     ));
 }
 
@@ -61,11 +76,13 @@ TEST_F(TransferFunctionTextureUpdaterTest, ConstructorUpdatesTexture)
     TransferFunctionTextureUpdater updater{
         *guiUpdateFlags,
         *transferFunction,
-        *texture
+        *texture,
+        *preIntegrationTableTexture
     };
 
     // If texture was updated, GetGlId should return non-zero
     EXPECT_NE(texture->GetGlId(), 0u);
+    EXPECT_NE(preIntegrationTableTexture->GetGlId(), 0u);
 }
 
 TEST_F(TransferFunctionTextureUpdaterTest, UpdateDoesNothingWhenFlagNotSet)
@@ -73,7 +90,8 @@ TEST_F(TransferFunctionTextureUpdaterTest, UpdateDoesNothingWhenFlagNotSet)
     TransferFunctionTextureUpdater updater{
         *guiUpdateFlags,
         *transferFunction,
-        *texture
+        *texture,
+        *preIntegrationTableTexture
     };
 
     guiUpdateFlags->transferFunctionChanged = false;
@@ -87,7 +105,8 @@ TEST_F(TransferFunctionTextureUpdaterTest, UpdateRegeneratesTextureWhenFlagSet)
     TransferFunctionTextureUpdater updater{
         *guiUpdateFlags,
         *transferFunction,
-        *texture
+        *texture,
+        *preIntegrationTableTexture
     };
 
     guiUpdateFlags->transferFunctionChanged = true;
@@ -100,7 +119,8 @@ TEST_F(TransferFunctionTextureUpdaterTest, UpdateClearsFlagAfterProcessing)
     TransferFunctionTextureUpdater updater{
         *guiUpdateFlags,
         *transferFunction,
-        *texture
+        *texture,
+        *preIntegrationTableTexture
     };
 
     guiUpdateFlags->transferFunctionChanged = true;
@@ -114,7 +134,8 @@ TEST_F(TransferFunctionTextureUpdaterTest, CanUpdateMultipleTimes)
     TransferFunctionTextureUpdater updater{
         *guiUpdateFlags,
         *transferFunction,
-        *texture
+        *texture,
+        *preIntegrationTableTexture
     };
 
     for (int i = 0; i < 5; ++i)
@@ -133,7 +154,8 @@ TEST_F(TransferFunctionTextureUpdaterTest, UpdateHandlesEmptyTransferFunction)
     TransferFunctionTextureUpdater updater{
         *guiUpdateFlags,
         *emptyTransferFunction,
-        *texture
+        *texture,
+        *preIntegrationTableTexture
     };
 
     guiUpdateFlags->transferFunctionChanged = true;
@@ -149,7 +171,8 @@ TEST_F(TransferFunctionTextureUpdaterTest, UpdateHandlesSingleControlPoint)
     TransferFunctionTextureUpdater updater{
         *guiUpdateFlags,
         *singlePointTf,
-        *texture
+        *texture,
+        *preIntegrationTableTexture
     };
 
     guiUpdateFlags->transferFunctionChanged = true;
@@ -169,7 +192,8 @@ TEST_F(TransferFunctionTextureUpdaterTest, UpdateHandlesMultipleControlPoints)
     TransferFunctionTextureUpdater updater{
         *guiUpdateFlags,
         *multiPointTf,
-        *texture
+        *texture,
+        *preIntegrationTableTexture
     };
 
     guiUpdateFlags->transferFunctionChanged = true;
@@ -182,7 +206,8 @@ TEST_F(TransferFunctionTextureUpdaterTest, UpdateDoesNotCauseGLError)
     TransferFunctionTextureUpdater updater{
         *guiUpdateFlags,
         *transferFunction,
-        *texture
+        *texture,
+        *preIntegrationTableTexture
     };
 
     guiUpdateFlags->transferFunctionChanged = true;
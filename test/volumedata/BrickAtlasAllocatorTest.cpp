@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/BrickAtlasAllocator.h>
+
+TEST(BrickAtlasAllocatorTest, AllocatesFreeSlotsFirst)
+{
+    auto allocator = VolumeData::BrickAtlasAllocator{2, 1};
+
+    const auto first = allocator.Allocate(10, false);
+    const auto second = allocator.Allocate(11, false);
+
+    ASSERT_TRUE(first.has_value());
+    ASSERT_TRUE(second.has_value());
+    EXPECT_NE(first->slot, second->slot);
+    EXPECT_FALSE(first->evictedKey.has_value());
+    EXPECT_FALSE(second->evictedKey.has_value());
+    EXPECT_EQ(allocator.Find(10), first->slot);
+    EXPECT_EQ(allocator.Find(11), second->slot);
+    EXPECT_FALSE(allocator.Find(12).has_value());
+}
+
+TEST(BrickAtlasAllocatorTest, EvictsLeastRecentlyUsedBrick)
+{
+    auto allocator = VolumeData::BrickAtlasAllocator{2, 1};
+    allocator.Allocate(10, false);
+    allocator.Allocate(11, false);
+    allocator.NextFrame();
+    allocator.Touch(10);
+    allocator.NextFrame();
+
+    const auto allocation = allocator.Allocate(12, false);
+
+    ASSERT_TRUE(allocation.has_value());
+    EXPECT_EQ(allocation->evictedKey, 11u);
+    EXPECT_FALSE(allocator.Find(11).has_value());
+    EXPECT_EQ(allocator.Find(12), allocation->slot);
+    EXPECT_TRUE(allocator.Find(10).has_value());
+}
+
+TEST(BrickAtlasAllocatorTest, DoesNotEvictBricksUsedInProtectedFrames)
+{
+    auto allocator = VolumeData::BrickAtlasAllocator{1, 2};
+    allocator.Allocate(10, false);
+    allocator.NextFrame();
+
+    EXPECT_FALSE(allocator.Allocate(11, false).has_value());
+
+    allocator.NextFrame();
+
+    const auto allocation = allocator.Allocate(11, false);
+    ASSERT_TRUE(allocation.has_value());
+    EXPECT_EQ(allocation->evictedKey, 10u);
+}
+
+TEST(BrickAtlasAllocatorTest, NeverEvictsPinnedBricks)
+{
+    auto allocator = VolumeData::BrickAtlasAllocator{2, 1};
+    allocator.Allocate(10, true);
+    allocator.Allocate(11, false);
+    allocator.NextFrame();
+
+    const auto allocation = allocator.Allocate(12, false);
+    ASSERT_TRUE(allocation.has_value());
+    EXPECT_EQ(allocation->evictedKey, 11u);
+
+    allocator.NextFrame();
+    allocator.Allocate(13, false);
+    EXPECT_TRUE(allocator.Find(10).has_value());
+    EXPECT_EQ(allocator.GetNumPinnedBricks(), 1u);
+}
+
+TEST(BrickAtlasAllocatorTest, FailsWhenAllSlotsArePinned)
+{
+    auto allocator = VolumeData::BrickAtlasAllocator{1, 1};
+    allocator.Allocate(10, true);
+    allocator.NextFrame();
+
+    EXPECT_FALSE(allocator.Allocate(11, false).has_value());
+}
+
+TEST(BrickAtlasAllocatorTest, AllocatingResidentBrickKeepsItsSlot)
+{
+    auto allocator = VolumeData::BrickAtlasAllocator{2, 1};
+    const auto first = allocator.Allocate(10, false);
+    const auto again = allocator.Allocate(10, false);
+
+    ASSERT_TRUE(again.has_value());
+    EXPECT_EQ(again->slot, first->slot);
+    EXPECT_FALSE(again->evictedKey.has_value());
+    EXPECT_EQ(allocator.GetNumResidentBricks(), 1u);
+}
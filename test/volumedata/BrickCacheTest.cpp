@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/BrickCache.h>
+#include <volumedata/BrickedVolumeReader.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+#include <volumedata/WriteBrickedVolume.h>
+
+#include <filesystem>
+#include <optional>
+
+class BrickCacheTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        filePath = std::filesystem::temp_directory_path() / "BrickCacheTest.bvol";
+
+        // 2 x 2 x 1 bricks of 4^3 8-bit voxels, 64 bytes each
+        auto volumeData = VolumeData::VolumeData{VolumeData::VolumeMetadata{8, 8, 4, 1, 8}};
+        for (uint32_t y = 0; y < 8; ++y)
+        {
+            for (uint32_t x = 0; x < 8; ++x)
+            {
+                volumeData.SetVoxel8(x, y, 0, static_cast<uint8_t>(x + 8 * y));
+            }
+        }
+        ASSERT_TRUE(VolumeData::WriteBrickedVolume(volumeData, filePath, 4));
+
+        auto readerResult = VolumeData::OpenBrickedVolume(filePath);
+        ASSERT_TRUE(readerResult);
+        reader.emplace(std::move(readerResult).value());
+    }
+
+    void TearDown() override
+    {
+        reader.reset();
+        std::filesystem::remove(filePath);
+    }
+
+    std::filesystem::path filePath;
+    std::optional<VolumeData::BrickedVolumeReader> reader;
+};
+
+TEST_F(BrickCacheTest, MissReadsBrickFromDisk)
+{
+    VolumeData::BrickCache cache{*reader, 1024};
+
+    const auto brick = cache.GetBrick(3);
+
+    ASSERT_NE(brick, nullptr);
+    EXPECT_EQ(brick->size(), 64u);
+    EXPECT_EQ((*brick)[0], 4 + 8 * 4);
+    EXPECT_EQ(cache.GetNumMisses(), 1u);
+    EXPECT_TRUE(cache.Contains(3));
+}
+
+TEST_F(BrickCacheTest, HitReturnsCachedBrick)
+{
+    VolumeData::BrickCache cache{*reader, 1024};
+
+    const auto first = cache.GetBrick(0);
+    const auto second = cache.GetBrick(0);
+
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(cache.GetNumHits(), 1u);
+    EXPECT_EQ(cache.GetNumMisses(), 1u);
+}
+
+TEST_F(BrickCacheTest, EvictsLeastRecentlyUsedBrick)
+{
+    VolumeData::BrickCache cache{*reader, 128};
+
+    cache.GetBrick(0);
+    cache.GetBrick(1);
+    cache.GetBrick(0);
+    cache.GetBrick(2);
+
+    EXPECT_TRUE(cache.Contains(0));
+    EXPECT_FALSE(cache.Contains(1));
+    EXPECT_TRUE(cache.Contains(2));
+    EXPECT_EQ(cache.GetSizeInBytes(), 128u);
+}
+
+TEST_F(BrickCacheTest, OutOfRangeBrickReturnsNull)
+{
+    VolumeData::BrickCache cache{*reader, 1024};
+
+    EXPECT_EQ(cache.GetBrick(reader->GetNumBricks()), nullptr);
+}
+
+TEST_F(BrickCacheTest, ClearRemovesAllBricks)
+{
+    VolumeData::BrickCache cache{*reader, 1024};
+    cache.GetBrick(0);
+    cache.GetBrick(1);
+
+    cache.Clear();
+
+    EXPECT_FALSE(cache.Contains(0));
+    EXPECT_EQ(cache.GetSizeInBytes(), 0u);
+}
@@ -0,0 +1,113 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/DecodeBrick.h>
+#include <volumedata/EncodeBrick.h>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+class BrickCodecTest : public ::testing::Test
+{
+protected:
+    static std::vector<uint8_t> MakeVoxels16(const std::vector<uint16_t>& values)
+    {
+        std::vector<uint8_t> voxels(values.size() * sizeof(uint16_t));
+        std::memcpy(voxels.data(), values.data(), voxels.size());
+        return voxels;
+    }
+};
+
+TEST_F(BrickCodecTest, RoundTrips8BitVoxels)
+{
+    std::vector<uint8_t> voxels(1000);
+    for (size_t i = 0; i < voxels.size(); ++i)
+    {
+        voxels[i] = static_cast<uint8_t>((i * 37) % 251);
+    }
+
+    const auto encoded = VolumeData::EncodeBrick(voxels, 1, 8);
+    std::vector<uint8_t> decoded(voxels.size());
+
+    ASSERT_TRUE(VolumeData::DecodeBrick(encoded, 1, 8, decoded));
+    EXPECT_EQ(decoded, voxels);
+}
+
+TEST_F(BrickCodecTest, RoundTrips16BitVoxels)
+{
+    std::vector<uint16_t> values(4096);
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = static_cast<uint16_t>((i < 2000) ? 0 : 1000 + (i * 7919) % 65000);
+    }
+    const auto voxels = MakeVoxels16(values);
+
+    const auto encoded = VolumeData::EncodeBrick(voxels, 1, 16);
+    std::vector<uint8_t> decoded(voxels.size());
+
+    ASSERT_TRUE(VolumeData::DecodeBrick(encoded, 1, 16, decoded));
+    EXPECT_EQ(decoded, voxels);
+}
+
+TEST_F(BrickCodecTest, RoundTripsMultiComponentVoxels)
+{
+    std::vector<uint16_t> values(3 * 500);
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = static_cast<uint16_t>((i % 3) * 20000 + i / 3);
+    }
+    const auto voxels = MakeVoxels16(values);
+
+    const auto encoded = VolumeData::EncodeBrick(voxels, 3, 16);
+    std::vector<uint8_t> decoded(voxels.size());
+
+    ASSERT_TRUE(VolumeData::DecodeBrick(encoded, 3, 16, decoded));
+    EXPECT_EQ(decoded, voxels);
+}
+
+TEST_F(BrickCodecTest, HomogeneousBrickCompressesWell)
+{
+    const auto voxels = MakeVoxels16(std::vector<uint16_t>(64 * 64 * 64, 1024));
+
+    const auto encoded = VolumeData::EncodeBrick(voxels, 1, 16);
+
+    EXPECT_LT(encoded.size(), voxels.size() / 50);
+}
+
+TEST_F(BrickCodecTest, LinearGradientCompressesWell)
+{
+    std::vector<uint16_t> values(32 * 32 * 32);
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = static_cast<uint16_t>(3 * i);
+    }
+    const auto voxels = MakeVoxels16(values);
+
+    const auto encoded = VolumeData::EncodeBrick(voxels, 1, 16);
+
+    EXPECT_LT(encoded.size(), voxels.size() / 50);
+}
+
+TEST_F(BrickCodecTest, TruncatedInputIsRejected)
+{
+    std::vector<uint8_t> voxels(256);
+    for (size_t i = 0; i < voxels.size(); ++i)
+    {
+        voxels[i] = static_cast<uint8_t>(i * i);
+    }
+
+    auto encoded = VolumeData::EncodeBrick(voxels, 1, 8);
+    encoded.pop_back();
+    std::vector<uint8_t> decoded(voxels.size());
+
+    EXPECT_FALSE(VolumeData::DecodeBrick(encoded, 1, 8, decoded));
+}
+
+TEST_F(BrickCodecTest, OverlongRunIsRejected)
+{
+    // A run of 130 bytes into a 16 byte brick
+    const std::vector<uint8_t> encoded = {255, 7};
+    std::vector<uint8_t> decoded(16);
+
+    EXPECT_FALSE(VolumeData::DecodeBrick(encoded, 1, 8, decoded));
+}
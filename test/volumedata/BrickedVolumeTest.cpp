@@ -0,0 +1,173 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/BrickedVolumeHeader.h>
+#include <volumedata/BrickedVolumeReader.h>
+#include <volumedata/LoadVolume.h>
+#include <volumedata/LoadVolumeBricked.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+#include <volumedata/WriteBrickedVolume.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <vector>
+
+class BrickedVolumeTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        filePath = std::filesystem::temp_directory_path() / "BrickedVolumeTest.bvol";
+
+        auto metadata = VolumeData::VolumeMetadata{10, 7, 5, 1, 16};
+        metadata.SetScale(1.0f, 2.0f, 3.0f);
+        volumeData = VolumeData::VolumeData{metadata};
+
+        for (uint32_t z = 0; z < 5; ++z)
+        {
+            for (uint32_t y = 0; y < 7; ++y)
+            {
+                for (uint32_t x = 0; x < 10; ++x)
+                {
+                    volumeData.SetVoxel16(x, y, z, static_cast<uint16_t>(x + 16 * y + 256 * z));
+                }
+            }
+        }
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(filePath);
+    }
+
+    std::filesystem::path filePath;
+    VolumeData::VolumeData volumeData;
+};
+
+TEST_F(BrickedVolumeTest, HeaderDescribesBrickGrid)
+{
+    ASSERT_TRUE(VolumeData::WriteBrickedVolume(volumeData, filePath, 4));
+
+    const auto reader = VolumeData::OpenBrickedVolume(filePath);
+    ASSERT_TRUE(reader);
+
+    const auto& header = reader->GetHeader();
+    EXPECT_EQ(header.brickSize, 4u);
+    EXPECT_EQ(header.numBricksX, 3u);
+    EXPECT_EQ(header.numBricksY, 2u);
+    EXPECT_EQ(header.numBricksZ, 2u);
+    EXPECT_EQ(reader->GetNumBricks(), 12u);
+    EXPECT_FLOAT_EQ(reader->GetMetadata().GetScaleY(), 2.0f);
+}
+
+TEST_F(BrickedVolumeTest, EdgeBricksAreClipped)
+{
+    ASSERT_TRUE(VolumeData::WriteBrickedVolume(volumeData, filePath, 4));
+    const auto reader = VolumeData::OpenBrickedVolume(filePath);
+    ASSERT_TRUE(reader);
+
+    const auto lastBrick = reader->GetBrickExtent(reader->GetNumBricks() - 1);
+    EXPECT_EQ(lastBrick.x, 8u);
+    EXPECT_EQ(lastBrick.y, 4u);
+    EXPECT_EQ(lastBrick.z, 4u);
+    EXPECT_EQ(lastBrick.width, 2u);
+    EXPECT_EQ(lastBrick.height, 3u);
+    EXPECT_EQ(lastBrick.depth, 1u);
+    EXPECT_EQ(reader->GetBrickSizeInBytes(reader->GetNumBricks() - 1), 2u * 3u * 1u * sizeof(uint16_t));
+}
+
+TEST_F(BrickedVolumeTest, ReadBrickReturnsBrickVoxels)
+{
+    ASSERT_TRUE(VolumeData::WriteBrickedVolume(volumeData, filePath, 4));
+    const auto reader = VolumeData::OpenBrickedVolume(filePath);
+    ASSERT_TRUE(reader);
+
+    // Brick (1, 1, 0) starts at voxel (4, 4, 0)
+    const size_t brickIndex = 1 + 1 * 3;
+    std::vector<uint8_t> brickData(reader->GetBrickSizeInBytes(brickIndex));
+    ASSERT_TRUE(reader->ReadBrick(brickIndex, brickData));
+
+    uint16_t firstVoxel;
+    std::memcpy(&firstVoxel, brickData.data(), sizeof(uint16_t));
+    EXPECT_EQ(firstVoxel, volumeData.GetVoxel16(4, 4, 0));
+}
+
+TEST_F(BrickedVolumeTest, IndexStoresBrickValueRange)
+{
+    ASSERT_TRUE(VolumeData::WriteBrickedVolume(volumeData, filePath, 4));
+    const auto reader = VolumeData::OpenBrickedVolume(filePath);
+    ASSERT_TRUE(reader);
+
+    const auto& entry = reader->GetBrickIndexEntry(0);
+    EXPECT_EQ(entry.minValue, volumeData.GetVoxel16(0, 0, 0));
+    EXPECT_EQ(entry.maxValue, volumeData.GetVoxel16(3, 3, 3));
+}
+
+TEST_F(BrickedVolumeTest, LoadVolumeBrickedRestoresVolume)
+{
+    ASSERT_TRUE(VolumeData::WriteBrickedVolume(volumeData, filePath, 4));
+
+    const auto loadedVolume = VolumeData::LoadVolumeBricked(filePath);
+    ASSERT_TRUE(loadedVolume);
+    ASSERT_TRUE(loadedVolume->IsValid());
+    EXPECT_EQ(loadedVolume->GetMetadata().GetWidth(), 10u);
+    EXPECT_TRUE(std::ranges::equal(loadedVolume->GetData(), volumeData.GetData()));
+}
+
+TEST_F(BrickedVolumeTest, LoadVolumeSelectsLoaderByExtension)
+{
+    ASSERT_TRUE(VolumeData::WriteBrickedVolume(volumeData, filePath, 64));
+
+    const auto loadedVolume = VolumeData::LoadVolume(filePath, VolumeData::VolumeStorageMode::Mapped);
+    ASSERT_TRUE(loadedVolume);
+    EXPECT_TRUE(std::ranges::equal(loadedVolume->GetData(), volumeData.GetData()));
+}
+
+TEST_F(BrickedVolumeTest, CompressedVolumeRoundTrips)
+{
+    ASSERT_TRUE(VolumeData::WriteBrickedVolume(volumeData, filePath, 4, VolumeData::BrickCompression::DeltaRle));
+
+    const auto reader = VolumeData::OpenBrickedVolume(filePath);
+    ASSERT_TRUE(reader);
+    EXPECT_EQ(reader->GetHeader().compression, VolumeData::BrickCompression::DeltaRle);
+    EXPECT_LT(reader->GetBrickIndexEntry(0).sizeInBytes, reader->GetBrickSizeInBytes(0));
+
+    const auto loadedVolume = VolumeData::LoadVolumeBricked(filePath);
+    ASSERT_TRUE(loadedVolume);
+    EXPECT_TRUE(std::ranges::equal(loadedVolume->GetData(), volumeData.GetData()));
+}
+
+TEST_F(BrickedVolumeTest, WritingInvalidVolumeFails)
+{
+    const auto result = VolumeData::WriteBrickedVolume(VolumeData::VolumeData{}, filePath, 4);
+
+    ASSERT_FALSE(result);
+    EXPECT_EQ(result.error(), VolumeData::VolumeWritingError::InvalidVolumeData);
+}
+
+TEST_F(BrickedVolumeTest, OpeningFileWithoutMagicFails)
+{
+    std::ofstream file(filePath, std::ios::binary);
+    const std::vector<char> garbage(128, 'x');
+    file.write(garbage.data(), garbage.size());
+    file.close();
+
+    const auto reader = VolumeData::OpenBrickedVolume(filePath);
+
+    ASSERT_FALSE(reader);
+    EXPECT_EQ(reader.error(), VolumeData::VolumeLoadingError::InvalidBrickedFileHeader);
+}
+
+TEST_F(BrickedVolumeTest, OpeningTruncatedFileFails)
+{
+    ASSERT_TRUE(VolumeData::WriteBrickedVolume(volumeData, filePath, 4));
+    std::filesystem::resize_file(filePath, std::filesystem::file_size(filePath) - 1);
+
+    const auto reader = VolumeData::OpenBrickedVolume(filePath);
+
+    ASSERT_FALSE(reader);
+    EXPECT_EQ(reader.error(), VolumeData::VolumeLoadingError::CorruptBrickIndex);
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/ClassifyBricks.h>
+#include <volumedata/VolumeMinMaxGrid.h>
+#include <transferfunction/TransferFunction.h>
+#include <transferfunction/TransferFunctionControlPoint.h>
+
+#include <glm/glm.hpp>
+
+class ClassifyBricksTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // Opaque only between 0.5 and 0.6
+        transferFunction[0] = TransferFunctionControlPoint{0.0f, glm::vec3{1.0f}, 0.0f};
+        transferFunction[1] = TransferFunctionControlPoint{0.45f, glm::vec3{1.0f}, 0.0f};
+        transferFunction[2] = TransferFunctionControlPoint{0.55f, glm::vec3{1.0f}, 1.0f};
+        transferFunction[3] = TransferFunctionControlPoint{0.65f, glm::vec3{1.0f}, 0.0f};
+        transferFunction[4] = TransferFunctionControlPoint{1.0f, glm::vec3{1.0f}, 0.0f};
+        transferFunction.SetNumActivePoints(5);
+
+        grid.brickSize = 4;
+        grid.numBricksX = 4;
+        grid.numBricksY = 1;
+        grid.numBricksZ = 1;
+        grid.minValues = {0.0f, 0.5f, 0.0f, 0.8f};
+        grid.maxValues = {0.2f, 0.52f, 1.0f, 1.0f};
+    }
+
+    TransferFunction transferFunction;
+    VolumeData::VolumeMinMaxGrid grid;
+};
+
+TEST_F(ClassifyBricksTest, MarksBricksByTransferFunctionOpacity)
+{
+    const auto occupancy = VolumeData::ClassifyBricks(grid, transferFunction, 1.0f);
+
+    ASSERT_EQ(occupancy.size(), 4u);
+    EXPECT_EQ(occupancy[0], 0);
+    EXPECT_NE(occupancy[1], 0);
+    EXPECT_NE(occupancy[2], 0);
+    EXPECT_EQ(occupancy[3], 0);
+}
+
+TEST_F(ClassifyBricksTest, AppliesDensityMultiplier)
+{
+    const auto occupancy = VolumeData::ClassifyBricks(grid, transferFunction, 2.5f);
+
+    // The first brick now spans [0, 0.5], the second one saturates beyond the opaque range
+    EXPECT_NE(occupancy[0], 0);
+    EXPECT_EQ(occupancy[1], 0);
+}
+
+TEST_F(ClassifyBricksTest, TransparentTransferFunctionEmptiesAllBricks)
+{
+    for (size_t i = 0; i < transferFunction.GetNumActivePoints(); ++i)
+    {
+        transferFunction[i].opacity = 0.0f;
+    }
+
+    const auto occupancy = VolumeData::ClassifyBricks(grid, transferFunction, 1.0f);
+
+    for (const auto value : occupancy)
+    {
+        EXPECT_EQ(value, 0);
+    }
+}
@@ -0,0 +1,38 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/ComputeBrickStepMultipliers.h>
+#include <volumedata/VolumeMinMaxGrid.h>
+
+class ComputeBrickStepMultipliersTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        grid.brickSize = 4;
+        grid.numBricksX = 4;
+        grid.numBricksY = 1;
+        grid.numBricksZ = 1;
+        grid.minValues = {0.3f, 0.3f, 0.3f, 0.0f};
+        grid.maxValues = {0.3f, 0.31f, 0.35f, 1.0f};
+    }
+
+    VolumeData::VolumeMinMaxGrid grid;
+};
+
+TEST_F(ComputeBrickStepMultipliersTest, StepsShrinkWithValueRange)
+{
+    const auto stepMultipliers = VolumeData::ComputeBrickStepMultipliers(grid, 1.0f, 0.02f, 8);
+
+    ASSERT_EQ(stepMultipliers.size(), 4u);
+    EXPECT_EQ(stepMultipliers[0], 8);
+    EXPECT_EQ(stepMultipliers[1], 4);
+    EXPECT_EQ(stepMultipliers[2], 1);
+    EXPECT_EQ(stepMultipliers[3], 1);
+}
+
+TEST_F(ComputeBrickStepMultipliersTest, AppliesDensityMultiplierAndClampsToTransferFunctionDomain)
+{
+    // The second brick spans 0.02 when doubled, and beyond the transfer function domain when quadrupled
+    EXPECT_EQ(VolumeData::ComputeBrickStepMultipliers(grid, 2.0f, 0.02f, 8)[1], 2);
+    EXPECT_EQ(VolumeData::ComputeBrickStepMultipliers(grid, 4.0f, 0.02f, 8)[1], 8);
+}
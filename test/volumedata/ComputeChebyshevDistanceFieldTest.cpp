@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/ComputeChebyshevDistanceField.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+namespace
+{
+    /// Distance of every cell to the nearest occupied cell by exhaustive search
+    std::vector<uint8_t> ComputeDistancesBruteForce(const std::vector<uint8_t>& occupancy, int width, int height, int depth)
+    {
+        std::vector<uint8_t> distances(occupancy.size(), 255);
+        for (int z = 0; z < depth; ++z)
+        {
+            for (int y = 0; y < height; ++y)
+            {
+                for (int x = 0; x < width; ++x)
+                {
+                    int distance = 255;
+                    for (int k = 0; k < depth; ++k)
+                    {
+                        for (int j = 0; j < height; ++j)
+                        {
+                            for (int i = 0; i < width; ++i)
+                            {
+                                if (occupancy[(k * height + j) * width + i] != 0)
+                                {
+                                    distance = std::min(distance, std::max({std::abs(x - i), std::abs(y - j), std::abs(z - k)}));
+                                }
+                            }
+                        }
+                    }
+                    distances[(z * height + y) * width + x] = static_cast<uint8_t>(distance);
+                }
+            }
+        }
+        return distances;
+    }
+}
+
+TEST(ComputeChebyshevDistanceFieldTest, MatchesBruteForce)
+{
+    constexpr int width = 13;
+    constexpr int height = 9;
+    constexpr int depth = 7;
+
+    std::mt19937 randomEngine{7};
+    std::bernoulli_distribution isOccupied{0.03};
+    std::vector<uint8_t> occupancy(width * height * depth);
+    std::ranges::generate(occupancy, [&]() { return isOccupied(randomEngine) ? uint8_t{255} : uint8_t{0}; });
+    occupancy[0] = 255;
+
+    const auto distances = VolumeData::ComputeChebyshevDistanceField(occupancy, width, height, depth);
+
+    EXPECT_EQ(distances, ComputeDistancesBruteForce(occupancy, width, height, depth));
+}
+
+TEST(ComputeChebyshevDistanceFieldTest, SingleOccupiedCell)
+{
+    std::vector<uint8_t> occupancy(6 * 5 * 4, 0);
+    occupancy[(2 * 5 + 1) * 6 + 3] = 255;
+
+    const auto distances = VolumeData::ComputeChebyshevDistanceField(occupancy, 6, 5, 4);
+
+    ASSERT_EQ(distances.size(), occupancy.size());
+    EXPECT_EQ(distances[(2 * 5 + 1) * 6 + 3], 0);
+    EXPECT_EQ(distances[(2 * 5 + 1) * 6 + 4], 1);
+    EXPECT_EQ(distances[(3 * 5 + 2) * 6 + 2], 1);
+    EXPECT_EQ(distances[(0 * 5 + 4) * 6 + 0], 3);
+}
+
+TEST(ComputeChebyshevDistanceFieldTest, UniformGrids)
+{
+    const auto emptyDistances = VolumeData::ComputeChebyshevDistanceField(std::vector<uint8_t>(64, 0), 4, 4, 4);
+    const auto occupiedDistances = VolumeData::ComputeChebyshevDistanceField(std::vector<uint8_t>(64, 255), 4, 4, 4);
+
+    EXPECT_TRUE(std::ranges::all_of(emptyDistances, [](uint8_t distance) { return distance == 255; }));
+    EXPECT_TRUE(std::ranges::all_of(occupiedDistances, [](uint8_t distance) { return distance == 0; }));
+    EXPECT_TRUE(VolumeData::ComputeChebyshevDistanceField(std::vector<uint8_t>(3, 0), 4, 4, 4).empty());
+}
@@ -0,0 +1,122 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/ComputeGradientVolume.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+namespace
+{
+    size_t GetGradientIndex(const VolumeData::VolumeData& gradientVolume, uint32_t x, uint32_t y, uint32_t z)
+    {
+        const auto& metadata = gradientVolume.GetMetadata();
+        return ((static_cast<size_t>(z) * metadata.GetHeight() + y) * metadata.GetWidth() + x) * metadata.GetComponents();
+    }
+
+    /// Decodes the octahedral normal stored in the first two components of a gradient voxel
+    std::array<float, 3> DecodeNormal(const VolumeData::VolumeData& gradientVolume, uint32_t x, uint32_t y, uint32_t z)
+    {
+        const auto* voxel = gradientVolume.GetDataPtr() + GetGradientIndex(gradientVolume, x, y, z);
+        const float u = voxel[0] / 255.0f * 2.0f - 1.0f;
+        const float v = voxel[1] / 255.0f * 2.0f - 1.0f;
+
+        std::array<float, 3> normal{u, v, 1.0f - std::abs(u) - std::abs(v)};
+        const float fold = std::max(-normal[2], 0.0f);
+        normal[0] += (normal[0] >= 0.0f) ? -fold : fold;
+        normal[1] += (normal[1] >= 0.0f) ? -fold : fold;
+
+        const float length = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+        return {normal[0] / length, normal[1] / length, normal[2] / length};
+    }
+
+    uint8_t GetMagnitude(const VolumeData::VolumeData& gradientVolume, uint32_t x, uint32_t y, uint32_t z)
+    {
+        return gradientVolume.GetDataPtr()[GetGradientIndex(gradientVolume, x, y, z) + 2];
+    }
+} // anonymous namespace
+
+class ComputeGradientVolumeTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        volumeData = VolumeData::VolumeData{VolumeData::VolumeMetadata{8, 6, 5, 1, 8}};
+    }
+
+    void FillRamp(int dx, int dy, int dz)
+    {
+        for (uint32_t z = 0; z < 5; ++z)
+        {
+            for (uint32_t y = 0; y < 6; ++y)
+            {
+                for (uint32_t x = 0; x < 8; ++x)
+                {
+                    volumeData.SetVoxel8(x, y, z, static_cast<uint8_t>(100 + 10 * (dx * static_cast<int>(x) + dy * static_cast<int>(y) + dz * static_cast<int>(z))));
+                }
+            }
+        }
+    }
+
+    VolumeData::VolumeData volumeData;
+};
+
+TEST_F(ComputeGradientVolumeTest, OutputHasThreeByteComponentsAndSameDimensions)
+{
+    const auto gradientVolume = VolumeData::ComputeGradientVolume(volumeData);
+
+    ASSERT_TRUE(gradientVolume.IsValid());
+    EXPECT_EQ(gradientVolume.GetMetadata().GetWidth(), 8u);
+    EXPECT_EQ(gradientVolume.GetMetadata().GetHeight(), 6u);
+    EXPECT_EQ(gradientVolume.GetMetadata().GetDepth(), 5u);
+    EXPECT_EQ(gradientVolume.GetMetadata().GetComponents(), 3u);
+    EXPECT_EQ(gradientVolume.GetMetadata().GetBitsPerComponent(), 8u);
+}
+
+TEST_F(ComputeGradientVolumeTest, FlatVolumeHasZeroMagnitude)
+{
+    const auto gradientVolume = VolumeData::ComputeGradientVolume(volumeData);
+
+    EXPECT_EQ(GetMagnitude(gradientVolume, 3, 3, 2), 0);
+}
+
+TEST_F(ComputeGradientVolumeTest, NormalPointsAgainstIncreasingValues)
+{
+    FillRamp(1, 0, 0);
+
+    const auto gradientVolume = VolumeData::ComputeGradientVolume(volumeData);
+    const auto normal = DecodeNormal(gradientVolume, 3, 3, 2);
+
+    EXPECT_NEAR(normal[0], -1.0f, 0.02f);
+    EXPECT_NEAR(normal[1], 0.0f, 0.02f);
+    EXPECT_NEAR(normal[2], 0.0f, 0.02f);
+    EXPECT_GT(GetMagnitude(gradientVolume, 3, 3, 2), 0);
+}
+
+TEST_F(ComputeGradientVolumeTest, EncodesLowerHemisphereNormals)
+{
+    FillRamp(0, 0, 1);
+
+    const auto gradientVolume = VolumeData::ComputeGradientVolume(volumeData);
+    const auto normal = DecodeNormal(gradientVolume, 3, 3, 2);
+
+    EXPECT_NEAR(normal[2], -1.0f, 0.02f);
+}
+
+TEST_F(ComputeGradientVolumeTest, BoundaryUsesClampedNeighbors)
+{
+    FillRamp(1, 0, 0);
+
+    const auto gradientVolume = VolumeData::ComputeGradientVolume(volumeData);
+
+    // One-sided difference of half the interior central difference
+    EXPECT_NEAR(DecodeNormal(gradientVolume, 0, 0, 0)[0], -1.0f, 0.02f);
+    EXPECT_LT(GetMagnitude(gradientVolume, 0, 3, 2), GetMagnitude(gradientVolume, 3, 3, 2));
+}
+
+TEST_F(ComputeGradientVolumeTest, InvalidVolumeYieldsEmptyResult)
+{
+    EXPECT_FALSE(VolumeData::ComputeGradientVolume(VolumeData::VolumeData{}).IsValid());
+}
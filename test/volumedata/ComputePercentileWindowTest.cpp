@@ -0,0 +1,40 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/ComputePercentileWindow.h>
+#include <volumedata/VolumeHistogram.h>
+
+class ComputePercentileWindowTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        histogram.numBins = 10;
+        histogram.components = 1;
+        histogram.counts = {0, 0, 1, 48, 0, 0, 48, 2, 1, 0};
+    }
+
+    VolumeData::VolumeHistogram histogram;
+};
+
+TEST_F(ComputePercentileWindowTest, FullRangeCoversOccupiedBins)
+{
+    const auto window = VolumeData::ComputePercentileWindow(histogram, 0.0f, 1.0f);
+
+    EXPECT_NEAR(window.GetLow(), 0.2f, 1e-6f);
+    EXPECT_NEAR(window.GetHigh(), 0.9f, 1e-6f);
+}
+
+TEST_F(ComputePercentileWindowTest, PercentilesTrimOutliers)
+{
+    const auto window = VolumeData::ComputePercentileWindow(histogram, 0.02f, 0.95f);
+
+    EXPECT_NEAR(window.GetLow(), 0.3f, 1e-6f);
+    EXPECT_NEAR(window.GetHigh(), 0.7f, 1e-6f);
+}
+
+TEST_F(ComputePercentileWindowTest, EmptyHistogramYieldsFullRange)
+{
+    const auto window = VolumeData::ComputePercentileWindow(VolumeData::VolumeHistogram{}, 0.01f, 0.99f);
+
+    EXPECT_EQ(window, VolumeData::VolumeWindow{});
+}
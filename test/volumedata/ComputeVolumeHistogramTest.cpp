@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/ComputeVolumeHistogram.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <algorithm>
+#include <numeric>
+
+class ComputeVolumeHistogramTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // Spans several blocks and leaves a partial block at the end
+        volumeData = VolumeData::VolumeData{VolumeData::VolumeMetadata{37, 29, 11, 1, 8}};
+
+        auto& data = volumeData.GetData();
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast<uint8_t>(i % 7 == 0 ? 255 : i % 3);
+        }
+    }
+
+    VolumeData::VolumeData volumeData;
+};
+
+TEST_F(ComputeVolumeHistogramTest, CountsEveryVoxel)
+{
+    const auto histogram = VolumeData::ComputeVolumeHistogram(volumeData, 256);
+
+    ASSERT_EQ(histogram.numBins, 256u);
+    ASSERT_EQ(histogram.components, 1u);
+    const auto counts = histogram.GetCounts(0);
+    EXPECT_EQ(std::accumulate(counts.begin(), counts.end(), uint64_t{0}), volumeData.GetData().size());
+}
+
+TEST_F(ComputeVolumeHistogramTest, MatchesSequentialCount)
+{
+    const auto histogram = VolumeData::ComputeVolumeHistogram(volumeData, 256);
+
+    std::vector<uint64_t> expectedCounts(256, 0);
+    for (const auto value : volumeData.GetData())
+    {
+        ++expectedCounts[value];
+    }
+
+    const auto counts = histogram.GetCounts(0);
+    EXPECT_TRUE(std::equal(counts.begin(), counts.end(), expectedCounts.begin()));
+    EXPECT_EQ(histogram.GetMaxCount(0), *std::max_element(expectedCounts.begin(), expectedCounts.end()));
+}
+
+TEST_F(ComputeVolumeHistogramTest, BinsSpanTheValueRange)
+{
+    const auto histogram = VolumeData::ComputeVolumeHistogram(volumeData, 4);
+
+    // Values 0 to 2 land in the first bin, 255 in the last
+    const auto counts = histogram.GetCounts(0);
+    EXPECT_GT(counts[0], 0u);
+    EXPECT_EQ(counts[1], 0u);
+    EXPECT_EQ(counts[2], 0u);
+    EXPECT_GT(counts[3], 0u);
+}
+
+TEST_F(ComputeVolumeHistogramTest, SeparatesComponentsOf16BitVolumes)
+{
+    auto rgVolume = VolumeData::VolumeData{VolumeData::VolumeMetadata{100, 10, 3, 2, 16}};
+    auto& data = rgVolume.GetData();
+    auto* values = reinterpret_cast<uint16_t*>(data.data());
+    const size_t numValues = data.size() / sizeof(uint16_t);
+    for (size_t i = 0; i < numValues; i += 2)
+    {
+        values[i] = 0;
+        values[i + 1] = 65535;
+    }
+
+    const auto histogram = VolumeData::ComputeVolumeHistogram(rgVolume, 16);
+
+    ASSERT_EQ(histogram.components, 2u);
+    EXPECT_EQ(histogram.GetCounts(0)[0], numValues / 2);
+    EXPECT_EQ(histogram.GetCounts(1)[15], numValues / 2);
+    EXPECT_EQ(histogram.GetCounts(1)[0], 0u);
+}
+
+TEST_F(ComputeVolumeHistogramTest, UnsupportedInputsYieldEmptyHistogram)
+{
+    EXPECT_TRUE(VolumeData::ComputeVolumeHistogram(VolumeData::VolumeData{}, 256).IsEmpty());
+    EXPECT_TRUE(VolumeData::ComputeVolumeHistogram(volumeData, 0).IsEmpty());
+    EXPECT_TRUE(VolumeData::ComputeVolumeHistogram(volumeData, 65537).IsEmpty());
+}
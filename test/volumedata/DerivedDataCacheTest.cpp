@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/ComputeVolumeContentHash.h>
+#include <volumedata/DerivedDataCache.h>
+#include <volumedata/DerivedDataHeader.h>
+#include <volumedata/DerivedDataKey.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <vector>
+
+class DerivedDataCacheTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        cacheDirectoryPath = std::filesystem::temp_directory_path() / "DerivedDataCacheTest";
+        std::filesystem::remove_all(cacheDirectoryPath);
+
+        volumeData = VolumeData::VolumeData{VolumeData::VolumeMetadata{5, 4, 3, 1, 16}};
+        for (uint32_t z = 0; z < 3; ++z)
+        {
+            for (uint32_t y = 0; y < 4; ++y)
+            {
+                for (uint32_t x = 0; x < 5; ++x)
+                {
+                    volumeData.SetVoxel16(x, y, z, static_cast<uint16_t>(x * 7 + y * 131 + z * 1031));
+                }
+            }
+        }
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(cacheDirectoryPath);
+    }
+
+    std::filesystem::path cacheDirectoryPath;
+    VolumeData::VolumeData volumeData;
+};
+
+TEST_F(DerivedDataCacheTest, ReadsWrittenEntry)
+{
+    const auto cache = VolumeData::DerivedDataCache{cacheDirectoryPath};
+    const auto key = VolumeData::DerivedDataKey{0x0123456789ABCDEFull, VolumeData::DerivedDataType::VolumeMinMaxGrid, 16};
+
+    const std::vector<float> minValues = {0.0f, 0.25f, 0.5f};
+    const std::vector<float> maxValues = {0.5f, 0.75f, 1.0f};
+    ASSERT_TRUE(cache.Write(key, std::array{std::as_bytes(std::span{minValues}), std::as_bytes(std::span{maxValues})}).has_value());
+
+    std::vector<float> readMinValues(3);
+    std::vector<float> readMaxValues(3);
+    ASSERT_TRUE(cache.Read(key, std::array{std::as_writable_bytes(std::span{readMinValues}), std::as_writable_bytes(std::span{readMaxValues})}));
+    EXPECT_EQ(readMinValues, minValues);
+    EXPECT_EQ(readMaxValues, maxValues);
+    EXPECT_FALSE(std::filesystem::exists(cache.GetEntryPath(key).string() + ".tmp"));
+}
+
+TEST_F(DerivedDataCacheTest, MissesOnOtherKeyOrSize)
+{
+    const auto cache = VolumeData::DerivedDataCache{cacheDirectoryPath};
+    const auto key = VolumeData::DerivedDataKey{42, VolumeData::DerivedDataType::VolumeHistogram, 256};
+
+    const std::vector<uint64_t> counts(256, 1);
+    ASSERT_TRUE(cache.Write(key, std::array{std::as_bytes(std::span{counts})}).has_value());
+
+    std::vector<uint64_t> readCounts(256);
+    const std::array readParts = {std::as_writable_bytes(std::span{readCounts})};
+    EXPECT_FALSE(cache.Read(VolumeData::DerivedDataKey{43, VolumeData::DerivedDataType::VolumeHistogram, 256}, readParts));
+    EXPECT_FALSE(cache.Read(VolumeData::DerivedDataKey{42, VolumeData::DerivedDataType::VolumeHistogram, 128}, readParts));
+
+    std::vector<uint64_t> tooFewCounts(128);
+    EXPECT_FALSE(cache.Read(key, std::array{std::as_writable_bytes(std::span{tooFewCounts})}));
+}
+
+TEST_F(DerivedDataCacheTest, RejectsStaleEntry)
+{
+    const auto cache = VolumeData::DerivedDataCache{cacheDirectoryPath};
+    const auto key = VolumeData::DerivedDataKey{7, VolumeData::DerivedDataType::GradientVolume, 0};
+
+    const std::vector<uint8_t> payload(60, 9);
+    ASSERT_TRUE(cache.Write(key, std::array{std::as_bytes(std::span{payload})}).has_value());
+
+    // Entries written by another file format version must be recomputed
+    {
+        std::fstream file(cache.GetEntryPath(key), std::ios::binary | std::ios::in | std::ios::out);
+        const uint32_t otherVersion = VolumeData::DerivedDataFormat::version + 1;
+        file.seekp(offsetof(VolumeData::DerivedDataHeader, version));
+        file.write(reinterpret_cast<const char*>(&otherVersion), sizeof(otherVersion));
+    }
+
+    std::vector<uint8_t> readPayload(60);
+    const std::array readParts = {std::as_writable_bytes(std::span{readPayload})};
+    EXPECT_FALSE(cache.Read(key, readParts));
+
+    ASSERT_TRUE(cache.Write(key, std::array{std::as_bytes(std::span{payload})}).has_value());
+    EXPECT_TRUE(cache.Read(key, readParts));
+    EXPECT_EQ(readPayload, payload);
+}
+
+TEST_F(DerivedDataCacheTest, ContentHashDependsOnVoxelsAndMetadata)
+{
+    const uint64_t hash = VolumeData::ComputeVolumeContentHash(volumeData);
+    EXPECT_EQ(VolumeData::ComputeVolumeContentHash(volumeData.Clone()), hash);
+
+    auto modifiedVolumeData = volumeData.Clone();
+    modifiedVolumeData.SetVoxel16(4, 3, 2, 1);
+    EXPECT_NE(VolumeData::ComputeVolumeContentHash(modifiedVolumeData), hash);
+
+    auto rescaledVolumeData = volumeData.Clone();
+    auto metadata = volumeData.GetMetadata();
+    metadata.SetScaleZ(2.0f);
+    rescaledVolumeData.SetMetadata(metadata);
+    EXPECT_NE(VolumeData::ComputeVolumeContentHash(rescaledVolumeData), hash);
+}
+
+TEST_F(DerivedDataCacheTest, ModifyingVolumeClearsContentHash)
+{
+    volumeData.SetContentHash(VolumeData::ComputeVolumeContentHash(volumeData));
+    auto copiedVolumeData = volumeData.Clone();
+    EXPECT_EQ(copiedVolumeData.GetContentHash(), volumeData.GetContentHash());
+
+    copiedVolumeData.SetVoxel16(0, 0, 0, 5);
+    EXPECT_FALSE(copiedVolumeData.GetContentHash().has_value());
+
+    volumeData.GetDataPtr();
+    EXPECT_FALSE(volumeData.GetContentHash().has_value());
+}
@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/DownsampleVolumeData.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+
+class DownsampleVolumeDataTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        volumeData = VolumeData::VolumeData{VolumeData::VolumeMetadata{5, 4, 2, 1, 16}};
+
+        for (uint32_t z = 0; z < 2; ++z)
+        {
+            for (uint32_t y = 0; y < 4; ++y)
+            {
+                for (uint32_t x = 0; x < 5; ++x)
+                {
+                    volumeData.SetVoxel16(x, y, z, static_cast<uint16_t>(1000 * x + 100 * y + 10 * z));
+                }
+            }
+        }
+    }
+
+    VolumeData::VolumeData volumeData;
+};
+
+TEST_F(DownsampleVolumeDataTest, DimensionsAreHalvedAndRoundedDown)
+{
+    const auto downsampled = VolumeData::DownsampleVolumeData(volumeData);
+
+    EXPECT_EQ(downsampled.GetMetadata().GetWidth(), 2u);
+    EXPECT_EQ(downsampled.GetMetadata().GetHeight(), 2u);
+    EXPECT_EQ(downsampled.GetMetadata().GetDepth(), 1u);
+    EXPECT_FLOAT_EQ(downsampled.GetMetadata().GetScaleX(), 2.5f * volumeData.GetMetadata().GetScaleX());
+    EXPECT_FLOAT_EQ(downsampled.GetMetadata().GetScaleY(), 2.0f * volumeData.GetMetadata().GetScaleY());
+    EXPECT_TRUE(downsampled.IsValid());
+}
+
+TEST_F(DownsampleVolumeDataTest, AveragesBlocksOfEightVoxels)
+{
+    const auto downsampled = VolumeData::DownsampleVolumeData(volumeData);
+
+    // Mean of x in {0, 1}, y in {2, 3}, z in {0, 1}
+    EXPECT_EQ(downsampled.GetVoxel16(0, 1, 0), 500 + 250 + 5);
+}
+
+TEST_F(DownsampleVolumeDataTest, OddBoundaryVoxelJoinsLastBlock)
+{
+    const auto downsampled = VolumeData::DownsampleVolumeData(volumeData);
+
+    // The last block covers x in {2, 3, 4}
+    EXPECT_EQ(downsampled.GetVoxel16(1, 0, 0), 3000 + 50 + 5);
+}
+
+TEST_F(DownsampleVolumeDataTest, SingleVoxelDimensionIsKept)
+{
+    auto thinVolume = VolumeData::VolumeData{VolumeData::VolumeMetadata{3, 1, 1, 1, 8}};
+    auto& data = thinVolume.GetData();
+    data = {10, 20, 60};
+
+    const auto downsampled = VolumeData::DownsampleVolumeData(thinVolume);
+
+    ASSERT_EQ(downsampled.GetSizeInBytes(), 1u);
+    EXPECT_EQ(downsampled.GetData()[0], 30);
+}
+
+TEST_F(DownsampleVolumeDataTest, Averages8BitMultiComponentVoxels)
+{
+    auto rgVolume = VolumeData::VolumeData{VolumeData::VolumeMetadata{2, 2, 2, 2, 8}};
+    auto& data = rgVolume.GetData();
+    for (size_t i = 0; i < data.size(); i += 2)
+    {
+        data[i] = 10;
+        data[i + 1] = static_cast<uint8_t>(i * 10);
+    }
+
+    const auto downsampled = VolumeData::DownsampleVolumeData(rgVolume);
+
+    ASSERT_EQ(downsampled.GetSizeInBytes(), 2u);
+    EXPECT_EQ(downsampled.GetData()[0], 10);
+    EXPECT_EQ(downsampled.GetData()[1], 70);
+}
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/FindTimeSeriesSteps.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+class FindTimeSeriesStepsTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        directoryPath = std::filesystem::temp_directory_path() / "FindTimeSeriesStepsTest";
+        std::filesystem::remove_all(directoryPath);
+        std::filesystem::create_directories(directoryPath);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(directoryPath);
+    }
+
+    void CreateFile(const std::string& fileName) const
+    {
+        std::ofstream{directoryPath / fileName, std::ios::binary} << 'x';
+    }
+
+    std::vector<std::string> FindStepFileNames() const
+    {
+        std::vector<std::string> fileNames;
+        for (const auto& stepPath : VolumeData::FindTimeSeriesSteps(directoryPath))
+        {
+            fileNames.push_back(stepPath.filename().string());
+        }
+        return fileNames;
+    }
+
+    std::filesystem::path directoryPath;
+};
+
+TEST_F(FindTimeSeriesStepsTest, FindsOnlyRawFiles)
+{
+    CreateFile("step_0.raw");
+    CreateFile("step_0.ini");
+    CreateFile("notes.txt");
+    std::filesystem::create_directories(directoryPath / "subdirectory.raw");
+
+    EXPECT_EQ(FindStepFileNames(), (std::vector<std::string>{"step_0.raw"}));
+}
+
+TEST_F(FindTimeSeriesStepsTest, SortsNumbersByValue)
+{
+    CreateFile("step_10.raw");
+    CreateFile("step_2.raw");
+    CreateFile("step_1.raw");
+
+    EXPECT_EQ(FindStepFileNames(), (std::vector<std::string>{"step_1.raw", "step_2.raw", "step_10.raw"}));
+}
+
+TEST_F(FindTimeSeriesStepsTest, SortsPaddedNumbersByValue)
+{
+    CreateFile("step_0010.raw");
+    CreateFile("step_0009.raw");
+    CreateFile("step_0100.raw");
+
+    EXPECT_EQ(FindStepFileNames(), (std::vector<std::string>{"step_0009.raw", "step_0010.raw", "step_0100.raw"}));
+}
+
+TEST_F(FindTimeSeriesStepsTest, SortsByPrefixBeforeNumber)
+{
+    CreateFile("b_1.raw");
+    CreateFile("a_2.raw");
+    CreateFile("a_10.raw");
+
+    EXPECT_EQ(FindStepFileNames(), (std::vector<std::string>{"a_2.raw", "a_10.raw", "b_1.raw"}));
+}
+
+TEST_F(FindTimeSeriesStepsTest, ReturnsEmptyForMissingDirectory)
+{
+    EXPECT_TRUE(VolumeData::FindTimeSeriesSteps(directoryPath / "missing").empty());
+}
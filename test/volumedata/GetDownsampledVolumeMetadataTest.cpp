@@ -0,0 +1,37 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/GetDownsampledVolumeMetadata.h>
+#include <volumedata/VolumeMetadata.h>
+
+TEST(GetDownsampledVolumeMetadataTest, FloorsDimensionsDownToOne)
+{
+    const auto metadata = VolumeData::GetDownsampledVolumeMetadata(VolumeData::VolumeMetadata{17, 3, 1, 1, 8}, 4);
+
+    EXPECT_EQ(metadata.GetWidth(), 4u);
+    EXPECT_EQ(metadata.GetHeight(), 1u);
+    EXPECT_EQ(metadata.GetDepth(), 1u);
+}
+
+TEST(GetDownsampledVolumeMetadataTest, PreservesPhysicalExtent)
+{
+    auto sourceMetadata = VolumeData::VolumeMetadata{10, 7, 4, 1, 16};
+    sourceMetadata.SetScale(1.0f, 2.0f, 3.0f);
+
+    const auto metadata = VolumeData::GetDownsampledVolumeMetadata(sourceMetadata);
+
+    EXPECT_FLOAT_EQ(metadata.GetWidth() * metadata.GetScaleX(), 10.0f);
+    EXPECT_FLOAT_EQ(metadata.GetHeight() * metadata.GetScaleY(), 14.0f);
+    EXPECT_FLOAT_EQ(metadata.GetDepth() * metadata.GetScaleZ(), 12.0f);
+}
+
+TEST(GetDownsampledVolumeMetadataTest, RepeatedHalvingMatchesSingleFactor)
+{
+    const auto sourceMetadata = VolumeData::VolumeMetadata{23, 9, 6, 1, 8};
+
+    const auto halvedTwice = VolumeData::GetDownsampledVolumeMetadata(VolumeData::GetDownsampledVolumeMetadata(sourceMetadata));
+    const auto quartered = VolumeData::GetDownsampledVolumeMetadata(sourceMetadata, 4);
+
+    EXPECT_EQ(halvedTwice.GetWidth(), quartered.GetWidth());
+    EXPECT_EQ(halvedTwice.GetHeight(), quartered.GetHeight());
+    EXPECT_EQ(halvedTwice.GetDepth(), quartered.GetDepth());
+}
@@ -0,0 +1,15 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/GetNyquistStepSize.h>
+#include <volumedata/VolumeMetadata.h>
+
+TEST(GetNyquistStepSizeTest, TakesTwoSamplesPerVoxelOfLargestDimension)
+{
+    EXPECT_FLOAT_EQ(VolumeData::GetNyquistStepSize(VolumeData::VolumeMetadata{256, 256, 256, 1, 8}), 1.0f / 512.0f);
+    EXPECT_FLOAT_EQ(VolumeData::GetNyquistStepSize(VolumeData::VolumeMetadata{100, 400, 50, 1, 16}), 1.0f / 800.0f);
+}
+
+TEST(GetNyquistStepSizeTest, EmptyVolumeYieldsFiniteStep)
+{
+    EXPECT_FLOAT_EQ(VolumeData::GetNyquistStepSize(VolumeData::VolumeMetadata{}), 0.5f);
+}
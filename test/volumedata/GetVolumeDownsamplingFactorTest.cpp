@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/FitVolumeToTextureBudget.h>
+#include <volumedata/GetVolumeDownsamplingFactor.h>
+#include <volumedata/GetVolumeTextureSizeInBytes.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+#include <volumedata/VolumeTextureBudget.h>
+
+#include <cstdint>
+#include <utility>
+
+TEST(GetVolumeDownsamplingFactorTest, KeepsFullResolutionWithoutLimits)
+{
+    const auto metadata = VolumeData::VolumeMetadata{1000, 800, 600, 1, 16};
+
+    EXPECT_EQ(VolumeData::GetVolumeDownsamplingFactor(metadata, VolumeData::VolumeTextureBudget{}), 1u);
+}
+
+TEST(GetVolumeDownsamplingFactorTest, FitsLargestDimensionIntoMaxTextureSize)
+{
+    const auto metadata = VolumeData::VolumeMetadata{1000, 100, 100, 1, 8};
+    auto budget = VolumeData::VolumeTextureBudget{};
+
+    budget.maxDimension = 1000;
+    EXPECT_EQ(VolumeData::GetVolumeDownsamplingFactor(metadata, budget), 1u);
+
+    budget.maxDimension = 256;
+    EXPECT_EQ(VolumeData::GetVolumeDownsamplingFactor(metadata, budget), 4u);
+}
+
+TEST(GetVolumeDownsamplingFactorTest, FitsTexturesIntoMemoryBudget)
+{
+    const auto metadata = VolumeData::VolumeMetadata{256, 256, 256, 1, 16};
+    const auto halfResolutionMetadata = VolumeData::VolumeMetadata{128, 128, 128, 1, 16};
+    auto budget = VolumeData::VolumeTextureBudget{};
+
+    budget.maxSizeInBytes = VolumeData::GetVolumeTextureSizeInBytes(metadata);
+    EXPECT_EQ(VolumeData::GetVolumeDownsamplingFactor(metadata, budget), 1u);
+
+    budget.maxSizeInBytes = VolumeData::GetVolumeTextureSizeInBytes(metadata) - 1;
+    EXPECT_EQ(VolumeData::GetVolumeDownsamplingFactor(metadata, budget), 2u);
+
+    budget.maxSizeInBytes = VolumeData::GetVolumeTextureSizeInBytes(halfResolutionMetadata) - 1;
+    EXPECT_EQ(VolumeData::GetVolumeDownsamplingFactor(metadata, budget), 4u);
+}
+
+TEST(GetVolumeDownsamplingFactorTest, StopsAtSingleVoxel)
+{
+    const auto metadata = VolumeData::VolumeMetadata{5, 3, 2, 1, 8};
+    auto budget = VolumeData::VolumeTextureBudget{};
+    budget.maxSizeInBytes = 0;
+
+    EXPECT_EQ(VolumeData::GetVolumeDownsamplingFactor(metadata, budget), 4u);
+}
+
+TEST(GetVolumeDownsamplingFactorTest, FitVolumeToTextureBudgetDownsamplesByFactor)
+{
+    auto volumeData = VolumeData::VolumeData{VolumeData::VolumeMetadata{10, 7, 5, 1, 8}};
+    auto budget = VolumeData::VolumeTextureBudget{};
+    budget.maxDimension = 3;
+
+    const auto fittedVolumeData = VolumeData::FitVolumeToTextureBudget(std::move(volumeData), budget);
+
+    EXPECT_EQ(fittedVolumeData.GetMetadata().GetWidth(), 2u);
+    EXPECT_EQ(fittedVolumeData.GetMetadata().GetHeight(), 1u);
+    EXPECT_EQ(fittedVolumeData.GetMetadata().GetDepth(), 1u);
+    EXPECT_FLOAT_EQ(fittedVolumeData.GetMetadata().GetScaleX(), 5.0f);
+}
@@ -0,0 +1,40 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/GetVolumeTextureFormat.h>
+#include <volumedata/VolumeMetadata.h>
+#include <volumedata/VolumeTextureFormat.h>
+
+#include <glad/glad.h>
+
+using namespace VolumeData;
+
+TEST(GetVolumeTextureFormatTest, SingleComponent8BitMapsToR8)
+{
+    const VolumeTextureFormat textureFormat = GetVolumeTextureFormat(VolumeMetadata{10, 10, 10, 1, 8});
+    EXPECT_EQ(textureFormat.internalFormat, static_cast<unsigned int>(GL_R8));
+    EXPECT_EQ(textureFormat.format, static_cast<unsigned int>(GL_RED));
+    EXPECT_EQ(textureFormat.type, static_cast<unsigned int>(GL_UNSIGNED_BYTE));
+}
+
+TEST(GetVolumeTextureFormatTest, SingleComponent16BitMapsToR16)
+{
+    const VolumeTextureFormat textureFormat = GetVolumeTextureFormat(VolumeMetadata{10, 10, 10, 1, 16});
+    EXPECT_EQ(textureFormat.internalFormat, static_cast<unsigned int>(GL_R16));
+    EXPECT_EQ(textureFormat.format, static_cast<unsigned int>(GL_RED));
+    EXPECT_EQ(textureFormat.type, static_cast<unsigned int>(GL_UNSIGNED_SHORT));
+}
+
+TEST(GetVolumeTextureFormatTest, ThreeComponent8BitMapsToRGB8)
+{
+    const VolumeTextureFormat textureFormat = GetVolumeTextureFormat(VolumeMetadata{10, 10, 10, 3, 8});
+    EXPECT_EQ(textureFormat.internalFormat, static_cast<unsigned int>(GL_RGB8));
+    EXPECT_EQ(textureFormat.format, static_cast<unsigned int>(GL_RGB));
+}
+
+TEST(GetVolumeTextureFormatTest, FourComponent16BitMapsToRGBA16)
+{
+    const VolumeTextureFormat textureFormat = GetVolumeTextureFormat(VolumeMetadata{10, 10, 10, 4, 16});
+    EXPECT_EQ(textureFormat.internalFormat, static_cast<unsigned int>(GL_RGBA16));
+    EXPECT_EQ(textureFormat.format, static_cast<unsigned int>(GL_RGBA));
+    EXPECT_EQ(textureFormat.type, static_cast<unsigned int>(GL_UNSIGNED_SHORT));
+}
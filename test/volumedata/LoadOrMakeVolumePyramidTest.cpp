@@ -0,0 +1,84 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/ComputeVolumeContentHash.h>
+#include <volumedata/DerivedDataCache.h>
+#include <volumedata/DerivedDataKey.h>
+#include <volumedata/LoadOrMakeVolumePyramid.h>
+#include <volumedata/MakeVolumePyramid.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <config/Config.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <utility>
+#include <vector>
+
+class LoadOrMakeVolumePyramidTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        volumeData = VolumeData::VolumeData{VolumeData::VolumeMetadata{7, 5, 3, 1, 8}};
+        auto& data = volumeData.GetData();
+        for (size_t i = 0; i < data.size(); ++i)
+        {
+            data[i] = static_cast<uint8_t>(i * 37 + 11);
+        }
+        volumeData.SetContentHash(VolumeData::ComputeVolumeContentHash(volumeData));
+        key = VolumeData::DerivedDataKey{*volumeData.GetContentHash(), VolumeData::DerivedDataType::VolumePyramid, 0};
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(VolumeData::DerivedDataCache{Config::derivedDataCachePath}.GetEntryPath(key));
+    }
+
+    /// Expects the levels to match those MakeVolumePyramid() builds
+    void ExpectPyramid(const std::vector<VolumeData::VolumeData>& levels)
+    {
+        const auto expectedLevels = VolumeData::MakeVolumePyramid(volumeData);
+        ASSERT_EQ(levels.size(), expectedLevels.size());
+        for (size_t i = 0; i < levels.size(); ++i)
+        {
+            EXPECT_EQ(levels[i].GetMetadata().GetWidth(), expectedLevels[i].GetMetadata().GetWidth());
+            EXPECT_EQ(levels[i].GetMetadata().GetHeight(), expectedLevels[i].GetMetadata().GetHeight());
+            EXPECT_EQ(levels[i].GetMetadata().GetDepth(), expectedLevels[i].GetMetadata().GetDepth());
+            EXPECT_TRUE(std::ranges::equal(levels[i].GetData(), expectedLevels[i].GetData()));
+        }
+    }
+
+    VolumeData::VolumeData volumeData;
+    VolumeData::DerivedDataKey key;
+};
+
+TEST_F(LoadOrMakeVolumePyramidTest, CachedPyramidMatchesComputedPyramid)
+{
+    ExpectPyramid(VolumeData::LoadOrMakeVolumePyramid(volumeData));
+    ExpectPyramid(VolumeData::LoadOrMakeVolumePyramid(volumeData));
+}
+
+TEST_F(LoadOrMakeVolumePyramidTest, RejectsEntryWithDifferentLevelDimensions)
+{
+    const auto levels = VolumeData::MakeVolumePyramid(volumeData);
+
+    // Same payload size as a valid entry, but with the dimensions of the first level swapped and its voxels cleared
+    const std::vector<uint8_t> clearedVoxels(levels[0].GetSizeInBytes(), 0);
+    std::vector<uint32_t> dimensions;
+    std::vector<std::span<const std::byte>> parts{std::span<const std::byte>{}};
+    for (const auto& level : levels)
+    {
+        const auto& metadata = level.GetMetadata();
+        dimensions.insert(dimensions.end(), {metadata.GetWidth(), metadata.GetHeight(), metadata.GetDepth()});
+        parts.push_back(std::as_bytes(level.GetData()));
+    }
+    std::swap(dimensions[0], dimensions[1]);
+    parts[0] = std::as_bytes(std::span{dimensions});
+    parts[1] = std::as_bytes(std::span{clearedVoxels});
+    ASSERT_TRUE(VolumeData::DerivedDataCache{Config::derivedDataCachePath}.Write(key, parts));
+
+    ExpectPyramid(VolumeData::LoadOrMakeVolumePyramid(volumeData));
+}
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/LoadVolumeMetadata.h>
+#include <volumedata/VolumeLoadingError.h>
+
+#include <filesystem>
+#include <fstream>
+#include <string>
+
+class LoadVolumeMetadataTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        iniFilePath = std::filesystem::temp_directory_path() / "LoadVolumeMetadataTest.ini";
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(iniFilePath);
+    }
+
+    void WriteIniFile(const std::string& contents)
+    {
+        std::ofstream file(iniFilePath);
+        file << contents;
+    }
+
+    std::filesystem::path iniFilePath;
+};
+
+TEST_F(LoadVolumeMetadataTest, LoadsValidMetadata)
+{
+    WriteIniFile("[Volume]\nWidth=256\nHeight=128\nDepth=64\nComponents=1\nBitsPerComponent=16\nScaleX=1.5\n");
+
+    const auto result = VolumeData::LoadVolumeMetadata(iniFilePath);
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->GetWidth(), 256u);
+    EXPECT_EQ(result->GetHeight(), 128u);
+    EXPECT_EQ(result->GetDepth(), 64u);
+    EXPECT_EQ(result->GetBitsPerComponent(), 16u);
+    EXPECT_FLOAT_EQ(result->GetScaleX(), 1.5f);
+}
+
+TEST_F(LoadVolumeMetadataTest, IgnoresOtherSectionsAndComments)
+{
+    WriteIniFile("; comment\n[Other]\nWidth=1\n[Volume]\n# comment\nWidth = 32\nHeight=32\nDepth=32\nComponents=1\nBitsPerComponent=8\nUnknownKey=5\n");
+
+    const auto result = VolumeData::LoadVolumeMetadata(iniFilePath);
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result->GetWidth(), 32u);
+}
+
+TEST_F(LoadVolumeMetadataTest, ReturnsErrorForMissingFile)
+{
+    const auto result = VolumeData::LoadVolumeMetadata(iniFilePath);
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), VolumeData::VolumeLoadingError::MetadataFileNotFound);
+}
+
+TEST_F(LoadVolumeMetadataTest, ReturnsErrorForUnparsableValue)
+{
+    WriteIniFile("[Volume]\nWidth=abc\n");
+
+    const auto result = VolumeData::LoadVolumeMetadata(iniFilePath);
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), VolumeData::VolumeLoadingError::MetadataParseError);
+}
+
+TEST_F(LoadVolumeMetadataTest, ReturnsErrorForIncompleteMetadata)
+{
+    WriteIniFile("[Volume]\nWidth=32\n");
+
+    const auto result = VolumeData::LoadVolumeMetadata(iniFilePath);
+
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), VolumeData::VolumeLoadingError::InvalidMetadata);
+}
@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/GetVolumeRegionMetadata.h>
+#include <volumedata/LoadVolume.h>
+#include <volumedata/LoadVolumeRaw.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+#include <volumedata/VolumeRegion.h>
+#include <volumedata/WriteBrickedVolume.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+
+class LoadVolumeRegionTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        rawFilePath = std::filesystem::temp_directory_path() / "LoadVolumeRegionTest.raw";
+        iniFilePath = std::filesystem::temp_directory_path() / "LoadVolumeRegionTest.ini";
+        bricksFilePath = std::filesystem::temp_directory_path() / "LoadVolumeRegionTest.bvol";
+
+        auto metadata = VolumeData::VolumeMetadata{10, 7, 5, 1, 16};
+        metadata.SetScale(1.0f, 2.0f, 3.0f);
+        volumeData = VolumeData::VolumeData{metadata};
+
+        for (uint32_t z = 0; z < 5; ++z)
+        {
+            for (uint32_t y = 0; y < 7; ++y)
+            {
+                for (uint32_t x = 0; x < 10; ++x)
+                {
+                    volumeData.SetVoxel16(x, y, z, static_cast<uint16_t>(x + 16 * y + 256 * z));
+                }
+            }
+        }
+
+        const auto data = volumeData.GetData();
+        std::ofstream rawFile(rawFilePath, std::ios::binary);
+        rawFile.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+
+        std::ofstream iniFile(iniFilePath);
+        iniFile << "[Volume]\nWidth=10\nHeight=7\nDepth=5\nComponents=1\nBitsPerComponent=16\nScaleX=1\nScaleY=2\nScaleZ=3\n";
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(rawFilePath);
+        std::filesystem::remove(iniFilePath);
+        std::filesystem::remove(bricksFilePath);
+    }
+
+    /// Expects the region to hold the voxels of the source volume at the given offset and stride
+    void ExpectRegion(const VolumeData::VolumeData& region, uint32_t offsetX, uint32_t offsetY, uint32_t offsetZ, uint32_t stride)
+    {
+        const auto& metadata = region.GetMetadata();
+        for (uint32_t z = 0; z < metadata.GetDepth(); ++z)
+        {
+            for (uint32_t y = 0; y < metadata.GetHeight(); ++y)
+            {
+                for (uint32_t x = 0; x < metadata.GetWidth(); ++x)
+                {
+                    ASSERT_EQ(region.GetVoxel16(x, y, z), volumeData.GetVoxel16(offsetX + x * stride, offsetY + y * stride, offsetZ + z * stride));
+                }
+            }
+        }
+    }
+
+    std::filesystem::path rawFilePath;
+    std::filesystem::path iniFilePath;
+    std::filesystem::path bricksFilePath;
+    VolumeData::VolumeData volumeData;
+};
+
+TEST_F(LoadVolumeRegionTest, MetadataOfStridedRegionPreservesSpacing)
+{
+    const auto metadata = VolumeData::GetVolumeRegionMetadata(volumeData.GetMetadata(), VolumeData::VolumeRegion{1, 0, 0, 9, 0, 4, 2});
+    ASSERT_TRUE(metadata.has_value());
+
+    EXPECT_EQ(metadata->GetWidth(), 5u);
+    EXPECT_EQ(metadata->GetHeight(), 4u);
+    EXPECT_EQ(metadata->GetDepth(), 2u);
+    EXPECT_FLOAT_EQ(metadata->GetScaleX(), 2.0f);
+    EXPECT_FLOAT_EQ(metadata->GetScaleY(), 4.0f);
+    EXPECT_FLOAT_EQ(metadata->GetScaleZ(), 6.0f);
+}
+
+TEST_F(LoadVolumeRegionTest, RejectsRegionsOutsideOfVolume)
+{
+    const auto& metadata = volumeData.GetMetadata();
+
+    EXPECT_FALSE(VolumeData::GetVolumeRegionMetadata(metadata, VolumeData::VolumeRegion{10, 0, 0}).has_value());
+    EXPECT_FALSE(VolumeData::GetVolumeRegionMetadata(metadata, VolumeData::VolumeRegion{2, 0, 0, 9}).has_value());
+    EXPECT_FALSE(VolumeData::GetVolumeRegionMetadata(metadata, VolumeData::VolumeRegion{0, 0, 0, 0, 0, 0, 0}).has_value());
+
+    const auto result = VolumeData::LoadVolumeRaw(rawFilePath, VolumeData::VolumeRegion{0, 7, 0});
+    ASSERT_FALSE(result.has_value());
+    EXPECT_EQ(result.error(), VolumeData::VolumeLoadingError::InvalidRegion);
+}
+
+TEST_F(LoadVolumeRegionTest, LoadsCroppedRows)
+{
+    const auto result = VolumeData::LoadVolumeRaw(rawFilePath, VolumeData::VolumeRegion{2, 1, 1, 5, 4, 3});
+    ASSERT_TRUE(result.has_value());
+
+    EXPECT_EQ(result->GetMetadata().GetWidth(), 5u);
+    EXPECT_EQ(result->GetMetadata().GetHeight(), 4u);
+    EXPECT_EQ(result->GetMetadata().GetDepth(), 3u);
+    EXPECT_TRUE(result->GetSourcePath().empty());
+    ExpectRegion(result.value(), 2, 1, 1, 1);
+}
+
+TEST_F(LoadVolumeRegionTest, LoadsWholeRowsAsContiguousSlices)
+{
+    const auto result = VolumeData::LoadVolumeRaw(rawFilePath, VolumeData::VolumeRegion{0, 2, 3});
+    ASSERT_TRUE(result.has_value());
+
+    EXPECT_EQ(result->GetMetadata().GetHeight(), 5u);
+    EXPECT_EQ(result->GetMetadata().GetDepth(), 2u);
+    ExpectRegion(result.value(), 0, 2, 3, 1);
+}
+
+TEST_F(LoadVolumeRegionTest, LoadsStridedRegion)
+{
+    const auto result = VolumeData::LoadVolumeRaw(rawFilePath, VolumeData::VolumeRegion{1, 0, 0, 0, 0, 0, 3});
+    ASSERT_TRUE(result.has_value());
+
+    EXPECT_EQ(result->GetMetadata().GetWidth(), 3u);
+    EXPECT_EQ(result->GetMetadata().GetHeight(), 3u);
+    EXPECT_EQ(result->GetMetadata().GetDepth(), 2u);
+    ExpectRegion(result.value(), 1, 0, 0, 3);
+}
+
+TEST_F(LoadVolumeRegionTest, BrickedRegionMatchesRawRegion)
+{
+    ASSERT_TRUE(VolumeData::WriteBrickedVolume(volumeData, bricksFilePath, 4));
+
+    const auto region = VolumeData::VolumeRegion{3, 1, 0, 6, 5, 5, 2};
+    const auto rawResult = VolumeData::LoadVolume(rawFilePath, VolumeData::VolumeStorageMode::Mapped, region);
+    const auto brickedResult = VolumeData::LoadVolume(bricksFilePath, VolumeData::VolumeStorageMode::Owning, region);
+    ASSERT_TRUE(rawResult.has_value());
+    ASSERT_TRUE(brickedResult.has_value());
+
+    EXPECT_FALSE(rawResult->IsMapped());
+    EXPECT_EQ(rawResult->GetMetadata().GetWidth(), brickedResult->GetMetadata().GetWidth());
+    EXPECT_TRUE(std::ranges::equal(rawResult->GetData(), brickedResult->GetData()));
+    ExpectRegion(brickedResult.value(), 3, 1, 0, 2);
+}
@@ -0,0 +1,80 @@
+#include <gtest/gtest.h>
+
+#include <context/GlfwWindow.h>
+#include <context/InitGl.h>
+#include <textures/Texture.h>
+#include <textures/TextureId.h>
+#include <textures/TextureType.h>
+#include <volumedata/MakeStreamedVolumeDataTexture.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <glad/glad.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <vector>
+
+class MakeStreamedVolumeDataTextureTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        window = std::make_unique<Context::GlfwWindow>();
+        Context::InitGl();
+
+        rawFilePath = std::filesystem::temp_directory_path() / "MakeStreamedVolumeDataTextureTest.raw";
+        metadata = VolumeData::VolumeMetadata{17, 13, 29, 1, 8};
+
+        fileContents.resize(metadata.GetTotalSizeInBytes());
+        for (size_t i = 0; i < fileContents.size(); ++i)
+        {
+            fileContents[i] = static_cast<uint8_t>((i * 7) % 256);
+        }
+
+        std::ofstream file(rawFilePath, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(fileContents.data()), fileContents.size());
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(rawFilePath);
+    }
+
+    std::unique_ptr<Context::GlfwWindow> window;
+    std::filesystem::path rawFilePath;
+    VolumeData::VolumeMetadata metadata;
+    std::vector<uint8_t> fileContents;
+};
+
+TEST_F(MakeStreamedVolumeDataTextureTest, StreamedTextureMatchesFileContents)
+{
+    auto textureResult = Factory::MakeStreamedVolumeDataTexture(TextureId::VolumeData, GL_TEXTURE1, rawFilePath, metadata);
+    ASSERT_TRUE(textureResult.has_value());
+    EXPECT_EQ(textureResult->GetTextureType(), TextureType::Texture3D);
+
+    std::vector<uint8_t> textureContents(fileContents.size());
+    glPixelStorei(GL_PACK_ALIGNMENT, 1);
+    glBindTexture(GL_TEXTURE_3D, textureResult->GetGlId());
+    glGetTexImage(GL_TEXTURE_3D, 0, GL_RED, GL_UNSIGNED_BYTE, textureContents.data());
+
+    EXPECT_EQ(textureContents, fileContents);
+    EXPECT_EQ(glGetError(), static_cast<GLenum>(GL_NO_ERROR));
+}
+
+TEST_F(MakeStreamedVolumeDataTextureTest, FailsForMissingFile)
+{
+    auto textureResult = Factory::MakeStreamedVolumeDataTexture(TextureId::VolumeData, GL_TEXTURE1, rawFilePath.parent_path() / "MakeStreamedVolumeDataTextureTestMissing.raw", metadata);
+
+    ASSERT_FALSE(textureResult.has_value());
+    EXPECT_EQ(textureResult.error(), VolumeData::VolumeLoadingError::RawFileNotFound);
+}
+
+TEST_F(MakeStreamedVolumeDataTextureTest, FailsOnFileSizeMismatch)
+{
+    auto textureResult = Factory::MakeStreamedVolumeDataTexture(TextureId::VolumeData, GL_TEXTURE1, rawFilePath, VolumeData::VolumeMetadata{17, 13, 30, 1, 8});
+
+    ASSERT_FALSE(textureResult.has_value());
+    EXPECT_EQ(textureResult.error(), VolumeData::VolumeLoadingError::FileSizeMismatch);
+}
@@ -0,0 +1,69 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/MakeVolumeMinMaxGrid.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+
+class MakeVolumeMinMaxGridTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        volumeData = VolumeData::VolumeData{VolumeData::VolumeMetadata{10, 4, 4, 1, 8}};
+    }
+
+    VolumeData::VolumeData volumeData;
+};
+
+TEST_F(MakeVolumeMinMaxGridTest, GridDimensionsAreRoundedUp)
+{
+    const auto grid = VolumeData::MakeVolumeMinMaxGrid(volumeData, 4);
+
+    EXPECT_EQ(grid.brickSize, 4u);
+    EXPECT_EQ(grid.numBricksX, 3u);
+    EXPECT_EQ(grid.numBricksY, 1u);
+    EXPECT_EQ(grid.numBricksZ, 1u);
+    EXPECT_EQ(grid.minValues.size(), 3u);
+    EXPECT_EQ(grid.maxValues.size(), 3u);
+}
+
+TEST_F(MakeVolumeMinMaxGridTest, RangesAreNormalized)
+{
+    volumeData.SetVoxel8(1, 1, 1, 255);
+
+    const auto grid = VolumeData::MakeVolumeMinMaxGrid(volumeData, 4);
+
+    EXPECT_FLOAT_EQ(grid.minValues[0], 0.0f);
+    EXPECT_FLOAT_EQ(grid.maxValues[0], 1.0f);
+    EXPECT_FLOAT_EQ(grid.maxValues[2], 0.0f);
+}
+
+TEST_F(MakeVolumeMinMaxGridTest, RangesIncludeNeighboringVoxels)
+{
+    // First voxel of the second brick, read by trilinear samples in the first brick
+    volumeData.SetVoxel8(4, 0, 0, 51);
+
+    const auto grid = VolumeData::MakeVolumeMinMaxGrid(volumeData, 4);
+
+    EXPECT_FLOAT_EQ(grid.maxValues[0], 0.2f);
+    EXPECT_FLOAT_EQ(grid.maxValues[1], 0.2f);
+    EXPECT_FLOAT_EQ(grid.maxValues[2], 0.0f);
+}
+
+TEST_F(MakeVolumeMinMaxGridTest, NormalizesSixteenBitVolumes)
+{
+    auto volume16 = VolumeData::VolumeData{VolumeData::VolumeMetadata{4, 4, 4, 1, 16}};
+    volume16.SetVoxel16(0, 0, 0, 65535);
+
+    const auto grid = VolumeData::MakeVolumeMinMaxGrid(volume16, 4);
+
+    ASSERT_EQ(grid.GetNumBricks(), 1u);
+    EXPECT_FLOAT_EQ(grid.maxValues[0], 1.0f);
+}
+
+TEST_F(MakeVolumeMinMaxGridTest, InvalidVolumeYieldsEmptyGrid)
+{
+    const auto grid = VolumeData::MakeVolumeMinMaxGrid(VolumeData::VolumeData{}, 4);
+
+    EXPECT_EQ(grid.GetNumBricks(), 0u);
+}
@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/MakeVolumePyramid.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <cstdint>
+
+class MakeVolumePyramidTest : public ::testing::Test
+{
+};
+
+TEST_F(MakeVolumePyramidTest, LevelsMatchTextureMipChain)
+{
+    const auto volumeData = VolumeData::VolumeData{VolumeData::VolumeMetadata{16, 5, 3, 1, 8}};
+
+    const auto levels = VolumeData::MakeVolumePyramid(volumeData);
+
+    // max(1, floor(dimension / 2^level)) for levels 1 to 4
+    const uint32_t expectedDimensions[4][3] = {{8, 2, 1}, {4, 1, 1}, {2, 1, 1}, {1, 1, 1}};
+    ASSERT_EQ(levels.size(), 4u);
+    for (size_t i = 0; i < levels.size(); ++i)
+    {
+        EXPECT_EQ(levels[i].GetMetadata().GetWidth(), expectedDimensions[i][0]);
+        EXPECT_EQ(levels[i].GetMetadata().GetHeight(), expectedDimensions[i][1]);
+        EXPECT_EQ(levels[i].GetMetadata().GetDepth(), expectedDimensions[i][2]);
+    }
+}
+
+TEST_F(MakeVolumePyramidTest, CoarsestLevelHoldsMeanOfUniformVolume)
+{
+    auto volumeData = VolumeData::VolumeData{VolumeData::VolumeMetadata{8, 8, 8, 1, 16}};
+    for (uint32_t z = 0; z < 8; ++z)
+    {
+        for (uint32_t y = 0; y < 8; ++y)
+        {
+            for (uint32_t x = 0; x < 8; ++x)
+            {
+                volumeData.SetVoxel16(x, y, z, 4242);
+            }
+        }
+    }
+
+    const auto levels = VolumeData::MakeVolumePyramid(volumeData);
+
+    ASSERT_FALSE(levels.empty());
+    EXPECT_EQ(levels.back().GetVoxel16(0, 0, 0), 4242);
+}
+
+TEST_F(MakeVolumePyramidTest, InvalidVolumeHasNoLevels)
+{
+    EXPECT_TRUE(VolumeData::MakeVolumePyramid(VolumeData::VolumeData{}).empty());
+}
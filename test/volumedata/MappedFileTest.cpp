@@ -0,0 +1,102 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/MappedFile.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <utility>
+#include <vector>
+
+class MappedFileTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        filePath = std::filesystem::temp_directory_path() / "MappedFileTest.raw";
+
+        fileContents.resize(4096);
+        for (size_t i = 0; i < fileContents.size(); ++i)
+        {
+            fileContents[i] = static_cast<uint8_t>(i % 251);
+        }
+
+        std::ofstream file(filePath, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(fileContents.data()), fileContents.size());
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(filePath);
+    }
+
+    std::filesystem::path filePath;
+    std::vector<uint8_t> fileContents;
+};
+
+TEST_F(MappedFileTest, CanMapExistingFile)
+{
+    VolumeData::MappedFile mappedFile{filePath};
+
+    EXPECT_TRUE(mappedFile.IsMapped());
+    EXPECT_NE(mappedFile.GetDataPtr(), nullptr);
+}
+
+TEST_F(MappedFileTest, MappedSizeMatchesFileSize)
+{
+    VolumeData::MappedFile mappedFile{filePath};
+
+    EXPECT_EQ(mappedFile.GetSizeInBytes(), fileContents.size());
+    EXPECT_EQ(mappedFile.GetData().size(), fileContents.size());
+}
+
+TEST_F(MappedFileTest, MappedContentsMatchFileContents)
+{
+    VolumeData::MappedFile mappedFile{filePath};
+
+    ASSERT_TRUE(mappedFile.IsMapped());
+    EXPECT_TRUE(std::equal(fileContents.begin(), fileContents.end(), mappedFile.GetData().begin()));
+}
+
+TEST_F(MappedFileTest, PrefetchKeepsContentsAndClampsRange)
+{
+    VolumeData::MappedFile mappedFile{filePath, VolumeData::MappedFileAccessPattern::OnDemand};
+    ASSERT_TRUE(mappedFile.IsMapped());
+
+    mappedFile.Prefetch(100, 1000);
+    mappedFile.Prefetch(4000, 1000);
+    mappedFile.Prefetch(8192, 1);
+
+    EXPECT_TRUE(std::equal(fileContents.begin(), fileContents.end(), mappedFile.GetData().begin()));
+}
+
+TEST_F(MappedFileTest, MappingNonExistentFileFails)
+{
+    VolumeData::MappedFile mappedFile{filePath.parent_path() / "MappedFileTestDoesNotExist.raw"};
+
+    EXPECT_FALSE(mappedFile.IsMapped());
+    EXPECT_EQ(mappedFile.GetSizeInBytes(), 0u);
+}
+
+TEST_F(MappedFileTest, MappingEmptyFileFails)
+{
+    const auto emptyFilePath = filePath.parent_path() / "MappedFileTestEmpty.raw";
+    std::ofstream{emptyFilePath, std::ios::binary}.close();
+
+    VolumeData::MappedFile mappedFile{emptyFilePath};
+
+    EXPECT_FALSE(mappedFile.IsMapped());
+    std::filesystem::remove(emptyFilePath);
+}
+
+TEST_F(MappedFileTest, MoveTransfersMapping)
+{
+    VolumeData::MappedFile original{filePath};
+    const uint8_t* dataPtr = original.GetDataPtr();
+
+    VolumeData::MappedFile moved = std::move(original);
+
+    EXPECT_FALSE(original.IsMapped());
+    EXPECT_TRUE(moved.IsMapped());
+    EXPECT_EQ(moved.GetDataPtr(), dataPtr);
+}
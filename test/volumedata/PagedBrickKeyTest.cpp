@@ -0,0 +1,29 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/GetBrickedVolumeLevelPath.h>
+#include <volumedata/PagedBrickKey.h>
+
+#include <filesystem>
+
+TEST(PagedBrickKeyTest, RoundTripsLevelAndBrickIndex)
+{
+    const auto key = VolumeData::PagedBrickKey::Encode(3, 123456);
+
+    EXPECT_EQ(VolumeData::PagedBrickKey::GetLevel(key), 3u);
+    EXPECT_EQ(VolumeData::PagedBrickKey::GetBrickIndex(key), 123456u);
+}
+
+TEST(PagedBrickKeyTest, LargestKeyIsDistinctFromNone)
+{
+    const auto key = VolumeData::PagedBrickKey::Encode(VolumeData::PagedBrickKey::maxNumLevels - 1, VolumeData::PagedBrickKey::maxNumBricksPerLevel - 1);
+
+    EXPECT_NE(key, VolumeData::PagedBrickKey::none);
+}
+
+TEST(PagedBrickKeyTest, NamesLevelFilesAfterLevelZero)
+{
+    const auto levelZeroPath = std::filesystem::path{"datasets"} / "knee.bvol";
+
+    EXPECT_EQ(VolumeData::GetBrickedVolumeLevelPath(levelZeroPath, 0), levelZeroPath);
+    EXPECT_EQ(VolumeData::GetBrickedVolumeLevelPath(levelZeroPath, 2), std::filesystem::path{"datasets"} / "knee_lod2.bvol");
+}
@@ -0,0 +1,53 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/QuantizeVolumeData.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+#include <volumedata/VolumeWindow.h>
+
+class QuantizeVolumeDataTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        volumeData = VolumeData::VolumeData{VolumeData::VolumeMetadata{4, 2, 2, 1, 16}};
+        volumeData.SetVoxel16(0, 0, 0, 0);
+        volumeData.SetVoxel16(1, 0, 0, 16384);
+        volumeData.SetVoxel16(2, 0, 0, 32768);
+        volumeData.SetVoxel16(3, 0, 0, 65535);
+    }
+
+    VolumeData::VolumeData volumeData;
+};
+
+TEST_F(QuantizeVolumeDataTest, FullWindowScalesToEightBits)
+{
+    const auto quantized = VolumeData::QuantizeVolumeData(volumeData, VolumeData::VolumeWindow{});
+
+    ASSERT_TRUE(quantized.IsValid());
+    EXPECT_EQ(quantized.GetMetadata().GetBitsPerComponent(), 8u);
+    EXPECT_EQ(quantized.GetMetadata().GetWidth(), 4u);
+    EXPECT_EQ(quantized.GetVoxel8(0, 0, 0), 0);
+    EXPECT_EQ(quantized.GetVoxel8(1, 0, 0), 64);
+    EXPECT_EQ(quantized.GetVoxel8(2, 0, 0), 128);
+    EXPECT_EQ(quantized.GetVoxel8(3, 0, 0), 255);
+}
+
+TEST_F(QuantizeVolumeDataTest, NarrowWindowClampsOutsideValues)
+{
+    // Covers [0.25, 0.5]
+    const auto quantized = VolumeData::QuantizeVolumeData(volumeData, VolumeData::VolumeWindow{.center = 0.375f, .width = 0.25f});
+
+    EXPECT_EQ(quantized.GetVoxel8(0, 0, 0), 0);
+    EXPECT_EQ(quantized.GetVoxel8(1, 0, 0), 0);
+    EXPECT_EQ(quantized.GetVoxel8(2, 0, 0), 255);
+    EXPECT_EQ(quantized.GetVoxel8(3, 0, 0), 255);
+}
+
+TEST_F(QuantizeVolumeDataTest, RejectsEightBitVolumesAndEmptyWindows)
+{
+    const auto volume8 = VolumeData::VolumeData{VolumeData::VolumeMetadata{2, 2, 2, 1, 8}};
+
+    EXPECT_FALSE(VolumeData::QuantizeVolumeData(volume8, VolumeData::VolumeWindow{}).IsValid());
+    EXPECT_FALSE(VolumeData::QuantizeVolumeData(volumeData, VolumeData::VolumeWindow{.center = 0.5f, .width = 0.0f}).IsValid());
+}
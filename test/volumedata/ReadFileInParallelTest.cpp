@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/FileCachingMode.h>
+#include <volumedata/LoadVolumeRaw.h>
+#include <volumedata/PositionedFileReader.h>
+#include <volumedata/ReadFileInParallel.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+#include <volumedata/VolumeStorageMode.h>
+
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <span>
+#include <vector>
+
+class ReadFileInParallelTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        filePath = std::filesystem::temp_directory_path() / "ReadFileInParallelTest.raw";
+
+        // Spans several chunks and ends in a partial block
+        fileData.resize(1237 * 1031 * 17);
+        for (size_t i = 0; i < fileData.size(); ++i)
+        {
+            fileData[i] = static_cast<uint8_t>((i * 2654435761u) >> 24);
+        }
+
+        std::ofstream file(filePath, std::ios::binary);
+        file.write(reinterpret_cast<const char*>(fileData.data()), static_cast<std::streamsize>(fileData.size()));
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove(filePath);
+    }
+
+    std::filesystem::path filePath;
+    std::vector<uint8_t> fileData;
+};
+
+TEST_F(ReadFileInParallelTest, ReadsWholeFileCached)
+{
+    const auto reader = VolumeData::PositionedFileReader{filePath};
+    ASSERT_TRUE(reader.IsOpen());
+
+    std::vector<uint8_t> data(fileData.size());
+    ASSERT_TRUE(VolumeData::ReadFileInParallel(reader, std::span{data}));
+    EXPECT_EQ(data, fileData);
+}
+
+TEST_F(ReadFileInParallelTest, ReadsWholeFileUncached)
+{
+    // Falls back to cached reads on file systems without direct I/O, which must give the same result
+    const auto reader = VolumeData::PositionedFileReader{filePath, VolumeData::FileCachingMode::Uncached};
+    ASSERT_TRUE(reader.IsOpen());
+
+    std::vector<uint8_t> data(fileData.size());
+    ASSERT_TRUE(VolumeData::ReadFileInParallel(reader, std::span{data}));
+    EXPECT_EQ(data, fileData);
+}
+
+TEST_F(ReadFileInParallelTest, ReadUpToStopsAtEndOfFile)
+{
+    const auto reader = VolumeData::PositionedFileReader{filePath};
+    std::vector<uint8_t> data(4096);
+
+    EXPECT_EQ(reader.ReadUpTo(fileData.size() - 1000, std::span{data}), 1000u);
+    EXPECT_EQ(reader.ReadUpTo(fileData.size(), std::span{data}), 0u);
+    EXPECT_FALSE(reader.Read(fileData.size() - 1000, std::span{data}));
+}
+
+TEST_F(ReadFileInParallelTest, RejectsDestinationLargerThanFile)
+{
+    const auto reader = VolumeData::PositionedFileReader{filePath};
+    std::vector<uint8_t> data(fileData.size() + 1);
+
+    EXPECT_FALSE(VolumeData::ReadFileInParallel(reader, std::span{data}));
+}
+
+TEST_F(ReadFileInParallelTest, UncachedStorageModeLoadsSameVoxels)
+{
+    const auto metadata = VolumeData::VolumeMetadata{1237, 1031, 17, 1, 8};
+    ASSERT_EQ(metadata.GetTotalSizeInBytes(), fileData.size());
+
+    const auto result = VolumeData::LoadVolumeRaw(filePath, metadata, VolumeData::VolumeStorageMode::OwningUncached);
+    ASSERT_TRUE(result.has_value());
+    EXPECT_FALSE(result->IsMapped());
+    EXPECT_TRUE(std::ranges::equal(result->GetData(), fileData));
+}
@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/ComputeVolumeContentHash.h>
+#include <volumedata/ReleaseVolumeHostCopy.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+#include <volumedata/WriteVolumeRaw.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <utility>
+
+class ReleaseVolumeHostCopyTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        spillDirectoryPath = std::filesystem::temp_directory_path() / "ReleaseVolumeHostCopyTest";
+        rawFilePath = std::filesystem::temp_directory_path() / "ReleaseVolumeHostCopyTest.raw";
+        std::filesystem::remove_all(spillDirectoryPath);
+    }
+
+    void TearDown() override
+    {
+        std::filesystem::remove_all(spillDirectoryPath);
+        std::filesystem::remove(rawFilePath);
+    }
+
+    static VolumeData::VolumeData MakeVolumeData()
+    {
+        auto volumeData = VolumeData::VolumeData{VolumeData::VolumeMetadata{6, 5, 4, 1, 16}};
+        for (uint32_t z = 0; z < 4; ++z)
+        {
+            for (uint32_t y = 0; y < 5; ++y)
+            {
+                for (uint32_t x = 0; x < 6; ++x)
+                {
+                    volumeData.SetVoxel16(x, y, z, static_cast<uint16_t>(x + 10 * y + 100 * z));
+                }
+            }
+        }
+        return volumeData;
+    }
+
+    static void ExpectSameVoxels(const VolumeData::VolumeData& released, const VolumeData::VolumeData& original)
+    {
+        ASSERT_EQ(released.GetSizeInBytes(), original.GetSizeInBytes());
+        EXPECT_TRUE(std::ranges::equal(released.GetData(), original.GetData()));
+    }
+
+    std::filesystem::path spillDirectoryPath;
+    std::filesystem::path rawFilePath;
+};
+
+TEST_F(ReleaseVolumeHostCopyTest, MapsSourceFile)
+{
+    auto volumeData = MakeVolumeData();
+    ASSERT_TRUE(VolumeData::WriteVolumeRaw(volumeData, rawFilePath).has_value());
+    volumeData.SetSourcePath(rawFilePath);
+    const auto original = volumeData.Clone();
+
+    const auto released = VolumeData::ReleaseVolumeHostCopy(std::move(volumeData), spillDirectoryPath);
+
+    EXPECT_TRUE(released.IsMapped());
+    EXPECT_EQ(released.GetSourcePath(), rawFilePath);
+    EXPECT_FALSE(std::filesystem::exists(spillDirectoryPath));
+    ExpectSameVoxels(released, original);
+}
+
+TEST_F(ReleaseVolumeHostCopyTest, SpillsVolumeWithoutSourceFile)
+{
+    auto volumeData = MakeVolumeData();
+    const uint64_t contentHash = VolumeData::ComputeVolumeContentHash(volumeData);
+    volumeData.SetContentHash(contentHash);
+    const auto original = volumeData.Clone();
+
+    const auto released = VolumeData::ReleaseVolumeHostCopy(std::move(volumeData), spillDirectoryPath);
+
+    EXPECT_TRUE(released.IsMapped());
+    EXPECT_EQ(released.GetContentHash(), contentHash);
+    EXPECT_EQ(VolumeData::ComputeVolumeContentHash(released), contentHash);
+    EXPECT_EQ(released.GetVoxel16(5, 4, 3), 345);
+    ExpectSameVoxels(released, original);
+}
+
+TEST_F(ReleaseVolumeHostCopyTest, KeepsVolumeWithoutBackingFile)
+{
+    const auto released = VolumeData::ReleaseVolumeHostCopy(MakeVolumeData(), spillDirectoryPath);
+
+    EXPECT_FALSE(released.IsMapped());
+    EXPECT_EQ(released.GetVoxel16(5, 4, 3), 345);
+}
+
+TEST_F(ReleaseVolumeHostCopyTest, MutableAccessMaterializesReleasedVolume)
+{
+    auto volumeData = MakeVolumeData();
+    volumeData.SetContentHash(VolumeData::ComputeVolumeContentHash(volumeData));
+    auto released = VolumeData::ReleaseVolumeHostCopy(std::move(volumeData), spillDirectoryPath);
+    ASSERT_TRUE(released.IsMapped());
+
+    EXPECT_TRUE(released.SetVoxel16(0, 0, 0, 7));
+    EXPECT_FALSE(released.IsMapped());
+    EXPECT_EQ(released.GetVoxel16(0, 0, 0), 7);
+    EXPECT_EQ(released.GetVoxel16(1, 0, 0), 1);
+}
@@ -0,0 +1,188 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/ComputeVolumeContentHash.h>
+#include <volumedata/ComputeVolumeHistogram.h>
+#include <volumedata/ConvertVolumeDataToSparse.h>
+#include <volumedata/DownsampleVolumeData.h>
+#include <volumedata/LoadVolumeRaw.h>
+#include <volumedata/MakeDenseVolumeData.h>
+#include <volumedata/MakeSparseVolumeData.h>
+#include <volumedata/MakeVolumeMinMaxGrid.h>
+#include <volumedata/SparseVolumeData.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+#include <volumedata/VolumeStorageMode.h>
+#include <volumedata/WriteVolumeRaw.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <utility>
+#include <vector>
+
+class SparseVolumeDataTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        // 10x9x7 voxels in 4^3 bricks: 3x3x2 bricks, clipped at the upper boundaries.
+        // A structure fills x, y in [4, 8) and z in [0, 4), the rest is background.
+        volumeData = VolumeData::VolumeData{VolumeData::VolumeMetadata{10, 9, 7, 1, 16}};
+        for (uint32_t z = 0; z < 4; ++z)
+        {
+            for (uint32_t y = 4; y < 8; ++y)
+            {
+                for (uint32_t x = 4; x < 8; ++x)
+                {
+                    volumeData.SetVoxel16(x, y, z, static_cast<uint16_t>(1000 + x + 10 * y + 100 * z));
+                }
+            }
+        }
+        volumeData.SetVoxel16(9, 8, 6, 7);
+    }
+
+    VolumeData::VolumeData volumeData;
+};
+
+TEST_F(SparseVolumeDataTest, StoresOnlyNonUniformBricks)
+{
+    const auto sparseVolumeData = VolumeData::MakeSparseVolumeData(volumeData, 4);
+    ASSERT_TRUE(sparseVolumeData.IsValid());
+
+    EXPECT_EQ(sparseVolumeData.GetNumBricks(), 18u);
+    EXPECT_EQ(sparseVolumeData.GetNumUniformBricks(), 16u);
+    EXPECT_TRUE(sparseVolumeData.GetBrick(0).isUniform);
+    EXPECT_FALSE(sparseVolumeData.GetBrick(4).isUniform);
+    EXPECT_EQ(sparseVolumeData.GetBrickData(4).size(), 4u * 4u * 4u * sizeof(uint16_t));
+    EXPECT_TRUE(sparseVolumeData.GetBrickData(0).empty());
+    EXPECT_LT(sparseVolumeData.GetSizeInBytes(), volumeData.GetSizeInBytes());
+
+    // The last brick is clipped to 2x1x3 voxels
+    const auto lastBrickExtent = sparseVolumeData.GetBrickExtent(17);
+    EXPECT_EQ(lastBrickExtent.x, 8u);
+    EXPECT_EQ(lastBrickExtent.width, 2u);
+    EXPECT_EQ(lastBrickExtent.height, 1u);
+    EXPECT_EQ(lastBrickExtent.depth, 3u);
+    EXPECT_EQ(sparseVolumeData.GetBrickData(17).size(), 6u * sizeof(uint16_t));
+}
+
+TEST_F(SparseVolumeDataTest, RoundTripsThroughDenseForm)
+{
+    const auto sparseVolumeData = VolumeData::MakeSparseVolumeData(volumeData, 4);
+    const auto denseVolumeData = VolumeData::MakeDenseVolumeData(sparseVolumeData);
+
+    ASSERT_TRUE(denseVolumeData.IsValid());
+    EXPECT_EQ(denseVolumeData.GetMetadata().GetWidth(), 10u);
+    EXPECT_TRUE(std::ranges::equal(denseVolumeData.GetData(), volumeData.GetData()));
+}
+
+TEST_F(SparseVolumeDataTest, AccessorsMatchDenseVolume)
+{
+    const auto sparseVolumeData = VolumeData::MakeSparseVolumeData(volumeData, 4);
+    std::vector<uint16_t> row(10);
+    const auto rowBytes = std::span<uint8_t>{reinterpret_cast<uint8_t*>(row.data()), row.size() * sizeof(uint16_t)};
+
+    for (uint32_t z = 0; z < 7; ++z)
+    {
+        for (uint32_t y = 0; y < 9; ++y)
+        {
+            ASSERT_TRUE(sparseVolumeData.CopyRow(y, z, rowBytes));
+            for (uint32_t x = 0; x < 10; ++x)
+            {
+                EXPECT_EQ(sparseVolumeData.GetVoxel16(x, y, z), volumeData.GetVoxel16(x, y, z));
+                EXPECT_EQ(row[x], volumeData.GetVoxel16(x, y, z));
+            }
+        }
+    }
+
+    EXPECT_EQ(sparseVolumeData.GetVoxel16(10, 0, 0), 0);
+    EXPECT_EQ(sparseVolumeData.GetVoxel8(5, 5, 0), 0);
+    EXPECT_FALSE(sparseVolumeData.CopyRow(9, 0, rowBytes));
+}
+
+TEST_F(SparseVolumeDataTest, UniformBricksKeepAllComponents)
+{
+    auto rgVolumeData = VolumeData::VolumeData{VolumeData::VolumeMetadata{6, 3, 3, 2, 8}};
+    auto& data = rgVolumeData.GetData();
+    for (size_t i = 0; i < data.size(); i += 2)
+    {
+        data[i] = 11;
+        data[i + 1] = 22;
+    }
+    data[data.size() - 1] = 33;
+
+    const auto sparseVolumeData = VolumeData::MakeSparseVolumeData(rgVolumeData, 3);
+    EXPECT_EQ(sparseVolumeData.GetNumUniformBricks(), 1u);
+
+    const auto denseVolumeData = VolumeData::MakeDenseVolumeData(sparseVolumeData);
+    EXPECT_TRUE(std::ranges::equal(denseVolumeData.GetData(), rgVolumeData.GetData()));
+}
+
+TEST_F(SparseVolumeDataTest, RejectsInvalidInput)
+{
+    EXPECT_FALSE(VolumeData::MakeSparseVolumeData(volumeData, 0).IsValid());
+    EXPECT_FALSE(VolumeData::MakeSparseVolumeData(VolumeData::VolumeData{}).IsValid());
+    EXPECT_FALSE(VolumeData::MakeDenseVolumeData(VolumeData::SparseVolumeData{}).IsValid());
+}
+
+TEST_F(SparseVolumeDataTest, SparseBackedVolumeActsAsDenseView)
+{
+    auto sparseBackedVolumeData = VolumeData::ConvertVolumeDataToSparse(volumeData.Clone(), 4);
+    ASSERT_TRUE(sparseBackedVolumeData.IsSparse());
+    ASSERT_TRUE(sparseBackedVolumeData.IsValid());
+    EXPECT_EQ(sparseBackedVolumeData.GetSparseData()->GetNumUniformBricks(), 16u);
+    EXPECT_EQ(sparseBackedVolumeData.GetSizeInBytes(), volumeData.GetSizeInBytes());
+    EXPECT_EQ(sparseBackedVolumeData.GetVoxel16(5, 6, 2), volumeData.GetVoxel16(5, 6, 2));
+    EXPECT_EQ(sparseBackedVolumeData.GetVoxel16(9, 8, 6), 7);
+
+    std::vector<uint8_t> slices(3 * 10 * 9 * sizeof(uint16_t));
+    ASSERT_TRUE(sparseBackedVolumeData.CopySlices(2, 3, std::span{slices}));
+    EXPECT_TRUE(std::ranges::equal(slices, std::as_const(volumeData).GetData().subspan(2 * 10 * 9 * sizeof(uint16_t), slices.size())));
+    EXPECT_FALSE(sparseBackedVolumeData.CopySlices(5, 3, std::span{slices}));
+
+    // Clones share the sparse volume and its dense view
+    const auto clone = sparseBackedVolumeData.Clone();
+    EXPECT_EQ(clone.GetSparseData(), sparseBackedVolumeData.GetSparseData());
+    EXPECT_TRUE(std::ranges::equal(std::as_const(sparseBackedVolumeData).GetData(), volumeData.GetData()));
+    EXPECT_EQ(clone.GetDataPtr(), std::as_const(sparseBackedVolumeData).GetDataPtr());
+
+    sparseBackedVolumeData.Materialize();
+    EXPECT_FALSE(sparseBackedVolumeData.IsSparse());
+    EXPECT_TRUE(std::ranges::equal(std::as_const(sparseBackedVolumeData).GetData(), volumeData.GetData()));
+    EXPECT_TRUE(std::ranges::equal(clone.GetData(), volumeData.GetData()));
+}
+
+TEST_F(SparseVolumeDataTest, ConsumersReadSparseVolumesLikeDenseOnes)
+{
+    const auto sparseBackedVolumeData = VolumeData::ConvertVolumeDataToSparse(volumeData.Clone(), 4);
+    ASSERT_TRUE(sparseBackedVolumeData.IsSparse());
+
+    const auto histogram = VolumeData::ComputeVolumeHistogram(sparseBackedVolumeData, 256);
+    EXPECT_EQ(histogram.counts, VolumeData::ComputeVolumeHistogram(volumeData, 256).counts);
+
+    const auto minMaxGrid = VolumeData::MakeVolumeMinMaxGrid(sparseBackedVolumeData, 3);
+    const auto denseMinMaxGrid = VolumeData::MakeVolumeMinMaxGrid(volumeData, 3);
+    EXPECT_EQ(minMaxGrid.minValues, denseMinMaxGrid.minValues);
+    EXPECT_EQ(minMaxGrid.maxValues, denseMinMaxGrid.maxValues);
+
+    EXPECT_EQ(VolumeData::ComputeVolumeContentHash(sparseBackedVolumeData), VolumeData::ComputeVolumeContentHash(volumeData));
+
+    const auto downsampledVolumeData = VolumeData::DownsampleVolumeData(sparseBackedVolumeData);
+    EXPECT_TRUE(std::ranges::equal(downsampledVolumeData.GetData(), VolumeData::DownsampleVolumeData(volumeData).GetData()));
+}
+
+TEST_F(SparseVolumeDataTest, SparseStorageModeLoadsSparseVolume)
+{
+    const auto rawFilePath = std::filesystem::temp_directory_path() / "SparseVolumeDataTest.raw";
+    ASSERT_TRUE(VolumeData::WriteVolumeRaw(volumeData, rawFilePath).has_value());
+
+    const auto result = VolumeData::LoadVolumeRaw(rawFilePath, volumeData.GetMetadata(), VolumeData::VolumeStorageMode::Sparse);
+    std::filesystem::remove(rawFilePath);
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_TRUE(result->IsSparse());
+    EXPECT_FALSE(result->IsMapped());
+    EXPECT_EQ(result->GetSourcePath(), rawFilePath);
+    EXPECT_TRUE(std::ranges::equal(result->GetData(), volumeData.GetData()));
+}
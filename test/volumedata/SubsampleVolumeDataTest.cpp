@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/SubsampleVolumeData.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+
+class SubsampleVolumeDataTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        volumeData = VolumeData::VolumeData{VolumeData::VolumeMetadata{9, 8, 7, 1, 8}};
+
+        for (uint32_t z = 0; z < 7; ++z)
+        {
+            for (uint32_t y = 0; y < 8; ++y)
+            {
+                for (uint32_t x = 0; x < 9; ++x)
+                {
+                    volumeData.SetVoxel8(x, y, z, static_cast<uint8_t>(x + 10 * y + 100 * (z % 2)));
+                }
+            }
+        }
+    }
+
+    VolumeData::VolumeData volumeData;
+};
+
+TEST_F(SubsampleVolumeDataTest, DimensionsAreRoundedUp)
+{
+    const auto subsampled = VolumeData::SubsampleVolumeData(volumeData, 2);
+
+    EXPECT_EQ(subsampled.GetMetadata().GetWidth(), 5u);
+    EXPECT_EQ(subsampled.GetMetadata().GetHeight(), 4u);
+    EXPECT_EQ(subsampled.GetMetadata().GetDepth(), 4u);
+    EXPECT_TRUE(subsampled.IsValid());
+}
+
+TEST_F(SubsampleVolumeDataTest, ScaleIsMultipliedByStride)
+{
+    const auto subsampled = VolumeData::SubsampleVolumeData(volumeData, 4);
+
+    EXPECT_FLOAT_EQ(subsampled.GetMetadata().GetScaleX(), 4.0f * volumeData.GetMetadata().GetScaleX());
+    EXPECT_FLOAT_EQ(subsampled.GetMetadata().GetScaleY(), 4.0f * volumeData.GetMetadata().GetScaleY());
+    EXPECT_FLOAT_EQ(subsampled.GetMetadata().GetScaleZ(), 4.0f * volumeData.GetMetadata().GetScaleZ());
+}
+
+TEST_F(SubsampleVolumeDataTest, SamplesEveryStrideThVoxel)
+{
+    const auto subsampled = VolumeData::SubsampleVolumeData(volumeData, 2);
+
+    EXPECT_EQ(subsampled.GetVoxel8(0, 0, 0), volumeData.GetVoxel8(0, 0, 0));
+    EXPECT_EQ(subsampled.GetVoxel8(1, 2, 1), volumeData.GetVoxel8(2, 4, 2));
+    EXPECT_EQ(subsampled.GetVoxel8(4, 3, 3), volumeData.GetVoxel8(8, 6, 6));
+}
+
+TEST_F(SubsampleVolumeDataTest, StrideOneCopiesVolume)
+{
+    const auto subsampled = VolumeData::SubsampleVolumeData(volumeData, 1);
+
+    EXPECT_TRUE(std::ranges::equal(subsampled.GetData(), volumeData.GetData()));
+}
+
+TEST_F(SubsampleVolumeDataTest, Subsamples16BitMultiComponentVolumes)
+{
+    auto source = VolumeData::VolumeData{VolumeData::VolumeMetadata{4, 4, 4, 2, 16}};
+    auto& data = source.GetData();
+    for (size_t i = 0; i < data.size(); ++i)
+    {
+        data[i] = static_cast<uint8_t>(i);
+    }
+
+    const auto subsampled = VolumeData::SubsampleVolumeData(source, 2);
+    const auto subsampledData = subsampled.GetData();
+
+    // Voxel (1, 1, 1) of the result is voxel (2, 2, 2) of the source, 4 bytes per voxel
+    const size_t sourceOffset = ((2 * 4 + 2) * 4 + 2) * 4;
+    const size_t offset = ((1 * 2 + 1) * 2 + 1) * 4;
+    for (size_t i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(subsampledData[offset + i], data[sourceOffset + i]);
+    }
+}
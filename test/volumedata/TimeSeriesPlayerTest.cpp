@@ -0,0 +1,204 @@
+#include <gtest/gtest.h>
+
+#include <context/InitGl.h>
+#include <context/GlfwWindow.h>
+#include <gui/GuiUpdateFlags.h>
+#include <textures/Texture.h>
+#include <textures/TextureId.h>
+#include <volumedata/TimeSeriesPlaybackState.h>
+#include <volumedata/TimeSeriesPlayer.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeHandle.h>
+#include <volumedata/VolumeLoadingProgress.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <glad/glad.h>
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace Constants
+{
+    constexpr uint32_t width = 4;
+    constexpr uint32_t height = 3;
+    constexpr uint32_t depth = 2;
+    constexpr size_t numVoxels = width * height * depth;
+    constexpr size_t numSteps = 3;
+}
+
+class TimeSeriesPlayerTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        window = std::make_unique<Context::GlfwWindow>();
+        Context::InitGl();
+
+        directoryPath = std::filesystem::temp_directory_path() / "TimeSeriesPlayerTest";
+        std::filesystem::remove_all(directoryPath);
+        std::filesystem::create_directories(directoryPath);
+
+        for (size_t step = 0; step < Constants::numSteps; ++step)
+        {
+            const auto stepPath = directoryPath / ("step_" + std::to_string(step) + ".raw");
+            const auto voxels = GetStepVoxels(step);
+            std::ofstream{stepPath, std::ios::binary}.write(reinterpret_cast<const char*>(voxels.data()), static_cast<std::streamsize>(voxels.size()));
+
+            auto iniFilePath = stepPath;
+            iniFilePath.replace_extension(".ini");
+            std::ofstream{iniFilePath} << "[Volume]\nWidth=4\nHeight=3\nDepth=2\nComponents=1\nBitsPerComponent=8\nScaleX=1\nScaleY=1\nScaleZ=1\n";
+
+            stepPaths.push_back(stepPath);
+        }
+
+        // The initial volume of the loader, which differs in size from the steps
+        const std::array<uint8_t, 1> initialVoxel{255};
+        volumeDataTexture = std::make_unique<Texture>(TextureId::VolumeData, GL_TEXTURE1, 1, 1, 1, GL_R8, GL_RED, GL_UNSIGNED_BYTE, GL_LINEAR, GL_CLAMP_TO_EDGE, initialVoxel.data());
+        volumeData = VolumeData::VolumeHandle{VolumeData::VolumeData{VolumeData::VolumeMetadata{1, 1, 1, 1, 8}}};
+    }
+
+    void TearDown() override
+    {
+        volumeDataTexture.reset();
+        window.reset();
+        std::filesystem::remove_all(directoryPath);
+    }
+
+    static std::vector<uint8_t> GetStepVoxels(size_t step)
+    {
+        std::vector<uint8_t> voxels(Constants::numVoxels);
+        for (size_t i = 0; i < voxels.size(); ++i)
+        {
+            voxels[i] = static_cast<uint8_t>(100 * step + i);
+        }
+        return voxels;
+    }
+
+    std::unique_ptr<VolumeData::TimeSeriesPlayer> MakePlayer()
+    {
+        return std::make_unique<VolumeData::TimeSeriesPlayer>(stepPaths, guiUpdateFlags, volumeData, *volumeDataTexture, volumeLoadingProgress, timeSeriesPlaybackState);
+    }
+
+    /// Updates the player like the main loop, until it presents a timestep or the timeout expires
+    bool UpdateUntilTimeStepChanged(VolumeData::TimeSeriesPlayer& player)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+        while (std::chrono::steady_clock::now() < deadline)
+        {
+            guiUpdateFlags.volumeDataChanged = false; // Cleared by the ProgressiveVolumeLoader in the application
+            player.Update();
+            if (guiUpdateFlags.timeStepChanged)
+            {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds{1});
+        }
+        return false;
+    }
+
+    std::vector<uint8_t> ReadVolumeDataTexture() const
+    {
+        std::vector<uint8_t> voxels(Constants::numVoxels);
+        volumeDataTexture->Bind();
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glGetTexImage(GL_TEXTURE_3D, 0, GL_RED, GL_UNSIGNED_BYTE, voxels.data());
+        glPixelStorei(GL_PACK_ALIGNMENT, 4);
+        return voxels;
+    }
+
+    std::vector<uint8_t> GetVolumeDataVoxels() const
+    {
+        const auto data = volumeData->GetData();
+        return std::vector<uint8_t>{data.begin(), data.end()};
+    }
+
+    std::unique_ptr<Context::GlfwWindow> window;
+    std::filesystem::path directoryPath;
+    std::vector<std::filesystem::path> stepPaths;
+    GuiUpdateFlags guiUpdateFlags;
+    VolumeData::VolumeHandle volumeData;
+    std::unique_ptr<Texture> volumeDataTexture;
+    VolumeData::VolumeLoadingProgress volumeLoadingProgress;
+    VolumeData::TimeSeriesPlaybackState timeSeriesPlaybackState;
+};
+
+TEST_F(TimeSeriesPlayerTest, HandsOffFirstStepToStorage)
+{
+    const auto player = MakePlayer();
+    ASSERT_TRUE(UpdateUntilTimeStepChanged(*player));
+
+    EXPECT_EQ(timeSeriesPlaybackState.numSteps, Constants::numSteps);
+    EXPECT_EQ(timeSeriesPlaybackState.displayedStep, 0u);
+    EXPECT_FALSE(timeSeriesPlaybackState.error.has_value());
+    EXPECT_EQ(GetVolumeDataVoxels(), GetStepVoxels(0));
+    EXPECT_EQ(ReadVolumeDataTexture(), GetStepVoxels(0));
+    EXPECT_EQ(glGetError(), static_cast<GLenum>(GL_NO_ERROR));
+}
+
+TEST_F(TimeSeriesPlayerTest, PlayingStepDoesNotSignalVolumeDataChange)
+{
+    timeSeriesPlaybackState.isPlaying = true;
+    const auto player = MakePlayer();
+    ASSERT_TRUE(UpdateUntilTimeStepChanged(*player));
+    EXPECT_FALSE(guiUpdateFlags.volumeDataChanged);
+
+    // The next step is not due yet, and the flag only lasts for the frame in which the step was presented
+    guiUpdateFlags.volumeDataChanged = false;
+    player->Update();
+    EXPECT_FALSE(guiUpdateFlags.timeStepChanged);
+    EXPECT_FALSE(guiUpdateFlags.volumeDataChanged);
+}
+
+TEST_F(TimeSeriesPlayerTest, PausedStepSignalsVolumeDataChange)
+{
+    timeSeriesPlaybackState.isPlaying = false;
+    const auto player = MakePlayer();
+    ASSERT_TRUE(UpdateUntilTimeStepChanged(*player));
+    EXPECT_TRUE(guiUpdateFlags.volumeDataChanged);
+
+    guiUpdateFlags.volumeDataChanged = false;
+    player->Update();
+    EXPECT_FALSE(guiUpdateFlags.timeStepChanged);
+    EXPECT_FALSE(guiUpdateFlags.volumeDataChanged);
+}
+
+TEST_F(TimeSeriesPlayerTest, PausingSignalsVolumeDataChangeOnce)
+{
+    timeSeriesPlaybackState.isPlaying = true;
+    const auto player = MakePlayer();
+    ASSERT_TRUE(UpdateUntilTimeStepChanged(*player));
+    ASSERT_FALSE(guiUpdateFlags.volumeDataChanged);
+
+    timeSeriesPlaybackState.isPlaying = false;
+    guiUpdateFlags.volumeDataChanged = false;
+    player->Update();
+    EXPECT_TRUE(guiUpdateFlags.volumeDataChanged);
+
+    guiUpdateFlags.volumeDataChanged = false;
+    player->Update();
+    EXPECT_FALSE(guiUpdateFlags.volumeDataChanged);
+    EXPECT_EQ(timeSeriesPlaybackState.displayedStep, 0u);
+    EXPECT_EQ(GetVolumeDataVoxels(), GetStepVoxels(0));
+}
+
+TEST_F(TimeSeriesPlayerTest, WaitsForInitialVolume)
+{
+    volumeLoadingProgress.isLoading = true;
+    const auto player = MakePlayer();
+
+    for (int frame = 0; frame < 10; ++frame)
+    {
+        player->Update();
+        std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+
+    EXPECT_FALSE(guiUpdateFlags.timeStepChanged);
+    EXPECT_EQ(volumeData->GetMetadata().GetWidth(), 1u);
+}
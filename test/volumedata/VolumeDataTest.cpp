@@ -1,8 +1,15 @@
 #include <gtest/gtest.h>
 
+#include <volumedata/MappedFile.h>
 #include <volumedata/VolumeData.h>
 #include <volumedata/VolumeMetadata.h>
 
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
 class VolumeDataTest : public ::testing::Test
 {
 protected:
@@ -275,15 +282,20 @@ TEST_F(VolumeDataTest, VoxelIndexingCoversFullVolume8Bit)
     }
 }
 
-TEST_F(VolumeDataTest, CanCopyVolumeData)
+TEST_F(VolumeDataTest, CanCloneVolumeData)
 {
+    static_assert(!std::is_copy_constructible_v<VolumeData::VolumeData>);
+    static_assert(!std::is_copy_assignable_v<VolumeData::VolumeData>);
+
     VolumeData::VolumeMetadata metadata{10, 10, 10, 1, 8};
     VolumeData::VolumeData original{metadata};
     original.SetVoxel8(5, 5, 5, 128);
 
-    VolumeData::VolumeData copy = original;
+    VolumeData::VolumeData copy = original.Clone();
+    copy.SetVoxel8(5, 5, 5, 64);
 
-    EXPECT_EQ(copy.GetVoxel8(5, 5, 5), 128u);
+    EXPECT_EQ(copy.GetVoxel8(5, 5, 5), 64u);
+    EXPECT_EQ(original.GetVoxel8(5, 5, 5), 128u);
     EXPECT_TRUE(copy.IsValid());
 }
 
@@ -298,3 +310,44 @@ TEST_F(VolumeDataTest, CanMoveVolumeData)
     EXPECT_EQ(moved.GetVoxel8(5, 5, 5), 128u);
     EXPECT_TRUE(moved.IsValid());
 }
+
+TEST_F(VolumeDataTest, MappedVolumeDataReadsFromMapping)
+{
+    const auto filePath = std::filesystem::temp_directory_path() / "VolumeDataTestMapped.raw";
+    std::vector<uint8_t> contents(1000, 0);
+    contents[5 * 100 + 5 * 10 + 5] = 128;
+    std::ofstream(filePath, std::ios::binary).write(reinterpret_cast<const char*>(contents.data()), contents.size());
+
+    VolumeData::VolumeMetadata metadata{10, 10, 10, 1, 8};
+    VolumeData::VolumeData volume{metadata, std::make_shared<const VolumeData::MappedFile>(filePath)};
+
+    EXPECT_TRUE(volume.IsMapped());
+    EXPECT_TRUE(volume.IsValid());
+    EXPECT_EQ(volume.GetSizeInBytes(), 1000u);
+    EXPECT_EQ(volume.GetVoxel8(5, 5, 5), 128u);
+
+    volume.Clear();
+    std::filesystem::remove(filePath);
+}
+
+TEST_F(VolumeDataTest, SetVoxelOnMappedVolumeDataMaterializesCopy)
+{
+    const auto filePath = std::filesystem::temp_directory_path() / "VolumeDataTestMaterialize.raw";
+    std::vector<uint8_t> contents(1000, 7);
+    std::ofstream(filePath, std::ios::binary).write(reinterpret_cast<const char*>(contents.data()), contents.size());
+
+    VolumeData::VolumeMetadata metadata{10, 10, 10, 1, 8};
+    auto mappedFile = std::make_shared<const VolumeData::MappedFile>(filePath);
+    VolumeData::VolumeData volume{metadata, mappedFile};
+
+    EXPECT_TRUE(volume.SetVoxel8(5, 5, 5, 128));
+
+    EXPECT_FALSE(volume.IsMapped());
+    EXPECT_TRUE(volume.IsValid());
+    EXPECT_EQ(volume.GetVoxel8(5, 5, 5), 128u);
+    EXPECT_EQ(volume.GetVoxel8(0, 0, 0), 7u);
+    EXPECT_EQ(mappedFile->GetData()[5 * 100 + 5 * 10 + 5], 7u);
+
+    mappedFile.reset();
+    std::filesystem::remove(filePath);
+}
@@ -0,0 +1,57 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeHandle.h>
+#include <volumedata/VolumeMetadata.h>
+
+#include <utility>
+
+class VolumeHandleTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        auto volumeData = VolumeData::VolumeData{VolumeData::VolumeMetadata{4, 3, 2, 1, 16}};
+        volumeData.SetVoxel16(1, 2, 1, 4242);
+        volumeHandle = VolumeData::VolumeHandle{std::move(volumeData)};
+    }
+
+    VolumeData::VolumeHandle volumeHandle;
+};
+
+TEST_F(VolumeHandleTest, DefaultHandleRefersToInvalidVolume)
+{
+    const auto emptyHandle = VolumeData::VolumeHandle{};
+
+    EXPECT_FALSE(emptyHandle->IsValid());
+    EXPECT_EQ(emptyHandle.GetUseCount(), 1);
+}
+
+TEST_F(VolumeHandleTest, CopiesShareVolume)
+{
+    const auto copiedHandle = volumeHandle;
+
+    EXPECT_EQ(&copiedHandle.Get(), &volumeHandle.Get());
+    EXPECT_EQ(copiedHandle->GetDataPtr(), volumeHandle->GetDataPtr());
+    EXPECT_EQ(volumeHandle.GetUseCount(), 2);
+}
+
+TEST_F(VolumeHandleTest, ReplacedVolumeStaysAliveForOtherHolders)
+{
+    const auto previousHandle = volumeHandle;
+    volumeHandle = VolumeData::VolumeHandle{VolumeData::VolumeData{VolumeData::VolumeMetadata{2, 2, 2, 1, 8}}};
+
+    EXPECT_EQ(previousHandle->GetVoxel16(1, 2, 1), 4242);
+    EXPECT_EQ(previousHandle.GetUseCount(), 1);
+    EXPECT_EQ(volumeHandle->GetMetadata().GetBitsPerComponent(), 8u);
+}
+
+TEST_F(VolumeHandleTest, CloneIsIndependentOfSharedVolume)
+{
+    auto editableVolumeData = volumeHandle.Clone();
+    editableVolumeData.SetVoxel16(1, 2, 1, 7);
+
+    EXPECT_NE(editableVolumeData.GetDataPtr(), volumeHandle->GetDataPtr());
+    EXPECT_EQ(editableVolumeData.GetVoxel16(1, 2, 1), 7);
+    EXPECT_EQ(volumeHandle->GetVoxel16(1, 2, 1), 4242);
+}
@@ -0,0 +1,135 @@
+#include <gtest/gtest.h>
+
+#include <volumedata/BrickExtent.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/VolumeMetadata.h>
+#include <volumedata/VolumeView.h>
+
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+class VolumeViewTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        volumeData = VolumeData::VolumeData{VolumeData::VolumeMetadata{4, 3, 2, 1, 16}};
+
+        for (uint32_t z = 0; z < 2; ++z)
+        {
+            for (uint32_t y = 0; y < 3; ++y)
+            {
+                for (uint32_t x = 0; x < 4; ++x)
+                {
+                    volumeData.SetVoxel16(x, y, z, static_cast<uint16_t>(100 * z + 10 * y + x));
+                }
+            }
+        }
+    }
+
+    VolumeData::VolumeData volumeData;
+};
+
+TEST_F(VolumeViewTest, MatchesCheckedAccessors)
+{
+    const auto view = VolumeData::MakeVolumeView<uint16_t>(std::as_const(volumeData));
+    ASSERT_TRUE(view.has_value());
+
+    for (uint32_t z = 0; z < 2; ++z)
+    {
+        for (uint32_t y = 0; y < 3; ++y)
+        {
+            for (uint32_t x = 0; x < 4; ++x)
+            {
+                EXPECT_EQ(view->At(x, y, z), volumeData.GetVoxel16(x, y, z));
+            }
+        }
+    }
+}
+
+TEST_F(VolumeViewTest, RejectsMismatchingFormat)
+{
+    EXPECT_FALSE(VolumeData::MakeVolumeView<uint8_t>(std::as_const(volumeData)).has_value());
+    EXPECT_FALSE((VolumeData::MakeVolumeView<uint16_t, 2>(std::as_const(volumeData)).has_value()));
+    EXPECT_FALSE(VolumeData::MakeVolumeView<uint16_t>(VolumeData::VolumeData{}).has_value());
+}
+
+TEST_F(VolumeViewTest, RowsAreContiguousInMemoryOrder)
+{
+    const auto view = VolumeData::MakeVolumeView<uint16_t>(std::as_const(volumeData)).value();
+
+    std::vector<uint16_t> values;
+    for (const auto row : view.GetRows())
+    {
+        EXPECT_EQ(row.size(), 4u);
+        values.insert(values.end(), row.begin(), row.end());
+    }
+
+    const auto voxels = view.GetVoxels();
+    ASSERT_EQ(values.size(), voxels.size());
+    EXPECT_TRUE(std::equal(values.begin(), values.end(), voxels.begin()));
+    EXPECT_EQ(view.GetRow(2, 1)[3], 123);
+}
+
+TEST_F(VolumeViewTest, BrickSharesStridesOfVolume)
+{
+    const auto view = VolumeData::MakeVolumeView<uint16_t>(std::as_const(volumeData)).value();
+    const auto brick = view.GetBrick(VolumeData::BrickExtent{1, 1, 1, 2, 2, 1});
+
+    EXPECT_FALSE(brick.IsContiguous());
+    EXPECT_TRUE(brick.GetVoxels().empty());
+    EXPECT_EQ(brick.At(0, 0, 0), 111);
+    EXPECT_EQ(brick.At(1, 1, 0), 122);
+
+    uint32_t sum = 0;
+    for (const auto row : brick.GetRows())
+    {
+        sum = std::accumulate(row.begin(), row.end(), sum);
+    }
+    EXPECT_EQ(sum, 111u + 112u + 121u + 122u);
+
+    EXPECT_TRUE(view.GetSlice(1).IsContiguous());
+    EXPECT_EQ(view.GetSlice(1).At(3, 2, 0), 123);
+}
+
+TEST_F(VolumeViewTest, NeighborhoodIsClampedAtBoundary)
+{
+    const auto view = VolumeData::MakeVolumeView<uint16_t>(std::as_const(volumeData)).value();
+    const auto neighborhood = view.GetRowNeighborhood(0, 1);
+
+    EXPECT_EQ(neighborhood.row[2], 102);
+    EXPECT_EQ(neighborhood.previousRow[2], 102);
+    EXPECT_EQ(neighborhood.nextRow[2], 112);
+    EXPECT_EQ(neighborhood.previousSlice[2], 2);
+    EXPECT_EQ(neighborhood.nextSlice[2], 102);
+
+    EXPECT_EQ(view.GetClamped(-1, -1, 5), 100);
+    EXPECT_EQ(view.GetClamped(7, 1, 0), 13);
+}
+
+TEST_F(VolumeViewTest, WritableViewWritesThroughToVolume)
+{
+    auto view = VolumeData::MakeVolumeView<uint16_t>(volumeData).value();
+    view.At(3, 2, 1) = 4242;
+
+    EXPECT_EQ(volumeData.GetVoxel16(3, 2, 1), 4242);
+}
+
+TEST_F(VolumeViewTest, VisitDispatchesOnFormat)
+{
+    auto rgVolume = VolumeData::VolumeData{VolumeData::VolumeMetadata{2, 2, 2, 2, 8}};
+    uint32_t numComponents = 0;
+    size_t rowLength = 0;
+
+    EXPECT_TRUE(VolumeData::VisitVolumeView(rgVolume, [&](const auto& view)
+    {
+        numComponents = view.numComponents;
+        rowLength = view.GetRowLength();
+    }));
+    EXPECT_EQ(numComponents, 2u);
+    EXPECT_EQ(rowLength, 4u);
+
+    EXPECT_FALSE(VolumeData::VisitVolumeView(VolumeData::VolumeData{}, [](const auto&) {}));
+}
@@ -0,0 +1,173 @@
+/**
+* \file VolumeBrickConverter.cpp
+*
+* \brief Command-line tool converting .raw volumes into bricked volume files.
+*
+* Usage: VolumeBrickConverter <input.raw> [output.bvol] [brickSize] [none|deltarle] [numLevels]
+*
+* The input is read together with its companion .ini metadata file. If no output path
+* is given, the input path with BrickedVolumeFormat::fileExtension is used. The brick size
+* defaults to BrickedVolumeFormat::defaultBrickSize, and bricks are compressed with
+* BrickCompression::DeltaRle unless "none" is given.
+*
+* numLevels defaults to 1, which writes the full-resolution volume only. Larger values
+* additionally write coarser levels of detail for paged rendering, each downsampled by
+* two from the previous one and named by GetBrickedVolumeLevelPath(). 0 writes levels
+* until one fits into a single brick.
+*/
+
+#include <volumedata/BrickCompression.h>
+#include <volumedata/BrickedVolumeHeader.h>
+#include <volumedata/DownsampleVolumeData.h>
+#include <volumedata/GetBrickedVolumeLevelPath.h>
+#include <volumedata/LoadVolumeRaw.h>
+#include <volumedata/PagedBrickKey.h>
+#include <volumedata/VolumeData.h>
+#include <volumedata/WriteBrickedVolume.h>
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace
+{
+    std::optional<VolumeData::BrickCompression> ParseCompression(std::string_view argument)
+    {
+        if (argument == "none")
+        {
+            return VolumeData::BrickCompression::None;
+        }
+        if (argument == "deltarle")
+        {
+            return VolumeData::BrickCompression::DeltaRle;
+        }
+        return std::nullopt;
+    }
+
+    std::optional<uint32_t> ParseUnsigned(std::string_view argument)
+    {
+        uint32_t value = 0;
+        const auto [end, errorCode] = std::from_chars(argument.data(), argument.data() + argument.size(), value);
+        if (errorCode != std::errc{} || end != argument.data() + argument.size())
+        {
+            return std::nullopt;
+        }
+        return value;
+    }
+
+    bool FitsIntoSingleBrick(const VolumeData::VolumeData& volumeData, uint32_t brickSize)
+    {
+        const auto& metadata = volumeData.GetMetadata();
+        return metadata.GetWidth() <= brickSize && metadata.GetHeight() <= brickSize && metadata.GetDepth() <= brickSize;
+    }
+} // anonymous namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc < 2 || argc > 6)
+    {
+        std::cerr << "Usage: " << argv[0] << " <input.raw> [output" << VolumeData::BrickedVolumeFormat::fileExtension << "] [brickSize] [none|deltarle] [numLevels]" << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const std::filesystem::path inputPath = argv[1];
+
+    std::filesystem::path outputPath = inputPath;
+    outputPath.replace_extension(VolumeData::BrickedVolumeFormat::fileExtension);
+    if (argc >= 3)
+    {
+        outputPath = argv[2];
+    }
+
+    uint32_t brickSize = VolumeData::BrickedVolumeFormat::defaultBrickSize;
+    if (argc >= 4)
+    {
+        const std::string_view brickSizeArgument = argv[3];
+        const auto [end, errorCode] = std::from_chars(brickSizeArgument.data(), brickSizeArgument.data() + brickSizeArgument.size(), brickSize);
+        if (errorCode != std::errc{} || end != brickSizeArgument.data() + brickSizeArgument.size() || brickSize == 0)
+        {
+            std::cerr << "Invalid brick size " << brickSizeArgument << std::endl;
+            return EXIT_FAILURE;
+        }
+    }
+
+    auto compression = VolumeData::BrickCompression::DeltaRle;
+    if (argc >= 5)
+    {
+        const auto parsedCompression = ParseCompression(argv[4]);
+        if (!parsedCompression)
+        {
+            std::cerr << "Invalid compression " << argv[4] << std::endl;
+            return EXIT_FAILURE;
+        }
+        compression = parsedCompression.value();
+    }
+
+    uint32_t numLevels = 1;
+    if (argc == 6)
+    {
+        const auto parsedNumLevels = ParseUnsigned(argv[5]);
+        if (!parsedNumLevels || parsedNumLevels.value() > VolumeData::PagedBrickKey::maxNumLevels)
+        {
+            std::cerr << "Invalid number of levels " << argv[5] << ", expected at most " << VolumeData::PagedBrickKey::maxNumLevels << std::endl;
+            return EXIT_FAILURE;
+        }
+        numLevels = (parsedNumLevels.value() == 0) ? VolumeData::PagedBrickKey::maxNumLevels : parsedNumLevels.value();
+    }
+
+    // The converter only reads the volume once, front to back
+    const auto volumeLoadingResult = VolumeData::LoadVolumeRaw(inputPath, VolumeData::VolumeStorageMode::Mapped);
+    if (!volumeLoadingResult)
+    {
+        std::cerr << "Failed to load volume from " << inputPath << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    const auto writingResult = VolumeData::WriteBrickedVolume(volumeLoadingResult.value(), outputPath, brickSize, compression);
+    if (!writingResult)
+    {
+        std::cerr << "Failed to write bricked volume to " << outputPath << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    std::cout << "Wrote " << outputPath << " with " << brickSize << "^3 bricks, "
+              << std::filesystem::file_size(outputPath) << " of " << std::filesystem::file_size(inputPath) << " bytes" << std::endl;
+
+    // Each level is downsampled from the previous one, so only one coarse level is held in memory at a time
+    std::optional<VolumeData::VolumeData> levelVolumeData;
+    uint32_t numWrittenLevels = 1;
+    while (numWrittenLevels < numLevels)
+    {
+        const auto& previousVolumeData = levelVolumeData ? levelVolumeData.value() : volumeLoadingResult.value();
+        if (FitsIntoSingleBrick(previousVolumeData, brickSize))
+        {
+            break;
+        }
+
+        levelVolumeData = VolumeData::DownsampleVolumeData(previousVolumeData);
+        const auto levelPath = VolumeData::GetBrickedVolumeLevelPath(outputPath, numWrittenLevels);
+        if (!VolumeData::WriteBrickedVolume(levelVolumeData.value(), levelPath, brickSize, compression))
+        {
+            std::cerr << "Failed to write bricked volume to " << levelPath << std::endl;
+            return EXIT_FAILURE;
+        }
+
+        const auto& levelMetadata = levelVolumeData->GetMetadata();
+        std::cout << "Wrote level " << numWrittenLevels << " to " << levelPath << ", " << levelMetadata.GetWidth() << " x " << levelMetadata.GetHeight() << " x " << levelMetadata.GetDepth() << " voxels" << std::endl;
+        ++numWrittenLevels;
+    }
+
+    // Coarser levels left over from an earlier conversion would be picked up by the paged renderer
+    for (uint32_t level = numWrittenLevels; level < VolumeData::PagedBrickKey::maxNumLevels; ++level)
+    {
+        std::filesystem::remove(VolumeData::GetBrickedVolumeLevelPath(outputPath, level));
+    }
+
+    return EXIT_SUCCESS;
+}